@@ -0,0 +1,294 @@
+/**
+ * @brief OBJ loading throughput benchmark
+ *
+ * Compares, on the same file:
+ * - Raw read: fread of the whole file (upper bound for any loader)
+ * - Baseline: single-threaded std::getline + std::istringstream parser
+ *   with a std::unordered_map triplet index (typical textbook loader)
+ * - ObjLoader on the calling thread only
+ * - ObjLoader on the JobSystem
+ *
+ * Every run must produce the same meshes as the baseline (checked; the
+ * baseline ignores vertex colors and needs faces with valid indices).
+ * Without --file a synthetic OBJ (quads with v/vt/vn, several groups and
+ * materials) of --size-mb megabytes is generated in the working directory.
+ * Run twice or after a read so the file is in the page cache, or the first
+ * pass measures the disk.
+ *
+ * Usage: obj_bench [--file PATH] [--size-mb N] [--quick]
+ */
+
+#include "engine/core/JobSystem.h"
+#include "engine/resource/model/Mesh.h"
+#include "engine/resource/model/ObjLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace rs_engine;
+using resource::Mesh;
+using resource::Vertex;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// ========== Synthetic Input ==========
+
+/**
+ * @brief Write a grid-of-quads OBJ of roughly the requested size
+ */
+bool writeSyntheticObj(const std::string& path, size_t targetBytes) {
+    constexpr int GROUPS = 8;
+    constexpr double BYTES_PER_GRID_POINT = 150.0;  // v + vt + vn + one quad, measured
+    int resolution = std::max(2, static_cast<int>(std::sqrt(targetBytes / BYTES_PER_GRID_POINT / GROUPS)));
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    std::fprintf(file, "# obj_bench synthetic mesh\nmtllib bench.mtl\n");
+    size_t base = 0;
+    for (int g = 0; g < GROUPS; ++g) {
+        std::fprintf(file, "o Patch%d\nusemtl Material%d\n", g, g % 3);
+        for (int y = 0; y < resolution; ++y) {
+            for (int x = 0; x < resolution; ++x) {
+                double u = static_cast<double>(x) / (resolution - 1);
+                double v = static_cast<double>(y) / (resolution - 1);
+                double height = 0.25 * std::sin(u * 12.0 + g) * std::cos(v * 9.0);
+                std::fprintf(file, "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn %.6f %.6f %.6f\n",
+                             u * 10.0 + g * 11.0, height, v * 10.0, u, v, 0.0, 1.0, 0.0);
+            }
+        }
+        for (int y = 0; y + 1 < resolution; ++y) {
+            for (int x = 0; x + 1 < resolution; ++x) {
+                size_t a = base + static_cast<size_t>(y) * resolution + x + 1;
+                size_t b = a + 1, c = a + resolution + 1, d = a + resolution;
+                std::fprintf(file, "f %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu\n",
+                             a, a, a, b, b, b, c, c, c, d, d, d);
+            }
+        }
+        base += static_cast<size_t>(resolution) * resolution;
+    }
+    return std::fclose(file) == 0;
+}
+
+// ========== Baseline Loader ==========
+
+/**
+ * @brief Textbook single-threaded loader (same grouping and vertex order as ObjLoader)
+ */
+bool loadBaseline(const std::string& path, std::vector<std::shared_ptr<Mesh>>& meshes) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    std::vector<Vec3> positions, texCoords, normals;
+    struct Builder {
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+        std::unordered_map<std::string, uint32_t> lookup;
+        std::string name;
+        bool missingNormals = false;
+    };
+    std::vector<Builder> builders;
+    std::unordered_map<std::string, size_t> builderIndex;
+    std::string group, material;
+
+    std::string line, keyword, token;
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        if (!(stream >> keyword)) continue;
+        if (keyword == "v") {
+            Vec3 p; stream >> p.x >> p.y >> p.z; positions.push_back(p);
+        } else if (keyword == "vt") {
+            Vec3 t; stream >> t.x >> t.y; t.y = 1.0f - t.y; texCoords.push_back(t);
+        } else if (keyword == "vn") {
+            Vec3 n; stream >> n.x >> n.y >> n.z; normals.push_back(n);
+        } else if (keyword == "o" || keyword == "g") {
+            stream >> group;
+        } else if (keyword == "usemtl") {
+            stream >> material;
+        } else if (keyword == "f") {
+            std::string key = group + "\n" + material;
+            auto inserted = builderIndex.emplace(key, builders.size());
+            if (inserted.second) {
+                builders.emplace_back();
+                builders.back().name = group + (material.empty() ? "" : "/" + material);
+            }
+            Builder& builder = builders[inserted.first->second];
+
+            std::vector<uint32_t> face;
+            while (stream >> token) {
+                auto found = builder.lookup.find(token);
+                if (found == builder.lookup.end()) {
+                    int v = 0, t = 0, n = 0;
+                    if (std::sscanf(token.c_str(), "%d/%d/%d", &v, &t, &n) < 3 &&
+                        std::sscanf(token.c_str(), "%d//%d", &v, &n) < 2) {
+                        std::sscanf(token.c_str(), "%d/%d", &v, &t);
+                    }
+                    auto resolve = [](int index, size_t count) {
+                        return index > 0 ? index - 1 : static_cast<int>(count) + index;
+                    };
+                    Vertex vertex;
+                    vertex.position = positions[resolve(v, positions.size())];
+                    if (t != 0) vertex.texCoord = texCoords[resolve(t, texCoords.size())];
+                    if (n != 0) vertex.normal = normals[resolve(n, normals.size())];
+                    builder.missingNormals |= n == 0;
+                    found = builder.lookup.emplace(token, static_cast<uint32_t>(builder.vertices.size())).first;
+                    builder.vertices.push_back(vertex);
+                }
+                face.push_back(found->second);
+            }
+            for (size_t i = 2; i < face.size(); ++i) {
+                builder.indices.insert(builder.indices.end(), {face[0], face[i - 1], face[i]});
+            }
+        }
+    }
+
+    for (Builder& builder : builders) {
+        auto mesh = std::make_shared<Mesh>(builder.name);
+        mesh->setVertices(std::move(builder.vertices));
+        mesh->setIndices(std::move(builder.indices));
+        if (builder.missingNormals) {
+            mesh->calculateNormals();
+        }
+        meshes.push_back(mesh);
+    }
+    return !meshes.empty();
+}
+
+bool sameMeshes(const std::vector<std::shared_ptr<Mesh>>& a, const std::vector<std::shared_ptr<Mesh>>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t m = 0; m < a.size(); ++m) {
+        if (a[m]->getIndices() != b[m]->getIndices() || a[m]->getVertexCount() != b[m]->getVertexCount()) {
+            return false;
+        }
+        for (size_t i = 0; i < a[m]->getVertexCount(); ++i) {
+            const Vertex& va = a[m]->getVertices()[i];
+            const Vertex& vb = b[m]->getVertices()[i];
+            if (std::memcmp(&va.position, &vb.position, sizeof(Vec3)) != 0 ||
+                std::memcmp(&va.normal, &vb.normal, sizeof(Vec3)) != 0 ||
+                std::memcmp(&va.texCoord, &vb.texCoord, sizeof(Vec3)) != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string path;
+    size_t sizeMB = 256;
+    bool quick = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--file") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else if (std::strcmp(argv[i], "--size-mb") == 0 && i + 1 < argc) {
+            sizeMB = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--quick") == 0) {
+            quick = true;
+        } else {
+            std::cerr << "Usage: obj_bench [--file PATH] [--size-mb N] [--quick]" << std::endl;
+            return 1;
+        }
+    }
+    if (quick) {
+        sizeMB = std::min<size_t>(sizeMB, 32);
+    }
+
+    if (path.empty()) {
+        path = "obj_bench_" + std::to_string(sizeMB) + "mb.obj";
+        std::ifstream existing(path);
+        if (!existing) {
+            std::cout << "[INFO] Writing synthetic " << sizeMB << " MB OBJ to " << path << std::endl;
+            if (!writeSyntheticObj(path, sizeMB << 20)) {
+                std::cerr << "[ERROR] Cannot write " << path << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    // Raw read (also warms the page cache for the loaders)
+    auto start = Clock::now();
+    std::vector<char> raw;
+    {
+        FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) {
+            std::cerr << "[ERROR] Cannot open " << path << std::endl;
+            return 1;
+        }
+        std::fseek(file, 0, SEEK_END);
+        raw.resize(static_cast<size_t>(std::ftell(file)));
+        std::fseek(file, 0, SEEK_SET);
+        raw.resize(std::fread(raw.data(), 1, raw.size(), file));
+        std::fclose(file);
+    }
+    double rawSeconds = secondsSince(start);
+    double megabytes = raw.size() / (1024.0 * 1024.0);
+    raw = std::vector<char>();
+
+    JobSystem jobs(JobSystem::getDefaultWorkerCount());
+    std::printf("\nOBJ load: %s (%.1f MB), %u threads\n\n", path.c_str(), megabytes,
+                jobs.getThreadCount());
+    std::printf("  %-28s %10s %10s %9s\n", "loader", "seconds", "MB/s", "speedup");
+    std::printf("  %-28s %10.3f %10.0f %9s\n", "raw read (fread)", rawSeconds, megabytes / rawSeconds, "");
+
+    std::vector<std::shared_ptr<Mesh>> baseline;
+    start = Clock::now();
+    if (!loadBaseline(path, baseline)) {
+        std::cerr << "[ERROR] Baseline loader failed" << std::endl;
+        return 1;
+    }
+    double baselineSeconds = secondsSince(start);
+    std::printf("  %-28s %10.3f %10.0f %8.1fx\n", "baseline (iostream)", baselineSeconds,
+                megabytes / baselineSeconds, 1.0);
+
+    bool allMatch = true;
+    for (bool multithreaded : {false, true}) {
+        resource::ObjLoadSettings settings;
+        settings.jobSystem = multithreaded ? &jobs : nullptr;
+        resource::ObjLoadResult result;
+        std::vector<std::shared_ptr<Mesh>> meshes;
+        start = Clock::now();
+        if (!resource::ObjLoader::load(path, meshes, settings, &result)) {
+            std::cerr << "[ERROR] ObjLoader failed" << std::endl;
+            return 1;
+        }
+        double seconds = secondsSince(start);
+        bool match = sameMeshes(meshes, baseline);
+        allMatch &= match;
+
+        std::printf("  %-28s %10.3f %10.0f %8.1fx  (parse %.0f ms, build %.0f ms)%s\n",
+                    multithreaded ? "ObjLoader (JobSystem)" : "ObjLoader (1 thread)", seconds,
+                    megabytes / seconds, baselineSeconds / seconds, result.parseMs, result.buildMs,
+                    match ? "" : "  MISMATCH");
+        if (multithreaded) {
+            std::printf("\n  %zu meshes, %zu triangles, %zu vertices (%zu positions)\n",
+                        result.meshes, result.triangles, result.vertices, result.positions);
+        }
+    }
+
+    if (!allMatch) {
+        std::cerr << "\n[ERROR] ObjLoader output differs from the baseline" << std::endl;
+        return 1;
+    }
+    std::cout << "\n[SUCCESS] All loaders produced identical meshes" << std::endl;
+    return 0;
+}
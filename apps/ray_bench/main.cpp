@@ -0,0 +1,251 @@
+/**
+ * @brief Ray query throughput benchmark
+ *
+ * Measures rays per second for:
+ * - Primitive tests: scalar Ray::intersectAABB / intersectTriangle vs.
+ *   the 4-wide SIMD versions (one ray vs 4 boxes / triangles)
+ * - Mesh queries: brute force vs. MeshBVH single-ray vs. MeshBVH packets
+ *   with coherent (camera grid) and incoherent (random) rays
+ *
+ * Usage: ray_bench [--quick]
+ */
+
+#include "engine/core/math/RayPacket.h"
+#include "engine/resource/model/Mesh.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace rs_engine;
+using resource::Mesh;
+using resource::MeshBVH;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+volatile float g_sink = 0.0f;  // Keeps results observable so loops aren't optimized away
+
+template<typename Fn>
+double measureSeconds(int repeats, Fn&& fn) {
+    double best = 1e30;
+    for (int i = 0; i < repeats; ++i) {
+        auto start = Clock::now();
+        fn();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        best = std::min(best, seconds);
+    }
+    return best;
+}
+
+void printRate(const char* label, double operations, double seconds) {
+    std::printf("  %-46s %12.3f M/s\n", label, operations / seconds / 1e6);
+}
+
+/**
+ * @brief Camera rays over a square grid, emitted in 2x2 pixel quads for packet coherence
+ */
+std::vector<Ray> makeCoherentRays(int resolution, const Vec3& eye, float fovScale) {
+    std::vector<Ray> rays;
+    rays.reserve(static_cast<size_t>(resolution) * resolution);
+    Vec3 forward = (Vec3(0, 0, 0) - eye).normalize();
+    Vec3 right = forward.cross(Vec3(0, 1, 0)).normalize();
+    Vec3 up = right.cross(forward);
+
+    auto pixelRay = [&](int x, int y) {
+        float sx = ((x + 0.5f) / resolution * 2.0f - 1.0f) * fovScale;
+        float sy = ((y + 0.5f) / resolution * 2.0f - 1.0f) * fovScale;
+        return Ray(eye, (forward + right * sx + up * sy).normalize());
+    };
+
+    for (int y = 0; y < resolution; y += 2) {
+        for (int x = 0; x < resolution; x += 2) {
+            rays.push_back(pixelRay(x, y));
+            rays.push_back(pixelRay(x + 1, y));
+            rays.push_back(pixelRay(x, y + 1));
+            rays.push_back(pixelRay(x + 1, y + 1));
+        }
+    }
+    return rays;
+}
+
+std::vector<Ray> makeIncoherentRays(size_t count, std::mt19937& rng) {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<Ray> rays;
+    rays.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Vec3 origin(dist(rng) * 4.0f, dist(rng) * 4.0f, dist(rng) * 4.0f);
+        Vec3 target(dist(rng) * 0.8f, dist(rng) * 0.8f, dist(rng) * 0.8f);
+        rays.push_back(Ray(origin, (target - origin).normalize()));
+    }
+    return rays;
+}
+
+// ========== Primitive Benchmarks ==========
+
+void benchmarkPrimitives(size_t rayCount, int repeats, std::mt19937& rng) {
+    std::cout << "\n[Primitives] one ray vs 4 primitives (" << rayCount << " rays)" << std::endl;
+
+    std::vector<Ray> rays = makeIncoherentRays(rayCount, rng);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    AABB boxes[4];
+    Vec3 triangles[12];
+    for (int i = 0; i < 4; ++i) {
+        Vec3 c(dist(rng) * 0.5f, dist(rng) * 0.5f, dist(rng) * 0.5f);
+        boxes[i] = AABB(c - Vec3(0.3f, 0.3f, 0.3f), c + Vec3(0.3f, 0.3f, 0.3f));
+        triangles[i * 3 + 0] = c + Vec3(-0.5f, -0.5f, 0.0f);
+        triangles[i * 3 + 1] = c + Vec3(0.5f, -0.5f, 0.1f);
+        triangles[i * 3 + 2] = c + Vec3(0.0f, 0.5f, -0.1f);
+    }
+    AABB4 boxes4 = AABB4::fromBoxes(boxes, 4);
+    Triangle4 triangles4 = Triangle4::fromTriangles(triangles, 4);
+
+    double tests = static_cast<double>(rayCount) * 4.0;
+
+    double seconds = measureSeconds(repeats, [&]() {
+        int hits = 0;
+        for (const Ray& ray : rays) {
+            for (int i = 0; i < 4; ++i) {
+                float tMin, tMax;
+                hits += ray.intersectAABB(boxes[i], tMin, tMax) ? 1 : 0;
+            }
+        }
+        g_sink = static_cast<float>(hits);
+    });
+    printRate("ray-AABB scalar (Ray::intersectAABB)", tests, seconds);
+
+    seconds = measureSeconds(repeats, [&]() {
+        int hits = 0;
+        for (const Ray& ray : rays) {
+            RaySIMD raySIMD(ray);
+            simd::Float4 tEntry;
+            hits += intersectAABB4(raySIMD, boxes4, 1e30f, tEntry);
+        }
+        g_sink = static_cast<float>(hits);
+    });
+    printRate("ray-AABB SIMD x4 (intersectAABB4)", tests, seconds);
+
+    seconds = measureSeconds(repeats, [&]() {
+        int hits = 0;
+        for (const Ray& ray : rays) {
+            for (int i = 0; i < 4; ++i) {
+                float t;
+                hits += ray.intersectTriangle(triangles[i * 3], triangles[i * 3 + 1],
+                                              triangles[i * 3 + 2], t) ? 1 : 0;
+            }
+        }
+        g_sink = static_cast<float>(hits);
+    });
+    printRate("ray-triangle scalar (Ray::intersectTriangle)", tests, seconds);
+
+    seconds = measureSeconds(repeats, [&]() {
+        int hits = 0;
+        for (const Ray& ray : rays) {
+            RaySIMD raySIMD(ray);
+            simd::Float4 t, u, v;
+            hits += intersectTriangle4(raySIMD, triangles4, 1e30f, t, u, v);
+        }
+        g_sink = static_cast<float>(hits);
+    });
+    printRate("ray-triangle SIMD x4 (intersectTriangle4)", tests, seconds);
+}
+
+// ========== Mesh Benchmarks ==========
+
+void benchmarkRaySet(const char* name, const Mesh& mesh, const MeshBVH& bvh,
+                     const std::vector<Ray>& rays, int repeats, bool includeBruteForce) {
+    std::cout << "  -- " << name << " (" << rays.size() << " rays)" << std::endl;
+    const double rayCount = static_cast<double>(rays.size());
+    std::vector<MeshBVH::Hit> hits(rays.size());
+
+    if (includeBruteForce) {
+        const auto& vertices = mesh.getVertices();
+        const auto& indices = mesh.getIndices();
+        size_t sampleCount = std::min<size_t>(rays.size(), 256);
+        double seconds = measureSeconds(1, [&]() {
+            float sum = 0.0f;
+            for (size_t r = 0; r < sampleCount; ++r) {
+                float closest = 1e30f;
+                for (size_t i = 0; i < indices.size(); i += 3) {
+                    float t;
+                    if (rays[r].intersectTriangle(vertices[indices[i]].position,
+                                                  vertices[indices[i + 1]].position,
+                                                  vertices[indices[i + 2]].position, t) &&
+                        t < closest) {
+                        closest = t;
+                    }
+                }
+                sum += closest;
+            }
+            g_sink = sum;
+        });
+        printRate("brute force", static_cast<double>(sampleCount), seconds);
+    }
+
+    size_t singleHits = 0;
+    double seconds = measureSeconds(repeats, [&]() {
+        singleHits = 0;
+        for (size_t i = 0; i < rays.size(); ++i) {
+            singleHits += bvh.intersect(rays[i], 1e30f, hits[i]) ? 1 : 0;
+        }
+    });
+    printRate("BVH single ray", rayCount, seconds);
+
+    size_t packetHits = 0;
+    seconds = measureSeconds(repeats, [&]() {
+        packetHits = bvh.intersectBatch(rays.data(), rays.size(), 1e30f, hits.data());
+    });
+    printRate("BVH 4-ray packets", rayCount, seconds);
+
+    if (singleHits != packetHits) {
+        std::cerr << "[ERROR] Hit count mismatch: single " << singleHits
+                  << " vs packet " << packetHits << std::endl;
+    }
+}
+
+void benchmarkMesh(int segments, int gridResolution, int repeats, std::mt19937& rng) {
+    std::unique_ptr<Mesh> mesh(Mesh::createSphere("BenchSphere", 1.0f, segments));
+
+    auto start = Clock::now();
+    const MeshBVH* bvh = mesh->getBVH();
+    double buildMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (!bvh) {
+        std::cerr << "[ERROR] Failed to build BVH" << std::endl;
+        return;
+    }
+
+    std::cout << "\n[Mesh] sphere, " << bvh->getTriangleCount() << " triangles, BVH build "
+              << buildMs << " ms, " << bvh->getMemorySize() / 1024 << " KB" << std::endl;
+
+    bool bruteForce = bvh->getTriangleCount() <= 200000;
+    std::vector<Ray> coherent = makeCoherentRays(gridResolution, Vec3(0.0f, 0.5f, 3.0f), 0.45f);
+    std::vector<Ray> incoherent = makeIncoherentRays(coherent.size(), rng);
+    benchmarkRaySet("coherent camera rays", *mesh, *bvh, coherent, repeats, bruteForce);
+    benchmarkRaySet("incoherent random rays", *mesh, *bvh, incoherent, repeats, bruteForce);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+    int repeats = quick ? 1 : 5;
+    int gridResolution = quick ? 128 : 512;
+
+    std::cout << "[INFO] Ray query benchmark, SIMD backend: " << simd::backendName() << std::endl;
+
+    std::mt19937 rng(12345);
+    benchmarkPrimitives(quick ? 100000 : 1000000, repeats, rng);
+
+    for (int segments : {32, 128, 512}) {
+        benchmarkMesh(segments, gridResolution, repeats, rng);
+    }
+
+    std::cout << "\n[SUCCESS] Benchmark complete." << std::endl;
+    return 0;
+}
@@ -0,0 +1,935 @@
+/**
+ * @brief Scene scaling benchmark
+ *
+ * Spawns N objects spread across M procedural meshes with random
+ * transforms and animation, plus P particles (small objects moved on the
+ * CPU every frame, so their records are re-uploaded each frame). Each
+ * configuration is warmed up, then F frames are measured. Frame-time
+ * percentiles, draw calls, triangles and memory are printed and written
+ * to JSON.
+ *
+ * Modes:
+ * - Windowed (default): the full Engine (window, ImGui, systems). Frame
+ *   time is one Engine::update(), so it includes vsync (Fifo present).
+ * - Headless (--headless): no window or surface. A device is created
+ *   directly and the Scene renders into an offscreen target. Frame time
+ *   is Scene::update() plus encoding and submission; update and render
+ *   are also reported separately. GPU execution is not waited on.
+ *
+ * --queries also times Scene::queryRay / queryFrustum / queryAABB (AABB
+ * tree) against a linear scan over every object's bounds, right after each
+ * spawn. Both must find the same objects. Without --objects or --sweep it
+ * sweeps 1k, 10k and 100k objects.
+ *
+ * --snapshot saves the scene after each run's frames and loads the file
+ * back over the still populated scene. The reloaded objects must draw the
+ * same triangles from meshes that still hold GPU data.
+ *
+ * Usage: stress [--objects N] [--meshes M] [--particles P] [--frames F]
+ *               [--warmup W] [--sweep N1,N2,...] [--headless] [--queries]
+ *               [--snapshot] [--json PATH] [--seed S]
+ *
+ * Shaders are loaded from ./shaders (copied next to the binary by the build).
+ */
+
+#include "engine/core/Engine.h"
+#include "engine/core/JobSystem.h"
+#include "engine/core/math/Frustum.h"
+#include "engine/core/math/SIMD.h"
+#include "engine/rendering/scene/Scene.h"
+#include "engine/resource/ResourceManager.h"
+#include "engine/systems/rendering/RenderSystem.h"
+#include "engine/systems/resource/ResourceSystem.h"
+
+#include <dawn/dawn_proc.h>
+#include <dawn/native/DawnNative.h>
+#include <dawn/webgpu_cpp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__APPLE__)
+    #include <mach/mach.h>
+#elif defined(_WIN32)
+    #include <windows.h>
+    #include <psapi.h>
+#endif
+
+using namespace rs_engine;
+using rendering::Scene;
+using rendering::SceneObject;
+using rendering::Camera;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float FIXED_DELTA_TIME = 1.0f / 60.0f;  // Same animation every run
+constexpr float OBJECT_SPACING = 3.0f;            // Average distance between objects
+constexpr uint32_t HEADLESS_WIDTH = 1280;
+constexpr uint32_t HEADLESS_HEIGHT = 720;
+
+// Spatial query benchmark (--queries)
+constexpr size_t QUERY_RAYS = 1000;
+constexpr size_t QUERY_BOXES = 1000;
+constexpr size_t QUERY_FRUSTUMS = 256;            // Marquee-sized: a tenth of the screen per axis
+constexpr int QUERY_REPEATS = 3;                  // Best of
+
+// Snapshot reload check (--snapshot)
+constexpr const char* SNAPSHOT_PATH = "stress_snapshot.rsscene";
+
+struct Options {
+    std::vector<size_t> objectCounts = {10000};
+    uint32_t meshCount = 8;
+    size_t particleCount = 0;
+    uint32_t frames = 300;
+    uint32_t warmupFrames = 30;
+    bool headless = false;
+    bool queries = false;
+    bool snapshot = false;
+    bool countsGiven = false;     // --objects or --sweep on the command line
+    std::string jsonPath = "stress_results.json";
+    uint32_t seed = 12345;
+};
+
+struct TimingSummary {
+    double mean = 0.0, p50 = 0.0, p90 = 0.0, p99 = 0.0, max = 0.0;
+};
+
+struct QueryTiming {
+    double treeUs = 0.0;          // Per query, through the Scene's AABB tree
+    double linearUs = 0.0;        // Per query, testing every object
+    size_t hits = 0;              // Objects found over all queries (same for both)
+    bool mismatch = false;        // Tree and scan found different objects
+};
+
+struct RunResult {
+    size_t objects = 0;
+    size_t particles = 0;
+    uint32_t frames = 0;
+    double spawnMs = 0.0;
+    TimingSummary frameMs;
+    TimingSummary updateMs;     // Headless only
+    TimingSummary renderMs;     // Headless only
+    size_t drawCalls = 0;
+    size_t triangles = 0;
+    size_t rssBytes = 0;
+    size_t peakRssBytes = 0;
+    uint64_t meshGPUBytes = 0;
+    uint64_t objectBufferBytes = 0;
+    bool queriesMeasured = false;
+    QueryTiming rayQuery;
+    QueryTiming frustumQuery;
+    QueryTiming boxQuery;
+    bool snapshotMeasured = false;
+    bool snapshotOk = false;      // Same objects and drawable triangles after the reload
+    double snapshotSaveMs = 0.0;
+    double snapshotLoadMs = 0.0;
+};
+
+// ========== Options ==========
+
+void printUsage() {
+    std::cout << "Usage: stress [--objects N] [--meshes M] [--particles P] [--frames F]\n"
+                 "              [--warmup W] [--sweep N1,N2,...] [--headless] [--queries] [--snapshot]\n"
+                 "              [--json PATH] [--seed S]" << std::endl;
+}
+
+bool parseCountList(const char* text, std::vector<size_t>& counts) {
+    counts.clear();
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        char* end = nullptr;
+        unsigned long long value = std::strtoull(item.c_str(), &end, 10);
+        if (item.empty() || *end != '\0') {
+            return false;
+        }
+        counts.push_back(static_cast<size_t>(value));
+    }
+    return !counts.empty();
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        auto number = [&](auto& out) {
+            if (!value) return false;
+            out = static_cast<std::remove_reference_t<decltype(out)>>(std::strtoull(value, nullptr, 10));
+            ++i;
+            return true;
+        };
+
+        bool ok = true;
+        if (std::strcmp(arg, "--objects") == 0) {
+            options.objectCounts.resize(1);
+            ok = number(options.objectCounts[0]);
+            options.countsGiven = true;
+        } else if (std::strcmp(arg, "--sweep") == 0) {
+            ok = value && parseCountList(value, options.objectCounts);
+            options.countsGiven = true;
+            ++i;
+        } else if (std::strcmp(arg, "--meshes") == 0) {
+            ok = number(options.meshCount) && options.meshCount > 0;
+        } else if (std::strcmp(arg, "--particles") == 0) {
+            ok = number(options.particleCount);
+        } else if (std::strcmp(arg, "--frames") == 0) {
+            ok = number(options.frames) && options.frames > 0;
+        } else if (std::strcmp(arg, "--warmup") == 0) {
+            ok = number(options.warmupFrames);
+        } else if (std::strcmp(arg, "--seed") == 0) {
+            ok = number(options.seed);
+        } else if (std::strcmp(arg, "--json") == 0) {
+            ok = value != nullptr;
+            if (ok) options.jsonPath = value;
+            ++i;
+        } else if (std::strcmp(arg, "--headless") == 0) {
+            options.headless = true;
+        } else if (std::strcmp(arg, "--queries") == 0) {
+            options.queries = true;
+        } else if (std::strcmp(arg, "--snapshot") == 0) {
+            options.snapshot = true;
+        } else {
+            ok = false;
+        }
+
+        if (!ok) {
+            std::cerr << "[ERROR] Invalid argument: " << arg << std::endl;
+            printUsage();
+            return false;
+        }
+    }
+    if (options.queries && !options.countsGiven) {
+        options.objectCounts = {1000, 10000, 100000};
+    }
+    return true;
+}
+
+// ========== Measurement ==========
+
+TimingSummary summarize(std::vector<double> samples) {
+    TimingSummary summary;
+    if (samples.empty()) {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+
+    // Nearest-rank percentiles
+    auto percentile = [&](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p * samples.size()));
+        return samples[std::min(samples.size() - 1, rank > 0 ? rank - 1 : 0)];
+    };
+    double sum = 0.0;
+    for (double sample : samples) sum += sample;
+
+    summary.mean = sum / samples.size();
+    summary.p50 = percentile(0.50);
+    summary.p90 = percentile(0.90);
+    summary.p99 = percentile(0.99);
+    summary.max = samples.back();
+    return summary;
+}
+
+double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Resident set size (current and peak) in bytes; 0 where unsupported
+ */
+void queryProcessMemory(size_t& rss, size_t& peakRss) {
+    rss = peakRss = 0;
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0) {
+            rss = std::strtoull(line.c_str() + 6, nullptr, 10) * 1024;
+        } else if (line.compare(0, 6, "VmHWM:") == 0) {
+            peakRss = std::strtoull(line.c_str() + 6, nullptr, 10) * 1024;
+        }
+    }
+#elif defined(__APPLE__)
+    mach_task_basic_info info{};
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        rss = info.resident_size;
+        peakRss = info.resident_size_max;
+    }
+#elif defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        rss = counters.WorkingSetSize;
+        peakRss = counters.PeakWorkingSetSize;
+    }
+#endif
+}
+
+// ========== Scene Content ==========
+
+/**
+ * @brief Procedural mesh set: cubes, spheres of increasing detail and planes
+ */
+std::vector<resource::ResourceHandle> createMeshes(resource::ResourceManager& resources, uint32_t count) {
+    std::vector<resource::ResourceHandle> meshes;
+    for (uint32_t i = 0; i < count; ++i) {
+        std::string name = "StressMesh" + std::to_string(i);
+        resource::ResourceHandle handle;
+        switch (i % 3) {
+            case 0:  handle = resources.createCubeMesh(name, 1.0f); break;
+            case 1:  handle = resources.createSphereMesh(name, 0.6f, 8 + 8 * static_cast<int>((i / 3) % 4)); break;
+            default: handle = resources.createPlaneMesh(name, 1.5f, 1.5f); break;
+        }
+        if (handle != resource::INVALID_RESOURCE_HANDLE) {
+            meshes.push_back(handle);
+        }
+    }
+    return meshes;
+}
+
+/**
+ * @brief Objects and CPU-driven particles of one configuration
+ */
+class StressContent {
+public:
+    StressContent(Scene& targetScene, uint32_t seed) : scene(targetScene), rng(seed) {}
+
+    /**
+     * @brief Replace the scene's objects with a new configuration
+     * @return Spawn time in milliseconds
+     */
+    double spawn(const std::vector<resource::ResourceHandle>& meshes, resource::ResourceHandle particleMesh,
+                 size_t objectCount, size_t particleCount) {
+        auto start = Clock::now();
+        scene.clearAllObjects();
+        particles.clear();
+        velocities.clear();
+
+        // Constant density: the volume grows with the object count
+        extent = std::max(10.0f, std::cbrt(static_cast<float>(objectCount)) * OBJECT_SPACING);
+        std::uniform_real_distribution<float> position(-0.5f * extent, 0.5f * extent);
+        std::uniform_real_distribution<float> scale(0.5f, 1.5f);
+        std::uniform_real_distribution<float> phase(0.0f, 6.2831853f);
+
+        std::vector<SceneObject*> objects;
+        objects.reserve(objectCount);
+        for (size_t m = 0; m < meshes.size(); ++m) {
+            rendering::ObjectTemplate objectTemplate;
+            objectTemplate.meshHandle = meshes[m];
+            size_t count = objectCount / meshes.size() + (m < objectCount % meshes.size() ? 1 : 0);
+            scene.createObjects(count, objectTemplate, &objects);
+        }
+        for (SceneObject* object : objects) {
+            float s = scale(rng);
+            resource::Transform transform(Vec3(position(rng), position(rng), position(rng)),
+                                          Vec3(0, 0, 0), Vec3(s, s, s));
+            object->setTransform(transform);
+            object->setAnimationTime(phase(rng));
+        }
+
+        if (particleCount > 0) {
+            rendering::ObjectTemplate particleTemplate;
+            particleTemplate.meshHandle = particleMesh;
+            particleTemplate.transform.scale = Vec3(0.1f, 0.1f, 0.1f);
+            scene.createObjects(particleCount, particleTemplate, &particles);
+            velocities.resize(particles.size());
+            for (size_t i = 0; i < particles.size(); ++i) {
+                respawnParticle(i);
+                // Spread the first wave over the whole flight time
+                stepParticle(i, phase(rng) * 0.3f);
+            }
+        }
+
+        // Look at the whole volume
+        Camera* camera = scene.getCamera();
+        camera->setPerspective(60.0f * 3.14159265f / 180.0f, camera->getAspectRatio(), 0.1f, extent * 4.0f);
+        camera->lookAt(Vec3(0.0f, extent * 0.6f, extent * 1.4f), Vec3(0, 0, 0), Vec3(0, 1, 0));
+
+        scene.update(0.0f);
+        return millisecondsSince(start);
+    }
+
+    float getExtent() const { return extent; }
+
+    /**
+     * @brief Ballistic fountain: every particle moves (and is re-uploaded) each frame
+     */
+    void updateParticles(float deltaTime) {
+        for (size_t i = 0; i < particles.size(); ++i) {
+            stepParticle(i, deltaTime);
+        }
+    }
+
+private:
+    Scene& scene;
+    std::mt19937 rng;
+    float extent = 10.0f;
+    std::vector<SceneObject*> particles;
+    std::vector<Vec3> velocities;
+
+    void respawnParticle(size_t i) {
+        std::uniform_real_distribution<float> spread(-1.0f, 1.0f);
+        float speed = std::sqrt(extent) * 3.0f;
+        velocities[i] = Vec3(spread(rng) * 0.25f * speed, speed, spread(rng) * 0.25f * speed);
+        particles[i]->setPosition(Vec3(0.0f, -0.5f * extent, 0.0f));
+    }
+
+    void stepParticle(size_t i, float deltaTime) {
+        velocities[i].y -= 9.81f * deltaTime;
+        Vec3 position = particles[i]->getPosition() + velocities[i] * deltaTime;
+        if (position.y < -0.5f * extent) {
+            respawnParticle(i);
+        } else {
+            particles[i]->setPosition(position);
+        }
+    }
+};
+
+void recordSceneStats(const Scene& scene, const resource::ResourceManager& resources, RunResult& result) {
+    result.drawCalls = scene.getLODStats().drawCalls;
+    result.triangles = scene.getLODStats().trianglesDrawn;
+    result.meshGPUBytes = resources.getGPUMemoryUsed();
+    result.objectBufferBytes = scene.getObjectBufferSize();
+    queryProcessMemory(result.rssBytes, result.peakRssBytes);
+}
+
+// ========== Spatial Queries ==========
+
+/**
+ * @brief Best-of-QUERY_REPEATS time of one pass over all queries, in microseconds per query
+ */
+template<typename Fn>
+double timeQueries(size_t queryCount, Fn&& runAll) {
+    double best = 1e30;
+    for (int repeat = 0; repeat < QUERY_REPEATS; ++repeat) {
+        auto start = Clock::now();
+        runAll();
+        best = std::min(best, millisecondsSince(start));
+    }
+    return best * 1000.0 / queryCount;
+}
+
+/**
+ * @brief Scene queries (AABB tree) vs. a linear scan over the same bounds
+ *
+ * Random rays and boxes inside the spawn volume, and marquee frustums
+ * inside the camera view. Bounds are current after spawn, so neither side
+ * pays for re-indexing.
+ */
+void measureQueries(Scene& scene, float extent, uint32_t seed, RunResult& result) {
+    std::mt19937 rng(seed ^ 0x9E3779B9u);
+    std::uniform_real_distribution<float> position(-0.5f * extent, 0.5f * extent);
+    std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> boxSize(OBJECT_SPACING, 4.0f * OBJECT_SPACING);
+    std::uniform_real_distribution<float> ndc(-1.0f, 0.8f);
+
+    std::vector<Ray> rays;
+    while (rays.size() < QUERY_RAYS) {
+        Vec3 dir(direction(rng), direction(rng), direction(rng));
+        if (dir.length() > 0.01f) {
+            rays.emplace_back(Vec3(position(rng), position(rng), position(rng)), dir.normalize());
+        }
+    }
+    std::vector<AABB> boxes(QUERY_BOXES);
+    for (AABB& box : boxes) {
+        Vec3 center(position(rng), position(rng), position(rng));
+        Vec3 half = Vec3(boxSize(rng), boxSize(rng), boxSize(rng)) * 0.5f;
+        box = AABB(center - half, center + half);
+    }
+    const Mat4& viewProj = scene.getCamera()->getViewProjectionMatrix();
+    std::vector<Frustum> frustums(QUERY_FRUSTUMS);
+    for (Frustum& frustum : frustums) {
+        float x = ndc(rng), y = ndc(rng);
+        frustum = Frustum::fromViewProjectionRect(viewProj, x, y, x + 0.2f, y + 0.2f);
+    }
+    const float maxDistance = extent;
+    const std::vector<SceneObject*>& objects = scene.getAllObjects();
+    scene.updateSpatialIndex();
+
+    // Rays: candidates sorted by entry distance, as Scene::queryRay returns them
+    std::vector<Scene::RayCandidate> candidates;
+    size_t treeHits = 0, linearHits = 0;
+    result.rayQuery.treeUs = timeQueries(rays.size(), [&]() {
+        treeHits = 0;
+        for (const Ray& ray : rays) {
+            scene.queryRay(ray, maxDistance, candidates);
+            treeHits += candidates.size();
+        }
+    });
+    result.rayQuery.linearUs = timeQueries(rays.size(), [&]() {
+        linearHits = 0;
+        for (const Ray& ray : rays) {
+            candidates.clear();
+            for (SceneObject* object : objects) {
+                float tMin, tMax;
+                if (ray.intersectAABB(object->getCachedWorldBounds(), tMin, tMax) &&
+                    tMax >= 0.0f && tMin <= maxDistance) {
+                    candidates.push_back({object, tMin});
+                }
+            }
+            std::sort(candidates.begin(), candidates.end(),
+                      [](const Scene::RayCandidate& a, const Scene::RayCandidate& b) {
+                          return a.distance < b.distance;
+                      });
+            linearHits += candidates.size();
+        }
+    });
+    result.rayQuery.hits = treeHits;
+    result.rayQuery.mismatch = treeHits != linearHits;
+
+    std::vector<SceneObject*> found;
+    result.frustumQuery.treeUs = timeQueries(frustums.size(), [&]() {
+        treeHits = 0;
+        for (const Frustum& frustum : frustums) {
+            scene.queryFrustum(frustum, found);
+            treeHits += found.size();
+        }
+    });
+    result.frustumQuery.linearUs = timeQueries(frustums.size(), [&]() {
+        linearHits = 0;
+        for (const Frustum& frustum : frustums) {
+            found.clear();
+            for (SceneObject* object : objects) {
+                if (frustum.intersectsAABB(object->getCachedWorldBounds())) {
+                    found.push_back(object);
+                }
+            }
+            linearHits += found.size();
+        }
+    });
+    result.frustumQuery.hits = treeHits;
+    result.frustumQuery.mismatch = treeHits != linearHits;
+
+    result.boxQuery.treeUs = timeQueries(boxes.size(), [&]() {
+        treeHits = 0;
+        for (const AABB& box : boxes) {
+            scene.queryAABB(box, found);
+            treeHits += found.size();
+        }
+    });
+    result.boxQuery.linearUs = timeQueries(boxes.size(), [&]() {
+        linearHits = 0;
+        for (const AABB& box : boxes) {
+            found.clear();
+            for (SceneObject* object : objects) {
+                if (object->getCachedWorldBounds().overlaps(box)) {
+                    found.push_back(object);
+                }
+            }
+            linearHits += found.size();
+        }
+    });
+    result.boxQuery.hits = treeHits;
+    result.boxQuery.mismatch = treeHits != linearHits;
+
+    result.queriesMeasured = true;
+    if (result.rayQuery.mismatch || result.frustumQuery.mismatch || result.boxQuery.mismatch) {
+        std::cerr << "[ERROR] Spatial index and linear scan disagree at " << objects.size()
+                  << " objects" << std::endl;
+    }
+}
+
+// ========== Snapshot Reload ==========
+
+/**
+ * @brief Triangles of every object's model whose meshes still have GPU data
+ */
+size_t countDrawableTriangles(const Scene& scene) {
+    size_t triangles = 0;
+    for (const SceneObject* object : scene.getAllObjects()) {
+        std::shared_ptr<resource::Model> model = object->getModel();
+        if (!model) continue;
+        for (const auto& mesh : model->getMeshes()) {
+            if (mesh->hasGPUResources()) {
+                triangles += mesh->getIndexCount() / 3;
+            }
+        }
+    }
+    return triangles;
+}
+
+/**
+ * @brief Save the scene and load it back over itself
+ *
+ * The load clears the objects that reference the meshes it then resolves
+ * by name, so it catches clears that unload shared resources.
+ */
+void measureSnapshot(Scene& scene, RunResult& result) {
+    const size_t objectsBefore = scene.getObjectCount();
+    const size_t trianglesBefore = countDrawableTriangles(scene);
+
+    auto start = Clock::now();
+    bool ok = scene.saveSnapshot(SNAPSHOT_PATH);
+    result.snapshotSaveMs = millisecondsSince(start);
+
+    start = Clock::now();
+    ok = ok && scene.loadSnapshot(SNAPSHOT_PATH);
+    result.snapshotLoadMs = millisecondsSince(start);
+    std::remove(SNAPSHOT_PATH);
+
+    const size_t trianglesAfter = countDrawableTriangles(scene);
+    result.snapshotMeasured = true;
+    result.snapshotOk = ok && scene.getObjectCount() == objectsBefore && trianglesAfter == trianglesBefore;
+    if (!result.snapshotOk) {
+        std::cerr << "[ERROR] Snapshot reload changed the scene: " << objectsBefore << " -> "
+                  << scene.getObjectCount() << " objects, " << trianglesBefore << " -> " << trianglesAfter
+                  << " drawable triangles" << std::endl;
+    }
+}
+
+// ========== Headless Mode ==========
+
+/**
+ * @brief Surfaceless device and offscreen color/depth target
+ */
+struct HeadlessTarget {
+    std::unique_ptr<dawn::native::Instance> dawnInstance;
+    wgpu::Device device;
+    wgpu::TextureView colorView;
+    wgpu::TextureView depthView;
+
+    bool create(uint32_t width, uint32_t height) {
+        DawnProcTable procs = dawn::native::GetProcs();
+        dawnProcSetProcs(&procs);
+
+        dawnInstance = std::make_unique<dawn::native::Instance>();
+        std::vector<dawn::native::Adapter> adapters = dawnInstance->EnumerateAdapters();
+        if (adapters.empty()) {
+            std::cerr << "[ERROR] No WebGPU adapters found" << std::endl;
+            return false;
+        }
+
+        wgpu::Adapter adapter(adapters[0].Get());
+        wgpu::DeviceDescriptor deviceDesc = {};
+        deviceDesc.label = "Stress Device";
+        device = adapter.CreateDevice(&deviceDesc);
+        if (!device) {
+            std::cerr << "[ERROR] Failed to create device" << std::endl;
+            return false;
+        }
+
+        // Same formats as RenderSystem's scene target
+        wgpu::TextureDescriptor textureDesc = {};
+        textureDesc.dimension = wgpu::TextureDimension::e2D;
+        textureDesc.size = {width, height, 1};
+        textureDesc.mipLevelCount = 1;
+        textureDesc.sampleCount = 1;
+        textureDesc.usage = wgpu::TextureUsage::RenderAttachment;
+
+        textureDesc.format = wgpu::TextureFormat::BGRA8Unorm;
+        wgpu::Texture color = device.CreateTexture(&textureDesc);
+        textureDesc.format = wgpu::TextureFormat::Depth24Plus;
+        wgpu::Texture depth = device.CreateTexture(&textureDesc);
+        if (!color || !depth) {
+            std::cerr << "[ERROR] Failed to create offscreen render target" << std::endl;
+            return false;
+        }
+        colorView = color.CreateView();
+        depthView = depth.CreateView();
+        return true;
+    }
+
+    /**
+     * @brief Encode one scene pass and submit it
+     */
+    void renderFrame(Scene& scene) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+
+        wgpu::RenderPassColorAttachment colorAttachment = {};
+        colorAttachment.view = colorView;
+        colorAttachment.loadOp = wgpu::LoadOp::Clear;
+        colorAttachment.storeOp = wgpu::StoreOp::Store;
+        colorAttachment.clearValue = {0.2, 0.3, 0.3, 1.0};
+
+        wgpu::RenderPassDepthStencilAttachment depthAttachment = {};
+        depthAttachment.view = depthView;
+        depthAttachment.depthLoadOp = wgpu::LoadOp::Clear;
+        depthAttachment.depthStoreOp = wgpu::StoreOp::Store;
+        depthAttachment.depthClearValue = 1.0f;
+
+        wgpu::RenderPassDescriptor passDesc = {};
+        passDesc.colorAttachmentCount = 1;
+        passDesc.colorAttachments = &colorAttachment;
+        passDesc.depthStencilAttachment = &depthAttachment;
+
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&passDesc);
+        scene.render(pass);
+        pass.End();
+
+        wgpu::CommandBuffer commands = encoder.Finish();
+        device.GetQueue().Submit(1, &commands);
+        device.Tick();  // Let Dawn retire finished work
+    }
+};
+
+bool runHeadless(const Options& options, std::vector<RunResult>& results) {
+    HeadlessTarget target;
+    if (!target.create(HEADLESS_WIDTH, HEADLESS_HEIGHT)) {
+        return false;
+    }
+
+    // Same pool the Engine creates; declared first so it outlives the scene and resources
+    JobSystem jobs(JobSystem::getDefaultWorkerCount());
+    resource::ResourceManager resources;
+    resources.initialize(target.device, &jobs);
+    std::vector<resource::ResourceHandle> meshes = createMeshes(resources, options.meshCount);
+    resource::ResourceHandle particleMesh = resources.createSphereMesh("StressParticle", 0.5f, 6);
+
+    Scene scene(&target.device, &resources, &jobs);
+    if (!scene.initialize()) {
+        std::cerr << "[ERROR] Scene initialization failed (is ./shaders present?)" << std::endl;
+        return false;
+    }
+    scene.getCamera()->setAspectRatio(static_cast<float>(HEADLESS_WIDTH) / HEADLESS_HEIGHT);
+    StressContent content(scene, options.seed);
+
+    for (size_t objectCount : options.objectCounts) {
+        RunResult result;
+        result.objects = objectCount;
+        result.particles = options.particleCount;
+        result.frames = options.frames;
+        result.spawnMs = content.spawn(meshes, particleMesh, objectCount, options.particleCount);
+        if (options.queries) {
+            measureQueries(scene, content.getExtent(), options.seed, result);
+        }
+
+        std::vector<double> frameMs, updateMs, renderMs;
+        frameMs.reserve(options.frames);
+        updateMs.reserve(options.frames);
+        renderMs.reserve(options.frames);
+        for (uint32_t frame = 0; frame < options.warmupFrames + options.frames; ++frame) {
+            auto frameStart = Clock::now();
+            content.updateParticles(FIXED_DELTA_TIME);
+            scene.update(FIXED_DELTA_TIME);
+            double updateTime = millisecondsSince(frameStart);
+
+            auto renderStart = Clock::now();
+            target.renderFrame(scene);
+            double renderTime = millisecondsSince(renderStart);
+
+            if (frame >= options.warmupFrames) {
+                frameMs.push_back(millisecondsSince(frameStart));
+                updateMs.push_back(updateTime);
+                renderMs.push_back(renderTime);
+            }
+        }
+
+        result.frameMs = summarize(std::move(frameMs));
+        result.updateMs = summarize(std::move(updateMs));
+        result.renderMs = summarize(std::move(renderMs));
+        recordSceneStats(scene, resources, result);
+        if (options.snapshot) {
+            measureSnapshot(scene, result);
+        }
+        results.push_back(result);
+    }
+    return true;
+}
+
+// ========== Windowed Mode ==========
+
+bool runWindowed(const Options& options, std::vector<RunResult>& results) {
+    Engine engine;
+    if (!engine.initialize()) {
+        std::cerr << "[ERROR] Failed to initialize engine" << std::endl;
+        return false;
+    }
+    auto* renderSystem = engine.getSystem<RenderSystem>();
+    auto* resourceSystem = engine.getSystem<ResourceSystem>();
+    Scene* scene = renderSystem ? renderSystem->getScene() : nullptr;
+    resource::ResourceManager* resources = resourceSystem ? resourceSystem->getResourceManager() : nullptr;
+    if (!scene || !resources) {
+        std::cerr << "[ERROR] Required systems not found!" << std::endl;
+        engine.shutdown();
+        return false;
+    }
+    engine.start();
+
+    std::vector<resource::ResourceHandle> meshes = createMeshes(*resources, options.meshCount);
+    resource::ResourceHandle particleMesh = resources->createSphereMesh("StressParticle", 0.5f, 6);
+    StressContent content(*scene, options.seed);
+
+    for (size_t objectCount : options.objectCounts) {
+        RunResult result;
+        result.objects = objectCount;
+        result.particles = options.particleCount;
+        result.spawnMs = content.spawn(meshes, particleMesh, objectCount, options.particleCount);
+        if (options.queries) {
+            measureQueries(*scene, content.getExtent(), options.seed, result);
+        }
+
+        std::vector<double> frameMs;
+        frameMs.reserve(options.frames);
+        for (uint32_t frame = 0; frame < options.warmupFrames + options.frames; ++frame) {
+            if (engine.shouldClose()) break;
+
+            auto frameStart = Clock::now();
+            content.updateParticles(FIXED_DELTA_TIME);
+            engine.update();
+            if (frame >= options.warmupFrames) {
+                frameMs.push_back(millisecondsSince(frameStart));
+            }
+        }
+
+        result.frames = static_cast<uint32_t>(frameMs.size());
+        result.frameMs = summarize(std::move(frameMs));
+        recordSceneStats(*scene, *resources, result);
+        if (options.snapshot) {
+            measureSnapshot(*scene, result);
+        }
+        results.push_back(result);
+        if (engine.shouldClose()) break;
+    }
+
+    engine.shutdown();
+    return true;
+}
+
+// ========== Report ==========
+
+void writeTiming(std::ostream& out, const char* name, const TimingSummary& t) {
+    out << "      \"" << name << "\": {\"mean\": " << t.mean << ", \"p50\": " << t.p50
+        << ", \"p90\": " << t.p90 << ", \"p99\": " << t.p99 << ", \"max\": " << t.max << "},\n";
+}
+
+void writeQuery(std::ostream& out, const char* name, const QueryTiming& q, bool last) {
+    out << "\"" << name << "\": {\"treeUs\": " << q.treeUs << ", \"linearUs\": " << q.linearUs
+        << ", \"hits\": " << q.hits << ", \"match\": " << (q.mismatch ? "false" : "true") << "}"
+        << (last ? "" : ", ");
+}
+
+bool writeJson(const std::string& path, const Options& options, const std::vector<RunResult>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "[ERROR] Cannot write " << path << std::endl;
+        return false;
+    }
+
+    out << "{\n";
+    out << "  \"benchmark\": \"stress\",\n";
+    out << "  \"mode\": \"" << (options.headless ? "headless" : "windowed") << "\",\n";
+    out << "  \"threads\": " << JobSystem::getDefaultWorkerCount() + 1 << ",\n";
+    out << "  \"simdBackend\": \"" << simd::backendName() << "\",\n";
+    out << "  \"meshes\": " << options.meshCount << ",\n";
+    out << "  \"warmupFrames\": " << options.warmupFrames << ",\n";
+    out << "  \"seed\": " << options.seed << ",\n";
+    out << "  \"runs\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const RunResult& r = results[i];
+        out << "    {\n";
+        out << "      \"objects\": " << r.objects << ",\n";
+        out << "      \"particles\": " << r.particles << ",\n";
+        out << "      \"frames\": " << r.frames << ",\n";
+        out << "      \"spawnMs\": " << r.spawnMs << ",\n";
+        writeTiming(out, "frameMs", r.frameMs);
+        if (options.headless) {
+            writeTiming(out, "updateMs", r.updateMs);
+            writeTiming(out, "renderMs", r.renderMs);
+        }
+        out << "      \"drawCalls\": " << r.drawCalls << ",\n";
+        out << "      \"triangles\": " << r.triangles << ",\n";
+        if (r.queriesMeasured) {
+            out << "      \"queries\": {";
+            writeQuery(out, "ray", r.rayQuery, false);
+            writeQuery(out, "frustum", r.frustumQuery, false);
+            writeQuery(out, "aabb", r.boxQuery, true);
+            out << "},\n";
+        }
+        if (r.snapshotMeasured) {
+            out << "      \"snapshot\": {\"saveMs\": " << r.snapshotSaveMs << ", \"loadMs\": " << r.snapshotLoadMs
+                << ", \"reloadOk\": " << (r.snapshotOk ? "true" : "false") << "},\n";
+        }
+        out << "      \"memory\": {\"rssBytes\": " << r.rssBytes << ", \"peakRssBytes\": " << r.peakRssBytes
+            << ", \"meshGpuBytes\": " << r.meshGPUBytes << ", \"objectBufferBytes\": " << r.objectBufferBytes << "}\n";
+        out << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+    return true;
+}
+
+void printTable(const std::vector<RunResult>& results) {
+    std::printf("\n  %10s %9s %9s %9s %9s %9s %10s %9s\n",
+                "objects", "spawn ms", "mean ms", "p50 ms", "p99 ms", "max ms", "draws", "RSS MB");
+    for (const RunResult& r : results) {
+        std::printf("  %10zu %9.2f %9.3f %9.3f %9.3f %9.3f %10zu %9.1f\n",
+                    r.objects + r.particles, r.spawnMs, r.frameMs.mean, r.frameMs.p50, r.frameMs.p99,
+                    r.frameMs.max, r.drawCalls, r.rssBytes / (1024.0 * 1024.0));
+    }
+}
+
+void printQueryTable(const std::vector<RunResult>& results) {
+    std::printf("\n  Spatial queries, us per query (tree / linear scan = speedup)\n");
+    std::printf("  %10s %28s %28s %28s\n", "objects", "queryRay", "queryFrustum", "queryAABB");
+    auto cell = [](const QueryTiming& q) {
+        char text[64];
+        std::snprintf(text, sizeof(text), "%8.2f / %9.2f = %5.1fx%s", q.treeUs, q.linearUs,
+                      q.treeUs > 0.0 ? q.linearUs / q.treeUs : 0.0, q.mismatch ? "!" : "");
+        return std::string(text);
+    };
+    for (const RunResult& r : results) {
+        if (r.queriesMeasured) {
+            std::printf("  %10zu %28s %28s %28s\n", r.objects + r.particles, cell(r.rayQuery).c_str(),
+                        cell(r.frustumQuery).c_str(), cell(r.boxQuery).c_str());
+        }
+    }
+}
+
+void printSnapshotTable(const std::vector<RunResult>& results) {
+    std::printf("\n  Snapshot save / reload over the populated scene\n");
+    std::printf("  %10s %10s %10s %8s\n", "objects", "save ms", "load ms", "reload");
+    for (const RunResult& r : results) {
+        if (r.snapshotMeasured) {
+            std::printf("  %10zu %10.2f %10.2f %8s\n", r.objects + r.particles, r.snapshotSaveMs,
+                        r.snapshotLoadMs, r.snapshotOk ? "ok" : "FAILED");
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cout << "[INFO] Stress benchmark: " << options.meshCount << " meshes, "
+              << options.particleCount << " particles, " << options.frames << " frames per run ("
+              << (options.headless ? "headless" : "windowed") << ", "
+              << JobSystem::getDefaultWorkerCount() + 1 << " threads)" << std::endl;
+
+    // Object spawns log once per batch; keep per-run output to the table
+    std::vector<RunResult> results;
+    bool ok = options.headless ? runHeadless(options, results) : runWindowed(options, results);
+    if (!ok) {
+        return 1;
+    }
+
+    printTable(results);
+    if (options.queries) {
+        printQueryTable(results);
+    }
+    if (options.snapshot) {
+        printSnapshotTable(results);
+    }
+    if (!writeJson(options.jsonPath, options, results)) {
+        return 1;
+    }
+    std::cout << "\n[SUCCESS] Results written to " << options.jsonPath << std::endl;
+    return 0;
+}
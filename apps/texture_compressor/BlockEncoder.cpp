@@ -0,0 +1,522 @@
+#include "BlockEncoder.h"
+#include "engine/core/JobSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace rs_engine {
+
+namespace {
+
+constexpr int BLOCK_TEXELS = 16;
+constexpr int REFINE_ITERATIONS = 2;
+const int BC7_WEIGHTS4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+inline int clampInt(int value, int low, int high) { return std::min(std::max(value, low), high); }
+
+/**
+ * Mean and principal axis (power iteration on the covariance) of the
+ * texels in mask, over the first dims channels. The axis is zero when
+ * all texels are equal.
+ */
+void principalAxis(const uint8_t* rgba, uint32_t mask, int dims, float mean[4], float axis[4]) {
+    int count = 0;
+    std::fill(mean, mean + 4, 0.0f);
+    for (int i = 0; i < BLOCK_TEXELS; ++i) {
+        if (mask & (1u << i)) {
+            for (int c = 0; c < dims; ++c) {
+                mean[c] += rgba[i * 4 + c];
+            }
+            count++;
+        }
+    }
+    for (int c = 0; c < dims; ++c) {
+        mean[c] /= static_cast<float>(std::max(count, 1));
+    }
+
+    float covariance[4][4] = {};
+    for (int i = 0; i < BLOCK_TEXELS; ++i) {
+        if (!(mask & (1u << i))) {
+            continue;
+        }
+        float d[4] = {};
+        for (int c = 0; c < dims; ++c) {
+            d[c] = rgba[i * 4 + c] - mean[c];
+        }
+        for (int a = 0; a < dims; ++a) {
+            for (int b = 0; b < dims; ++b) {
+                covariance[a][b] += d[a] * d[b];
+            }
+        }
+    }
+
+    // Start from the diagonal (largest channel spread dominates)
+    std::fill(axis, axis + 4, 0.0f);
+    for (int c = 0; c < dims; ++c) {
+        axis[c] = covariance[c][c] + 1e-3f * static_cast<float>(c + 1);
+    }
+    for (int iteration = 0; iteration < 8; ++iteration) {
+        float next[4] = {};
+        for (int a = 0; a < dims; ++a) {
+            for (int b = 0; b < dims; ++b) {
+                next[a] += covariance[a][b] * axis[b];
+            }
+        }
+        float length = 0.0f;
+        for (int c = 0; c < dims; ++c) {
+            length += next[c] * next[c];
+        }
+        length = std::sqrt(length);
+        if (length < 1e-6f) {
+            std::fill(axis, axis + 4, 0.0f);
+            return;
+        }
+        for (int c = 0; c < dims; ++c) {
+            axis[c] = next[c] / length;
+        }
+    }
+}
+
+/**
+ * Endpoints at the extreme projections onto the axis, pulled in by
+ * inset (a fraction of the range) since the extremes are rarely both hit.
+ */
+void fitEndpoints(const uint8_t* rgba, uint32_t mask, int dims, float inset, float e0[4], float e1[4]) {
+    float mean[4];
+    float axis[4];
+    principalAxis(rgba, mask, dims, mean, axis);
+
+    float minT = 0.0f;
+    float maxT = 0.0f;
+    for (int i = 0; i < BLOCK_TEXELS; ++i) {
+        if (mask & (1u << i)) {
+            float t = 0.0f;
+            for (int c = 0; c < dims; ++c) {
+                t += (rgba[i * 4 + c] - mean[c]) * axis[c];
+            }
+            minT = std::min(minT, t);
+            maxT = std::max(maxT, t);
+        }
+    }
+    const float pull = (maxT - minT) * inset;
+    maxT -= pull;
+    minT += pull;
+    for (int c = 0; c < 4; ++c) {
+        e0[c] = c < dims ? mean[c] + axis[c] * maxT : 255.0f;
+        e1[c] = c < dims ? mean[c] + axis[c] * minT : 255.0f;
+    }
+}
+
+/**
+ * Least-squares endpoints for fixed texel weights: minimizes
+ * sum |x - (w * e0 + (1 - w) * e1)|^2. False if the system is singular.
+ */
+bool refineEndpoints(const uint8_t* rgba, uint32_t mask, int dims, const float* weights, float e0[4], float e1[4]) {
+    float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+    float ax[4] = {}, bx[4] = {};
+    for (int i = 0; i < BLOCK_TEXELS; ++i) {
+        if (!(mask & (1u << i))) {
+            continue;
+        }
+        const float a = weights[i];
+        const float b = 1.0f - a;
+        aa += a * a;
+        bb += b * b;
+        ab += a * b;
+        for (int c = 0; c < dims; ++c) {
+            ax[c] += a * rgba[i * 4 + c];
+            bx[c] += b * rgba[i * 4 + c];
+        }
+    }
+    const float det = aa * bb - ab * ab;
+    if (std::fabs(det) < 1e-4f) {
+        return false;
+    }
+    for (int c = 0; c < dims; ++c) {
+        e0[c] = std::min(std::max((ax[c] * bb - bx[c] * ab) / det, 0.0f), 255.0f);
+        e1[c] = std::min(std::max((bx[c] * aa - ax[c] * ab) / det, 0.0f), 255.0f);
+    }
+    return true;
+}
+
+// ========== BC1 Color ==========
+
+inline uint16_t packRGB565(const float color[4]) {
+    const int r = clampInt(static_cast<int>(color[0] * 31.0f / 255.0f + 0.5f), 0, 31);
+    const int g = clampInt(static_cast<int>(color[1] * 63.0f / 255.0f + 0.5f), 0, 63);
+    const int b = clampInt(static_cast<int>(color[2] * 31.0f / 255.0f + 0.5f), 0, 31);
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+inline void unpackRGB565(uint16_t color, int out[3]) {
+    const int r = color >> 11;
+    const int g = (color >> 5) & 63;
+    const int b = color & 31;
+    out[0] = (r << 3) | (r >> 2);
+    out[1] = (g << 2) | (g >> 4);
+    out[2] = (b << 3) | (b >> 2);
+}
+
+struct ColorBlock {
+    uint16_t color0 = 0;
+    uint16_t color1 = 0;
+    uint8_t indices[BLOCK_TEXELS] = {};
+    uint64_t error = UINT64_MAX;
+};
+
+/**
+ * Order the endpoints for the mode, build the decoder's palette and pick
+ * the nearest entry per texel. Texels outside opaqueMask get index 3
+ * (transparent, 3-color mode only).
+ */
+ColorBlock evaluateColor(const uint8_t* rgba, uint32_t opaqueMask, bool fourColor, uint16_t color0, uint16_t color1) {
+    ColorBlock block;
+    if (fourColor ? color0 < color1 : color0 > color1) {
+        std::swap(color0, color1);
+    }
+    block.color0 = color0;
+    block.color1 = color1;
+
+    // Equal endpoints decode in 3-color mode in BC1; entries 0-2 are the same color then
+    const bool threeColorPalette = !fourColor || color0 == color1;
+    int palette[4][3];
+    unpackRGB565(color0, palette[0]);
+    unpackRGB565(color1, palette[1]);
+    for (int c = 0; c < 3; ++c) {
+        if (threeColorPalette) {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        } else {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+    }
+    const int entries = threeColorPalette ? 3 : 4;
+
+    block.error = 0;
+    for (int i = 0; i < BLOCK_TEXELS; ++i) {
+        if (!(opaqueMask & (1u << i))) {
+            block.indices[i] = 3;
+            continue;
+        }
+        int best = 0;
+        int bestError = INT32_MAX;
+        for (int entry = 0; entry < entries; ++entry) {
+            int error = 0;
+            for (int c = 0; c < 3; ++c) {
+                const int d = rgba[i * 4 + c] - palette[entry][c];
+                error += d * d;
+            }
+            if (error < bestError) {
+                bestError = error;
+                best = entry;
+            }
+        }
+        block.indices[i] = static_cast<uint8_t>(best);
+        block.error += static_cast<uint64_t>(bestError);
+    }
+    return block;
+}
+
+ColorBlock encodeColor(const uint8_t* rgba, uint32_t opaqueMask, bool fourColor) {
+    if (opaqueMask == 0) {
+        return evaluateColor(rgba, opaqueMask, false, 0, 0);
+    }
+
+    float e0[4];
+    float e1[4];
+    fitEndpoints(rgba, opaqueMask, 3, fourColor ? 1.0f / 16.0f : 1.0f / 8.0f, e0, e1);
+    ColorBlock best = evaluateColor(rgba, opaqueMask, fourColor, packRGB565(e0), packRGB565(e1));
+
+    // Weight of color0 per palette entry
+    const float fourColorWeights[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+    const float threeColorWeights[4] = {1.0f, 0.0f, 0.5f, 0.0f};
+    for (int iteration = 0; iteration < REFINE_ITERATIONS && best.error > 0 && best.color0 != best.color1;
+         ++iteration) {
+        float weights[BLOCK_TEXELS];
+        for (int i = 0; i < BLOCK_TEXELS; ++i) {
+            weights[i] = (fourColor ? fourColorWeights : threeColorWeights)[best.indices[i]];
+        }
+        if (!refineEndpoints(rgba, opaqueMask, 3, weights, e0, e1)) {
+            break;
+        }
+        ColorBlock candidate = evaluateColor(rgba, opaqueMask, fourColor, packRGB565(e0), packRGB565(e1));
+        if (candidate.error >= best.error) {
+            break;
+        }
+        best = candidate;
+    }
+    return best;
+}
+
+void writeColorBlock(const ColorBlock& block, uint8_t* out) {
+    uint32_t bits = 0;
+    for (int i = 0; i < BLOCK_TEXELS; ++i) {
+        bits |= static_cast<uint32_t>(block.indices[i]) << (i * 2);
+    }
+    out[0] = static_cast<uint8_t>(block.color0);
+    out[1] = static_cast<uint8_t>(block.color0 >> 8);
+    out[2] = static_cast<uint8_t>(block.color1);
+    out[3] = static_cast<uint8_t>(block.color1 >> 8);
+    for (int i = 0; i < 4; ++i) {
+        out[4 + i] = static_cast<uint8_t>(bits >> (i * 8));
+    }
+}
+
+// ========== BC7 Mode 6 ==========
+
+struct BC7Block {
+    int endpoints[2][4] = {};      // 8-bit values; the low bit is the endpoint's p-bit
+    uint8_t indices[BLOCK_TEXELS] = {};
+    uint64_t error = UINT64_MAX;
+};
+
+BC7Block evaluateBC7(const uint8_t* rgba, const int endpoints[2][4]) {
+    BC7Block block;
+    std::memcpy(block.endpoints, endpoints, sizeof(block.endpoints));
+
+    int palette[16][4];
+    for (int entry = 0; entry < 16; ++entry) {
+        const int w = BC7_WEIGHTS4[entry];
+        for (int c = 0; c < 4; ++c) {
+            palette[entry][c] = ((64 - w) * endpoints[0][c] + w * endpoints[1][c] + 32) >> 6;
+        }
+    }
+
+    block.error = 0;
+    for (int i = 0; i < BLOCK_TEXELS; ++i) {
+        int best = 0;
+        int bestError = INT32_MAX;
+        for (int entry = 0; entry < 16; ++entry) {
+            int error = 0;
+            for (int c = 0; c < 4; ++c) {
+                const int d = rgba[i * 4 + c] - palette[entry][c];
+                error += d * d;
+            }
+            if (error < bestError) {
+                bestError = error;
+                best = entry;
+            }
+        }
+        block.indices[i] = static_cast<uint8_t>(best);
+        block.error += static_cast<uint64_t>(bestError);
+    }
+    return block;
+}
+
+/**
+ * Quantize float endpoints to 7 bits + p-bit, trying all four p-bit pairs
+ */
+BC7Block quantizeBC7(const uint8_t* rgba, const float e0[4], const float e1[4]) {
+    BC7Block best;
+    for (int pbits = 0; pbits < 4; ++pbits) {
+        const int p[2] = {pbits & 1, pbits >> 1};
+        int endpoints[2][4];
+        for (int c = 0; c < 4; ++c) {
+            const int q0 = clampInt(static_cast<int>((e0[c] - p[0]) * 0.5f + 0.5f), 0, 127);
+            const int q1 = clampInt(static_cast<int>((e1[c] - p[1]) * 0.5f + 0.5f), 0, 127);
+            endpoints[0][c] = (q0 << 1) | p[0];
+            endpoints[1][c] = (q1 << 1) | p[1];
+        }
+        BC7Block candidate = evaluateBC7(rgba, endpoints);
+        if (candidate.error < best.error) {
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+class BitWriter {
+public:
+    explicit BitWriter(uint8_t* out) : data(out) { std::memset(data, 0, 16); }
+
+    void write(uint32_t value, int bits) {
+        for (int i = 0; i < bits; ++i, ++position) {
+            data[position >> 3] |= static_cast<uint8_t>(((value >> i) & 1u) << (position & 7));
+        }
+    }
+
+private:
+    uint8_t* data;
+    int position = 0;
+};
+
+void writeBC7Mode6(BC7Block block, uint8_t* out) {
+    // Texel 0 is the anchor: its index drops the top bit, so it must be < 8
+    if (block.indices[0] >= 8) {
+        for (int c = 0; c < 4; ++c) {
+            std::swap(block.endpoints[0][c], block.endpoints[1][c]);
+        }
+        for (int i = 0; i < BLOCK_TEXELS; ++i) {
+            block.indices[i] = static_cast<uint8_t>(15 - block.indices[i]);
+        }
+    }
+
+    BitWriter writer(out);
+    writer.write(1u << 6, 7);                       // Mode 6
+    for (int c = 0; c < 4; ++c) {
+        writer.write(static_cast<uint32_t>(block.endpoints[0][c] >> 1), 7);
+        writer.write(static_cast<uint32_t>(block.endpoints[1][c] >> 1), 7);
+    }
+    writer.write(static_cast<uint32_t>(block.endpoints[0][0] & 1), 1);
+    writer.write(static_cast<uint32_t>(block.endpoints[1][0] & 1), 1);
+    writer.write(block.indices[0], 3);
+    for (int i = 1; i < BLOCK_TEXELS; ++i) {
+        writer.write(block.indices[i], 4);
+    }
+}
+
+} // namespace
+
+// ========== BlockEncoder ==========
+
+uint64_t BlockEncoder::encodeBC1(const uint8_t* rgba, uint8_t* out, bool punchThroughAlpha) {
+    uint32_t opaqueMask = 0xFFFF;
+    if (punchThroughAlpha) {
+        for (int i = 0; i < BLOCK_TEXELS; ++i) {
+            if (rgba[i * 4 + 3] < 128) {
+                opaqueMask &= ~(1u << i);
+            }
+        }
+    }
+
+    // Blocks with transparent texels need the 3-color mode
+    const ColorBlock block = encodeColor(rgba, opaqueMask, opaqueMask == 0xFFFF);
+    writeColorBlock(block, out);
+    return block.error;
+}
+
+uint64_t BlockEncoder::encodeBC3(const uint8_t* rgba, uint8_t* out) {
+    const uint64_t alphaError = encodeBC4(rgba + 3, 4, out);
+    const ColorBlock block = encodeColor(rgba, 0xFFFF, true);   // BC3 color is always 4-color
+    writeColorBlock(block, out + 8);
+    return block.error + alphaError;
+}
+
+uint64_t BlockEncoder::encodeBC5(const uint8_t* rgba, uint8_t* out) {
+    return encodeBC4(rgba, 4, out) + encodeBC4(rgba + 1, 4, out + 8);
+}
+
+uint64_t BlockEncoder::encodeBC4(const uint8_t* values, size_t stride, uint8_t* out) {
+    int low = 255;
+    int high = 0;
+    for (int i = 0; i < BLOCK_TEXELS; ++i) {
+        low = std::min<int>(low, values[i * stride]);
+        high = std::max<int>(high, values[i * stride]);
+    }
+
+    // 8-value mode (red0 > red1): both ends plus six interpolants
+    int palette[8];
+    palette[0] = high;
+    palette[1] = low;
+    for (int k = 2; k < 8; ++k) {
+        palette[k] = ((8 - k) * high + (k - 1) * low + 3) / 7;
+    }
+
+    uint64_t indexBits = 0;
+    uint64_t totalError = 0;
+    for (int i = 0; i < BLOCK_TEXELS && high > low; ++i) {
+        const int value = values[i * stride];
+        int best = 0;
+        int bestError = INT32_MAX;
+        for (int entry = 0; entry < 8; ++entry) {
+            const int error = (value - palette[entry]) * (value - palette[entry]);
+            if (error < bestError) {
+                bestError = error;
+                best = entry;
+            }
+        }
+        indexBits |= static_cast<uint64_t>(best) << (i * 3);
+        totalError += static_cast<uint64_t>(bestError);
+    }
+
+    out[0] = static_cast<uint8_t>(high);
+    out[1] = static_cast<uint8_t>(low);
+    for (int i = 0; i < 6; ++i) {
+        out[2 + i] = static_cast<uint8_t>(indexBits >> (i * 8));
+    }
+    return totalError;
+}
+
+uint64_t BlockEncoder::encodeBC7(const uint8_t* rgba, uint8_t* out) {
+    float e0[4];
+    float e1[4];
+    fitEndpoints(rgba, 0xFFFF, 4, 1.0f / 32.0f, e0, e1);
+    BC7Block best = quantizeBC7(rgba, e0, e1);
+
+    for (int iteration = 0; iteration < REFINE_ITERATIONS && best.error > 0; ++iteration) {
+        float weights[BLOCK_TEXELS];
+        for (int i = 0; i < BLOCK_TEXELS; ++i) {
+            weights[i] = 1.0f - BC7_WEIGHTS4[best.indices[i]] / 64.0f;    // Weight of endpoint 0
+        }
+        if (!refineEndpoints(rgba, 0xFFFF, 4, weights, e0, e1)) {
+            break;
+        }
+        BC7Block candidate = quantizeBC7(rgba, e0, e1);
+        if (candidate.error >= best.error) {
+            break;
+        }
+        best = candidate;
+    }
+
+    writeBC7Mode6(best, out);
+    return best.error;
+}
+
+uint64_t BlockEncoder::encodeImage(const uint8_t* rgba, uint32_t width, uint32_t height,
+                                   resource::TextureFormat format, uint8_t* out, JobSystem& jobs) {
+    const resource::TextureFormatInfo info = resource::getTextureFormatInfo(format);
+    const uint32_t blocksWide = (width + 3) / 4;
+    const uint32_t blocksHigh = (height + 3) / 4;
+    bool punchThroughAlpha = false;
+    if (format == resource::TextureFormat::BC1_RGBA) {
+        for (size_t i = 0; i < static_cast<size_t>(width) * height && !punchThroughAlpha; ++i) {
+            punchThroughAlpha = rgba[i * 4 + 3] < 128;
+        }
+    }
+
+    std::vector<uint64_t> rowErrors(blocksHigh, 0);
+    jobs.parallelFor(blocksHigh, 4, [&](size_t begin, size_t end) {
+        uint8_t texels[BLOCK_TEXELS * 4];
+        for (size_t blockY = begin; blockY < end; ++blockY) {
+            for (uint32_t blockX = 0; blockX < blocksWide; ++blockX) {
+                // Gather the block, repeating the edge for levels smaller than a block
+                for (uint32_t y = 0; y < 4; ++y) {
+                    const uint32_t sourceY = std::min<uint32_t>(static_cast<uint32_t>(blockY) * 4 + y, height - 1);
+                    for (uint32_t x = 0; x < 4; ++x) {
+                        const uint32_t sourceX = std::min(blockX * 4 + x, width - 1);
+                        std::memcpy(texels + (y * 4 + x) * 4,
+                                    rgba + (static_cast<size_t>(sourceY) * width + sourceX) * 4, 4);
+                    }
+                }
+
+                uint8_t* block = out + (blockY * blocksWide + blockX) * info.blockBytes;
+                switch (format) {
+                    case resource::TextureFormat::BC1_RGBA:
+                        rowErrors[blockY] += encodeBC1(texels, block, punchThroughAlpha);
+                        break;
+                    case resource::TextureFormat::BC3_RGBA:
+                        rowErrors[blockY] += encodeBC3(texels, block);
+                        break;
+                    case resource::TextureFormat::BC5_RG:
+                        rowErrors[blockY] += encodeBC5(texels, block);
+                        break;
+                    case resource::TextureFormat::BC7_RGBA:
+                        rowErrors[blockY] += encodeBC7(texels, block);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+    });
+
+    uint64_t totalError = 0;
+    for (uint64_t error : rowErrors) {
+        totalError += error;
+    }
+    return totalError;
+}
+
+} // namespace rs_engine
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "engine/resource/texture/Texture.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace rs_engine {
+
+class JobSystem;
+
+/**
+ * @brief CPU block compression encoders (BC1, BC3, BC4, BC5, BC7)
+ *
+ * Each encoder takes one 4x4 block of RGBA8 texels (row-major, 64 bytes)
+ * and returns the summed squared error of the channels the format stores
+ * (RGB of the opaque texels for BC1, RG for BC5, RGBA otherwise), measured
+ * against the palette a decoder reconstructs.
+ *
+ * - BC1 / BC3 color: principal axis fit, then least-squares endpoint refinement
+ * - BC4 / BC5 / BC3 alpha: min / max range fit, 8-value mode
+ * - BC7: mode 6 only (one RGBA subset, 7-bit endpoints + p-bits, 4-bit
+ *   indices) with the same fit / refinement; good on smooth color, weaker
+ *   than a full multi-mode encoder on blocks with several distinct colors
+ *
+ * ETC2 and ASTC are not encoded here; KTX2 files with them (from external
+ * encoders) load in the engine all the same.
+ */
+class BlockEncoder {
+public:
+    /**
+     * @param punchThroughAlpha Texels with alpha < 128 become transparent (3-color mode)
+     */
+    static uint64_t encodeBC1(const uint8_t* rgba, uint8_t* out, bool punchThroughAlpha);
+    static uint64_t encodeBC3(const uint8_t* rgba, uint8_t* out);
+    static uint64_t encodeBC5(const uint8_t* rgba, uint8_t* out);
+    static uint64_t encodeBC7(const uint8_t* rgba, uint8_t* out);
+
+    /**
+     * @brief Encode one channel (16 values, stride bytes apart) as a BC4 block
+     */
+    static uint64_t encodeBC4(const uint8_t* values, size_t stride, uint8_t* out);
+
+    /**
+     * @brief Encode a whole RGBA8 image, block rows split across the workers of jobs
+     *
+     * Partial edge blocks (levels under 4 texels) repeat the last row / column.
+     * @param out getTextureLevelSize(format, width, height) bytes
+     * @return Summed squared error of all blocks
+     */
+    static uint64_t encodeImage(const uint8_t* rgba, uint32_t width, uint32_t height,
+                                resource::TextureFormat format, uint8_t* out, JobSystem& jobs);
+};
+
+} // namespace rs_engine
@@ -0,0 +1,212 @@
+/**
+ * @brief Offline texture compressor: image file -> block-compressed KTX2
+ *
+ * Decodes the source with ImageDecoder (PNG, TGA, BMP, PNM; JPEG sources
+ * must be converted to PNG first), builds the mip chain with the engine's
+ * box filter, encodes every level on the JobSystem and writes a KTX2 file
+ * that Texture::loadFromFile / ResourceManager::loadTexture upload as is.
+ *
+ * Formats (all 4x4 blocks; level 0 must be a multiple of 4 in both axes):
+ * - bc1: 8 bytes/block (8x smaller than RGBA8), RGB + 1-bit alpha
+ * - bc3: 16 bytes/block (4x), RGB + smooth alpha
+ * - bc5: 16 bytes/block, two channels (tangent-space normal maps; linear)
+ * - bc7: 16 bytes/block (4x), mode 6 encoder, RGBA
+ * - rgba8: uncompressed, for comparison or unaligned sizes
+ * - auto (default): bc1 for opaque images, bc3 when there is alpha
+ *
+ * Color formats are tagged sRGB unless --linear is given; the engine
+ * samples both the same way (see Texture::getWebGPUFormat).
+ *
+ * Usage: texture_compressor INPUT OUTPUT.ktx2 [--format auto|bc1|bc3|bc5|bc7|rgba8]
+ *                           [--no-mips] [--linear]
+ */
+
+#include "BlockEncoder.h"
+#include "engine/core/JobSystem.h"
+#include "engine/resource/texture/ImageDecoder.h"
+#include "engine/resource/texture/ImageProcessing.h"
+#include "engine/resource/texture/KTX2Container.h"
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace rs_engine;
+using resource::TextureFormat;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const char* USAGE =
+    "Usage: texture_compressor INPUT OUTPUT.ktx2 [--format auto|bc1|bc3|bc5|bc7|rgba8] [--no-mips] [--linear]";
+
+/**
+ * Expand gray / gray+alpha / RGB to RGBA8
+ */
+std::vector<uint8_t> toRGBA(const resource::DecodedImage& image) {
+    const size_t pixelCount = static_cast<size_t>(image.width) * image.height;
+    std::vector<uint8_t> rgba(pixelCount * 4);
+    if (image.channels == 3) {
+        resource::ImageProcessing::expandRGBToRGBA(image.pixels.data(), rgba.data(), pixelCount);
+        return rgba;
+    }
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const uint8_t* source = image.pixels.data() + i * image.channels;
+        uint8_t* target = rgba.data() + i * 4;
+        switch (image.channels) {
+            case 1: target[0] = target[1] = target[2] = source[0]; target[3] = 255; break;
+            case 2: target[0] = target[1] = target[2] = source[0]; target[3] = source[1]; break;
+            default: std::memcpy(target, source, 4); break;
+        }
+    }
+    return rgba;
+}
+
+bool parseFormat(const std::string& name, TextureFormat& format) {
+    if (name == "auto") format = TextureFormat::Unknown;
+    else if (name == "bc1") format = TextureFormat::BC1_RGBA;
+    else if (name == "bc3") format = TextureFormat::BC3_RGBA;
+    else if (name == "bc5") format = TextureFormat::BC5_RG;
+    else if (name == "bc7") format = TextureFormat::BC7_RGBA;
+    else if (name == "rgba8") format = TextureFormat::RGBA8;
+    else return false;
+    return true;
+}
+
+const char* formatName(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::BC1_RGBA: return "BC1";
+        case TextureFormat::BC3_RGBA: return "BC3";
+        case TextureFormat::BC5_RG: return "BC5";
+        case TextureFormat::BC7_RGBA: return "BC7";
+        default: return "RGBA8";
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string inputPath;
+    std::string outputPath;
+    TextureFormat format = TextureFormat::Unknown;
+    bool mipmaps = true;
+    bool linear = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            if (!parseFormat(argv[++i], format)) {
+                std::cerr << USAGE << std::endl;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--no-mips") == 0) {
+            mipmaps = false;
+        } else if (std::strcmp(argv[i], "--linear") == 0) {
+            linear = true;
+        } else if (argv[i][0] != '-' && inputPath.empty()) {
+            inputPath = argv[i];
+        } else if (argv[i][0] != '-' && outputPath.empty()) {
+            outputPath = argv[i];
+        } else {
+            std::cerr << USAGE << std::endl;
+            return 1;
+        }
+    }
+    if (inputPath.empty() || outputPath.empty()) {
+        std::cerr << USAGE << std::endl;
+        return 1;
+    }
+
+    resource::DecodedImage image;
+    if (!resource::ImageDecoder::load(inputPath, image)) {
+        return 1;
+    }
+    const uint32_t width = image.width;
+    const uint32_t height = image.height;
+    std::vector<uint8_t> rgba = toRGBA(image);
+    image = resource::DecodedImage();
+
+    if (format == TextureFormat::Unknown) {
+        bool hasAlpha = false;
+        for (size_t i = 3; i < rgba.size() && !hasAlpha; i += 4) {
+            hasAlpha = rgba[i] != 255;
+        }
+        format = hasAlpha ? TextureFormat::BC3_RGBA : TextureFormat::BC1_RGBA;
+    }
+    const resource::TextureFormatInfo info = resource::getTextureFormatInfo(format);
+    if (width % info.blockWidth != 0 || height % info.blockHeight != 0) {
+        std::cerr << "[ERROR] " << width << "x" << height << " is not a multiple of 4 (WebGPU needs whole "
+                  << "blocks for compressed textures); resize the source or use --format rgba8" << std::endl;
+        return 1;
+    }
+
+    JobSystem jobs(JobSystem::getDefaultWorkerCount());
+    std::cout << "[INFO] " << inputPath << ": " << width << "x" << height << " -> " << formatName(format)
+              << " (" << jobs.getThreadCount() << " threads)" << std::endl;
+
+    // Mip chain in RGBA8, then every level encoded into the output chain
+    auto start = Clock::now();
+    std::vector<uint8_t> chain;
+    std::vector<resource::MipLevelInfo> chainLevels;
+    resource::ImageProcessing::buildMipChain(rgba.data(), width, height, 4, mipmaps, chain, chainLevels, &jobs);
+    const double mipSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    resource::KTX2Image output;
+    output.width = width;
+    output.height = height;
+    output.format = format;
+    output.srgb = !linear && format != TextureFormat::BC5_RG;
+
+    start = Clock::now();
+    uint64_t level0Error = 0;
+    if (format == TextureFormat::RGBA8) {
+        output.data = std::move(chain);
+        output.levels = chainLevels;
+    } else {
+        size_t offset = 0;
+        for (const resource::MipLevelInfo& level : chainLevels) {
+            resource::MipLevelInfo encoded = level;
+            encoded.offset = offset;
+            offset += resource::getTextureLevelSize(format, level.width, level.height);
+            output.levels.push_back(encoded);
+        }
+        output.data.resize(offset);
+        for (size_t i = 0; i < chainLevels.size(); ++i) {
+            const uint64_t error = BlockEncoder::encodeImage(chain.data() + chainLevels[i].offset,
+                                                             chainLevels[i].width, chainLevels[i].height, format,
+                                                             output.data.data() + output.levels[i].offset, jobs);
+            if (i == 0) {
+                level0Error = error;
+            }
+        }
+    }
+    const double encodeSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (!resource::KTX2Container::save(outputPath, output)) {
+        return 1;
+    }
+
+    // Report size against the RGBA8 chain (RG8 for BC5) and level 0 quality
+    size_t uncompressedSize = 0;
+    for (const resource::MipLevelInfo& level : output.levels) {
+        uncompressedSize += resource::getTextureLevelSize(
+            format == TextureFormat::BC5_RG ? TextureFormat::RG8 : TextureFormat::RGBA8, level.width, level.height);
+    }
+    const int channels = format == TextureFormat::BC5_RG ? 2 : format == TextureFormat::BC1_RGBA ? 3 : 4;
+    const double samples = static_cast<double>(width) * height * channels;
+    const double mse = level0Error / samples;
+    const double megapixels = static_cast<double>(width) * height / 1e6;
+
+    std::cout << "[INFO] " << output.levels.size() << " levels, mips " << mipSeconds * 1000.0 << " ms" << std::endl;
+    if (format != TextureFormat::RGBA8) {
+        std::cout << "[INFO] Encode " << encodeSeconds * 1000.0 << " ms ("
+                  << megapixels / std::max(encodeSeconds, 1e-9) << " MPixel/s of level 0)" << std::endl;
+        std::cout << "[INFO] Level 0 PSNR: "
+                  << (mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : INFINITY) << " dB" << std::endl;
+    }
+    std::cout << "[SUCCESS] Wrote " << outputPath << ": " << output.data.size() / 1024.0 << " KB GPU data ("
+              << uncompressedSize / 1024.0 << " KB uncompressed, "
+              << static_cast<double>(uncompressedSize) / output.data.size() << "x smaller)" << std::endl;
+    return 0;
+}
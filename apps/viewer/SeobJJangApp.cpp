@@ -189,8 +189,10 @@ std::vector<std::string> getObjectNames() {
         auto* scene = g_appInstance->renderSystem->getScene();
         if (scene) {
             const auto& objects = scene->getAllObjects();
-            for (const auto& [name, obj] : objects) {
-                names.push_back(name);
+            for (const auto* obj : objects) {
+                if (obj->hasName()) {  // Unnamed objects cannot be looked up by name
+                    names.push_back(obj->getName());
+                }
             }
         }
     }
@@ -46,6 +46,10 @@ bool Engine::initialize() {
     // Sort systems by priority before initialization
     sortSystems();
 
+    // Worker pool first: systems pick it up from initialize()
+    jobSystem = std::make_unique<JobSystem>(JobSystem::getDefaultWorkerCount());
+    std::cout << "[INFO] Job system: " << jobSystem->getWorkerCount() << " worker threads" << std::endl;
+
     // Initialize all systems in priority order
     for (auto& system : systems) {
         std::cout << "   [INFO] Initializing " << system->getName() 
@@ -127,6 +131,9 @@ void Engine::shutdown() {
 
     systems.clear();
     systemsCache.clear();
+    
+    // Systems have joined their background work - stop the workers last
+    jobSystem.reset();
     isInitialized = false;
 
     std::cout << "[SUCCESS] Engine shutdown complete" << std::endl;
@@ -7,6 +7,7 @@
 #include <string>
 #include <cstdint>
 #include "IEngineSystem.h"
+#include "JobSystem.h"
 #include "Config.h"
 #include "../core/math/Vec3.h"
 
@@ -23,12 +24,17 @@ class ResourceSystem;
  * - Frame timing and delta time calculation
  * - Fixed timestep updates for physics
  * - System priority ordering
+ * - The worker pool shared by all systems (outlives every system)
  * 
  * Platform Support: 100% shared between Web and Native
  * Platform differences are handled by individual systems
  */
 class Engine {
 private:
+    // Worker pool: created before the systems initialize, destroyed after they
+    // shut down (declared first so it also outlives them on destruction)
+    std::unique_ptr<JobSystem> jobSystem;
+    
     // System storage (owned by engine)
     std::vector<std::unique_ptr<IEngineSystem>> systems;
     
@@ -140,6 +146,14 @@ public:
     const std::vector<std::unique_ptr<IEngineSystem>>& getSystems() const {
         return systems;
     }
+    
+    /**
+     * @brief Engine-wide worker pool (nullptr before initialize / after shutdown)
+     * 
+     * Sized from EngineConfig when initialize() runs. Systems hand it to the
+     * objects they create (ResourceManager, Scene).
+     */
+    JobSystem* getJobSystem() { return jobSystem.get(); }
 
     // ========== Time Management ==========
     
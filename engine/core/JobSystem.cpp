@@ -0,0 +1,141 @@
+#include "JobSystem.h"
+#include "Config.h"
+#include <algorithm>
+#include <iostream>
+
+namespace rs_engine {
+
+JobSystem::JobSystem(uint32_t workerCount) {
+    workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&JobSystem::workerLoop, this);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+uint32_t JobSystem::getDefaultWorkerCount() {
+    if (!EngineConfig::getLimits().enableMultithreading) {
+        return 0;
+    }
+    uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void JobSystem::parallelFor(size_t count, size_t grainSize, const RangeFunction& fn) {
+    if (count == 0) {
+        return;
+    }
+    grainSize = std::max<size_t>(grainSize, 1);
+
+    // Serial path: no workers or not enough work to split
+    if (workers.empty() || count <= grainSize) {
+        fn(0, count);
+        return;
+    }
+
+    auto batch = std::make_shared<Batch>();
+    batch->function = &fn;
+    batch->count = count;
+    batch->grainSize = grainSize;
+    batch->chunkCount = (count + grainSize - 1) / grainSize;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        pendingBatches.push_back(batch);
+    }
+    if (batch->chunkCount > 2) {
+        workAvailable.notify_all();
+    } else {
+        workAvailable.notify_one();
+    }
+
+    // The caller works on its own batch, then waits for chunks still running elsewhere
+    runChunks(*batch);
+
+    if (batch->finishedChunks.load(std::memory_order_acquire) < batch->chunkCount) {
+        std::unique_lock<std::mutex> lock(doneMutex);
+        batchDone.wait(lock, [&batch]() {
+            return batch->finishedChunks.load(std::memory_order_acquire) >= batch->chunkCount;
+        });
+    }
+}
+
+void JobSystem::submit(Task task) {
+    if (workers.empty()) {
+        task();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        pendingTasks.push_back(std::move(task));
+    }
+    workAvailable.notify_one();
+}
+
+bool JobSystem::runChunks(Batch& batch) {
+    bool finishedLast = false;
+    for (;;) {
+        size_t chunk = batch.nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= batch.chunkCount) {
+            break;
+        }
+
+        size_t begin = chunk * batch.grainSize;
+        size_t end = std::min(begin + batch.grainSize, batch.count);
+        (*batch.function)(begin, end);
+
+        size_t finished = batch.finishedChunks.fetch_add(1, std::memory_order_acq_rel) + 1;
+        finishedLast = finished == batch.chunkCount;
+    }
+    return finishedLast;
+}
+
+void JobSystem::workerLoop() {
+    for (;;) {
+        std::shared_ptr<Batch> batch;
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            workAvailable.wait(lock, [this]() {
+                return stopping || !pendingBatches.empty() || !pendingTasks.empty();
+            });
+
+            if (!pendingBatches.empty()) {
+                batch = pendingBatches.front();
+                // Every chunk is claimed once the counter passes the end - retire the batch
+                if (batch->nextChunk.load(std::memory_order_relaxed) >= batch->chunkCount) {
+                    pendingBatches.pop_front();
+                    continue;
+                }
+            } else if (!pendingTasks.empty()) {
+                task = std::move(pendingTasks.front());
+                pendingTasks.pop_front();
+            } else {
+                return;  // Stopping with nothing left
+            }
+        }
+
+        if (task) {
+            task();
+            continue;
+        }
+
+        if (runChunks(*batch)) {
+            // Lock so the notification cannot slip between the caller's check and wait
+            std::lock_guard<std::mutex> lock(doneMutex);
+            batchDone.notify_all();
+        }
+    }
+}
+
+} // namespace rs_engine
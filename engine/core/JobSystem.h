@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rs_engine {
+
+/**
+ * @brief Minimal worker pool for data-parallel loops
+ *
+ * A parallelFor() call is split into chunks of grainSize items that
+ * workers (and the calling thread) claim with an atomic counter, so
+ * there is no per-item scheduling cost. The caller blocks until every
+ * chunk has finished. Calls may be issued from several threads and may
+ * nest; a waiting caller always works on its own loop first.
+ *
+ * Independent long-running work (e.g. asset loading) goes through
+ * submit(); workers prefer parallelFor chunks over queued tasks, and a
+ * task may itself call parallelFor.
+ *
+ * The engine owns one pool (Engine::getJobSystem()), created before the
+ * systems initialize and destroyed after they have shut down; tools
+ * without an Engine create their own. Web builds have no worker threads
+ * (EngineConfig multithreading is off) and every loop and task runs
+ * serially on the calling thread.
+ *
+ * Example:
+ *   jobs.parallelFor(rays.size(), 64, [&](size_t begin, size_t end) {
+ *       for (size_t i = begin; i < end; ++i) { ... }
+ *   });
+ *
+ * Platform Support: 100% shared API, serial fallback on Web
+ */
+class JobSystem {
+public:
+    /**
+     * @brief Range callback: processes items [begin, end)
+     */
+    using RangeFunction = std::function<void(size_t begin, size_t end)>;
+
+    /**
+     * @brief Fire-and-forget work item
+     */
+    using Task = std::function<void()>;
+
+    /**
+     * @param workerCount Number of worker threads (0 = serial)
+     */
+    explicit JobSystem(uint32_t workerCount);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Worker count for the current EngineConfig (hardware threads - 1, 0 on Web)
+     */
+    static uint32_t getDefaultWorkerCount();
+
+    /**
+     * @brief Run fn over [0, count) in chunks and wait for completion
+     * @param count Number of items
+     * @param grainSize Items per chunk (tune so a chunk is ~10-100 us of work)
+     * @param fn Called as fn(begin, end) for each chunk, possibly concurrently
+     */
+    void parallelFor(size_t count, size_t grainSize, const RangeFunction& fn);
+
+    /**
+     * @brief Run a task on a worker without waiting for it
+     *
+     * Tasks start in submission order. Without workers the task runs
+     * immediately on the calling thread. Tasks still queued when the pool
+     * is destroyed are run before the workers exit.
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Worker threads, not counting the caller
+     */
+    uint32_t getWorkerCount() const { return static_cast<uint32_t>(workers.size()); }
+
+    /**
+     * @brief Threads that execute a parallelFor (workers + caller)
+     */
+    uint32_t getThreadCount() const { return getWorkerCount() + 1; }
+
+private:
+    struct Batch {
+        const RangeFunction* function = nullptr;
+        size_t count = 0;
+        size_t grainSize = 1;
+        size_t chunkCount = 0;
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> finishedChunks{0};
+    };
+
+    std::vector<std::thread> workers;
+    std::deque<std::shared_ptr<Batch>> pendingBatches;
+    std::deque<Task> pendingTasks;
+    std::mutex queueMutex;
+    std::condition_variable workAvailable;
+    std::mutex doneMutex;
+    std::condition_variable batchDone;
+    bool stopping = false;
+
+    void workerLoop();
+
+    /**
+     * @brief Claim and run chunks until the batch has none left
+     * @return true if this call finished the batch's last chunk
+     */
+    bool runChunks(Batch& batch);
+};
+
+} // namespace rs_engine
@@ -0,0 +1,142 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <utility>
+
+#if defined(__EMSCRIPTEN__)
+    // No mapping: buffered read only
+#elif defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace rs_engine {
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        opened = std::exchange(other.opened, false);
+        mapped = std::exchange(other.mapped, false);
+        buffer = std::move(other.buffer);
+#if defined(_WIN32)
+        fileHandle = std::exchange(other.fileHandle, nullptr);
+        mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string& path, bool sequential) {
+    close();
+
+#if defined(__EMSCRIPTEN__)
+    (void)sequential;
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    buffer.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!buffer.empty() && !file.read(reinterpret_cast<char*>(buffer.data()), buffer.size())) {
+        buffer.clear();
+        return false;
+    }
+    data = buffer.data();
+    size = buffer.size();
+#elif defined(_WIN32)
+    (void)sequential;
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    size = static_cast<size_t>(fileSize.QuadPart);
+    if (size > 0) {
+        mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            close();
+            return false;
+        }
+        data = static_cast<const uint8_t*>(view);
+        mapped = true;
+    }
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    size = static_cast<size_t>(info.st_size);
+    if (size > 0) {
+        void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            ::close(fd);
+            size = 0;
+            return false;
+        }
+        // Start read-ahead now; pages are still faulted in lazily
+        madvise(view, size, sequential ? MADV_SEQUENTIAL : MADV_WILLNEED);
+        data = static_cast<const uint8_t*>(view);
+        mapped = true;
+    }
+    ::close(fd);  // The mapping keeps the file referenced
+#endif
+
+    opened = true;
+    return true;
+}
+
+void MappedFile::close() {
+#if defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    if (mapped) {
+        UnmapViewOfFile(data);
+    }
+    if (mappingHandle) {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle) {
+        CloseHandle(fileHandle);
+    }
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#elif !defined(__EMSCRIPTEN__)
+    if (mapped) {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+#endif
+    data = nullptr;
+    size = 0;
+    opened = false;
+    mapped = false;
+    buffer.clear();
+    buffer.shrink_to_fit();
+}
+
+} // namespace rs_engine
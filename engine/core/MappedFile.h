@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rs_engine {
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped where possible
+ *
+ * Native builds map the file (mmap / MapViewOfFile), so opening costs no
+ * copy and pages are read in on first touch. Web builds have no mapping
+ * of the virtual file system and read the file into an owned buffer; the
+ * API is the same.
+ *
+ * The view stays valid until close() or destruction. The file must not
+ * be truncated while mapped.
+ *
+ * Example:
+ *   MappedFile file;
+ *   if (file.open("scene.rsscene")) {
+ *       const auto* header = reinterpret_cast<const Header*>(file.getData());
+ *   }
+ *
+ * Platform Support: 100% shared API, buffered fallback on Web
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a file (closes any previous mapping)
+     * @param sequential Hint that the file is read front to back (read-ahead)
+     * @return false if the file cannot be opened or mapped
+     */
+    bool open(const std::string& path, bool sequential = true);
+
+    void close();
+
+    bool isOpen() const { return opened; }
+    const uint8_t* getData() const { return data; }
+    size_t getSize() const { return size; }
+
+private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    bool opened = false;
+    bool mapped = false;             // false = data points into buffer
+    std::vector<uint8_t> buffer;     // Fallback storage (Web, empty files)
+#if defined(_WIN32)
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+} // namespace rs_engine
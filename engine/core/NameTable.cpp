@@ -0,0 +1,90 @@
+#include "NameTable.h"
+
+namespace rs_engine {
+
+NameTable& NameTable::get() {
+    static NameTable instance;
+    return instance;
+}
+
+NameTable::NameTable() {
+    strings.emplace_back();  // INVALID_NAME_ID
+    refCounts.push_back(0);
+}
+
+NameId NameTable::acquire(std::string_view name) {
+    if (name.empty()) {
+        return INVALID_NAME_ID;
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = lookup.find(name);
+    if (it != lookup.end()) {
+        refCounts[it->second]++;
+        return it->second;
+    }
+    
+    // deque::emplace_back never relocates existing strings, so older views stay valid
+    NameId id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+        strings[id].assign(name.data(), name.size());
+    } else {
+        id = static_cast<NameId>(strings.size());
+        strings.emplace_back(name);
+        refCounts.push_back(0);
+    }
+    refCounts[id] = 1;
+    lookup.emplace(std::string_view(strings[id]), id);
+    return id;
+}
+
+void NameTable::addRef(NameId id) {
+    if (id == INVALID_NAME_ID) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    if (id < refCounts.size() && refCounts[id] > 0) {
+        refCounts[id]++;
+    }
+}
+
+void NameTable::release(NameId id) {
+    if (id == INVALID_NAME_ID) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    if (id >= refCounts.size() || refCounts[id] == 0 || --refCounts[id] > 0) {
+        return;
+    }
+    
+    // Last reference: drop the view before the string it points into
+    lookup.erase(std::string_view(strings[id]));
+    std::string().swap(strings[id]);
+    freeIds.push_back(id);
+}
+
+NameId NameTable::find(std::string_view name) const {
+    if (name.empty()) {
+        return INVALID_NAME_ID;
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = lookup.find(name);
+    return it != lookup.end() ? it->second : INVALID_NAME_ID;
+}
+
+const std::string& NameTable::getString(NameId id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return id < strings.size() ? strings[id] : strings[INVALID_NAME_ID];
+}
+
+size_t NameTable::getCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return lookup.size();
+}
+
+} // namespace rs_engine
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace rs_engine {
+
+/**
+ * @brief Interned string id (0 = no name)
+ */
+using NameId = uint32_t;
+constexpr NameId INVALID_NAME_ID = 0;
+
+/**
+ * @brief Process-wide, reference-counted string interning table
+ *
+ * Each distinct string is stored once and identified by a dense 32-bit
+ * id, so objects can carry a display name without owning a std::string
+ * and name comparisons become integer compares.
+ *
+ * Ids are reference counted: acquire() adds a reference, release() drops
+ * one, and the last release frees the string and recycles its id. Hold
+ * names through Name rather than calling these directly. Spawning and
+ * destroying named objects therefore keeps the table at the size of the
+ * names in use.
+ *
+ * All methods are thread-safe. A reference returned by getString() stays
+ * valid while the id is held.
+ *
+ * Platform Support: 100% shared
+ */
+class NameTable {
+public:
+    static NameTable& get();
+
+    /**
+     * @brief Id of a string with one more reference, adding it on first use
+     * @return INVALID_NAME_ID for the empty string (no reference taken)
+     */
+    NameId acquire(std::string_view name);
+
+    /**
+     * @brief One more reference to a held id (INVALID_NAME_ID is ignored)
+     */
+    void addRef(NameId id);
+
+    /**
+     * @brief Drop a reference; the last one frees the string and the id
+     */
+    void release(NameId id);
+
+    /**
+     * @brief Id of a string in use (INVALID_NAME_ID if unknown; never inserts)
+     */
+    NameId find(std::string_view name) const;
+
+    /**
+     * @brief String of an id (empty for INVALID_NAME_ID or unused ids)
+     */
+    const std::string& getString(NameId id) const;
+
+    /**
+     * @brief Number of distinct names in use
+     */
+    size_t getCount() const;
+
+private:
+    NameTable();
+
+    mutable std::mutex mutex;
+    std::deque<std::string> strings;                        // Index = id (0 = empty); never moves
+    std::vector<uint32_t> refCounts;                        // Parallel to strings (0 = free slot)
+    std::vector<NameId> freeIds;                            // Released ids, reused first
+    std::unordered_map<std::string_view, NameId> lookup;    // Views into strings
+};
+
+/**
+ * @brief Owning reference to an interned name (released on destruction)
+ *
+ * Copies share the id and add a reference; moves transfer it.
+ */
+class Name {
+public:
+    Name() = default;
+    explicit Name(std::string_view text) : id(NameTable::get().acquire(text)) {}
+    Name(const Name& other) : id(other.id) { NameTable::get().addRef(id); }
+    Name(Name&& other) noexcept : id(other.id) { other.id = INVALID_NAME_ID; }
+    ~Name() { NameTable::get().release(id); }
+
+    Name& operator=(Name other) noexcept {
+        std::swap(id, other.id);
+        return *this;
+    }
+
+    NameId getId() const { return id; }
+    bool isValid() const { return id != INVALID_NAME_ID; }
+    const std::string& getString() const { return NameTable::get().getString(id); }
+
+private:
+    NameId id = INVALID_NAME_ID;
+};
+
+} // namespace rs_engine
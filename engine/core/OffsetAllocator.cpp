@@ -0,0 +1,350 @@
+#include "OffsetAllocator.h"
+#include <algorithm>
+#include <cassert>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace rs_engine {
+
+namespace {
+
+constexpr uint32_t MANTISSA_BITS = 3;
+constexpr uint32_t MANTISSA_VALUE = 1u << MANTISSA_BITS;
+constexpr uint32_t MANTISSA_MASK = MANTISSA_VALUE - 1;
+
+// Callers guarantee value != 0
+inline uint32_t highestSetBit(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return 31u - static_cast<uint32_t>(__builtin_clz(value));
+#endif
+}
+
+inline uint32_t lowestSetBit(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+}
+
+/**
+ * @brief Index of the lowest set bit at or above startBit (NO_SPACE if none)
+ */
+inline uint32_t findLowestSetBitAfter(uint32_t bitMask, uint32_t startBit) {
+    if (startBit >= 32) {
+        return OffsetAllocator::NO_SPACE;
+    }
+    const uint32_t masked = bitMask & ~((1u << startBit) - 1u);
+    return masked == 0 ? OffsetAllocator::NO_SPACE : lowestSetBit(masked);
+}
+
+} // namespace
+
+// ========== Small Float Bins ==========
+
+uint32_t OffsetAllocator::sizeToBinRoundUp(uint32_t size) {
+    if (size < MANTISSA_VALUE) {
+        return size;   // Denormal: exact bins 0..7
+    }
+    const uint32_t mantissaStartBit = highestSetBit(size) - MANTISSA_BITS;
+    const uint32_t exponent = mantissaStartBit + 1;
+    uint32_t mantissa = (size >> mantissaStartBit) & MANTISSA_MASK;
+    if (size & ((1u << mantissaStartBit) - 1u)) {
+        mantissa++;   // A carry out of the mantissa bumps the exponent, as intended
+    }
+    return (exponent << MANTISSA_BITS) + mantissa;
+}
+
+uint32_t OffsetAllocator::sizeToBinRoundDown(uint32_t size) {
+    if (size < MANTISSA_VALUE) {
+        return size;
+    }
+    const uint32_t mantissaStartBit = highestSetBit(size) - MANTISSA_BITS;
+    const uint32_t exponent = mantissaStartBit + 1;
+    const uint32_t mantissa = (size >> mantissaStartBit) & MANTISSA_MASK;
+    return (exponent << MANTISSA_BITS) | mantissa;
+}
+
+uint32_t OffsetAllocator::binToSize(uint32_t bin) {
+    const uint32_t exponent = bin >> MANTISSA_BITS;
+    const uint32_t mantissa = bin & MANTISSA_MASK;
+    if (exponent == 0) {
+        return mantissa;
+    }
+    return (mantissa | MANTISSA_VALUE) << (exponent - 1);
+}
+
+// ========== OffsetAllocator ==========
+
+OffsetAllocator::OffsetAllocator(uint32_t size, uint32_t maxAllocations)
+    : size(size), maxAllocations(std::max<uint32_t>(maxAllocations, 2)) {
+    reset();
+}
+
+void OffsetAllocator::reset() {
+    freeStorage = 0;
+    allocationCount = 0;
+    usedBinsTop = 0;
+    std::fill(std::begin(usedBins), std::end(usedBins), static_cast<uint8_t>(0));
+    std::fill(std::begin(binIndices), std::end(binIndices), UNUSED);
+
+    nodes.assign(maxAllocations, Node());
+    freeNodes.resize(maxAllocations);
+    for (uint32_t i = 0; i < maxAllocations; ++i) {
+        freeNodes[i] = maxAllocations - i - 1;   // Pop order 0, 1, 2...
+    }
+
+    if (size > 0) {
+        insertNodeIntoBin(size, 0);
+    }
+}
+
+OffsetAllocator::Allocation OffsetAllocator::allocate(uint32_t allocationSize) {
+    // One node for the allocation, maybe one for the remainder
+    if (allocationSize == 0 || freeNodes.size() < 2) {
+        return {};
+    }
+
+    // Smallest bin whose every range is guaranteed to fit
+    const uint32_t minBin = sizeToBinRoundUp(allocationSize);
+    const uint32_t minTop = minBin >> MANTISSA_BITS;
+    const uint32_t minLeaf = minBin & MANTISSA_MASK;
+
+    uint32_t top = minTop;
+    uint32_t leaf = NO_SPACE;
+    if (usedBinsTop & (1u << top)) {
+        leaf = findLowestSetBitAfter(usedBins[top], minLeaf);
+    }
+    if (leaf == NO_SPACE) {
+        // Any leaf of a larger top bin fits
+        top = findLowestSetBitAfter(usedBinsTop, minTop + 1);
+        if (top == NO_SPACE) {
+            return {};
+        }
+        leaf = lowestSetBit(usedBins[top]);
+    }
+    const uint32_t bin = (top << MANTISSA_BITS) | leaf;
+
+    // Pop the head of the bin's free list
+    const uint32_t nodeIndex = binIndices[bin];
+    Node& node = nodes[nodeIndex];
+    const uint32_t nodeTotalSize = node.dataSize;
+    node.dataSize = allocationSize;
+    node.used = true;
+    binIndices[bin] = node.binListNext;
+    if (node.binListNext != UNUSED) {
+        nodes[node.binListNext].binListPrev = UNUSED;
+    }
+    node.binListNext = UNUSED;
+    freeStorage -= nodeTotalSize;
+    if (binIndices[bin] == UNUSED) {
+        usedBins[top] &= static_cast<uint8_t>(~(1u << leaf));
+        if (usedBins[top] == 0) {
+            usedBinsTop &= ~(1u << top);
+        }
+    }
+
+    // Return the remainder to the bins as a new free neighbor
+    const uint32_t remainder = nodeTotalSize - allocationSize;
+    if (remainder > 0) {
+        const uint32_t newNodeIndex = insertNodeIntoBin(remainder, node.dataOffset + allocationSize);
+        Node& remainderNode = nodes[newNodeIndex];
+        if (node.neighborNext != UNUSED) {
+            nodes[node.neighborNext].neighborPrev = newNodeIndex;
+        }
+        remainderNode.neighborPrev = nodeIndex;
+        remainderNode.neighborNext = node.neighborNext;
+        node.neighborNext = newNodeIndex;
+    }
+
+    allocationCount++;
+    Allocation allocation;
+    allocation.offset = node.dataOffset;
+    allocation.node = nodeIndex;
+    return allocation;
+}
+
+void OffsetAllocator::free(const Allocation& allocation) {
+    if (allocation.node == NO_SPACE || allocation.node >= nodes.size()) {
+        return;
+    }
+    Node& node = nodes[allocation.node];
+    assert(node.used && "OffsetAllocator: double free");
+    if (!node.used) {
+        return;
+    }
+
+    uint32_t offset = node.dataOffset;
+    uint32_t rangeSize = node.dataSize;
+
+    // Merge with free neighbors (they are unlinked from their bins)
+    if (node.neighborPrev != UNUSED && !nodes[node.neighborPrev].used) {
+        const uint32_t prevIndex = node.neighborPrev;
+        const Node& prev = nodes[prevIndex];
+        offset = prev.dataOffset;
+        rangeSize += prev.dataSize;
+        node.neighborPrev = prev.neighborPrev;
+        removeNodeFromBin(prevIndex);
+    }
+    if (node.neighborNext != UNUSED && !nodes[node.neighborNext].used) {
+        const uint32_t nextIndex = node.neighborNext;
+        const Node& next = nodes[nextIndex];
+        rangeSize += next.dataSize;
+        node.neighborNext = next.neighborNext;
+        removeNodeFromBin(nextIndex);
+    }
+
+    const uint32_t neighborPrev = node.neighborPrev;
+    const uint32_t neighborNext = node.neighborNext;
+
+    // The allocation's node is recycled; the merged range gets a fresh one
+    node = Node();
+    freeNodes.push_back(allocation.node);
+    allocationCount--;
+
+    const uint32_t combinedIndex = insertNodeIntoBin(rangeSize, offset);
+    if (neighborNext != UNUSED) {
+        nodes[combinedIndex].neighborNext = neighborNext;
+        nodes[neighborNext].neighborPrev = combinedIndex;
+    }
+    if (neighborPrev != UNUSED) {
+        nodes[combinedIndex].neighborPrev = neighborPrev;
+        nodes[neighborPrev].neighborNext = combinedIndex;
+    }
+}
+
+bool OffsetAllocator::allocatePacked(const uint32_t* sizes, size_t count, Allocation* outAllocations) {
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += sizes[i];
+    }
+    // One node per allocation plus the free tail
+    if (count > 0 && (total == 0 || total > size || count + 1 > maxAllocations)) {
+        return false;
+    }
+    reset();
+    if (count == 0) {
+        return true;
+    }
+
+    // Drop the whole-space free range; the allocations are linked directly as neighbors
+    removeNodeFromBin(binIndices[sizeToBinRoundDown(size)]);
+
+    uint32_t offset = 0;
+    uint32_t prevIndex = UNUSED;
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t nodeIndex = freeNodes.back();
+        freeNodes.pop_back();
+        Node& node = nodes[nodeIndex];
+        node.dataOffset = offset;
+        node.dataSize = sizes[i];
+        node.used = true;
+        node.neighborPrev = prevIndex;
+        if (prevIndex != UNUSED) {
+            nodes[prevIndex].neighborNext = nodeIndex;
+        }
+        outAllocations[i].offset = offset;
+        outAllocations[i].node = nodeIndex;
+        offset += sizes[i];
+        prevIndex = nodeIndex;
+    }
+    allocationCount = static_cast<uint32_t>(count);
+
+    if (offset < size) {
+        const uint32_t tailIndex = insertNodeIntoBin(size - offset, offset);
+        nodes[tailIndex].neighborPrev = prevIndex;
+        nodes[prevIndex].neighborNext = tailIndex;
+    }
+    return true;
+}
+
+uint32_t OffsetAllocator::getAllocationSize(const Allocation& allocation) const {
+    if (allocation.node == NO_SPACE || allocation.node >= nodes.size()) {
+        return 0;
+    }
+    return nodes[allocation.node].dataSize;
+}
+
+OffsetAllocator::StorageReport OffsetAllocator::getStorageReport() const {
+    StorageReport report;
+    if (freeNodes.empty()) {
+        return report;   // Out of nodes: nothing can be allocated
+    }
+    report.totalFree = freeStorage;
+    if (usedBinsTop != 0) {
+        const uint32_t top = highestSetBit(usedBinsTop);
+        const uint32_t leaf = highestSetBit(usedBins[top]);
+        report.largestFree = binToSize((top << MANTISSA_BITS) | leaf);
+    }
+    return report;
+}
+
+// ========== Bins ==========
+
+uint32_t OffsetAllocator::insertNodeIntoBin(uint32_t nodeSize, uint32_t dataOffset) {
+    // Round down: every range in a bin is at least the bin's size
+    const uint32_t bin = sizeToBinRoundDown(nodeSize);
+    const uint32_t top = bin >> MANTISSA_BITS;
+    const uint32_t leaf = bin & MANTISSA_MASK;
+    if (binIndices[bin] == UNUSED) {
+        usedBins[top] |= static_cast<uint8_t>(1u << leaf);
+        usedBinsTop |= 1u << top;
+    }
+
+    const uint32_t headIndex = binIndices[bin];
+    const uint32_t nodeIndex = freeNodes.back();
+    freeNodes.pop_back();
+
+    Node& node = nodes[nodeIndex];
+    node = Node();
+    node.dataOffset = dataOffset;
+    node.dataSize = nodeSize;
+    node.binListNext = headIndex;
+    if (headIndex != UNUSED) {
+        nodes[headIndex].binListPrev = nodeIndex;
+    }
+    binIndices[bin] = nodeIndex;
+
+    freeStorage += nodeSize;
+    return nodeIndex;
+}
+
+void OffsetAllocator::removeNodeFromBin(uint32_t nodeIndex) {
+    Node& node = nodes[nodeIndex];
+    if (node.binListPrev != UNUSED) {
+        // Inside the list: unlink
+        nodes[node.binListPrev].binListNext = node.binListNext;
+        if (node.binListNext != UNUSED) {
+            nodes[node.binListNext].binListPrev = node.binListPrev;
+        }
+    } else {
+        // Head of the list: advance the bin
+        const uint32_t bin = sizeToBinRoundDown(node.dataSize);
+        const uint32_t top = bin >> MANTISSA_BITS;
+        const uint32_t leaf = bin & MANTISSA_MASK;
+        binIndices[bin] = node.binListNext;
+        if (node.binListNext != UNUSED) {
+            nodes[node.binListNext].binListPrev = UNUSED;
+        }
+        if (binIndices[bin] == UNUSED) {
+            usedBins[top] &= static_cast<uint8_t>(~(1u << leaf));
+            if (usedBins[top] == 0) {
+                usedBinsTop &= ~(1u << top);
+            }
+        }
+    }
+
+    freeStorage -= node.dataSize;
+    node = Node();
+    freeNodes.push_back(nodeIndex);
+}
+
+} // namespace rs_engine
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rs_engine {
+
+/**
+ * @brief O(1) range allocator over an abstract [0, size) space
+ *
+ * Hands out offsets only; the caller owns the memory the offsets refer to
+ * (e.g. a GPU buffer). Units are whatever the caller counts in: vertices,
+ * 4-byte words, bytes.
+ *
+ * Free ranges are kept in 256 size bins (two-level segregated fit: 32
+ * power-of-two classes x 8 linear sub-bins each, i.e. a tiny float with a
+ * 3-bit mantissa). Two bitmasks find the smallest non-empty bin that is
+ * guaranteed to fit a request, so allocate() and free() do a constant
+ * amount of work. Freed ranges merge with free neighbors at once, so the
+ * space never holds two adjacent free ranges.
+ *
+ * Rounding the request up to a bin boundary wastes nothing (the node is
+ * split to the exact size); it only means a free range slightly larger
+ * than the request may be skipped if it sits in the request's own bin.
+ *
+ * Not thread-safe.
+ *
+ * Platform Support: 100% shared
+ */
+class OffsetAllocator {
+public:
+    static constexpr uint32_t NO_SPACE = 0xFFFFFFFFu;
+
+    struct Allocation {
+        uint32_t offset = NO_SPACE;
+        uint32_t node = NO_SPACE;   // Pass back to free()
+
+        bool isValid() const { return offset != NO_SPACE; }
+    };
+
+    struct StorageReport {
+        uint32_t totalFree = 0;
+        uint32_t largestFree = 0;   // Lower bound (largest free bin's minimum size)
+    };
+
+    /**
+     * @param size Units managed
+     * @param maxAllocations Live allocations plus free ranges that can exist at once
+     */
+    explicit OffsetAllocator(uint32_t size, uint32_t maxAllocations = 64 * 1024);
+
+    /**
+     * @brief Free everything (one free range covering the whole space)
+     */
+    void reset();
+
+    /**
+     * @return Allocation with offset NO_SPACE if no free range fits (or out of nodes)
+     */
+    Allocation allocate(uint32_t size);
+    void free(const Allocation& allocation);
+
+    /**
+     * @brief Reset, then place allocations of the given sizes back to back from offset 0
+     *
+     * For compaction: the sizes fit whenever their sum does, which the
+     * rounded bin search of allocate() does not guarantee for the last ones.
+     * @param outAllocations count entries, in the order of sizes
+     * @return false (allocator unchanged) if the sum or the count does not fit
+     */
+    bool allocatePacked(const uint32_t* sizes, size_t count, Allocation* outAllocations);
+
+    uint32_t getAllocationSize(const Allocation& allocation) const;
+    uint32_t getSize() const { return size; }
+    uint32_t getAllocationCount() const { return allocationCount; }
+    StorageReport getStorageReport() const;
+
+    // ========== Small Float Bins ==========
+
+    static uint32_t sizeToBinRoundUp(uint32_t size);
+    static uint32_t sizeToBinRoundDown(uint32_t size);
+    static uint32_t binToSize(uint32_t bin);
+
+private:
+    static constexpr uint32_t TOP_BINS = 32;
+    static constexpr uint32_t LEAF_BINS = 8;
+    static constexpr uint32_t BIN_COUNT = TOP_BINS * LEAF_BINS;
+    static constexpr uint32_t UNUSED = 0xFFFFFFFFu;
+
+    struct Node {
+        uint32_t dataOffset = 0;
+        uint32_t dataSize = 0;
+        uint32_t binListPrev = UNUSED;      // Free ranges of the same bin
+        uint32_t binListNext = UNUSED;
+        uint32_t neighborPrev = UNUSED;     // Adjacent ranges in address order
+        uint32_t neighborNext = UNUSED;
+        bool used = false;
+    };
+
+    uint32_t size;
+    uint32_t maxAllocations;
+    uint32_t freeStorage = 0;
+    uint32_t allocationCount = 0;
+
+    uint32_t usedBinsTop = 0;               // Bit per top bin: any leaf bin non-empty
+    uint8_t usedBins[TOP_BINS] = {};        // Bit per leaf bin: free list non-empty
+    uint32_t binIndices[BIN_COUNT] = {};    // Head of each bin's free list
+
+    std::vector<Node> nodes;
+    std::vector<uint32_t> freeNodes;        // Stack of unused node indices
+
+    uint32_t insertNodeIntoBin(uint32_t nodeSize, uint32_t dataOffset);
+    void removeNodeFromBin(uint32_t nodeIndex);
+};
+
+} // namespace rs_engine
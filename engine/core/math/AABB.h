@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Vec3.h"
+#include <algorithm>
+#include <limits>
+
+namespace rs_engine {
+
+/**
+ * @brief Axis-Aligned Bounding Box
+ *
+ * Used for:
+ * - Spatial index nodes (DynamicAABBTree)
+ * - Broad-phase culling and picking
+ *
+ * Platform Support: 100% shared
+ */
+struct AABB {
+    Vec3 min;
+    Vec3 max;
+
+    AABB() = default;
+    AABB(const Vec3& min, const Vec3& max) : min(min), max(max) {}
+
+    /**
+     * @brief Create an inverted (empty) box that any expand() will overwrite
+     */
+    static AABB empty() {
+        constexpr float maxFloat = std::numeric_limits<float>::max();
+        constexpr float minFloat = std::numeric_limits<float>::lowest();
+        return AABB(Vec3(maxFloat, maxFloat, maxFloat), Vec3(minFloat, minFloat, minFloat));
+    }
+
+    static AABB merge(const AABB& a, const AABB& b) {
+        return AABB(
+            Vec3(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z)),
+            Vec3(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z))
+        );
+    }
+
+    bool isValid() const {
+        return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+    }
+
+    Vec3 center() const { return (min + max) * 0.5f; }
+    Vec3 size() const { return max - min; }
+    Vec3 extents() const { return (max - min) * 0.5f; }
+
+    /**
+     * @brief Surface area (used as SAH cost metric)
+     */
+    float surfaceArea() const {
+        Vec3 d = max - min;
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+
+    void expand(const Vec3& point) {
+        min.x = std::min(min.x, point.x);
+        min.y = std::min(min.y, point.y);
+        min.z = std::min(min.z, point.z);
+        max.x = std::max(max.x, point.x);
+        max.y = std::max(max.y, point.y);
+        max.z = std::max(max.z, point.z);
+    }
+
+    void expand(const AABB& other) {
+        *this = merge(*this, other);
+    }
+
+    /**
+     * @brief Get a copy grown by margin on every side
+     */
+    AABB fattened(float margin) const {
+        Vec3 m(margin, margin, margin);
+        return AABB(min - m, max + m);
+    }
+
+    bool contains(const AABB& other) const {
+        return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+               other.max.x <= max.x && other.max.y <= max.y && other.max.z <= max.z;
+    }
+
+    bool contains(const Vec3& point) const {
+        return min.x <= point.x && point.x <= max.x &&
+               min.y <= point.y && point.y <= max.y &&
+               min.z <= point.z && point.z <= max.z;
+    }
+
+    bool overlaps(const AABB& other) const {
+        return min.x <= other.max.x && other.min.x <= max.x &&
+               min.y <= other.max.y && other.min.y <= max.y &&
+               min.z <= other.max.z && other.min.z <= max.z;
+    }
+
+    /**
+     * @brief Squared distance from point to the box (0 if inside)
+     */
+    float distanceSquared(const Vec3& point) const {
+        float dx = std::max(std::max(min.x - point.x, 0.0f), point.x - max.x);
+        float dy = std::max(std::max(min.y - point.y, 0.0f), point.y - max.y);
+        float dz = std::max(std::max(min.z - point.z, 0.0f), point.z - max.z);
+        return dx * dx + dy * dy + dz * dz;
+    }
+};
+
+} // namespace rs_engine
@@ -0,0 +1,204 @@
+#pragma once
+
+#include "Vec3.h"
+#include "Mat4.h"
+#include "AABB.h"
+#include <algorithm>
+#include <cmath>
+
+namespace rs_engine {
+
+/**
+ * @brief Plane in Hessian normal form: dot(normal, p) + d = 0
+ *
+ * Points with positive signed distance are on the "inside" half-space.
+ */
+struct Plane {
+    Vec3 normal = Vec3(0, 1, 0);
+    float d = 0.0f;
+
+    Plane() = default;
+    Plane(const Vec3& n, float dist) : normal(n), d(dist) {}
+
+    float signedDistance(const Vec3& point) const {
+        return normal.dot(point) + d;
+    }
+
+    Plane normalized() const {
+        float len = normal.length();
+        if (len <= 0.0f) return *this;
+        float invLen = 1.0f / len;
+        return Plane(normal * invLen, d * invLen);
+    }
+};
+
+/**
+ * @brief View frustum made of 6 inward-facing planes
+ *
+ * Built from a view-projection matrix using WebGPU clip space conventions
+ * (x, y in [-w, w], z in [0, w]).
+ *
+ * Platform Support: 100% shared
+ */
+class Frustum {
+public:
+    enum PlaneIndex { Left = 0, Right, Bottom, Top, Near, Far, Count };
+
+    /**
+     * @brief Result of a volume test
+     */
+    enum class Containment {
+        Outside,
+        Intersecting,
+        Inside
+    };
+
+    Plane planes[Count];
+
+    Frustum() = default;
+
+    /**
+     * @brief Extract planes from a (column-major) view-projection matrix
+     *
+     * Gribb/Hartmann plane extraction adapted to the [0, 1] depth range.
+     */
+    static Frustum fromViewProjection(const Mat4& m) {
+        auto row = [&m](int r) {
+            return Plane(Vec3(m(r, 0), m(r, 1), m(r, 2)), m(r, 3));
+        };
+        auto add = [](const Plane& a, const Plane& b) {
+            return Plane(a.normal + b.normal, a.d + b.d);
+        };
+        auto sub = [](const Plane& a, const Plane& b) {
+            return Plane(a.normal - b.normal, a.d - b.d);
+        };
+
+        Plane r0 = row(0), r1 = row(1), r2 = row(2), r3 = row(3);
+
+        Frustum f;
+        f.planes[Left]   = add(r3, r0).normalized();
+        f.planes[Right]  = sub(r3, r0).normalized();
+        f.planes[Bottom] = add(r3, r1).normalized();
+        f.planes[Top]    = sub(r3, r1).normalized();
+        f.planes[Near]   = r2.normalized();              // z >= 0 (WebGPU)
+        f.planes[Far]    = sub(r3, r2).normalized();
+        return f;
+    }
+
+    /**
+     * @brief Build the sub-frustum covering an NDC rectangle of the view
+     *
+     * Used for marquee selection: the rectangle is mapped to the full
+     * [-1, 1] clip range with a crop matrix before plane extraction.
+     */
+    static Frustum fromViewProjectionRect(const Mat4& viewProj,
+                                          float ndcMinX, float ndcMinY,
+                                          float ndcMaxX, float ndcMaxY) {
+        float width = std::max(ndcMaxX - ndcMinX, 1e-6f);
+        float height = std::max(ndcMaxY - ndcMinY, 1e-6f);
+
+        Mat4 crop;
+        crop(0, 0) = 2.0f / width;
+        crop(0, 3) = -(ndcMaxX + ndcMinX) / width;
+        crop(1, 1) = 2.0f / height;
+        crop(1, 3) = -(ndcMaxY + ndcMinY) / height;
+
+        return fromViewProjection(crop * viewProj);
+    }
+
+    /**
+     * @brief Express the frustum in another space
+     * @param m Matrix mapping the target space into the frustum's space
+     *          (e.g. an object's model matrix gives an object-space frustum)
+     *
+     * Planes are transformed by m^T and left unnormalized, which keeps
+     * all sign tests and classifyAABB() exact.
+     */
+    Frustum transformed(const Mat4& m) const {
+        Frustum f;
+        for (int i = 0; i < Count; ++i) {
+            const Plane& p = planes[i];
+            float n[4] = {p.normal.x, p.normal.y, p.normal.z, p.d};
+            float r[4];
+            for (int col = 0; col < 4; ++col) {
+                r[col] = m(0, col) * n[0] + m(1, col) * n[1] + m(2, col) * n[2] + m(3, col) * n[3];
+            }
+            f.planes[i] = Plane(Vec3(r[0], r[1], r[2]), r[3]);
+        }
+        return f;
+    }
+
+    /**
+     * @brief Fast AABB test (positive-vertex test only)
+     * @return false only if the box is definitely outside
+     */
+    bool intersectsAABB(const AABB& box) const {
+        for (int i = 0; i < Count; ++i) {
+            const Plane& p = planes[i];
+            // Corner of the box furthest along the plane normal
+            Vec3 positive(
+                p.normal.x >= 0.0f ? box.max.x : box.min.x,
+                p.normal.y >= 0.0f ? box.max.y : box.min.y,
+                p.normal.z >= 0.0f ? box.max.z : box.min.z
+            );
+            if (p.signedDistance(positive) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Classify an AABB as outside, intersecting or fully inside
+     *
+     * Fully-inside results let hierarchical queries accept whole subtrees
+     * without testing their children.
+     */
+    Containment classifyAABB(const AABB& box) const {
+        Vec3 center = box.center();
+        Vec3 extents = box.extents();
+        Containment result = Containment::Inside;
+
+        for (int i = 0; i < Count; ++i) {
+            const Plane& p = planes[i];
+            float distance = p.signedDistance(center);
+            float radius = extents.x * std::abs(p.normal.x) +
+                           extents.y * std::abs(p.normal.y) +
+                           extents.z * std::abs(p.normal.z);
+            if (distance < -radius) {
+                return Containment::Outside;
+            }
+            if (distance < radius) {
+                result = Containment::Intersecting;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Conservative triangle test
+     * @return false only if all three vertices are outside the same plane
+     */
+    bool intersectsTriangle(const Vec3& v0, const Vec3& v1, const Vec3& v2) const {
+        for (int i = 0; i < Count; ++i) {
+            const Plane& p = planes[i];
+            if (p.signedDistance(v0) < 0.0f &&
+                p.signedDistance(v1) < 0.0f &&
+                p.signedDistance(v2) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool containsPoint(const Vec3& point) const {
+        for (int i = 0; i < Count; ++i) {
+            if (planes[i].signedDistance(point) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace rs_engine
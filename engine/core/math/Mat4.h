@@ -267,7 +267,16 @@ struct Mat4 {
         }
         return Vec3(x, y, z);
     }
-    
+
+    // Transform direction (with w=0, ignores translation)
+    Vec3 transformDirection(const Vec3& dir) const {
+        return Vec3(
+            (*this)(0, 0) * dir.x + (*this)(0, 1) * dir.y + (*this)(0, 2) * dir.z,
+            (*this)(1, 0) * dir.x + (*this)(1, 1) * dir.y + (*this)(1, 2) * dir.z,
+            (*this)(2, 0) * dir.x + (*this)(2, 1) * dir.y + (*this)(2, 2) * dir.z
+        );
+    }
+
     // Matrix inverse (general 4x4 matrix inversion)
     Mat4 inverse() const {
         Mat4 inv;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Vec3.h"
+#include "AABB.h"
 #include <algorithm>
 #include <limits>
 
@@ -79,6 +80,10 @@ public:
 
         return true;
     }
+
+    bool intersectAABB(const AABB& box, float& tMin, float& tMax) const {
+        return intersectAABB(box.min, box.max, tMin, tMax);
+    }
     
     /**
      * @brief Test intersection with triangle using Möller-Trumbore algorithm
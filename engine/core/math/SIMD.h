@@ -0,0 +1,310 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Pick the 128-bit SIMD backend for the target
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define RS_SIMD_SSE2 1
+    #include <emmintrin.h>
+#elif defined(__wasm_simd128__)
+    #define RS_SIMD_WASM 1
+    #include <wasm_simd128.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define RS_SIMD_NEON 1
+    #include <arm_neon.h>
+#else
+    #define RS_SIMD_SCALAR 1
+#endif
+
+namespace rs_engine {
+namespace simd {
+
+/**
+ * @brief 4-wide float vector
+ *
+ * Thin wrapper over the native 128-bit register type:
+ * - Native x86-64: SSE2
+ * - Web: WebAssembly SIMD128 (requires -msimd128)
+ * - Native ARM64: NEON
+ * - Anything else: scalar fallback with the same semantics
+ *
+ * Comparisons return lane masks (all bits set / clear) that can be fed to
+ * select(), the bitwise operators and movemask().
+ *
+ * Platform Support: 100% shared
+ */
+struct Float4 {
+#if defined(RS_SIMD_SSE2)
+    __m128 v;
+    Float4() : v(_mm_setzero_ps()) {}
+    Float4(__m128 value) : v(value) {}
+    explicit Float4(float s) : v(_mm_set1_ps(s)) {}
+    Float4(float a, float b, float c, float d) : v(_mm_setr_ps(a, b, c, d)) {}
+    static Float4 load(const float* p) { return _mm_loadu_ps(p); }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+#elif defined(RS_SIMD_WASM)
+    v128_t v;
+    Float4() : v(wasm_f32x4_splat(0.0f)) {}
+    Float4(v128_t value) : v(value) {}
+    explicit Float4(float s) : v(wasm_f32x4_splat(s)) {}
+    Float4(float a, float b, float c, float d) : v(wasm_f32x4_make(a, b, c, d)) {}
+    static Float4 load(const float* p) { return wasm_v128_load(p); }
+    void store(float* p) const { wasm_v128_store(p, v); }
+#elif defined(RS_SIMD_NEON)
+    float32x4_t v;
+    Float4() : v(vdupq_n_f32(0.0f)) {}
+    Float4(float32x4_t value) : v(value) {}
+    explicit Float4(float s) : v(vdupq_n_f32(s)) {}
+    Float4(float a, float b, float c, float d) {
+        const float values[4] = {a, b, c, d};
+        v = vld1q_f32(values);
+    }
+    static Float4 load(const float* p) { return vld1q_f32(p); }
+    void store(float* p) const { vst1q_f32(p, v); }
+#else
+    float v[4];
+    Float4() : v{0.0f, 0.0f, 0.0f, 0.0f} {}
+    explicit Float4(float s) : v{s, s, s, s} {}
+    Float4(float a, float b, float c, float d) : v{a, b, c, d} {}
+    static Float4 load(const float* p) { return Float4(p[0], p[1], p[2], p[3]); }
+    void store(float* p) const { std::memcpy(p, v, sizeof(v)); }
+#endif
+
+    float lane(int i) const {
+        float values[4];
+        store(values);
+        return values[i];
+    }
+};
+
+#if defined(RS_SIMD_SCALAR)
+namespace detail {
+inline uint32_t bits(float f) { uint32_t u; std::memcpy(&u, &f, 4); return u; }
+inline float fromBits(uint32_t u) { float f; std::memcpy(&f, &u, 4); return f; }
+inline float maskOf(bool b) { return fromBits(b ? 0xFFFFFFFFu : 0u); }
+
+template<typename Op>
+inline Float4 map(const Float4& a, const Float4& b, Op op) {
+    return Float4(op(a.v[0], b.v[0]), op(a.v[1], b.v[1]), op(a.v[2], b.v[2]), op(a.v[3], b.v[3]));
+}
+} // namespace detail
+#endif
+
+// ========== Arithmetic ==========
+
+inline Float4 operator+(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_add_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_f32x4_add(a.v, b.v);
+#elif defined(RS_SIMD_NEON)
+    return vaddq_f32(a.v, b.v);
+#else
+    return detail::map(a, b, [](float x, float y) { return x + y; });
+#endif
+}
+
+inline Float4 operator-(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_sub_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_f32x4_sub(a.v, b.v);
+#elif defined(RS_SIMD_NEON)
+    return vsubq_f32(a.v, b.v);
+#else
+    return detail::map(a, b, [](float x, float y) { return x - y; });
+#endif
+}
+
+inline Float4 operator*(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_mul_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_f32x4_mul(a.v, b.v);
+#elif defined(RS_SIMD_NEON)
+    return vmulq_f32(a.v, b.v);
+#else
+    return detail::map(a, b, [](float x, float y) { return x * y; });
+#endif
+}
+
+inline Float4 operator/(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_div_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_f32x4_div(a.v, b.v);
+#elif defined(RS_SIMD_NEON)
+    return vdivq_f32(a.v, b.v);
+#else
+    return detail::map(a, b, [](float x, float y) { return x / y; });
+#endif
+}
+
+/**
+ * @brief Lane-wise minimum, returns b if either lane is NaN (SSE semantics)
+ */
+inline Float4 min(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_min_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_f32x4_pmin(b.v, a.v);
+#elif defined(RS_SIMD_NEON)
+    return vbslq_f32(vcltq_f32(a.v, b.v), a.v, b.v);
+#else
+    return detail::map(a, b, [](float x, float y) { return x < y ? x : y; });
+#endif
+}
+
+/**
+ * @brief Lane-wise maximum, returns b if either lane is NaN (SSE semantics)
+ */
+inline Float4 max(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_max_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_f32x4_pmax(b.v, a.v);
+#elif defined(RS_SIMD_NEON)
+    return vbslq_f32(vcgtq_f32(a.v, b.v), a.v, b.v);
+#else
+    return detail::map(a, b, [](float x, float y) { return x > y ? x : y; });
+#endif
+}
+
+// ========== Comparisons (return lane masks) ==========
+
+inline Float4 operator<(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_cmplt_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_f32x4_lt(a.v, b.v);
+#elif defined(RS_SIMD_NEON)
+    return vreinterpretq_f32_u32(vcltq_f32(a.v, b.v));
+#else
+    return detail::map(a, b, [](float x, float y) { return detail::maskOf(x < y); });
+#endif
+}
+
+inline Float4 operator<=(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_cmple_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_f32x4_le(a.v, b.v);
+#elif defined(RS_SIMD_NEON)
+    return vreinterpretq_f32_u32(vcleq_f32(a.v, b.v));
+#else
+    return detail::map(a, b, [](float x, float y) { return detail::maskOf(x <= y); });
+#endif
+}
+
+inline Float4 operator>(const Float4& a, const Float4& b) { return b < a; }
+inline Float4 operator>=(const Float4& a, const Float4& b) { return b <= a; }
+
+// ========== Bitwise / Masks ==========
+
+inline Float4 operator&(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_and_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_v128_and(a.v, b.v);
+#elif defined(RS_SIMD_NEON)
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)));
+#else
+    return detail::map(a, b, [](float x, float y) {
+        return detail::fromBits(detail::bits(x) & detail::bits(y));
+    });
+#endif
+}
+
+inline Float4 operator|(const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_or_ps(a.v, b.v);
+#elif defined(RS_SIMD_WASM)
+    return wasm_v128_or(a.v, b.v);
+#elif defined(RS_SIMD_NEON)
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)));
+#else
+    return detail::map(a, b, [](float x, float y) {
+        return detail::fromBits(detail::bits(x) | detail::bits(y));
+    });
+#endif
+}
+
+/**
+ * @brief Per lane: mask ? a : b
+ */
+inline Float4 select(const Float4& mask, const Float4& a, const Float4& b) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+#elif defined(RS_SIMD_WASM)
+    return wasm_v128_bitselect(a.v, b.v, mask.v);
+#elif defined(RS_SIMD_NEON)
+    return vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v);
+#else
+    Float4 r;
+    for (int i = 0; i < 4; ++i) {
+        r.v[i] = detail::bits(mask.v[i]) ? a.v[i] : b.v[i];
+    }
+    return r;
+#endif
+}
+
+/**
+ * @brief Pack the sign bit of each lane into the low 4 bits of an int
+ */
+inline int movemask(const Float4& mask) {
+#if defined(RS_SIMD_SSE2)
+    return _mm_movemask_ps(mask.v);
+#elif defined(RS_SIMD_WASM)
+    return static_cast<int>(wasm_i32x4_bitmask(mask.v));
+#elif defined(RS_SIMD_NEON)
+    static const int32_t shifts[4] = {0, 1, 2, 3};
+    uint32x4_t signBits = vshrq_n_u32(vreinterpretq_u32_f32(mask.v), 31);
+    return static_cast<int>(vaddvq_u32(vshlq_u32(signBits, vld1q_s32(shifts))));
+#else
+    int result = 0;
+    for (int i = 0; i < 4; ++i) {
+        result |= (detail::bits(mask.v[i]) >> 31) << i;
+    }
+    return result;
+#endif
+}
+
+/**
+ * @brief Lane mask from the low 4 bits of an int
+ */
+inline Float4 maskFromBits(int bits) {
+    auto lane = [bits](int i) {
+        uint32_t u = (bits >> i) & 1 ? 0xFFFFFFFFu : 0u;
+        float f;
+        std::memcpy(&f, &u, 4);
+        return f;
+    };
+    return Float4(lane(0), lane(1), lane(2), lane(3));
+}
+
+inline Float4 abs(const Float4& a) {
+    return max(a, Float4(0.0f) - a);
+}
+
+inline Float4 madd(const Float4& a, const Float4& b, const Float4& c) {
+    return a * b + c;
+}
+
+/**
+ * @brief Name of the compiled-in backend (for logs and benchmarks)
+ */
+inline const char* backendName() {
+#if defined(RS_SIMD_SSE2)
+    return "SSE2";
+#elif defined(RS_SIMD_WASM)
+    return "WASM SIMD128";
+#elif defined(RS_SIMD_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+} // namespace simd
+} // namespace rs_engine
@@ -4,7 +4,9 @@
 #include "../systems/input/CameraController.h"
 #include <imgui.h>
 #include <imgui_internal.h>  // Required for DockBuilder API
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
@@ -421,6 +423,49 @@ void ImGuiManager::showPerformanceMetrics() {
 
     ImGui::PlotLines("Frame Time (ms)", frameTimeHistory, 100, frameTimeIndex, nullptr, 0.0f, 50.0f, ImVec2(0, 80));
 
+    // Level of detail
+    rendering::Scene* scene = m_renderSystem ? m_renderSystem->getScene() : nullptr;
+    if (scene && ImGui::CollapsingHeader("Level of Detail", ImGuiTreeNodeFlags_DefaultOpen)) {
+        bool lodEnabled = scene->isLODEnabled();
+        if (ImGui::Checkbox("Enable LOD", &lodEnabled)) {
+            scene->setLODEnabled(lodEnabled);
+        }
+        float lodBias = scene->getLODBias();
+        if (ImGui::SliderFloat("LOD Bias", &lodBias, 0.25f, 4.0f, "%.2f")) {
+            scene->setLODBias(lodBias);
+        }
+
+        const auto& stats = scene->getLODStats();
+        ImGui::Text("Objects: %zu (%zu draw calls, %zu buffer binds)", stats.objectsDrawn, stats.drawCalls,
+                    stats.bufferBinds);
+        ImGui::Text("Triangles: %zu / %zu (saved %zu)",
+                    stats.trianglesDrawn, stats.trianglesFullDetail, stats.getTrianglesSaved());
+        for (uint32_t lod = 0; lod < rendering::LODStats::MAX_TRACKED_LODS; ++lod) {
+            if (stats.objectsPerLOD[lod] > 0) {
+                ImGui::Text("  LOD %u: %zu objects", lod, stats.objectsPerLOD[lod]);
+            }
+        }
+    }
+
+    if (scene && ImGui::CollapsingHeader("Occlusion Culling", ImGuiTreeNodeFlags_DefaultOpen)) {
+        bool occlusionEnabled = scene->isOcclusionCullingEnabled();
+        if (ImGui::Checkbox("Enable Occlusion Culling", &occlusionEnabled)) {
+            scene->setOcclusionCullingEnabled(occlusionEnabled);
+        }
+
+        const auto& stats = scene->getOcclusionStats();
+        ImGui::Text("Occluders: %zu (%zu / %zu triangles rasterized)",
+                    stats.occluders, stats.trianglesRasterized, stats.occluderTriangles);
+        ImGui::Text("Culled: %zu / %zu objects", stats.objectsOccluded, stats.objectsTested);
+        ImGui::Text("Rasterize: %.3f ms, Test: %.3f ms", stats.rasterizeMs, stats.testMs);
+    }
+
+    if (scene && ImGui::CollapsingHeader("GPU Uploads", ImGuiTreeNodeFlags_DefaultOpen)) {
+        const auto& stats = scene->getUploadStats();
+        ImGui::Text("Dirty objects: %zu", stats.dirtyObjects);
+        ImGui::Text("WriteBuffer calls: %zu (%zu bytes)", stats.writeCalls, stats.bytesUploaded);
+    }
+
     ImGui::End();
 }
 
@@ -754,7 +799,6 @@ void ImGuiManager::showHierarchy() {
     
     // Get all scene objects
     const auto& allObjects = scene->getAllObjects();
-    rendering::SceneObject* selectedObject = scene->getSelectedObject();
 
     // Scene tree structure
     if (ImGui::TreeNodeEx("Scene", ImGuiTreeNodeFlags_DefaultOpen)) {
@@ -782,11 +826,19 @@ void ImGuiManager::showHierarchy() {
         if (!allObjects.empty()) {
             ImGui::Separator();
             
-            for (const auto& [name, objectPtr] : allObjects) {
+            // Deleting reorders the object list: defer it until the loop is done
+            rendering::ObjectHandle pendingDelete;
+            
+            for (rendering::SceneObject* objectPtr : allObjects) {
                 if (!objectPtr) continue;
                 
+                // Unnamed (runtime-spawned) objects are shown by pool slot
+                std::string name = objectPtr->hasName()
+                    ? objectPtr->getName()
+                    : "Object #" + std::to_string(objectPtr->getHandle().getIndex());
+                
                 // Check if this object is selected
-                bool isSelected = (selectedObject == objectPtr.get());
+                bool isSelected = scene->isObjectSelected(objectPtr);
                 
                 // Node flags
                 ImGuiTreeNodeFlags nodeFlags = ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
@@ -806,9 +858,17 @@ void ImGuiManager::showHierarchy() {
                     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.5f, 0.5f, 1.0f));
                 }
                 
-                if (ImGui::TreeNodeEx(objectPtr.get(), nodeFlags, "%s", label.c_str())) {
+                if (ImGui::TreeNodeEx(objectPtr, nodeFlags, "%s", label.c_str())) {
                     if (ImGui::IsItemClicked()) {
-                        scene->setSelectedObject(objectPtr.get());
+                        // Ctrl-click toggles, Shift-click adds, plain click replaces
+                        const ImGuiIO& io = ImGui::GetIO();
+                        if (io.KeyCtrl) {
+                            scene->selectObject(objectPtr, rendering::SelectionMode::Toggle);
+                        } else if (io.KeyShift) {
+                            scene->selectObject(objectPtr, rendering::SelectionMode::Add);
+                        } else {
+                            scene->setSelectedObject(objectPtr);
+                        }
                         m_selectedObjectType = SelectedObjectType::None;
                     }
                 }
@@ -828,21 +888,23 @@ void ImGuiManager::showHierarchy() {
                     }
                     
                     if (ImGui::MenuItem("Focus")) {
-                        scene->setSelectedObject(objectPtr.get());
+                        scene->setSelectedObject(objectPtr);
                     }
                     
                     ImGui::Separator();
                     
                     if (ImGui::MenuItem("Delete", "Del")) {
-                        scene->removeObject(name);
-                        if (isSelected) {
-                            scene->clearSelection();
-                        }
+                        // destroyObject() also drops the object from the selection
+                        pendingDelete = objectPtr->getHandle();
                     }
                     
                     ImGui::EndPopup();
                 }
             }
+            
+            if (pendingDelete.isValid()) {
+                scene->destroyObject(pendingDelete);
+            }
         } else {
             ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.0f, 1.0f), "No objects in scene");
             ImGui::TextWrapped("Create objects using scene->createObject()");
@@ -869,6 +931,11 @@ void ImGuiManager::showInspector() {
     // Display selected scene object if available
     if (selectedObject) {
         ImGui::TextColored(ImVec4(0.2f, 0.8f, 0.2f, 1.0f), "Selected: %s", selectedObject->getName().c_str());
+        size_t selectionCount = m_renderSystem->getScene()->getSelectionCount();
+        if (selectionCount > 1) {
+            ImGui::SameLine();
+            ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), "(+%zu more)", selectionCount - 1);
+        }
         ImGui::Separator();
         
         // Transform Component
@@ -929,6 +996,11 @@ void ImGuiManager::showInspector() {
                 selectedObject->setVisible(visible);
             }
             
+            bool animated = selectedObject->isAnimated();
+            if (ImGui::Checkbox("Animated", &animated)) {
+                selectedObject->setAnimated(animated);
+            }
+            
             float animTime = selectedObject->getAnimationTime();
             if (ImGui::SliderFloat("Animation Time", &animTime, 0.0f, 10.0f)) {
                 selectedObject->setAnimationTime(animTime);
@@ -1471,6 +1543,34 @@ void ImGuiManager::showSceneViewport() {
         if (m_sceneTextureID) {
             // Use ImGui::Image to display the WebGPU texture (fills entire window)
             ImGui::Image(m_sceneTextureID, displaySize);
+
+            // Marquee / lasso overlay while a selection drag is in progress
+            InputSystem* inputSystem = m_renderSystem ? m_renderSystem->getInputSystem() : nullptr;
+            if (inputSystem && inputSystem->isSelectionDragActive()) {
+                ImDrawList* drawList = ImGui::GetWindowDrawList();
+                const ImU32 fillColor = IM_COL32(80, 150, 255, 40);
+                const ImU32 lineColor = IM_COL32(80, 150, 255, 220);
+
+                if (inputSystem->isLassoSelection()) {
+                    const auto& points = inputSystem->getLassoPoints();
+                    std::vector<ImVec2> polyline;
+                    polyline.reserve(points.size());
+                    for (const auto& [x, y] : points) {
+                        polyline.emplace_back(x, y);
+                    }
+                    if (polyline.size() >= 2) {
+                        drawList->AddPolyline(polyline.data(), static_cast<int>(polyline.size()),
+                                              lineColor, ImDrawFlags_Closed, 1.5f);
+                    }
+                } else {
+                    float x0, y0, x1, y1;
+                    inputSystem->getSelectionDragRect(x0, y0, x1, y1);
+                    ImVec2 rectMin(std::min(x0, x1), std::min(y0, y1));
+                    ImVec2 rectMax(std::max(x0, x1), std::max(y0, y1));
+                    drawList->AddRectFilled(rectMin, rectMax, fillColor);
+                    drawList->AddRect(rectMin, rectMax, lineColor, 0.0f, 0, 1.5f);
+                }
+            }
         } else {
             // Fallback if texture ID creation failed
             ImDrawList* draw_list = ImGui::GetWindowDrawList();
@@ -0,0 +1,329 @@
+#include "DynamicAABBTree.h"
+#include <algorithm>
+#include <cassert>
+
+namespace rs_engine {
+namespace rendering {
+
+DynamicAABBTree::DynamicAABBTree(float fatMargin)
+    : fatMargin(fatMargin) {
+}
+
+// ========== Node Pool ==========
+
+int32_t DynamicAABBTree::allocateNode() {
+    if (freeList == NULL_NODE) {
+        nodes.emplace_back();
+        return static_cast<int32_t>(nodes.size() - 1);
+    }
+
+    int32_t nodeId = freeList;
+    freeList = nodes[nodeId].parent;
+    nodes[nodeId] = Node();
+    return nodeId;
+}
+
+void DynamicAABBTree::freeNode(int32_t nodeId) {
+    nodes[nodeId].parent = freeList;
+    nodes[nodeId].height = -1;
+    nodes[nodeId].userData = nullptr;
+    freeList = nodeId;
+}
+
+// ========== Proxy Management ==========
+
+int32_t DynamicAABBTree::createProxy(const AABB& aabb, void* userData) {
+    int32_t proxyId = allocateNode();
+    Node& node = nodes[proxyId];
+    node.aabb = aabb.fattened(fatMargin);
+    node.userData = userData;
+    node.height = 0;
+
+    insertLeaf(proxyId);
+    ++proxyCount;
+    return proxyId;
+}
+
+void DynamicAABBTree::destroyProxy(int32_t proxyId) {
+    assert(proxyId >= 0 && proxyId < static_cast<int32_t>(nodes.size()));
+    assert(nodes[proxyId].isLeaf());
+
+    removeLeaf(proxyId);
+    freeNode(proxyId);
+    --proxyCount;
+}
+
+bool DynamicAABBTree::moveProxy(int32_t proxyId, const AABB& aabb) {
+    assert(proxyId >= 0 && proxyId < static_cast<int32_t>(nodes.size()));
+    assert(nodes[proxyId].isLeaf());
+
+    // Still inside the fat box - nothing to do
+    if (nodes[proxyId].aabb.contains(aabb)) {
+        return false;
+    }
+
+    removeLeaf(proxyId);
+    nodes[proxyId].aabb = aabb.fattened(fatMargin);
+    insertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAABBTree::clear() {
+    nodes.clear();
+    root = NULL_NODE;
+    freeList = NULL_NODE;
+    proxyCount = 0;
+}
+
+// ========== Tree Structure ==========
+
+void DynamicAABBTree::insertLeaf(int32_t leaf) {
+    if (root == NULL_NODE) {
+        root = leaf;
+        nodes[root].parent = NULL_NODE;
+        return;
+    }
+
+    // Descend towards the sibling with the lowest SAH cost
+    const AABB leafAABB = nodes[leaf].aabb;
+    int32_t index = root;
+    while (!nodes[index].isLeaf()) {
+        const Node& node = nodes[index];
+        int32_t child1 = node.child1;
+        int32_t child2 = node.child2;
+
+        float area = node.aabb.surfaceArea();
+        float combinedArea = AABB::merge(node.aabb, leafAABB).surfaceArea();
+
+        // Cost of creating a new parent for this node and the new leaf
+        float cost = 2.0f * combinedArea;
+
+        // Minimum cost of pushing the leaf further down the tree
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](int32_t child) {
+            const AABB& childAABB = nodes[child].aabb;
+            float mergedArea = AABB::merge(leafAABB, childAABB).surfaceArea();
+            if (nodes[child].isLeaf()) {
+                return mergedArea + inheritanceCost;
+            }
+            return (mergedArea - childAABB.surfaceArea()) + inheritanceCost;
+        };
+
+        float cost1 = descendCost(child1);
+        float cost2 = descendCost(child2);
+
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    int32_t sibling = index;
+
+    // Create a new parent for sibling + leaf
+    int32_t oldParent = nodes[sibling].parent;
+    int32_t newParent = allocateNode();
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].aabb = AABB::merge(leafAABB, nodes[sibling].aabb);
+    nodes[newParent].height = nodes[sibling].height + 1;
+    nodes[newParent].child1 = sibling;
+    nodes[newParent].child2 = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    if (oldParent != NULL_NODE) {
+        if (nodes[oldParent].child1 == sibling) {
+            nodes[oldParent].child1 = newParent;
+        } else {
+            nodes[oldParent].child2 = newParent;
+        }
+    } else {
+        root = newParent;
+    }
+
+    refitAncestors(nodes[leaf].parent);
+}
+
+void DynamicAABBTree::removeLeaf(int32_t leaf) {
+    if (leaf == root) {
+        root = NULL_NODE;
+        return;
+    }
+
+    int32_t parent = nodes[leaf].parent;
+    int32_t grandParent = nodes[parent].parent;
+    int32_t sibling = (nodes[parent].child1 == leaf) ? nodes[parent].child2 : nodes[parent].child1;
+
+    if (grandParent != NULL_NODE) {
+        // Replace parent with sibling
+        if (nodes[grandParent].child1 == parent) {
+            nodes[grandParent].child1 = sibling;
+        } else {
+            nodes[grandParent].child2 = sibling;
+        }
+        nodes[sibling].parent = grandParent;
+        freeNode(parent);
+
+        refitAncestors(grandParent);
+    } else {
+        root = sibling;
+        nodes[sibling].parent = NULL_NODE;
+        freeNode(parent);
+    }
+}
+
+void DynamicAABBTree::refitAncestors(int32_t index) {
+    while (index != NULL_NODE) {
+        index = balance(index);
+
+        Node& node = nodes[index];
+        const Node& child1 = nodes[node.child1];
+        const Node& child2 = nodes[node.child2];
+
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.aabb = AABB::merge(child1.aabb, child2.aabb);
+
+        index = node.parent;
+    }
+}
+
+int32_t DynamicAABBTree::balance(int32_t iA) {
+    Node* A = &nodes[iA];
+    if (A->isLeaf() || A->height < 2) {
+        return iA;
+    }
+
+    int32_t iB = A->child1;
+    int32_t iC = A->child2;
+    Node* B = &nodes[iB];
+    Node* C = &nodes[iC];
+
+    int32_t balanceFactor = C->height - B->height;
+
+    // Rotate C up
+    if (balanceFactor > 1) {
+        int32_t iF = C->child1;
+        int32_t iG = C->child2;
+        Node* F = &nodes[iF];
+        Node* G = &nodes[iG];
+
+        // Swap A and C
+        C->child1 = iA;
+        C->parent = A->parent;
+        A->parent = iC;
+
+        // A's old parent should point to C
+        if (C->parent != NULL_NODE) {
+            if (nodes[C->parent].child1 == iA) {
+                nodes[C->parent].child1 = iC;
+            } else {
+                nodes[C->parent].child2 = iC;
+            }
+        } else {
+            root = iC;
+        }
+
+        // Rotate
+        if (F->height > G->height) {
+            C->child2 = iF;
+            A->child2 = iG;
+            G->parent = iA;
+            A->aabb = AABB::merge(B->aabb, G->aabb);
+            C->aabb = AABB::merge(A->aabb, F->aabb);
+            A->height = 1 + std::max(B->height, G->height);
+            C->height = 1 + std::max(A->height, F->height);
+        } else {
+            C->child2 = iG;
+            A->child2 = iF;
+            F->parent = iA;
+            A->aabb = AABB::merge(B->aabb, F->aabb);
+            C->aabb = AABB::merge(A->aabb, G->aabb);
+            A->height = 1 + std::max(B->height, F->height);
+            C->height = 1 + std::max(A->height, G->height);
+        }
+
+        return iC;
+    }
+
+    // Rotate B up
+    if (balanceFactor < -1) {
+        int32_t iD = B->child1;
+        int32_t iE = B->child2;
+        Node* D = &nodes[iD];
+        Node* E = &nodes[iE];
+
+        // Swap A and B
+        B->child1 = iA;
+        B->parent = A->parent;
+        A->parent = iB;
+
+        // A's old parent should point to B
+        if (B->parent != NULL_NODE) {
+            if (nodes[B->parent].child1 == iA) {
+                nodes[B->parent].child1 = iB;
+            } else {
+                nodes[B->parent].child2 = iB;
+            }
+        } else {
+            root = iB;
+        }
+
+        // Rotate
+        if (D->height > E->height) {
+            B->child2 = iD;
+            A->child1 = iE;
+            E->parent = iA;
+            A->aabb = AABB::merge(C->aabb, E->aabb);
+            B->aabb = AABB::merge(A->aabb, D->aabb);
+            A->height = 1 + std::max(C->height, E->height);
+            B->height = 1 + std::max(A->height, D->height);
+        } else {
+            B->child2 = iE;
+            A->child1 = iD;
+            D->parent = iA;
+            A->aabb = AABB::merge(C->aabb, D->aabb);
+            B->aabb = AABB::merge(A->aabb, E->aabb);
+            A->height = 1 + std::max(C->height, D->height);
+            B->height = 1 + std::max(A->height, E->height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+// ========== Validation ==========
+
+int32_t DynamicAABBTree::validateStructure(int32_t index) const {
+    const Node& node = nodes[index];
+    if (node.isLeaf()) {
+        return node.height == 0 ? 1 : -1;
+    }
+
+    const Node& child1 = nodes[node.child1];
+    const Node& child2 = nodes[node.child2];
+    if (child1.parent != index || child2.parent != index) return -1;
+    if (node.height != 1 + std::max(child1.height, child2.height)) return -1;
+    if (!node.aabb.contains(child1.aabb) || !node.aabb.contains(child2.aabb)) return -1;
+
+    int32_t leaves1 = validateStructure(node.child1);
+    int32_t leaves2 = validateStructure(node.child2);
+    if (leaves1 < 0 || leaves2 < 0) return -1;
+    return leaves1 + leaves2;
+}
+
+bool DynamicAABBTree::validate() const {
+    if (root == NULL_NODE) {
+        return proxyCount == 0;
+    }
+    if (nodes[root].parent != NULL_NODE) {
+        return false;
+    }
+    return validateStructure(root) == proxyCount;
+}
+
+} // namespace rendering
+} // namespace rs_engine
@@ -0,0 +1,334 @@
+#pragma once
+
+#include "../../core/math/AABB.h"
+#include "../../core/math/Frustum.h"
+#include "../../core/math/Ray.h"
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <vector>
+
+namespace rs_engine {
+namespace rendering {
+
+/**
+ * @brief Incremental bounding volume hierarchy for dynamic objects
+ *
+ * Each proxy (leaf) stores a "fattened" AABB that is larger than the tight
+ * object bounds. Moving an object only touches the tree when its tight
+ * bounds leave the fat box, so small per-frame motion costs nothing.
+ * Internal nodes are kept balanced with AVL-style tree rotations.
+ *
+ * Query complexity is O(log n) for localized queries
+ * (ray, frustum, AABB overlap, nearest neighbour).
+ *
+ * Platform Support: 100% shared
+ */
+class DynamicAABBTree {
+public:
+    static constexpr int32_t NULL_NODE = -1;
+
+    explicit DynamicAABBTree(float fatMargin = 0.1f);
+
+    // ========== Proxy Management ==========
+
+    /**
+     * @brief Insert a new proxy
+     * @param aabb Tight bounds of the object
+     * @param userData Opaque pointer returned by queries
+     * @return Proxy id
+     */
+    int32_t createProxy(const AABB& aabb, void* userData);
+
+    /**
+     * @brief Remove a proxy from the tree
+     */
+    void destroyProxy(int32_t proxyId);
+
+    /**
+     * @brief Update a proxy's bounds
+     * @return true if the tree was restructured (tight box left the fat box)
+     */
+    bool moveProxy(int32_t proxyId, const AABB& aabb);
+
+    /**
+     * @brief Remove all proxies
+     */
+    void clear();
+
+    void* getUserData(int32_t proxyId) const { return nodes[proxyId].userData; }
+    const AABB& getFatAABB(int32_t proxyId) const { return nodes[proxyId].aabb; }
+
+    // ========== Statistics ==========
+
+    int32_t getProxyCount() const { return proxyCount; }
+    int32_t getHeight() const { return root == NULL_NODE ? 0 : nodes[root].height; }
+    float getFatMargin() const { return fatMargin; }
+
+    /**
+     * @brief Verify structure and bounds invariants (debug only)
+     */
+    bool validate() const;
+
+    // ========== Queries ==========
+
+    /**
+     * @brief Visit all proxies whose fat AABB overlaps the box
+     * @param callback bool(int32_t proxyId) - return false to stop
+     */
+    template<typename Callback>
+    void query(const AABB& aabb, Callback&& callback) const;
+
+    /**
+     * @brief Visit all proxies whose fat AABB intersects the frustum
+     *
+     * Subtrees entirely inside the frustum are accepted without testing children.
+     * @param callback bool(int32_t proxyId) - return false to stop
+     */
+    template<typename Callback>
+    void query(const Frustum& frustum, Callback&& callback) const;
+
+    /**
+     * @brief Cast a ray against the fat AABBs, nearest nodes first
+     * @param callback float(int32_t proxyId, float maxDistance) - return the new
+     *        max distance (the same value to continue, smaller to clip, 0 to stop)
+     */
+    template<typename Callback>
+    void raycast(const Ray& ray, float maxDistance, Callback&& callback) const;
+
+    /**
+     * @brief Best-first nearest neighbour search
+     * @param callback float(int32_t proxyId) - return the exact squared distance
+     *        of the object, or infinity to reject it
+     * @param outDistanceSq Output: squared distance of the result
+     * @return Nearest proxy id or NULL_NODE
+     */
+    template<typename Callback>
+    int32_t nearest(const Vec3& point, float maxDistance, Callback&& callback,
+                    float* outDistanceSq = nullptr) const;
+
+private:
+    struct Node {
+        AABB aabb;                  // Fat AABB for leaves, union for internal nodes
+        void* userData = nullptr;
+        int32_t parent = NULL_NODE; // Doubles as "next" in the free list
+        int32_t child1 = NULL_NODE;
+        int32_t child2 = NULL_NODE;
+        int32_t height = -1;        // Leaf = 0, free node = -1
+
+        bool isLeaf() const { return child1 == NULL_NODE; }
+    };
+
+    /**
+     * @brief Small fixed-capacity stack that spills to the heap
+     */
+    class NodeStack {
+    public:
+        void push(int32_t value) {
+            if (count < INLINE_CAPACITY) {
+                inlineData[count] = value;
+            } else {
+                overflow.push_back(value);
+            }
+            ++count;
+        }
+
+        int32_t pop() {
+            --count;
+            if (count < INLINE_CAPACITY) {
+                return inlineData[count];
+            }
+            int32_t value = overflow.back();
+            overflow.pop_back();
+            return value;
+        }
+
+        bool empty() const { return count == 0; }
+
+    private:
+        static constexpr int INLINE_CAPACITY = 128;
+        int32_t inlineData[INLINE_CAPACITY];
+        std::vector<int32_t> overflow;
+        int count = 0;
+    };
+
+    std::vector<Node> nodes;
+    int32_t root = NULL_NODE;
+    int32_t freeList = NULL_NODE;
+    int32_t proxyCount = 0;
+    float fatMargin;
+
+    int32_t allocateNode();
+    void freeNode(int32_t nodeId);
+
+    void insertLeaf(int32_t leaf);
+    void removeLeaf(int32_t leaf);
+    void refitAncestors(int32_t index);
+    int32_t balance(int32_t index);
+
+    template<typename Callback>
+    bool visitLeaves(int32_t index, Callback& callback) const;
+
+    int32_t validateStructure(int32_t index) const;
+};
+
+// ========== Query Implementations ==========
+
+template<typename Callback>
+void DynamicAABBTree::query(const AABB& aabb, Callback&& callback) const {
+    if (root == NULL_NODE) return;
+
+    NodeStack stack;
+    stack.push(root);
+
+    while (!stack.empty()) {
+        int32_t index = stack.pop();
+        const Node& node = nodes[index];
+        if (!node.aabb.overlaps(aabb)) continue;
+
+        if (node.isLeaf()) {
+            if (!callback(index)) return;
+        } else {
+            stack.push(node.child1);
+            stack.push(node.child2);
+        }
+    }
+}
+
+template<typename Callback>
+bool DynamicAABBTree::visitLeaves(int32_t index, Callback& callback) const {
+    NodeStack stack;
+    stack.push(index);
+
+    while (!stack.empty()) {
+        const Node& node = nodes[stack.pop()];
+        if (node.isLeaf()) {
+            if (!callback(static_cast<int32_t>(&node - nodes.data()))) return false;
+        } else {
+            stack.push(node.child1);
+            stack.push(node.child2);
+        }
+    }
+    return true;
+}
+
+template<typename Callback>
+void DynamicAABBTree::query(const Frustum& frustum, Callback&& callback) const {
+    if (root == NULL_NODE) return;
+
+    NodeStack stack;
+    stack.push(root);
+
+    while (!stack.empty()) {
+        int32_t index = stack.pop();
+        const Node& node = nodes[index];
+
+        Frustum::Containment containment = frustum.classifyAABB(node.aabb);
+        if (containment == Frustum::Containment::Outside) continue;
+
+        if (node.isLeaf()) {
+            if (!callback(index)) return;
+        } else if (containment == Frustum::Containment::Inside) {
+            // Whole subtree is visible - no further plane tests needed
+            if (!visitLeaves(index, callback)) return;
+        } else {
+            stack.push(node.child1);
+            stack.push(node.child2);
+        }
+    }
+}
+
+template<typename Callback>
+void DynamicAABBTree::raycast(const Ray& ray, float maxDistance, Callback&& callback) const {
+    if (root == NULL_NODE) return;
+
+    float tMin, tMax;
+    if (!ray.intersectAABB(nodes[root].aabb.min, nodes[root].aabb.max, tMin, tMax) ||
+        tMax < 0.0f || tMin > maxDistance) {
+        return;
+    }
+
+    NodeStack stack;
+    stack.push(root);
+
+    while (!stack.empty()) {
+        int32_t index = stack.pop();
+        const Node& node = nodes[index];
+
+        if (node.isLeaf()) {
+            // Re-check against the (possibly clipped) max distance
+            if (!ray.intersectAABB(node.aabb.min, node.aabb.max, tMin, tMax) ||
+                tMin > maxDistance) {
+                continue;
+            }
+            maxDistance = callback(index, maxDistance);
+            if (maxDistance <= 0.0f) return;
+            continue;
+        }
+
+        float t1Min, t1Max, t2Min, t2Max;
+        const Node& c1 = nodes[node.child1];
+        const Node& c2 = nodes[node.child2];
+        bool hit1 = ray.intersectAABB(c1.aabb.min, c1.aabb.max, t1Min, t1Max) &&
+                    t1Max >= 0.0f && t1Min <= maxDistance;
+        bool hit2 = ray.intersectAABB(c2.aabb.min, c2.aabb.max, t2Min, t2Max) &&
+                    t2Max >= 0.0f && t2Min <= maxDistance;
+
+        // Push the farther child first so the nearer one is visited next
+        if (hit1 && hit2) {
+            if (t1Min <= t2Min) {
+                stack.push(node.child2);
+                stack.push(node.child1);
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        } else if (hit1) {
+            stack.push(node.child1);
+        } else if (hit2) {
+            stack.push(node.child2);
+        }
+    }
+}
+
+template<typename Callback>
+int32_t DynamicAABBTree::nearest(const Vec3& point, float maxDistance, Callback&& callback,
+                                 float* outDistanceSq) const {
+    int32_t best = NULL_NODE;
+    float bestDistanceSq = maxDistance < std::numeric_limits<float>::max()
+        ? maxDistance * maxDistance
+        : std::numeric_limits<float>::infinity();
+
+    if (root != NULL_NODE) {
+        // Min-heap on distance to the node bounds (a lower bound for its contents)
+        using Entry = std::pair<float, int32_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        open.emplace(nodes[root].aabb.distanceSquared(point), root);
+
+        while (!open.empty()) {
+            auto [distanceSq, index] = open.top();
+            open.pop();
+            if (distanceSq >= bestDistanceSq) break;
+
+            const Node& node = nodes[index];
+            if (node.isLeaf()) {
+                float exactSq = callback(index);
+                if (exactSq < bestDistanceSq) {
+                    bestDistanceSq = exactSq;
+                    best = index;
+                }
+            } else {
+                float d1 = nodes[node.child1].aabb.distanceSquared(point);
+                float d2 = nodes[node.child2].aabb.distanceSquared(point);
+                if (d1 < bestDistanceSq) open.emplace(d1, node.child1);
+                if (d2 < bestDistanceSq) open.emplace(d2, node.child2);
+            }
+        }
+    }
+
+    if (outDistanceSq) *outDistanceSq = bestDistanceSq;
+    return best;
+}
+
+} // namespace rendering
+} // namespace rs_engine
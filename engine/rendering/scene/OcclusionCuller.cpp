@@ -0,0 +1,315 @@
+#include "OcclusionCuller.h"
+#include "../../core/JobSystem.h"
+#include "../../core/math/SIMD.h"
+#include "../../resource/model/Mesh.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace rs_engine {
+namespace rendering {
+
+namespace {
+    // Occludee tests per job chunk
+    constexpr size_t TEST_GRAIN_SIZE = 64;
+
+    // Triangles with less screen area than this (in pixels^2) cover nothing
+    constexpr float MIN_TRIANGLE_AREA = 1e-6f;
+
+    struct ClipVertex {
+        float x, y, z, w;
+    };
+
+    inline ClipVertex transformPoint(const Mat4& m, float x, float y, float z) {
+        return {
+            m(0, 0) * x + m(0, 1) * y + m(0, 2) * z + m(0, 3),
+            m(1, 0) * x + m(1, 1) * y + m(1, 2) * z + m(1, 3),
+            m(2, 0) * x + m(2, 1) * y + m(2, 2) * z + m(2, 3),
+            m(3, 0) * x + m(3, 1) * y + m(3, 2) * z + m(3, 3)
+        };
+    }
+
+    /**
+     * @brief Pixel containing a screen coordinate, clamped to [-1, size] (safe int conversion)
+     */
+    inline int32_t pixelOf(float coordinate, uint32_t size) {
+        float clamped = std::min(std::max(coordinate, -1.0f), static_cast<float>(size));
+        return static_cast<int32_t>(std::floor(clamped));
+    }
+
+    float elapsedMs(std::chrono::high_resolution_clock::time_point start) {
+        std::chrono::duration<float, std::milli> elapsed =
+            std::chrono::high_resolution_clock::now() - start;
+        return elapsed.count();
+    }
+}
+
+OcclusionCuller::OcclusionCuller(uint32_t w, uint32_t h) {
+    tilesX = std::max(1u, (w + TILE_WIDTH - 1) / TILE_WIDTH);
+    tilesY = std::max(1u, (h + TILE_HEIGHT - 1) / TILE_HEIGHT);
+    width = tilesX * TILE_WIDTH;
+    height = tilesY * TILE_HEIGHT;
+    depthBuffer.assign(static_cast<size_t>(width) * height, 1.0f);
+}
+
+// ========== Occluders ==========
+
+void OcclusionCuller::beginFrame(const Mat4& viewProj) {
+    viewProjection = viewProj;
+    std::fill(depthBuffer.begin(), depthBuffer.end(), 1.0f);
+    occluders.clear();
+    stats = OcclusionStats();
+}
+
+void OcclusionCuller::addOccluder(const float* positions, size_t vertexCount, size_t stride,
+                                  const uint32_t* indices, size_t indexCount, const Mat4& model) {
+    if (!positions || !indices || vertexCount == 0 || indexCount < 3) {
+        return;
+    }
+    occluders.push_back({positions, vertexCount, stride, indices, indexCount, model});
+    stats.occluders++;
+    stats.occluderTriangles += indexCount / 3;
+}
+
+void OcclusionCuller::addOccluder(const resource::Mesh& mesh, const Mat4& model) {
+    const auto& vertices = mesh.getVertices();
+    const auto& indices = mesh.getIndices();
+    if (vertices.empty() || indices.empty()) {
+        return;
+    }
+    addOccluder(&vertices[0].position.x, vertices.size(), sizeof(resource::Vertex),
+                indices.data(), indices.size(), model);
+}
+
+void OcclusionCuller::rasterize(JobSystem& jobs) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // 1. Transform and set up triangles, one occluder per job
+    occluderTriangles.resize(occluders.size());
+    jobs.parallelFor(occluders.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            setupTriangles(occluders[i], occluderTriangles[i]);
+        }
+    });
+    for (const auto& triangles : occluderTriangles) {
+        stats.trianglesRasterized += triangles.size();
+    }
+
+    // 2. Rasterize, one screen tile per job
+    jobs.parallelFor(static_cast<size_t>(tilesX) * tilesY, 1, [&](size_t begin, size_t end) {
+        for (size_t tile = begin; tile < end; ++tile) {
+            rasterizeTile(static_cast<uint32_t>(tile));
+        }
+    });
+
+    occluders.clear();
+    stats.rasterizeMs = elapsedMs(start);
+}
+
+void OcclusionCuller::setupTriangles(const Occluder& occluder,
+                                     std::vector<ScreenTriangle>& triangles) const {
+    triangles.clear();
+    triangles.reserve(occluder.indexCount / 3);
+
+    const Mat4 mvp = viewProjection * occluder.model;
+    const auto* bytes = reinterpret_cast<const uint8_t*>(occluder.positions);
+    const float halfWidth = 0.5f * static_cast<float>(width);
+    const float halfHeight = 0.5f * static_cast<float>(height);
+
+    for (size_t i = 0; i + 2 < occluder.indexCount; i += 3) {
+        float sx[3], sy[3], sz[3];
+        bool valid = true;
+        for (int k = 0; k < 3; ++k) {
+            uint32_t index = occluder.indices[i + k];
+            if (index >= occluder.vertexCount) { valid = false; break; }
+            const float* p = reinterpret_cast<const float*>(bytes + index * occluder.stride);
+            ClipVertex c = transformPoint(mvp, p[0], p[1], p[2]);
+
+            // Crossing the near plane: skipping the triangle only loses occlusion
+            if (c.w <= 0.0f || c.z < 0.0f) { valid = false; break; }
+
+            float invW = 1.0f / c.w;
+            sx[k] = (c.x * invW + 1.0f) * halfWidth;
+            sy[k] = (1.0f - c.y * invW) * halfHeight;
+            sz[k] = c.z * invW;
+        }
+        if (!valid) continue;
+
+        float area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sx[2] - sx[0]) * (sy[1] - sy[0]);
+        if (std::fabs(area) < MIN_TRIANGLE_AREA) continue;
+
+        // Occluders are two-sided: orient every triangle so inside is positive
+        if (area < 0.0f) {
+            std::swap(sx[1], sx[2]);
+            std::swap(sy[1], sy[2]);
+            std::swap(sz[1], sz[2]);
+            area = -area;
+        }
+
+        ScreenTriangle tri;
+        tri.minX = std::max(0, pixelOf(std::min({sx[0], sx[1], sx[2]}), width));
+        tri.minY = std::max(0, pixelOf(std::min({sy[0], sy[1], sy[2]}), height));
+        tri.maxX = std::min(static_cast<int32_t>(width) - 1, pixelOf(std::max({sx[0], sx[1], sx[2]}), width));
+        tri.maxY = std::min(static_cast<int32_t>(height) - 1, pixelOf(std::max({sy[0], sy[1], sy[2]}), height));
+        if (tri.minX > tri.maxX || tri.minY > tri.maxY) continue;
+
+        // Edge a->b: inside when (b - a) x (p - a) >= 0. Shrinking by half the
+        // L1 gradient means a center test passes only for fully covered pixels.
+        for (int e = 0; e < 3; ++e) {
+            int a = e, b = (e + 1) % 3;
+            float edgeA = sy[a] - sy[b];
+            float edgeB = sx[b] - sx[a];
+            tri.edgeA[e] = edgeA;
+            tri.edgeB[e] = edgeB;
+            tri.edgeC[e] = -(edgeA * sx[a] + edgeB * sy[a]) - 0.5f * (std::fabs(edgeA) + std::fabs(edgeB));
+        }
+
+        // Depth plane; bias to the farthest value inside the pixel
+        float invArea = 1.0f / area;
+        float dzdx = ((sz[1] - sz[0]) * (sy[2] - sy[0]) - (sz[2] - sz[0]) * (sy[1] - sy[0])) * invArea;
+        float dzdy = ((sz[2] - sz[0]) * (sx[1] - sx[0]) - (sz[1] - sz[0]) * (sx[2] - sx[0])) * invArea;
+        tri.depthA = dzdx;
+        tri.depthB = dzdy;
+        tri.depthC = sz[0] - dzdx * sx[0] - dzdy * sy[0] + 0.5f * (std::fabs(dzdx) + std::fabs(dzdy));
+
+        triangles.push_back(tri);
+    }
+}
+
+void OcclusionCuller::rasterizeTile(uint32_t tileIndex) {
+    using simd::Float4;
+
+    const int32_t tileMinX = static_cast<int32_t>((tileIndex % tilesX) * TILE_WIDTH);
+    const int32_t tileMinY = static_cast<int32_t>((tileIndex / tilesX) * TILE_HEIGHT);
+    const int32_t tileMaxX = tileMinX + static_cast<int32_t>(TILE_WIDTH) - 1;
+    const int32_t tileMaxY = tileMinY + static_cast<int32_t>(TILE_HEIGHT) - 1;
+    const Float4 laneOffsets(0.5f, 1.5f, 2.5f, 3.5f);
+    const Float4 zero(0.0f);
+
+    for (const auto& triangles : occluderTriangles) {
+        for (const ScreenTriangle& tri : triangles) {
+            if (tri.maxX < tileMinX || tri.minX > tileMaxX ||
+                tri.maxY < tileMinY || tri.minY > tileMaxY) {
+                continue;
+            }
+
+            // Columns in aligned groups of 4 (tiles are a multiple of 4 wide)
+            int32_t minX = std::max(tri.minX, tileMinX) & ~3;
+            int32_t maxX = std::min(tri.maxX, tileMaxX);
+            int32_t minY = std::max(tri.minY, tileMinY);
+            int32_t maxY = std::min(tri.maxY, tileMaxY);
+
+            const Float4 a0(tri.edgeA[0]), a1(tri.edgeA[1]), a2(tri.edgeA[2]);
+            const Float4 depthA(tri.depthA);
+            const Float4 stepE0(tri.edgeA[0] * 4.0f), stepE1(tri.edgeA[1] * 4.0f), stepE2(tri.edgeA[2] * 4.0f);
+            const Float4 stepZ(tri.depthA * 4.0f);
+            const Float4 startX = Float4(static_cast<float>(minX)) + laneOffsets;
+
+            for (int32_t y = minY; y <= maxY; ++y) {
+                float centerY = static_cast<float>(y) + 0.5f;
+                Float4 e0 = simd::madd(a0, startX, Float4(tri.edgeB[0] * centerY + tri.edgeC[0]));
+                Float4 e1 = simd::madd(a1, startX, Float4(tri.edgeB[1] * centerY + tri.edgeC[1]));
+                Float4 e2 = simd::madd(a2, startX, Float4(tri.edgeB[2] * centerY + tri.edgeC[2]));
+                Float4 z = simd::madd(depthA, startX, Float4(tri.depthB * centerY + tri.depthC));
+
+                float* row = depthBuffer.data() + static_cast<size_t>(y) * width;
+                for (int32_t x = minX; x <= maxX; x += 4) {
+                    Float4 inside = (e0 >= zero) & (e1 >= zero) & (e2 >= zero);
+                    if (simd::movemask(inside)) {
+                        Float4 depth = Float4::load(row + x);
+                        Float4 write = inside & (z < depth);
+                        simd::select(write, z, depth).store(row + x);
+                    }
+                    e0 = e0 + stepE0;
+                    e1 = e1 + stepE1;
+                    e2 = e2 + stepE2;
+                    z = z + stepZ;
+                }
+            }
+        }
+    }
+}
+
+// ========== Occludee Tests ==========
+
+bool OcclusionCuller::projectBounds(const AABB& bounds, float& minX, float& minY,
+                                    float& maxX, float& maxY, float& minDepth) const {
+    const float halfWidth = 0.5f * static_cast<float>(width);
+    const float halfHeight = 0.5f * static_cast<float>(height);
+
+    minX = minY = minDepth = std::numeric_limits<float>::max();
+    maxX = maxY = std::numeric_limits<float>::lowest();
+
+    for (int corner = 0; corner < 8; ++corner) {
+        ClipVertex c = transformPoint(viewProjection,
+                                      (corner & 1) ? bounds.max.x : bounds.min.x,
+                                      (corner & 2) ? bounds.max.y : bounds.min.y,
+                                      (corner & 4) ? bounds.max.z : bounds.min.z);
+        if (c.w <= 0.0f || c.z < 0.0f) {
+            return false;
+        }
+        float invW = 1.0f / c.w;
+        float x = (c.x * invW + 1.0f) * halfWidth;
+        float y = (1.0f - c.y * invW) * halfHeight;
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+        minDepth = std::min(minDepth, c.z * invW);
+    }
+    return true;
+}
+
+bool OcclusionCuller::isVisible(const AABB& worldBounds) const {
+    float minX, minY, maxX, maxY, minDepth;
+    if (!projectBounds(worldBounds, minX, minY, maxX, maxY, minDepth)) {
+        return true;  // Crosses the near plane (camera inside or right next to it)
+    }
+
+    // Every pixel the rectangle touches
+    int32_t x0 = std::max(0, pixelOf(minX, width));
+    int32_t y0 = std::max(0, pixelOf(minY, height));
+    int32_t x1 = std::min(static_cast<int32_t>(width) - 1, pixelOf(maxX, width));
+    int32_t y1 = std::min(static_cast<int32_t>(height) - 1, pixelOf(maxY, height));
+    if (x0 > x1 || y0 > y1) {
+        return false;  // Off-screen
+    }
+
+    // Visible if any pixel's occluder depth is not in front of the box.
+    // Widening to aligned groups of 4 only tests extra pixels (conservative).
+    const simd::Float4 boxDepth(minDepth);
+    x0 &= ~3;
+    for (int32_t y = y0; y <= y1; ++y) {
+        const float* row = depthBuffer.data() + static_cast<size_t>(y) * width;
+        for (int32_t x = x0; x <= x1; x += 4) {
+            if (simd::movemask(boxDepth <= simd::Float4::load(row + x))) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+size_t OcclusionCuller::testVisibility(const AABB* bounds, size_t count, uint8_t* visible, JobSystem& jobs) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    jobs.parallelFor(count, TEST_GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            visible[i] = isVisible(bounds[i]) ? 1 : 0;
+        }
+    });
+
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        visibleCount += visible[i];
+    }
+
+    stats.objectsTested += count;
+    stats.objectsOccluded += count - visibleCount;
+    stats.testMs += elapsedMs(start);
+    return visibleCount;
+}
+
+} // namespace rendering
+} // namespace rs_engine
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "../../core/math/Mat4.h"
+#include "../../core/math/Vec3.h"
+#include "../../core/math/AABB.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rs_engine {
+
+class JobSystem;
+
+namespace resource {
+class Mesh;
+}
+
+namespace rendering {
+
+/**
+ * @brief Per-frame occlusion culling statistics
+ */
+struct OcclusionStats {
+    size_t occluders = 0;
+    size_t occluderTriangles = 0;       // Triangles submitted
+    size_t trianglesRasterized = 0;     // Survived near-plane / screen rejection
+    size_t objectsTested = 0;
+    size_t objectsOccluded = 0;
+    float rasterizeMs = 0.0f;
+    float testMs = 0.0f;
+};
+
+/**
+ * @brief CPU software occlusion culler
+ *
+ * Each frame a small set of occluder meshes is rasterized into a
+ * low-resolution depth buffer (256x128 by default), then world AABBs are
+ * tested against it before any draw is issued. Everything runs on the CPU,
+ * so it needs no GPU readback and works headless.
+ *
+ * - Depth follows WebGPU conventions: z/w in [0, 1], smaller is nearer.
+ * - Rasterization is 4 pixels per SIMD op (see core/math/SIMD.h) and is
+ *   split into screen tiles processed by the caller's JobSystem; each tile owns
+ *   its pixels, so there are no write conflicts.
+ * - Occluders are rasterized conservatively: a pixel is only written if
+ *   the triangle covers it entirely, with the farthest depth it reaches
+ *   inside the pixel. Occludee tests use the nearest depth of the box over
+ *   its whole screen rectangle. Culling can therefore miss occlusion but
+ *   never hides a visible object.
+ * - Occluder triangles crossing the near plane are skipped (also
+ *   conservative); boxes crossing it are always visible.
+ *
+ * Usage per frame:
+ *   culler.beginFrame(viewProj);
+ *   culler.addOccluder(mesh, worldMatrix);   // Big, simple, solid meshes
+ *   culler.rasterize();
+ *   if (culler.isVisible(bounds)) draw(...);
+ *
+ * Occluder geometry is referenced, not copied, until rasterize() returns.
+ *
+ * Platform Support: 100% shared (serial on Web)
+ */
+class OcclusionCuller {
+public:
+    static constexpr uint32_t DEFAULT_WIDTH = 256;
+    static constexpr uint32_t DEFAULT_HEIGHT = 128;
+
+    /**
+     * @param width Depth buffer width (rounded up to a multiple of the tile width)
+     * @param height Depth buffer height (rounded up to a multiple of the tile height)
+     */
+    OcclusionCuller(uint32_t width = DEFAULT_WIDTH, uint32_t height = DEFAULT_HEIGHT);
+
+    uint32_t getWidth() const { return width; }
+    uint32_t getHeight() const { return height; }
+
+    // ========== Occluders ==========
+
+    /**
+     * @brief Clear the depth buffer and occluder list for a new view
+     */
+    void beginFrame(const Mat4& viewProjection);
+
+    /**
+     * @brief Queue indexed triangles as an occluder
+     * @param positions First vertex position (x, y, z floats)
+     * @param stride Bytes between consecutive positions
+     * @param indices Triangle list indices
+     * @param model Object-to-world matrix
+     */
+    void addOccluder(const float* positions, size_t vertexCount, size_t stride,
+                     const uint32_t* indices, size_t indexCount, const Mat4& model);
+
+    /**
+     * @brief Queue a mesh as an occluder (CPU-side vertex data)
+     */
+    void addOccluder(const resource::Mesh& mesh, const Mat4& model);
+
+    size_t getOccluderCount() const { return occluders.size(); }
+
+    /**
+     * @brief Rasterize all queued occluders into the depth buffer
+     * @param jobs Pool the triangle setup and screen tiles are split across
+     */
+    void rasterize(JobSystem& jobs);
+
+    // ========== Occludee Tests ==========
+
+    /**
+     * @brief Test a world-space box against the depth buffer
+     * @return false only if the box is fully hidden or entirely off-screen
+     */
+    bool isVisible(const AABB& worldBounds) const;
+
+    /**
+     * @brief Test many boxes, spread across worker threads
+     * @param visible Output: one entry per box (1 = visible)
+     * @param jobs Pool the boxes are split across
+     * @return Number of visible boxes (also recorded in getStats())
+     */
+    size_t testVisibility(const AABB* bounds, size_t count, uint8_t* visible, JobSystem& jobs);
+
+    // ========== Debug / Stats ==========
+
+    /**
+     * @brief Depth buffer (row-major, row 0 at the top of the screen)
+     */
+    const std::vector<float>& getDepthBuffer() const { return depthBuffer; }
+
+    const OcclusionStats& getStats() const { return stats; }
+
+private:
+    static constexpr uint32_t TILE_WIDTH = 64;
+    static constexpr uint32_t TILE_HEIGHT = 32;
+
+    struct Occluder {
+        const float* positions;
+        size_t vertexCount;
+        size_t stride;
+        const uint32_t* indices;
+        size_t indexCount;
+        Mat4 model;
+    };
+
+    /**
+     * @brief Screen-space triangle ready for tile rasterization
+     *
+     * Edge and depth functions are planes in pixel coordinates, already
+     * biased so that evaluating them at a pixel center is conservative for
+     * the whole pixel.
+     */
+    struct ScreenTriangle {
+        float edgeA[3], edgeB[3], edgeC[3];  // inside when A*x + B*y + C >= 0 for all 3
+        float depthA, depthB, depthC;        // z = A*x + B*y + C (+ half-pixel bias)
+        int32_t minX, minY, maxX, maxY;      // Inclusive pixel bounds, clamped to screen
+    };
+
+    uint32_t width;
+    uint32_t height;
+    uint32_t tilesX;
+    uint32_t tilesY;
+    std::vector<float> depthBuffer;
+    Mat4 viewProjection;
+
+    std::vector<Occluder> occluders;
+    std::vector<std::vector<ScreenTriangle>> occluderTriangles;  // Per occluder (setup output)
+
+    OcclusionStats stats;
+
+    void setupTriangles(const Occluder& occluder, std::vector<ScreenTriangle>& triangles) const;
+    void rasterizeTile(uint32_t tileIndex);
+
+    /**
+     * @brief Project a box; false if it crosses the near plane
+     */
+    bool projectBounds(const AABB& bounds, float& minX, float& minY, float& maxX, float& maxY,
+                       float& minDepth) const;
+};
+
+} // namespace rendering
+} // namespace rs_engine
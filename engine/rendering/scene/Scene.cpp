@@ -1,13 +1,30 @@
 #include "Scene.h"
+#include "SceneSnapshot.h"
+#include "../../core/JobSystem.h"
+#include "../../core/MappedFile.h"
 #include <iostream>
 #include <cstring>
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <string_view>
 
 namespace rs_engine {
 
 namespace rendering {
 
-Scene::Scene(wgpu::Device* dev, resource::ResourceManager* resMgr) 
-    : device(dev), resourceManager(resMgr) {
+namespace {
+    // Objects per update() chunk (a chunk should be ~10-100 us of work)
+    constexpr size_t UPDATE_GRAIN_SIZE = 1024;
+    
+    // World bounds recomputed per chunk (8 corner transforms each)
+    constexpr size_t BOUNDS_GRAIN_SIZE = 512;
+}
+
+Scene::Scene(wgpu::Device* dev, resource::ResourceManager* resMgr, JobSystem* jobs) 
+    : device(dev), resourceManager(resMgr), jobSystem(jobs) {
     shaderManager = std::make_unique<ShaderManager>(device, "shaders/");
     
     // Create default camera
@@ -34,33 +51,68 @@ bool Scene::initialize() {
 }
 
 void Scene::update(float deltaTime) {
-    // Update all scene objects
-    for (auto& [name, object] : sceneObjects) {
-        object->update(deltaTime);
+    elapsedTime += deltaTime;
+    
+    if (deltaTime != 0.0f && !animatedObjects.empty()) {
+        // Advance the animated objects only, one contiguous chunk per job
+        getJobs().parallelFor(animatedObjects.size(), UPDATE_GRAIN_SIZE, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                animatedObjects[i]->advance(deltaTime);
+            }
+        });
+        
+        // Animation rotates them: only their subtrees are recomputed
+        for (SceneObject* object : animatedObjects) {
+            transformHierarchy.markLocalDirty(object->hierarchyIndex);
+        }
     }
+    
+    // Recompute world matrices, then re-index only the objects whose bounds changed
+    updateSpatialIndex();
 }
 
 void Scene::render(wgpu::RenderPassEncoder& renderPass) {
-    if (sceneObjects.empty()) {
+    if (objectList.empty()) {
         return;
     }
 
-    // Set render pipeline
+    // LOD selection inputs (bounds must be current)
+    updateSpatialIndex();
+    lodStats = LODStats();
+    const Vec3& cameraPosition = camera->getPosition();
+    float projectionScale = 1.0f / std::tan(camera->getFOVRadians() * 0.5f);
+
+    renderQueue.clear();
+    for (SceneObject* object : objectList) {
+        if (object->getVisible() && object->hasModel()) {
+            renderQueue.push_back(object);
+        }
+    }
+    
+    if (occlusionCullingEnabled) {
+        cullOccludedObjects();
+    }
+    
+    // Send changed data before any draw references it
+    uploadFrameData();
+    
+    // Both groups are bound once; each draw selects its record by firstInstance
     renderPass.SetPipeline(renderPipeline);
-
+    quantizedPipelineBound = false;
+    boundPositionBuffer = nullptr;
+    boundIndexBuffer = nullptr;
+    renderPass.SetBindGroup(0, frameBindGroup);
+    renderPass.SetBindGroup(1, objectBindGroup);
+    
     // Render each object
-    size_t objectIndex = 0;
-    for (const auto& [name, object] : sceneObjects) {
-        if (objectIndex >= MAX_OBJECTS) break;
-        if (!object->getVisible() || !object->hasModel()) continue;
-        
-        renderObject(renderPass, *object, objectIndex);
-        objectIndex++;
+    for (SceneObject* object : renderQueue) {
+        selectObjectLOD(*object, cameraPosition, projectionScale);
+        renderObject(renderPass, *object);
     }
     
-    // Render bounding box for selected object
-    if (selectedObject && selectedObject->hasModel()) {
-        renderBoundingBox(renderPass, *selectedObject);
+    // Render bounding boxes for all selected objects (single instanced draw)
+    if (!selectedObjects.empty()) {
+        renderSelectionHighlights(renderPass);
     }
 }
 
@@ -68,68 +120,675 @@ void Scene::render(wgpu::RenderPassEncoder& renderPass) {
 
 SceneObject* Scene::createObject(const std::string& name) {
     // Check if object already exists
-    if (sceneObjects.find(name) != sceneObjects.end()) {
+    if (findNamedObject(NameTable::get().find(name))) {
         std::cerr << "[ERROR] Scene object '" << name << "' already exists" << std::endl;
         return nullptr;
     }
     
-    auto object = std::make_unique<SceneObject>(name);
-    SceneObject* objectPtr = object.get();
-    sceneObjects[name] = std::move(object);
+    SceneObject* object = acquireObject();
+    if (!object) {
+        std::cerr << "[ERROR] Scene object pool is full (" << SceneObjectPool::MAX_OBJECTS
+                  << " objects)" << std::endl;
+        return nullptr;
+    }
+    object->name = Name(name);
+    registerObject(object);
     
-    std::cout << "[SUCCESS] Created scene object '" << name << "'" << std::endl;
-    return objectPtr;
+    // Unnamed objects are runtime spawns: no per-object log
+    if (object->hasName()) {
+        std::cout << "[SUCCESS] Created scene object '" << name << "'" << std::endl;
+    }
+    return object;
 }
 
 bool Scene::addMeshToObject(const std::string& objectName, resource::ResourceHandle meshHandle) {
-    auto it = sceneObjects.find(objectName);
-    if (it == sceneObjects.end()) {
+    SceneObject* object = getObject(objectName);
+    if (!object) {
         std::cerr << "[ERROR] Scene object '" << objectName << "' not found" << std::endl;
         return false;
     }
     
+    if (!addMeshToObject(object->handle, meshHandle)) {
+        return false;
+    }
+    
+    std::cout << "[SUCCESS] Added mesh to object '" << objectName << "'" << std::endl;
+    return true;
+}
+
+bool Scene::addMeshToObject(ObjectHandle handle, resource::ResourceHandle meshHandle) {
+    SceneObject* object = objectPool.get(handle);
+    if (!object) {
+        std::cerr << "[ERROR] Scene object handle " << handle.value << " is not valid" << std::endl;
+        return false;
+    }
+    
     if (!resourceManager) {
         std::cerr << "[ERROR] ResourceManager not available" << std::endl;
         return false;
     }
     
-    // Get the mesh from ResourceManager
-    auto mesh = resourceManager->getMesh(meshHandle);
-    if (!mesh) {
+    // Objects showing the same mesh share one model (and its LOD chain)
+    auto model = getMeshModel(meshHandle);
+    if (!model) {
         std::cerr << "[ERROR] Mesh with handle " << meshHandle << " not found" << std::endl;
         return false;
     }
     
-    // Create a model with this mesh
-    auto model = std::make_shared<resource::Model>(objectName + "_Model");
-    model->addMesh(mesh);
-    
     // Set the model on the object
-    it->second->setModel(model);
-    
-    std::cout << "[SUCCESS] Added mesh to object '" << objectName << "'" << std::endl;
+    object->setModel(model);
     return true;
 }
 
+size_t Scene::createObjects(size_t count, const ObjectTemplate& objectTemplate,
+                            std::vector<SceneObject*>* outObjects) {
+    if (count == 0) {
+        return 0;
+    }
+    
+    std::shared_ptr<resource::Model> model;
+    if (objectTemplate.meshHandle != resource::INVALID_RESOURCE_HANDLE) {
+        if (!resourceManager || !(model = getMeshModel(objectTemplate.meshHandle))) {
+            std::cerr << "[ERROR] createObjects: mesh with handle " << objectTemplate.meshHandle
+                      << " not found" << std::endl;
+            return 0;
+        }
+    }
+    
+    // Reserve everything once instead of growing per object
+    size_t total = objectList.size() + count;
+    flushDestroyedObjects();
+    objectPool.reserve(total);
+    objectList.reserve(total);
+    dirtyBoundsObjects.reserve(dirtyBoundsObjects.size() + count);
+    slotObjects.reserve(std::max(slotObjects.size(), total));
+    if (outObjects) {
+        outObjects->reserve(outObjects->size() + count);
+    }
+    
+    const bool named = !objectTemplate.namePrefix.empty();
+    std::string name = objectTemplate.namePrefix;
+    const size_t prefixLength = name.size();
+    size_t created = 0;
+    for (size_t number = 0; created < count; ++number) {
+        if (named) {
+            name.resize(prefixLength);
+            name += std::to_string(number);
+            if (findNamedObject(NameTable::get().find(name))) {
+                continue;  // Name taken by an existing object
+            }
+        }
+        
+        SceneObject* object = objectPool.acquire();
+        if (!object) {
+            std::cerr << "[ERROR] createObjects: object pool is full (" << SceneObjectPool::MAX_OBJECTS
+                      << " objects)" << std::endl;
+            break;
+        }
+        if (named) {
+            object->name = Name(name);
+        }
+        object->transform = objectTemplate.transform;
+        object->model = model;
+        object->layers = objectTemplate.layers;
+        object->isVisible = objectTemplate.visible;
+        object->animated = objectTemplate.animated;
+        registerObject(object);
+        
+        if (outObjects) {
+            outObjects->push_back(object);
+        }
+        ++created;
+    }
+    
+    std::cout << "[SUCCESS] Created " << created << " scene objects";
+    if (named) {
+        std::cout << " ('" << objectTemplate.namePrefix << "*')";
+    }
+    std::cout << std::endl;
+    return created;
+}
+
+SceneObject* Scene::instantiateModel(const std::shared_ptr<resource::Model>& model, const std::string& name,
+                                     std::vector<SceneObject*>* outObjects) {
+    if (!model) {
+        std::cerr << "[ERROR] instantiateModel: no model" << std::endl;
+        return nullptr;
+    }
+    
+    if (findNamedObject(NameTable::get().find(name))) {
+        std::cerr << "[ERROR] Scene object '" << name << "' already exists" << std::endl;
+        return nullptr;
+    }
+    
+    const auto& nodes = model->getNodes();
+    flushDestroyedObjects();
+    objectPool.reserve(objectList.size() + nodes.size() + 1);
+    
+    SceneObject* root = acquireObject();
+    if (!root) {
+        std::cerr << "[ERROR] instantiateModel: object pool is full (" << SceneObjectPool::MAX_OBJECTS
+                  << " objects)" << std::endl;
+        return nullptr;
+    }
+    root->name = Name(name);
+    if (nodes.empty()) {
+        root->model = model;
+    }
+    registerObject(root);
+    if (outObjects) {
+        outObjects->push_back(root);
+    }
+    
+    // One Model per distinct mesh range, shared by nodes drawing the same glTF mesh
+    std::unordered_map<uint64_t, std::shared_ptr<resource::Model>> rangeModels;
+    std::vector<SceneObject*> nodeObjects(nodes.size(), nullptr);
+    std::string nodeName;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const resource::ModelNode& node = nodes[i];
+        SceneObject* object = acquireObject();
+        if (!object) {
+            std::cerr << "[ERROR] instantiateModel: object pool is full (" << SceneObjectPool::MAX_OBJECTS
+                      << " objects)" << std::endl;
+            break;
+        }
+        
+        if (!name.empty() && !node.name.empty()) {
+            nodeName = name + "/" + node.name;
+            if (!findNamedObject(NameTable::get().find(nodeName))) {
+                object->name = Name(nodeName);
+            }
+        }
+        object->transform = node.transform;
+        
+        if (node.meshCount > 0 && node.firstMesh + node.meshCount <= model->getMeshCount()) {
+            uint64_t key = (static_cast<uint64_t>(node.firstMesh) << 32) | node.meshCount;
+            auto& rangeModel = rangeModels[key];
+            if (!rangeModel) {
+                rangeModel = std::make_shared<resource::Model>(model->getName() + "/" +
+                                                               (node.name.empty() ? std::to_string(i) : node.name));
+                for (uint32_t m = 0; m < node.meshCount; ++m) {
+                    rangeModel->addMesh(model->getMesh(node.firstMesh + m));
+                }
+            }
+            object->model = rangeModel;
+        }
+        registerObject(object);
+        
+        bool validParent = node.parent >= 0 && static_cast<size_t>(node.parent) < i && nodeObjects[node.parent];
+        setParent(object, validParent ? nodeObjects[node.parent] : root);
+        nodeObjects[i] = object;
+        if (outObjects) {
+            outObjects->push_back(object);
+        }
+    }
+    
+    std::cout << "[SUCCESS] Instantiated model '" << model->getName() << "'";
+    if (!name.empty()) {
+        std::cout << " as '" << name << "'";
+    }
+    std::cout << " (" << nodes.size() << " nodes)" << std::endl;
+    return root;
+}
+
 SceneObject* Scene::getObject(const std::string& name) {
-    auto it = sceneObjects.find(name);
-    return (it != sceneObjects.end()) ? it->second.get() : nullptr;
+    // find() never adds the name to the table
+    return findNamedObject(NameTable::get().find(name));
 }
 
 void Scene::removeObject(const std::string& name) {
-    auto it = sceneObjects.find(name);
-    if (it != sceneObjects.end()) {
-        sceneObjects.erase(it);
+    SceneObject* object = getObject(name);
+    if (object) {
+        releaseObject(object);
         std::cout << "[INFO] Removed object '" << name << "' from scene" << std::endl;
     }
 }
 
+bool Scene::destroyObject(ObjectHandle handle) {
+    SceneObject* object = objectPool.get(handle);
+    if (!object) {
+        return false;
+    }
+    releaseObject(object);
+    return true;
+}
+
+size_t Scene::destroyObjects(SceneObject* const* objects, size_t count) {
+    // Released objects drop their scene, so duplicates are skipped
+    size_t removed = 0;
+    for (size_t i = 0; i < count; ++i) {
+        SceneObject* object = objects[i];
+        if (object && object->ownerScene == this) {
+            releaseObject(object);
+            ++removed;
+        }
+    }
+    
+    if (removed > 0) {
+        std::cout << "[INFO] Removed " << removed << " objects from scene" << std::endl;
+    }
+    return removed;
+}
+
 void Scene::clearAllObjects() {
-    sceneObjects.clear();
+    clearSelection();
+    spatialIndex.clear();
+    dirtyBoundsObjects.clear();
+    transformHierarchy.clear();
+    objectList.clear();
+    animatedObjects.clear();
+    objectPool.clear();
+    nameIndex.clear();
+    destroyedObjectsPending = false;
+    meshModels.clear();     // Wrappers only: the meshes stay with the ResourceManager
+    
+    // Keep the buffer for the next objects
+    slotObjects.clear();
+    freeSlots.clear();
+    dirtySlots.clear();
+    slotDirty.assign(slotDirty.size(), 0);
     std::cout << "[INFO] Cleared all objects from scene" << std::endl;
 }
 
+SceneObject* Scene::acquireObject() {
+    // Recycle in batches: one dirty-list pass frees every slot destroyed so far
+    if (objectPool.getReleasedCount() > 0 && !objectPool.hasFreeSlot()) {
+        flushDestroyedObjects();
+    }
+    return objectPool.acquire();
+}
+
+void Scene::registerObject(SceneObject* object) {
+    const NameId nameId = object->getNameId();
+    if (nameId != INVALID_NAME_ID) {
+        if (nameId >= nameIndex.size()) {
+            nameIndex.resize(std::max<size_t>(nameId + 1, nameIndex.size() * 2));
+        }
+        nameIndex[nameId] = object->handle;
+    }
+    
+    // New objects start dirty; queue them for spatial indexing
+    object->ownerScene = this;
+    object->listIndex = static_cast<int32_t>(objectList.size());
+    objectList.push_back(object);
+    onObjectAnimatedChanged(object);
+    dirtyBoundsObjects.push_back(object);
+    transformHierarchy.addRoot(object);
+    allocateObjectSlot(object);
+}
+
+void Scene::releaseObject(SceneObject* object) {
+    deselectObject(object);
+    detachFromHierarchy(object);
+    removeFromSpatialIndex(object);
+    releaseObjectSlot(object);
+    
+    if (object->getNameId() < nameIndex.size() && nameIndex[object->getNameId()] == object->handle) {
+        nameIndex[object->getNameId()] = ObjectHandle();
+    }
+    
+    // Swap-remove from the dense list
+    SceneObject* moved = objectList.back();
+    moved->listIndex = object->listIndex;
+    objectList[moved->listIndex] = moved;
+    objectList.pop_back();
+    if (object->animatedIndex >= 0) {
+        object->animated = false;
+        onObjectAnimatedChanged(object);
+    }
+    
+    // The slot is reset now but only reused after flushDestroyedObjects(),
+    // which first drops it from dirtyBoundsObjects (no per-object search)
+    destroyedObjectsPending |= object->boundsDirty;
+    objectPool.release(object);
+}
+
+void Scene::flushDestroyedObjects() {
+    if (destroyedObjectsPending) {
+        dirtyBoundsObjects.erase(
+            std::remove_if(dirtyBoundsObjects.begin(), dirtyBoundsObjects.end(),
+                           [this](SceneObject* object) { return object->ownerScene != this; }),
+            dirtyBoundsObjects.end());
+        destroyedObjectsPending = false;
+    }
+    objectPool.recycleReleased();
+}
+
+bool Scene::renameObject(SceneObject* object, NameId newName) {
+    if (newName != INVALID_NAME_ID) {
+        if (findNamedObject(newName)) {
+            std::cerr << "[ERROR] Scene object '" << NameTable::get().getString(newName)
+                      << "' already exists" << std::endl;
+            return false;
+        }
+        if (newName >= nameIndex.size()) {
+            nameIndex.resize(std::max<size_t>(newName + 1, nameIndex.size() * 2));
+        }
+        nameIndex[newName] = object->handle;
+    }
+    if (object->getNameId() < nameIndex.size() && nameIndex[object->getNameId()] == object->handle) {
+        nameIndex[object->getNameId()] = ObjectHandle();
+    }
+    return true;
+}
+
+std::shared_ptr<resource::Model> Scene::getMeshModel(resource::ResourceHandle meshHandle) {
+    auto mesh = resourceManager->getMesh(meshHandle);
+    if (!mesh) {
+        return nullptr;
+    }
+    
+    auto& model = meshModels[meshHandle];
+    if (!model || model->getMesh(0) != mesh) {
+        model = std::make_shared<resource::Model>(mesh->getName() + "_Model");
+        model->addMesh(mesh);
+    }
+    
+    // Pick up a LOD chain generated after the model was created
+    const auto* lods = resourceManager->getMeshLODs(meshHandle);
+    size_t lodCount = lods ? lods->size() + 1 : 1;
+    if (model->getLODCount() != lodCount) {
+        if (lods) {
+            model->setLODs(*lods);
+        } else {
+            model->clearLODs();
+        }
+    }
+    return model;
+}
+
+// ========== Snapshots ==========
 
+namespace {
+    uint32_t appendSnapshotString(std::vector<char>& strings, const std::string& text) {
+        uint32_t offset = static_cast<uint32_t>(strings.size());
+        strings.insert(strings.end(), text.begin(), text.end());
+        return offset;
+    }
+    
+    bool snapshotRangeValid(uint64_t offset, uint64_t length, uint64_t size) {
+        return offset <= size && length <= size - offset;
+    }
+}
+
+bool Scene::saveSnapshot(const std::string& filepath) {
+    using namespace snapshot;
+    const size_t count = objectList.size();
+    
+    // Pre-order: parents precede children, and children keep their order
+    std::vector<SceneObject*> order;
+    std::vector<int32_t> snapshotIndex(count, NO_PARENT);  // By listIndex
+    std::vector<SceneObject*> stack;
+    order.reserve(count);
+    for (SceneObject* root : objectList) {
+        if (root->parent) {
+            continue;
+        }
+        stack.push_back(root);
+        while (!stack.empty()) {
+            SceneObject* object = stack.back();
+            stack.pop_back();
+            snapshotIndex[object->listIndex] = static_cast<int32_t>(order.size());
+            order.push_back(object);
+            stack.insert(stack.end(), object->children.rbegin(), object->children.rend());
+        }
+    }
+    
+    // Model references: shared mesh models map back to their mesh, other
+    // models must be registered with the ResourceManager
+    std::unordered_map<const resource::Model*, resource::ResourceHandle> meshOfModel;
+    for (const auto& entry : meshModels) {
+        meshOfModel.emplace(entry.second.get(), entry.first);
+    }
+    std::unordered_map<const resource::Model*, uint32_t> modelRefIndex;
+    std::vector<SnapshotModelRef> modelRefs;
+    std::vector<char> strings;
+    
+    auto findModelRef = [&](const std::shared_ptr<resource::Model>& model) {
+        auto it = modelRefIndex.find(model.get());
+        if (it != modelRefIndex.end()) {
+            return it->second;
+        }
+        
+        SnapshotModelRef ref = {};
+        std::string name;
+        std::string path;
+        auto meshIt = meshOfModel.find(model.get());
+        if (meshIt != meshOfModel.end()) {
+            if (auto mesh = resourceManager->getMesh(meshIt->second)) {
+                ref.kind = static_cast<uint32_t>(ModelRefKind::Mesh);
+                name = mesh->getName();
+            }
+        } else if (resourceManager && resourceManager->getModel(model->getHandle()) == model) {
+            ref.kind = static_cast<uint32_t>(ModelRefKind::Model);
+            name = model->getName();
+            path = model->getFilePath();
+        }
+        
+        uint32_t index = NO_MODEL;  // Unresolvable models are cached too
+        if (!name.empty()) {
+            ref.nameOffset = appendSnapshotString(strings, name);
+            ref.nameLength = static_cast<uint32_t>(name.size());
+            ref.pathOffset = appendSnapshotString(strings, path);
+            ref.pathLength = static_cast<uint32_t>(path.size());
+            index = static_cast<uint32_t>(modelRefs.size());
+            modelRefs.push_back(ref);
+        }
+        modelRefIndex.emplace(model.get(), index);
+        return index;
+    };
+    
+    std::vector<SnapshotTransform> transforms(count);
+    std::vector<SnapshotObject> records(count);
+    size_t unresolvedObjects = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const SceneObject* object = order[i];
+        const resource::Transform& t = object->transform;
+        transforms[i] = {{t.position.x, t.position.y, t.position.z},
+                         {t.rotation.x, t.rotation.y, t.rotation.z},
+                         {t.scale.x, t.scale.y, t.scale.z},
+                         object->animationTime};
+        
+        SnapshotObject& record = records[i];
+        record = {};
+        record.parent = object->parent ? snapshotIndex[object->parent->listIndex] : NO_PARENT;
+        record.modelRef = object->model ? findModelRef(object->model) : NO_MODEL;
+        if (object->model && record.modelRef == NO_MODEL) {
+            ++unresolvedObjects;
+        }
+        if (object->hasName()) {
+            const std::string& name = object->getName();
+            record.nameOffset = appendSnapshotString(strings, name);
+            record.nameLength = static_cast<uint32_t>(name.size());
+        }
+        record.layers = object->layers;
+        record.flags = (object->isVisible ? OBJECT_VISIBLE : 0u) | (object->occluder ? OBJECT_OCCLUDER : 0u) |
+                       (object->animated ? 0u : OBJECT_STATIC);
+    }
+    
+    if (strings.size() > std::numeric_limits<uint32_t>::max()) {
+        std::cerr << "[ERROR] saveSnapshot: names exceed the 4 GB string section" << std::endl;
+        return false;
+    }
+    
+    SceneSnapshotHeader header = {};
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.headerSize = sizeof(SceneSnapshotHeader);
+    header.endianTag = SNAPSHOT_ENDIAN_TAG;
+    header.objectCount = static_cast<uint32_t>(count);
+    header.modelRefCount = static_cast<uint32_t>(modelRefs.size());
+    header.transformsOffset = alignOffset(sizeof(SceneSnapshotHeader));
+    header.objectsOffset = alignOffset(header.transformsOffset + count * sizeof(SnapshotTransform));
+    header.modelRefsOffset = alignOffset(header.objectsOffset + count * sizeof(SnapshotObject));
+    header.stringsOffset = alignOffset(header.modelRefsOffset + modelRefs.size() * sizeof(SnapshotModelRef));
+    header.stringsSize = strings.size();
+    header.fileSize = header.stringsOffset + header.stringsSize;
+    
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "[ERROR] Cannot write scene snapshot '" << filepath << "'" << std::endl;
+        return false;
+    }
+    
+    uint64_t position = 0;
+    auto writeSection = [&](uint64_t offset, const void* data, size_t bytes) {
+        static const char padding[SNAPSHOT_ALIGNMENT] = {};
+        file.write(padding, static_cast<std::streamsize>(offset - position));
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        position = offset + bytes;
+    };
+    writeSection(0, &header, sizeof(header));
+    writeSection(header.transformsOffset, transforms.data(), count * sizeof(SnapshotTransform));
+    writeSection(header.objectsOffset, records.data(), count * sizeof(SnapshotObject));
+    writeSection(header.modelRefsOffset, modelRefs.data(), modelRefs.size() * sizeof(SnapshotModelRef));
+    writeSection(header.stringsOffset, strings.data(), strings.size());
+    file.close();
+    if (!file) {
+        std::cerr << "[ERROR] Failed to write scene snapshot '" << filepath << "'" << std::endl;
+        return false;
+    }
+    
+    if (unresolvedObjects > 0) {
+        std::cout << "[WARNING] " << unresolvedObjects << " objects have models not registered with the "
+                  << "ResourceManager; saved without a model" << std::endl;
+    }
+    std::cout << "[SUCCESS] Saved " << count << " objects to '" << filepath << "' ("
+              << header.fileSize << " bytes)" << std::endl;
+    return true;
+}
+
+bool Scene::loadSnapshot(const std::string& filepath) {
+    using namespace snapshot;
+    MappedFile file;
+    if (!file.open(filepath)) {
+        std::cerr << "[ERROR] Cannot open scene snapshot '" << filepath << "'" << std::endl;
+        return false;
+    }
+    
+    // Validate everything before the scene is touched
+    const uint8_t* base = file.getData();
+    const uint64_t fileSize = file.getSize();
+    SceneSnapshotHeader header = {};
+    if (fileSize >= sizeof(header)) {
+        std::memcpy(&header, base, sizeof(header));
+    }
+    if (header.magic != SNAPSHOT_MAGIC || header.endianTag != SNAPSHOT_ENDIAN_TAG) {
+        std::cerr << "[ERROR] '" << filepath << "' is not a scene snapshot" << std::endl;
+        return false;
+    }
+    if (header.version != SNAPSHOT_VERSION || header.headerSize != sizeof(SceneSnapshotHeader)) {
+        std::cerr << "[ERROR] Scene snapshot '" << filepath << "' has version " << header.version
+                  << " (supported: " << SNAPSHOT_VERSION << ")" << std::endl;
+        return false;
+    }
+    
+    auto sectionValid = [&](uint64_t offset, uint64_t count, uint64_t recordSize) {
+        return offset % SNAPSHOT_ALIGNMENT == 0 && offset <= fileSize &&
+               count <= (fileSize - offset) / recordSize;
+    };
+    bool valid = header.fileSize == fileSize &&
+                 header.objectCount <= SceneObjectPool::MAX_OBJECTS &&
+                 sectionValid(header.transformsOffset, header.objectCount, sizeof(SnapshotTransform)) &&
+                 sectionValid(header.objectsOffset, header.objectCount, sizeof(SnapshotObject)) &&
+                 sectionValid(header.modelRefsOffset, header.modelRefCount, sizeof(SnapshotModelRef)) &&
+                 sectionValid(header.stringsOffset, header.stringsSize, 1);
+    
+    const size_t count = header.objectCount;
+    const auto* transforms = reinterpret_cast<const SnapshotTransform*>(base + header.transformsOffset);
+    const auto* records = reinterpret_cast<const SnapshotObject*>(base + header.objectsOffset);
+    const auto* modelRefs = reinterpret_cast<const SnapshotModelRef*>(base + header.modelRefsOffset);
+    const char* strings = reinterpret_cast<const char*>(base + header.stringsOffset);
+    
+    for (uint32_t i = 0; valid && i < header.modelRefCount; ++i) {
+        const SnapshotModelRef& ref = modelRefs[i];
+        valid = ref.kind <= static_cast<uint32_t>(ModelRefKind::Model) && ref.nameLength > 0 &&
+                snapshotRangeValid(ref.nameOffset, ref.nameLength, header.stringsSize) &&
+                snapshotRangeValid(ref.pathOffset, ref.pathLength, header.stringsSize);
+    }
+    for (size_t i = 0; valid && i < count; ++i) {
+        const SnapshotObject& record = records[i];
+        valid = (record.parent == NO_PARENT || (record.parent >= 0 && static_cast<size_t>(record.parent) < i)) &&
+                (record.modelRef == NO_MODEL || record.modelRef < header.modelRefCount) &&
+                snapshotRangeValid(record.nameOffset, record.nameLength, header.stringsSize);
+    }
+    if (!valid) {
+        std::cerr << "[ERROR] Scene snapshot '" << filepath << "' is truncated or corrupt" << std::endl;
+        return false;
+    }
+    
+    clearAllObjects();
+    
+    // Resolve each referenced resource once
+    std::vector<std::shared_ptr<resource::Model>> models(header.modelRefCount);
+    for (uint32_t i = 0; i < header.modelRefCount && resourceManager; ++i) {
+        const SnapshotModelRef& ref = modelRefs[i];
+        std::string name(strings + ref.nameOffset, ref.nameLength);
+        if (ref.kind == static_cast<uint32_t>(ModelRefKind::Mesh)) {
+            if (auto mesh = resourceManager->getMesh(name)) {
+                models[i] = getMeshModel(mesh->getHandle());
+            }
+        } else {
+            models[i] = resourceManager->getModel(name);
+            if (!models[i] && ref.pathLength > 0) {
+                std::string path(strings + ref.pathOffset, ref.pathLength);
+                models[i] = resourceManager->getModel(resourceManager->loadModel(name, path));
+            }
+        }
+        if (!models[i]) {
+            std::cout << "[WARNING] Scene snapshot references missing "
+                      << (ref.kind == static_cast<uint32_t>(ModelRefKind::Mesh) ? "mesh" : "model")
+                      << " '" << name << "'; its objects have no model" << std::endl;
+        }
+    }
+    
+    objectPool.reserve(count);
+    objectList.reserve(count);
+    dirtyBoundsObjects.reserve(count);
+    slotObjects.reserve(count);
+    
+    std::vector<SceneObject*> loaded(count);
+    size_t duplicateNames = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const SnapshotTransform& t = transforms[i];
+        const SnapshotObject& record = records[i];
+        SceneObject* object = objectPool.acquire();  // Cannot fail: the pool is empty and count <= MAX_OBJECTS
+        
+        if (record.nameLength > 0) {
+            const std::string_view name(strings + record.nameOffset, record.nameLength);
+            if (findNamedObject(NameTable::get().find(name))) {
+                ++duplicateNames;  // Later duplicates stay unnamed
+            } else {
+                object->name = Name(name);
+            }
+        }
+        object->transform.position = Vec3(t.position[0], t.position[1], t.position[2]);
+        object->transform.rotation = Vec3(t.rotation[0], t.rotation[1], t.rotation[2]);
+        object->transform.scale = Vec3(t.scale[0], t.scale[1], t.scale[2]);
+        object->animationTime = t.animationTime;
+        if (record.modelRef != NO_MODEL) {
+            object->model = models[record.modelRef];
+        }
+        object->layers = record.layers;
+        object->isVisible = (record.flags & OBJECT_VISIBLE) != 0;
+        object->occluder = (record.flags & OBJECT_OCCLUDER) != 0;
+        object->animated = (record.flags & OBJECT_STATIC) == 0;
+        registerObject(object);
+        
+        // Parents precede children in the file
+        if (record.parent != NO_PARENT) {
+            object->parent = loaded[record.parent];
+            object->parent->children.push_back(object);
+        }
+        loaded[i] = object;
+    }
+    
+    if (duplicateNames > 0) {
+        std::cout << "[WARNING] " << duplicateNames << " duplicate object names in snapshot were dropped" << std::endl;
+    }
+    std::cout << "[SUCCESS] Loaded " << count << " objects from '" << filepath << "'" << std::endl;
+    return true;
+}
 
 // ========== Rendering Resource Creation ==========
 
@@ -140,11 +799,16 @@ bool Scene::createRenderingResources() {
     }
     std::cout << "[SUCCESS] Scene: createUniformBuffer() succeeded" << std::endl;
 
-    if (!createBindGroupLayout()) {
-        std::cerr << "[ERROR] Scene: createBindGroupLayout() failed" << std::endl;
+    if (!createBindGroupLayouts()) {
+        std::cerr << "[ERROR] Scene: createBindGroupLayouts() failed" << std::endl;
+        return false;
+    }
+    std::cout << "[SUCCESS] Scene: createBindGroupLayouts() succeeded" << std::endl;
+
+    if (!ensureObjectCapacity()) {
+        std::cerr << "[ERROR] Scene: ensureObjectCapacity() failed" << std::endl;
         return false;
     }
-    std::cout << "[SUCCESS] Scene: createBindGroupLayout() succeeded" << std::endl;
 
     if (!createRenderPipeline()) {
         std::cerr << "[ERROR] Scene: createRenderPipeline() failed" << std::endl;
@@ -168,56 +832,93 @@ bool Scene::createRenderingResources() {
 }
 
 bool Scene::createUniformBuffer() {
-    // Calculate aligned uniform size for dynamic offsets
-    alignedUniformSize = ((sizeof(ObjectUniforms) + UNIFORM_ALIGNMENT - 1) / UNIFORM_ALIGNMENT) * UNIFORM_ALIGNMENT;
-
-    // Create uniform buffer with space for multiple objects
-    wgpu::BufferDescriptor uniformBufferDesc{};
-    uniformBufferDesc.size = alignedUniformSize * MAX_OBJECTS;
-    uniformBufferDesc.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
-    uniformBuffer = device->CreateBuffer(&uniformBufferDesc);
-
-    if (!uniformBuffer) {
-        std::cerr << "[ERROR] Failed to create uniform buffer" << std::endl;
+    // Camera and time are shared by every draw: one small buffer, one bind group
+    wgpu::BufferDescriptor frameBufferDesc{};
+    frameBufferDesc.size = sizeof(FrameUniforms);
+    frameBufferDesc.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+    frameUniformBuffer = device->CreateBuffer(&frameBufferDesc);
+
+    if (!frameUniformBuffer) {
+        std::cerr << "[ERROR] Failed to create frame uniform buffer" << std::endl;
         return false;
     }
+    frameUniformsValid = false;
 
+    // The object data buffer is created by ensureObjectCapacity() once the layouts exist
     return true;
 }
 
-bool Scene::createBindGroupLayout() {
-    wgpu::BindGroupLayoutEntry layoutEntry{};
-    layoutEntry.binding = 0;
-    layoutEntry.visibility = wgpu::ShaderStage::Vertex;
-    layoutEntry.buffer.type = wgpu::BufferBindingType::Uniform;
-    layoutEntry.buffer.hasDynamicOffset = true;
-    layoutEntry.buffer.minBindingSize = sizeof(ObjectUniforms);
+bool Scene::createBindGroupLayouts() {
+    // Group 0: per-frame uniforms
+    wgpu::BindGroupLayoutEntry frameEntry{};
+    frameEntry.binding = 0;
+    frameEntry.visibility = wgpu::ShaderStage::Vertex;
+    frameEntry.buffer.type = wgpu::BufferBindingType::Uniform;
+    frameEntry.buffer.minBindingSize = sizeof(FrameUniforms);
+
+    wgpu::BindGroupLayoutDescriptor frameLayoutDesc{};
+    frameLayoutDesc.entryCount = 1;
+    frameLayoutDesc.entries = &frameEntry;
+
+    frameBindGroupLayout = device->CreateBindGroupLayout(&frameLayoutDesc);
+    if (!frameBindGroupLayout) {
+        std::cerr << "[ERROR] Failed to create frame bind group layout" << std::endl;
+        return false;
+    }
+
+    // Group 1: packed per-object records (no 256-byte dynamic offset padding)
+    wgpu::BindGroupLayoutEntry objectEntry{};
+    objectEntry.binding = 0;
+    objectEntry.visibility = wgpu::ShaderStage::Vertex;
+    objectEntry.buffer.type = wgpu::BufferBindingType::ReadOnlyStorage;
+    objectEntry.buffer.minBindingSize = sizeof(ObjectData);
 
-    wgpu::BindGroupLayoutDescriptor layoutDesc{};
-    layoutDesc.entryCount = 1;
-    layoutDesc.entries = &layoutEntry;
+    wgpu::BindGroupLayoutDescriptor objectLayoutDesc{};
+    objectLayoutDesc.entryCount = 1;
+    objectLayoutDesc.entries = &objectEntry;
 
-    bindGroupLayout = device->CreateBindGroupLayout(&layoutDesc);
-    if (!bindGroupLayout) {
-        std::cerr << "[ERROR] Failed to create bind group layout" << std::endl;
+    objectBindGroupLayout = device->CreateBindGroupLayout(&objectLayoutDesc);
+    if (!objectBindGroupLayout) {
+        std::cerr << "[ERROR] Failed to create object bind group layout" << std::endl;
         return false;
     }
 
-    // Create bind group
+    // The frame bind group never changes (the buffer is fixed-size)
+    wgpu::BindGroupEntry frameBindGroupEntry{};
+    frameBindGroupEntry.binding = 0;
+    frameBindGroupEntry.buffer = frameUniformBuffer;
+    frameBindGroupEntry.offset = 0;
+    frameBindGroupEntry.size = sizeof(FrameUniforms);
+
+    wgpu::BindGroupDescriptor frameBindGroupDesc{};
+    frameBindGroupDesc.layout = frameBindGroupLayout;
+    frameBindGroupDesc.entryCount = 1;
+    frameBindGroupDesc.entries = &frameBindGroupEntry;
+
+    frameBindGroup = device->CreateBindGroup(&frameBindGroupDesc);
+    if (!frameBindGroup) {
+        std::cerr << "[ERROR] Failed to create frame bind group" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool Scene::createObjectBindGroup() {
     wgpu::BindGroupEntry bindGroupEntry{};
     bindGroupEntry.binding = 0;
-    bindGroupEntry.buffer = uniformBuffer;
+    bindGroupEntry.buffer = objectDataBuffer;
     bindGroupEntry.offset = 0;
-    bindGroupEntry.size = alignedUniformSize;
+    bindGroupEntry.size = static_cast<uint64_t>(sizeof(ObjectData)) * objectCapacity;
 
     wgpu::BindGroupDescriptor bindGroupDesc{};
-    bindGroupDesc.layout = bindGroupLayout;
+    bindGroupDesc.layout = objectBindGroupLayout;
     bindGroupDesc.entryCount = 1;
     bindGroupDesc.entries = &bindGroupEntry;
 
-    bindGroup = device->CreateBindGroup(&bindGroupDesc);
-    if (!bindGroup) {
-        std::cerr << "[ERROR] Failed to create bind group" << std::endl;
+    objectBindGroup = device->CreateBindGroup(&bindGroupDesc);
+    if (!objectBindGroup) {
+        std::cerr << "[ERROR] Failed to create object bind group" << std::endl;
         return false;
     }
 
@@ -225,12 +926,19 @@ bool Scene::createBindGroupLayout() {
 }
 
 bool Scene::createRenderPipeline() {
+    // One pipeline per position encoding; both read only the position stream
+    renderPipeline = createPositionPipeline(resource::VertexEncoding::Float32x3);
+    quantizedRenderPipeline = createPositionPipeline(resource::VertexEncoding::Unorm16x4);
+    return renderPipeline && quantizedRenderPipeline;
+}
+
+wgpu::RenderPipeline Scene::createPositionPipeline(resource::VertexEncoding positionEncoding) {
     wgpu::ShaderModule vertexShader = shaderManager->loadShader("render/cube_vertex.wgsl");
     wgpu::ShaderModule fragmentShader = shaderManager->loadShader("render/cube_fragment.wgsl");
 
     if (!vertexShader || !fragmentShader) {
         std::cerr << "[ERROR] Failed to load shaders" << std::endl;
-        return false;
+        return nullptr;
     }
 
     wgpu::RenderPipelineDescriptor pipelineDesc{};
@@ -239,15 +947,15 @@ bool Scene::createRenderPipeline() {
     pipelineDesc.vertex.module = vertexShader;
     pipelineDesc.vertex.entryPoint = "vs_main";
 
-    // Vertex buffer layout
-    // Vertex struct: position(12) + normal(12) + texCoord(12) + color(12) = 48 bytes
+    // Vertex buffer layout: the mesh position stream only (see resource::VertexLayout);
+    // Unorm16x4 positions arrive as 0..1 and the object matrix dequantizes them
     wgpu::VertexAttribute positionAttr{};
-    positionAttr.format = wgpu::VertexFormat::Float32x3;
-    positionAttr.offset = 0;  // Position is at offset 0
-    positionAttr.shaderLocation = 0;
+    positionAttr.format = resource::VertexPacker::getWebGPUFormat(positionEncoding);
+    positionAttr.offset = 0;
+    positionAttr.shaderLocation = resource::VERTEX_LOCATION_POSITION;
 
     wgpu::VertexBufferLayout vertexBufferLayout{};
-    vertexBufferLayout.arrayStride = 12 * sizeof(float);  // 48 bytes: Vec3(pos) + Vec3(norm) + Vec3(tex) + Vec3(col)
+    vertexBufferLayout.arrayStride = resource::VertexPacker::getEncodingSize(positionEncoding);
     vertexBufferLayout.stepMode = wgpu::VertexStepMode::Vertex;
     vertexBufferLayout.attributeCount = 1;
     vertexBufferLayout.attributes = &positionAttr;
@@ -268,10 +976,11 @@ bool Scene::createRenderPipeline() {
     fragmentState.targets = &colorTarget;
     pipelineDesc.fragment = &fragmentState;
 
-    // Pipeline layout
+    // Pipeline layout: group 0 = frame, group 1 = objects
+    wgpu::BindGroupLayout bindGroupLayouts[2] = {frameBindGroupLayout, objectBindGroupLayout};
     wgpu::PipelineLayoutDescriptor layoutDesc{};
-    layoutDesc.bindGroupLayoutCount = 1;
-    layoutDesc.bindGroupLayouts = &bindGroupLayout;
+    layoutDesc.bindGroupLayoutCount = 2;
+    layoutDesc.bindGroupLayouts = bindGroupLayouts;
 
     wgpu::PipelineLayout pipelineLayout = device->CreatePipelineLayout(&layoutDesc);
     pipelineDesc.layout = pipelineLayout;
@@ -294,70 +1003,712 @@ bool Scene::createRenderPipeline() {
     pipelineDesc.multisample.mask = ~0u;
     pipelineDesc.multisample.alphaToCoverageEnabled = false;
 
-    renderPipeline = device->CreateRenderPipeline(&pipelineDesc);
-    if (!renderPipeline) {
+    wgpu::RenderPipeline pipeline = device->CreateRenderPipeline(&pipelineDesc);
+    if (!pipeline) {
         std::cerr << "[ERROR] Failed to create render pipeline" << std::endl;
-        return false;
     }
-
-    return true;
+    return pipeline;
 }
 
 // ========== Rendering ==========
 
-void Scene::updateObjectUniforms(const SceneObject& object, size_t objectIndex) {
-    ObjectUniforms uniforms;
-    uniforms.viewProj = camera->getViewProjectionMatrix();
-    uniforms.model = object.getModelMatrix();
-    uniforms.time = object.getAnimationTime();
+// ========== GPU Data Uploads ==========
+
+uint32_t Scene::allocateObjectSlot(SceneObject* object) {
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        slotObjects[slot] = object;
+    } else {
+        slot = static_cast<uint32_t>(slotObjects.size());
+        slotObjects.push_back(object);
+    }
+    object->objectSlot = static_cast<int32_t>(slot);
+    markObjectDataDirty(slot);
+    return slot;
+}
 
-    // Write to the specific offset for this object
-    uint32_t offset = static_cast<uint32_t>(objectIndex * alignedUniformSize);
-    device->GetQueue().WriteBuffer(uniformBuffer, offset, &uniforms, sizeof(ObjectUniforms));
+void Scene::releaseObjectSlot(SceneObject* object) {
+    if (object->objectSlot < 0) return;
+    
+    // A stale record is never drawn, so the slot needs no upload
+    uint32_t slot = static_cast<uint32_t>(object->objectSlot);
+    slotObjects[slot] = nullptr;
+    freeSlots.push_back(slot);
+    object->objectSlot = -1;
 }
 
-void Scene::renderObject(wgpu::RenderPassEncoder& renderPass, 
-                        const SceneObject& object, 
-                        size_t objectIndex) {
-    auto model = object.getModel();
-    if (!model) return;
+void Scene::markObjectDataDirty(uint32_t slot) {
+    if (slot >= slotDirty.size()) {
+        slotDirty.resize(std::max<size_t>(slot + 1, slotDirty.size() * 2), 0);
+    }
+    if (!slotDirty[slot]) {
+        slotDirty[slot] = 1;
+        dirtySlots.push_back(slot);
+    }
+}
+
+bool Scene::ensureObjectCapacity() {
+    if (objectDataBuffer && slotObjects.size() <= objectCapacity) {
+        return true;
+    }
     
-    // Update uniforms
-    updateObjectUniforms(object, objectIndex);
+    uint32_t newCapacity = std::max({INITIAL_OBJECT_CAPACITY, objectCapacity * 2,
+                                     static_cast<uint32_t>(slotObjects.size())});
     
-    // Set bind group with dynamic offset
-    uint32_t dynamicOffset = static_cast<uint32_t>(objectIndex * alignedUniformSize);
-    renderPass.SetBindGroup(0, bindGroup, 1, &dynamicOffset);
+    wgpu::BufferDescriptor bufferDesc{};
+    bufferDesc.size = static_cast<uint64_t>(sizeof(ObjectData)) * newCapacity;
+    bufferDesc.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopyDst;
+    wgpu::Buffer newBuffer = device->CreateBuffer(&bufferDesc);
     
-    // Render each mesh in the model
-    const auto& meshes = model->getMeshes();
+    if (!newBuffer) {
+        std::cerr << "[ERROR] Failed to create object data buffer (" << newCapacity << " objects)" << std::endl;
+        return false;
+    }
+    
+    objectDataBuffer = newBuffer;
+    objectCapacity = newCapacity;
+    objectData.resize(newCapacity);
+    if (!createObjectBindGroup()) {
+        return false;
+    }
+    
+    // The new buffer starts empty: every allocated record must be re-sent
+    for (uint32_t slot = 0; slot < slotObjects.size(); ++slot) {
+        if (slotObjects[slot]) {
+            markObjectDataDirty(slot);
+        }
+    }
+    
+    std::cout << "[INFO] Scene: object data buffer sized for " << newCapacity << " objects" << std::endl;
+    return true;
+}
+
+void Scene::uploadFrameData() {
+    uploadStats = GPUUploadStats();
+    if (!ensureObjectCapacity()) {
+        return;
+    }
+    
+    wgpu::Queue queue = device->GetQueue();
+    
+    // Camera and time: one small write, skipped when nothing changed
+    FrameUniforms frame{};
+    frame.viewProj = camera->getViewProjectionMatrix();
+    frame.time = elapsedTime;
+    if (!frameUniformsValid || std::memcmp(&frame, &frameUniforms, sizeof(FrameUniforms)) != 0) {
+        frameUniforms = frame;
+        frameUniformsValid = true;
+        queue.WriteBuffer(frameUniformBuffer, 0, &frameUniforms, sizeof(FrameUniforms));
+        uploadStats.writeCalls++;
+        uploadStats.bytesUploaded += sizeof(FrameUniforms);
+    }
+    
+    if (dirtySlots.empty()) {
+        return;
+    }
+    
+    // Refresh the CPU mirror of every dirty record
+    for (uint32_t slot : dirtySlots) {
+        slotDirty[slot] = 0;
+        if (const SceneObject* object = slotObjects[slot]) {  // Skip slots released since marked
+            // Quantized positions are mapped back to model space by the same matrix
+            const auto& model = object->getModel();
+            objectData[slot].model = model ? object->getModelMatrix() * model->getPositionDequantization()
+                                           : object->getModelMatrix();
+            uploadStats.dirtyObjects++;
+        }
+    }
+    
+    // Coalesce sorted slots into ranges; a short run of clean slots is cheaper
+    // to re-send from the mirror than an extra WriteBuffer call
+    std::sort(dirtySlots.begin(), dirtySlots.end());
+    size_t i = 0;
+    while (i < dirtySlots.size()) {
+        uint32_t first = dirtySlots[i];
+        uint32_t last = first;
+        while (++i < dirtySlots.size() && dirtySlots[i] - last <= MAX_COALESCE_GAP + 1) {
+            last = dirtySlots[i];
+        }
+        
+        uint64_t offset = static_cast<uint64_t>(first) * sizeof(ObjectData);
+        uint64_t size = static_cast<uint64_t>(last - first + 1) * sizeof(ObjectData);
+        queue.WriteBuffer(objectDataBuffer, offset, &objectData[first], size);
+        uploadStats.writeCalls++;
+        uploadStats.bytesUploaded += size;
+    }
+    dirtySlots.clear();
+}
+
+void Scene::cullOccludedObjects() {
+    occlusionCuller.beginFrame(camera->getViewProjectionMatrix());
+    
+    // Occluders use full detail: the buffer is tiny, and LOD 0 hides the most
+    for (SceneObject* object : renderQueue) {
+        if (!object->isOccluder()) continue;
+        Mat4 modelMatrix = object->getModelMatrix();
+        for (const auto& mesh : object->getModel()->getMeshes()) {
+            if (mesh) {
+                occlusionCuller.addOccluder(*mesh, modelMatrix);
+            }
+        }
+    }
+    
+    if (occlusionCuller.getOccluderCount() == 0) {
+        return;
+    }
+    occlusionCuller.rasterize(getJobs());
+    
+    // Occluders are always drawn; everything else is tested by world bounds
+    occludeeBounds.clear();
+    for (SceneObject* object : renderQueue) {
+        if (!object->isOccluder()) {
+            occludeeBounds.push_back(object->getCachedWorldBounds());
+        }
+    }
+    occludeeVisibility.resize(occludeeBounds.size());
+    occlusionCuller.testVisibility(occludeeBounds.data(), occludeeBounds.size(), occludeeVisibility.data(),
+                                   getJobs());
+    
+    size_t tested = 0;
+    auto hidden = [&](SceneObject* object) {
+        return !object->isOccluder() && !occludeeVisibility[tested++];
+    };
+    renderQueue.erase(std::remove_if(renderQueue.begin(), renderQueue.end(), hidden), renderQueue.end());
+}
+
+void Scene::renderObject(wgpu::RenderPassEncoder& renderPass, const SceneObject& object) {
+    auto model = object.getModel();
+    if (!model || object.objectSlot < 0) return;
+    
+    // The object's record is selected in the shader through instance_index
+    uint32_t firstInstance = static_cast<uint32_t>(object.objectSlot);
+    
+    // Render each mesh of the selected LOD
+    const auto& meshes = model->getLODMeshes(object.getCurrentLOD());
     for (const auto& mesh : meshes) {
         if (!mesh || !mesh->hasGPUResources()) continue;
         
-        // Set vertex and index buffers
-        renderPass.SetVertexBuffer(0, mesh->getVertexBuffer());
-        renderPass.SetIndexBuffer(mesh->getIndexBuffer(), wgpu::IndexFormat::Uint32);
+        // Position encoding selects the pipeline (switched only when it changes)
+        bool quantized = mesh->getVertexLayout().hasQuantizedPositions();
+        if (quantized != quantizedPipelineBound) {
+            renderPass.SetPipeline(quantized ? quantizedRenderPipeline : renderPipeline);
+            quantizedPipelineBound = quantized;
+        }
+        
+        // Meshes share MeshBufferPool arenas: rebind only when the arena (or
+        // index format) changes. Position-only pipeline: the attribute stream stays unbound
+        wgpu::Buffer positionBuffer = mesh->getPositionBuffer();
+        if (positionBuffer.Get() != boundPositionBuffer) {
+            renderPass.SetVertexBuffer(0, positionBuffer);
+            boundPositionBuffer = positionBuffer.Get();
+            lodStats.bufferBinds++;
+        }
+        wgpu::Buffer indexBuffer = mesh->getIndexBuffer();
+        if (indexBuffer.Get() != boundIndexBuffer || mesh->getIndexFormat() != boundIndexFormat) {
+            renderPass.SetIndexBuffer(indexBuffer, mesh->getIndexFormat());
+            boundIndexBuffer = indexBuffer.Get();
+            boundIndexFormat = mesh->getIndexFormat();
+            lodStats.bufferBinds++;
+        }
         
-        // Draw
-        renderPass.DrawIndexed(static_cast<uint32_t>(mesh->getIndexCount()), 1, 0, 0, 0);
+        // Draw the mesh's ranges of the arenas
+        renderPass.DrawIndexed(static_cast<uint32_t>(mesh->getIndexCount()), 1, mesh->getFirstIndex(),
+                               static_cast<int32_t>(mesh->getBaseVertex()), firstInstance);
+        lodStats.drawCalls++;
     }
 }
 
 // ========== Selection Management ==========
 
 void Scene::setSelectedObject(SceneObject* object) {
-    // Deselect previous object
-    if (selectedObject) {
-        selectedObject->setSelected(false);
+    clearSelection();
+    if (object) {
+        addToSelection(object);
+    }
+}
+
+void Scene::selectObject(SceneObject* object, SelectionMode mode) {
+    if (!object) return;
+    
+    switch (mode) {
+        case SelectionMode::Replace:
+            setSelectedObject(object);
+            break;
+        case SelectionMode::Add:
+            addToSelection(object);
+            break;
+        case SelectionMode::Subtract:
+            removeFromSelection(object);
+            break;
+        case SelectionMode::Toggle:
+            if (isObjectSelected(object)) {
+                removeFromSelection(object);
+            } else {
+                addToSelection(object);
+            }
+            break;
+    }
+}
+
+void Scene::selectObjects(const std::vector<SceneObject*>& objects, SelectionMode mode) {
+    if (mode == SelectionMode::Replace) {
+        clearSelection();
+        mode = SelectionMode::Add;
     }
     
-    // Select new object
-    selectedObject = object;
-    if (selectedObject) {
-        selectedObject->setSelected(true);
+    selectedObjects.reserve(selectedObjects.size() + (mode == SelectionMode::Subtract ? 0 : objects.size()));
+    for (SceneObject* object : objects) {
+        selectObject(object, mode);
+    }
+}
+
+void Scene::deselectObject(SceneObject* object) {
+    if (object) {
+        removeFromSelection(object);
     }
 }
 
+void Scene::clearSelection() {
+    for (SceneObject* object : selectedObjects) {
+        object->selectionIndex = -1;
+        object->setSelected(false);
+    }
+    selectedObjects.clear();
+    selectionHighlightDirty = true;
+}
+
+void Scene::addToSelection(SceneObject* object) {
+    if (object->selectionIndex >= 0) return;
+    
+    object->selectionIndex = static_cast<int32_t>(selectedObjects.size());
+    object->setSelected(true);
+    selectedObjects.push_back(object);
+    selectionHighlightDirty = true;
+}
+
+void Scene::removeFromSelection(SceneObject* object) {
+    int32_t index = object->selectionIndex;
+    if (index < 0) return;
+    
+    // Swap-and-pop keeps removal O(1); only the primary (last) entry keeps its meaning
+    SceneObject* last = selectedObjects.back();
+    selectedObjects[index] = last;
+    last->selectionIndex = index;
+    selectedObjects.pop_back();
+    
+    object->selectionIndex = -1;
+    object->setSelected(false);
+    selectionHighlightDirty = true;
+}
+
+// ========== Spatial Queries ==========
+
+void Scene::onObjectBoundsDirty(SceneObject* object) {
+    dirtyBoundsObjects.push_back(object);
+    
+    // A new model may bring another position dequantization into the record
+    if (object->objectSlot >= 0) {
+        markObjectDataDirty(static_cast<uint32_t>(object->objectSlot));
+    }
+}
+
+void Scene::removeFromSpatialIndex(SceneObject* object) {
+    if (object->spatialProxyId != DynamicAABBTree::NULL_NODE) {
+        spatialIndex.destroyProxy(object->spatialProxyId);
+        object->spatialProxyId = DynamicAABBTree::NULL_NODE;
+    }
+    object->ownerScene = nullptr;
+}
+
+// ========== Level of Detail ==========
+
+uint32_t Scene::selectObjectLOD(SceneObject& object, const Vec3& cameraPosition, float projectionScale) {
+    const auto& model = object.getModel();
+    uint32_t lod = 0;
+    
+    if (lodEnabled && model->getLODCount() > 1) {
+        // Bounding sphere of the world AABB, projected: diameter / visible height at that distance
+        const AABB& bounds = object.cachedWorldBounds;
+        float radius = (bounds.max - bounds.min).length() * 0.5f;
+        float distance = (bounds.center() - cameraPosition).length();
+        float screenSize = distance > radius
+            ? (radius / distance) * projectionScale * lodBias
+            : std::numeric_limits<float>::max();
+        
+        lod = model->selectLOD(screenSize, object.currentLOD, lodHysteresis);
+    }
+    object.currentLOD = lod;
+    
+    lodStats.objectsDrawn++;
+    lodStats.trianglesDrawn += model->getLODTriangleCount(lod);
+    lodStats.trianglesFullDetail += model->getLODTriangleCount(0);
+    lodStats.objectsPerLOD[std::min(lod, LODStats::MAX_TRACKED_LODS - 1)]++;
+    return lod;
+}
+
+// ========== Hierarchy ==========
+
+bool Scene::setParent(SceneObject* child, SceneObject* parent) {
+    if (!child || child->ownerScene != this || (parent && parent->ownerScene != this)) {
+        std::cerr << "[ERROR] setParent: objects must belong to this scene" << std::endl;
+        return false;
+    }
+    if (child->parent == parent) {
+        return true;
+    }
+    
+    // Reject cycles: the new parent must not be the child or one of its descendants
+    for (SceneObject* ancestor = parent; ancestor; ancestor = ancestor->parent) {
+        if (ancestor == child) {
+            std::cerr << "[ERROR] setParent: '" << parent->getName() << "' is a descendant of '"
+                      << child->getName() << "'" << std::endl;
+            return false;
+        }
+    }
+    
+    if (child->parent) {
+        auto& siblings = child->parent->children;
+        siblings.erase(std::find(siblings.begin(), siblings.end(), child));
+    }
+    child->parent = parent;
+    if (parent) {
+        parent->children.push_back(child);
+    }
+    
+    transformHierarchy.markStructureDirty();
+    return true;
+}
+
+void Scene::detachFromHierarchy(SceneObject* object) {
+    // Children of a removed object become roots (their local transform is kept)
+    transformHierarchy.removeNode(object);
+    for (SceneObject* child : object->children) {
+        child->parent = nullptr;
+    }
+    object->children.clear();
+    
+    if (object->parent) {
+        auto& siblings = object->parent->children;
+        siblings.erase(std::find(siblings.begin(), siblings.end(), object));
+        object->parent = nullptr;
+    }
+}
+
+void Scene::onObjectTransformDirty(SceneObject* object) {
+    transformHierarchy.markLocalDirty(object->hierarchyIndex);
+}
+
+void Scene::onObjectAnimatedChanged(SceneObject* object) {
+    if (object->animated && object->animatedIndex < 0) {
+        object->animatedIndex = static_cast<int32_t>(animatedObjects.size());
+        animatedObjects.push_back(object);
+    } else if (!object->animated && object->animatedIndex >= 0) {
+        // Swap-remove, like the dense object list
+        SceneObject* moved = animatedObjects.back();
+        moved->animatedIndex = object->animatedIndex;
+        animatedObjects[moved->animatedIndex] = moved;
+        animatedObjects.pop_back();
+        object->animatedIndex = -1;
+    }
+}
+
+void Scene::updateTransforms() {
+    hierarchyRoots.clear();
+    if (transformHierarchy.isStructureDirty()) {
+        hierarchyRoots.reserve(objectList.size());
+        for (SceneObject* object : objectList) {
+            if (!object->parent) {
+                hierarchyRoots.push_back(object);
+            }
+        }
+    }
+    
+    transformChangedObjects.clear();
+    transformHierarchy.update(hierarchyRoots, transformChangedObjects, getJobs());
+    
+    // World matrices moved - their bounds must be re-indexed and their records re-sent
+    for (SceneObject* object : transformChangedObjects) {
+        object->markBoundsDirty();
+        if (object->objectSlot >= 0) {
+            markObjectDataDirty(static_cast<uint32_t>(object->objectSlot));
+        }
+    }
+}
+
+void Scene::updateSpatialIndex() {
+    flushDestroyedObjects();
+    updateTransforms();
+    
+    // Model-space bounds are computed lazily and Models are shared between
+    // objects: settle them here so the parallel pass below only reads
+    for (SceneObject* object : dirtyBoundsObjects) {
+        if (object->model) {
+            Vec3 modelMin, modelMax;
+            object->model->getBounds(modelMin, modelMax);
+        }
+    }
+    
+    // World bounds in parallel (each object writes only its own cache)
+    getJobs().parallelFor(dirtyBoundsObjects.size(), BOUNDS_GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            SceneObject* object = dirtyBoundsObjects[i];
+            object->getWorldBounds(object->cachedWorldBounds.min, object->cachedWorldBounds.max);
+        }
+    });
+    
+    // Tree updates stay serial, in dirty-list order
+    for (SceneObject* object : dirtyBoundsObjects) {
+        object->boundsDirty = false;
+        if (object->selectionIndex >= 0) {
+            selectionHighlightDirty = true;
+        }
+        
+        if (object->spatialProxyId == DynamicAABBTree::NULL_NODE) {
+            object->spatialProxyId = spatialIndex.createProxy(object->cachedWorldBounds, object);
+        } else {
+            spatialIndex.moveProxy(object->spatialProxyId, object->cachedWorldBounds);
+        }
+    }
+    dirtyBoundsObjects.clear();
+}
+
+void Scene::queryRay(const Ray& ray, float maxDistance, std::vector<RayCandidate>& results) {
+    updateSpatialIndex();
+    results.clear();
+    
+    spatialIndex.raycast(ray, maxDistance, [&](int32_t proxyId, float currentMax) {
+        auto* object = static_cast<SceneObject*>(spatialIndex.getUserData(proxyId));
+        
+        // Fat AABB passed - confirm against the tight bounds
+        float tMin, tMax;
+        if (ray.intersectAABB(object->cachedWorldBounds, tMin, tMax) &&
+            tMax >= 0.0f && tMin <= currentMax) {
+            results.push_back({object, tMin});
+        }
+        return currentMax;
+    });
+    
+    std::sort(results.begin(), results.end(),
+              [](const RayCandidate& a, const RayCandidate& b) {
+                  return a.distance < b.distance;
+              });
+}
+
+void Scene::queryFrustum(const Frustum& frustum, std::vector<SceneObject*>& results) {
+    updateSpatialIndex();
+    results.clear();
+    
+    spatialIndex.query(frustum, [&](int32_t proxyId) {
+        auto* object = static_cast<SceneObject*>(spatialIndex.getUserData(proxyId));
+        if (frustum.intersectsAABB(object->cachedWorldBounds)) {
+            results.push_back(object);
+        }
+        return true;
+    });
+}
+
+void Scene::queryAABB(const AABB& box, std::vector<SceneObject*>& results) {
+    updateSpatialIndex();
+    results.clear();
+    
+    spatialIndex.query(box, [&](int32_t proxyId) {
+        auto* object = static_cast<SceneObject*>(spatialIndex.getUserData(proxyId));
+        if (object->cachedWorldBounds.overlaps(box)) {
+            results.push_back(object);
+        }
+        return true;
+    });
+}
+
+SceneObject* Scene::queryNearest(const Vec3& point, float maxDistance, float* outDistance) {
+    updateSpatialIndex();
+    
+    float distanceSq = 0.0f;
+    int32_t proxyId = spatialIndex.nearest(point, maxDistance, [&](int32_t id) {
+        auto* object = static_cast<SceneObject*>(spatialIndex.getUserData(id));
+        return object->cachedWorldBounds.distanceSquared(point);
+    }, &distanceSq);
+    
+    if (proxyId == DynamicAABBTree::NULL_NODE) {
+        return nullptr;
+    }
+    
+    if (outDistance) {
+        *outDistance = std::sqrt(distanceSq);
+    }
+    return static_cast<SceneObject*>(spatialIndex.getUserData(proxyId));
+}
+
+// ========== Scene Queries (raycast / overlap) ==========
+
+bool Scene::intersectObject(const Ray& ray, SceneObject* object, float maxDistance,
+                            RaycastHit& hit) {
+    auto model = object->getModel();
+    if (!model) {
+        return false;
+    }
+    
+    // Transform the ray into object space once instead of transforming every vertex.
+    // The direction is left unnormalized so t stays in world ray units.
+    Mat4 modelMatrix = object->getModelMatrix();
+    Mat4 invModel = modelMatrix.inverse();
+    Ray localRay(invModel.transformPoint(ray.origin), invModel.transformDirection(ray.direction));
+    
+    const auto& meshes = model->getMeshes();
+    float closestT = maxDistance;
+    const resource::Mesh* hitMesh = nullptr;
+    resource::MeshBVH::Hit closestHit;
+    
+    for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex) {
+        const auto& mesh = meshes[meshIndex];
+        if (!mesh) continue;
+        
+        const resource::MeshBVH* bvh = mesh->getBVH();
+        if (!bvh) continue;
+        
+        resource::MeshBVH::Hit meshHit;
+        if (bvh->intersect(localRay, closestT, meshHit)) {
+            closestT = meshHit.t;
+            closestHit = meshHit;
+            hitMesh = mesh.get();
+            hit.meshIndex = static_cast<uint32_t>(meshIndex);
+        }
+    }
+    
+    if (!hitMesh) {
+        return false;
+    }
+    
+    hit.object = object;
+    hit.distance = closestT;
+    hit.point = ray.origin + ray.direction * closestT;
+    hit.triangleIndex = closestHit.triangleIndex;
+    
+    // Geometric normal in object space -> world space (inverse transpose)
+    const auto& vertices = hitMesh->getVertices();
+    const auto& indices = hitMesh->getIndices();
+    size_t base = static_cast<size_t>(closestHit.triangleIndex) * 3;
+    const Vec3& v0 = vertices[indices[base]].position;
+    const Vec3& v1 = vertices[indices[base + 1]].position;
+    const Vec3& v2 = vertices[indices[base + 2]].position;
+    Vec3 localNormal = (v1 - v0).cross(v2 - v0);
+    hit.normal = invModel.transpose().transformDirection(localNormal).normalized();
+    return true;
+}
+
+bool Scene::raycastIndexed(const Ray& ray, float maxDistance, uint32_t layerMask,
+                           RaycastHit& hit) const {
+    hit = RaycastHit();
+    bool found = false;
+    
+    // Nodes are visited nearest first; returning the best t clips the rest of the traversal
+    spatialIndex.raycast(ray, maxDistance, [&](int32_t proxyId, float currentMax) {
+        auto* object = static_cast<SceneObject*>(spatialIndex.getUserData(proxyId));
+        if (!object->isInLayers(layerMask)) {
+            return currentMax;
+        }
+        
+        float tMin, tMax;
+        if (!ray.intersectAABB(object->cachedWorldBounds, tMin, tMax) ||
+            tMax < 0.0f || tMin > currentMax) {
+            return currentMax;
+        }
+        
+        RaycastHit objectHit;
+        if (intersectObject(ray, object, currentMax, objectHit)) {
+            hit = objectHit;
+            found = true;
+            return objectHit.distance;
+        }
+        return currentMax;
+    });
+    
+    return found;
+}
+
+bool Scene::raycast(const Ray& ray, RaycastHit& hit, float maxDistance, uint32_t layerMask) {
+    updateSpatialIndex();
+    return raycastIndexed(ray, maxDistance, layerMask, hit);
+}
+
+size_t Scene::raycastAll(const Ray& ray, std::vector<RaycastHit>& results,
+                         float maxDistance, uint32_t layerMask) {
+    updateSpatialIndex();
+    results.clear();
+    
+    spatialIndex.raycast(ray, maxDistance, [&](int32_t proxyId, float currentMax) {
+        auto* object = static_cast<SceneObject*>(spatialIndex.getUserData(proxyId));
+        if (!object->isInLayers(layerMask)) {
+            return currentMax;
+        }
+        
+        RaycastHit objectHit;
+        if (intersectObject(ray, object, currentMax, objectHit)) {
+            results.push_back(objectHit);
+        }
+        return currentMax;
+    });
+    
+    std::sort(results.begin(), results.end(),
+              [](const RaycastHit& a, const RaycastHit& b) {
+                  return a.distance < b.distance;
+              });
+    return results.size();
+}
+
+size_t Scene::raycastBatch(const Ray* rays, size_t count, RaycastHit* hits,
+                           float maxDistance, uint32_t layerMask) {
+    // Re-index once on this thread; the parallel part only reads the tree
+    updateSpatialIndex();
+    
+    std::atomic<size_t> hitCount{0};
+    getJobs().parallelFor(count, 64, [&](size_t begin, size_t end) {
+        size_t localHits = 0;
+        for (size_t i = begin; i < end; ++i) {
+            localHits += raycastIndexed(rays[i], maxDistance, layerMask, hits[i]) ? 1 : 0;
+        }
+        hitCount.fetch_add(localHits, std::memory_order_relaxed);
+    });
+    
+    return hitCount.load();
+}
+
+size_t Scene::overlapSphere(const Vec3& center, float radius, std::vector<SceneObject*>& results,
+                            uint32_t layerMask) {
+    updateSpatialIndex();
+    results.clear();
+    
+    Vec3 extent(radius, radius, radius);
+    AABB sphereBounds(center - extent, center + extent);
+    float radiusSq = radius * radius;
+    
+    spatialIndex.query(sphereBounds, [&](int32_t proxyId) {
+        auto* object = static_cast<SceneObject*>(spatialIndex.getUserData(proxyId));
+        if (object->isInLayers(layerMask) &&
+            object->cachedWorldBounds.distanceSquared(center) <= radiusSq) {
+            results.push_back(object);
+        }
+        return true;
+    });
+    return results.size();
+}
+
+size_t Scene::overlapBox(const AABB& box, std::vector<SceneObject*>& results, uint32_t layerMask) {
+    updateSpatialIndex();
+    results.clear();
+    
+    spatialIndex.query(box, [&](int32_t proxyId) {
+        auto* object = static_cast<SceneObject*>(spatialIndex.getUserData(proxyId));
+        if (object->isInLayers(layerMask) && object->cachedWorldBounds.overlaps(box)) {
+            results.push_back(object);
+        }
+        return true;
+    });
+    return results.size();
+}
+
 // ========== Bounding Box Rendering ==========
 
 bool Scene::createBoundingBoxPipeline() {
@@ -376,16 +1727,29 @@ bool Scene::createBoundingBoxPipeline() {
     vertexAttribute.offset = 0;
     vertexAttribute.shaderLocation = 0;
     
-    wgpu::VertexBufferLayout vertexBufferLayout{};
-    vertexBufferLayout.arrayStride = sizeof(float) * 3; // x, y, z
-    vertexBufferLayout.stepMode = wgpu::VertexStepMode::Vertex;
-    vertexBufferLayout.attributeCount = 1;
-    vertexBufferLayout.attributes = &vertexAttribute;
+    // Per-instance box center and size (one instance per selected object)
+    wgpu::VertexAttribute instanceAttributes[2]{};
+    instanceAttributes[0].format = wgpu::VertexFormat::Float32x3;
+    instanceAttributes[0].offset = 0;
+    instanceAttributes[0].shaderLocation = 1;
+    instanceAttributes[1].format = wgpu::VertexFormat::Float32x3;
+    instanceAttributes[1].offset = sizeof(float) * 3;
+    instanceAttributes[1].shaderLocation = 2;
+    
+    wgpu::VertexBufferLayout vertexBufferLayouts[2]{};
+    vertexBufferLayouts[0].arrayStride = sizeof(float) * 3; // x, y, z
+    vertexBufferLayouts[0].stepMode = wgpu::VertexStepMode::Vertex;
+    vertexBufferLayouts[0].attributeCount = 1;
+    vertexBufferLayouts[0].attributes = &vertexAttribute;
+    vertexBufferLayouts[1].arrayStride = sizeof(float) * 6; // center.xyz, size.xyz
+    vertexBufferLayouts[1].stepMode = wgpu::VertexStepMode::Instance;
+    vertexBufferLayouts[1].attributeCount = 2;
+    vertexBufferLayouts[1].attributes = instanceAttributes;
     
     // Pipeline layout
     wgpu::PipelineLayoutDescriptor layoutDesc{};
     layoutDesc.bindGroupLayoutCount = 1;
-    layoutDesc.bindGroupLayouts = &bindGroupLayout; // Reuse same layout
+    layoutDesc.bindGroupLayouts = &frameBindGroupLayout; // Boxes are in world space: frame data only
     wgpu::PipelineLayout pipelineLayout = device->CreatePipelineLayout(&layoutDesc);
     
     // Create render pipeline for lines
@@ -395,8 +1759,8 @@ bool Scene::createBoundingBoxPipeline() {
     // Vertex stage
     pipelineDesc.vertex.module = vertexShaderModule;
     pipelineDesc.vertex.entryPoint = "main";
-    pipelineDesc.vertex.bufferCount = 1;
-    pipelineDesc.vertex.buffers = &vertexBufferLayout;
+    pipelineDesc.vertex.bufferCount = 2;
+    pipelineDesc.vertex.buffers = vertexBufferLayouts;
     
     // Fragment stage
     wgpu::FragmentState fragmentState{};
@@ -462,8 +1826,8 @@ bool Scene::createBoundingBoxGeometry() {
         -0.5f,  0.5f,  0.5f   // 7: left  top    front
     };
     
-    // Create indices for 12 edges (24 indices for line list)
-    uint32_t indices[] = {
+    // Create indices for 12 edges (24 indices for line list, 48 bytes)
+    uint16_t indices[] = {
         // Back face
         0, 1,  1, 2,  2, 3,  3, 0,
         // Front face
@@ -472,7 +1836,7 @@ bool Scene::createBoundingBoxGeometry() {
         0, 4,  1, 5,  2, 6,  3, 7
     };
     
-    boundingBoxIndexCount = sizeof(indices) / sizeof(uint32_t);
+    boundingBoxIndexCount = sizeof(indices) / sizeof(uint16_t);
     
     // Create vertex buffer
     wgpu::BufferDescriptor vertexBufferDesc{};
@@ -503,44 +1867,77 @@ bool Scene::createBoundingBoxGeometry() {
     return true;
 }
 
-void Scene::renderBoundingBox(wgpu::RenderPassEncoder& renderPass, const SceneObject& object) {
+bool Scene::updateSelectionInstances() {
+    // Selected objects' bounds may have changed since the last update()
+    updateSpatialIndex();
+    if (!selectionHighlightDirty) {
+        return true;
+    }
+    selectionHighlightDirty = false;
+    
+    selectionInstanceData.clear();
+    selectionInstanceData.reserve(selectedObjects.size() * 6);
+    for (const SceneObject* object : selectedObjects) {
+        if (!object->hasModel()) continue;
+        
+        const AABB& bounds = object->getCachedWorldBounds();
+        Vec3 center = bounds.center();
+        Vec3 size = bounds.size();
+        selectionInstanceData.insert(selectionInstanceData.end(),
+                                     {center.x, center.y, center.z, size.x, size.y, size.z});
+    }
+    selectionInstanceCount = static_cast<uint32_t>(selectionInstanceData.size() / 6);
+    if (selectionInstanceCount == 0) {
+        return true;
+    }
+    
+    // Grow the instance buffer geometrically so large selections don't reallocate every change
+    if (selectionInstanceCount > selectionInstanceCapacity) {
+        uint32_t newCapacity = std::max<uint32_t>(64, selectionInstanceCapacity);
+        while (newCapacity < selectionInstanceCount) {
+            newCapacity *= 2;
+        }
+        
+        wgpu::BufferDescriptor instanceBufferDesc{};
+        instanceBufferDesc.size = static_cast<uint64_t>(newCapacity) * sizeof(float) * 6;
+        instanceBufferDesc.usage = wgpu::BufferUsage::Vertex | wgpu::BufferUsage::CopyDst;
+        selectionInstanceBuffer = device->CreateBuffer(&instanceBufferDesc);
+        
+        if (!selectionInstanceBuffer) {
+            std::cerr << "[ERROR] Failed to create selection instance buffer" << std::endl;
+            selectionInstanceCapacity = 0;
+            selectionInstanceCount = 0;
+            return false;
+        }
+        selectionInstanceCapacity = newCapacity;
+    }
+    
+    device->GetQueue().WriteBuffer(selectionInstanceBuffer, 0, selectionInstanceData.data(),
+                                   selectionInstanceData.size() * sizeof(float));
+    return true;
+}
+
+void Scene::renderSelectionHighlights(wgpu::RenderPassEncoder& renderPass) {
     if (!boundingBoxPipeline || !boundingBoxVertexBuffer || !boundingBoxIndexBuffer) {
         return;
     }
+    
+    if (!updateSelectionInstances() || selectionInstanceCount == 0) {
+        return;
+    }
 
-    // Get world bounds
-    Vec3 minBound, maxBound;
-    object.getWorldBounds(minBound, maxBound);
-
-    // Calculate center and size
-    Vec3 center = (minBound + maxBound) * 0.5f;
-    Vec3 size = maxBound - minBound;
-
-    // Create transform matrix for bounding box
-    Mat4 boxTransform = Mat4::translation(center) * Mat4::scale(size);
-
-    // Update uniforms for bounding box
-    ObjectUniforms uniforms;
-    uniforms.viewProj = camera->getViewProjectionMatrix();
-    uniforms.model = boxTransform;
-    uniforms.time = 0.0f;
-
-    // Use the last available slot (MAX_OBJECTS - 1) to avoid overwriting object uniforms
-    // This ensures we don't corrupt any object's uniform data
-    uint32_t boundingBoxSlot = MAX_OBJECTS - 1;
-    uint32_t boundingBoxOffset = static_cast<uint32_t>(boundingBoxSlot * alignedUniformSize);
-    device->GetQueue().WriteBuffer(uniformBuffer, boundingBoxOffset, &uniforms, sizeof(ObjectUniforms));
-
-    // Set pipeline and bind group
+    // Boxes are already in world space (instance center/size): only frame data is needed
     renderPass.SetPipeline(boundingBoxPipeline);
-    renderPass.SetBindGroup(0, bindGroup, 1, &boundingBoxOffset);
+    renderPass.SetBindGroup(0, frameBindGroup);
 
-    // Set vertex and index buffers
+    // Set vertex, instance and index buffers
     renderPass.SetVertexBuffer(0, boundingBoxVertexBuffer);
-    renderPass.SetIndexBuffer(boundingBoxIndexBuffer, wgpu::IndexFormat::Uint32);
+    renderPass.SetVertexBuffer(1, selectionInstanceBuffer, 0,
+                               static_cast<uint64_t>(selectionInstanceCount) * sizeof(float) * 6);
+    renderPass.SetIndexBuffer(boundingBoxIndexBuffer, wgpu::IndexFormat::Uint16);
 
-    // Draw lines
-    renderPass.DrawIndexed(boundingBoxIndexCount, 1, 0, 0, 0);
+    // Draw all boxes at once
+    renderPass.DrawIndexed(boundingBoxIndexCount, selectionInstanceCount, 0, 0, 0);
 }
 
 } // namespace rendering
@@ -2,13 +2,22 @@
 
 #include "../../core/math/Mat4.h"
 #include "../../core/math/Vec3.h"
+#include "../../core/math/AABB.h"
+#include "../../core/math/Frustum.h"
+#include "../../core/math/Ray.h"
 #include "Camera.h"
 #include "SceneObject.h"
+#include "SceneObjectPool.h"
+#include "DynamicAABBTree.h"
+#include "TransformHierarchy.h"
+#include "OcclusionCuller.h"
 #include "../ShaderManager.h"
 #include "../../resource/ResourceManager.h"
+#include "../../core/JobSystem.h"
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <limits>
 
 #ifdef __EMSCRIPTEN__
     #include <webgpu/webgpu.h>
@@ -19,66 +28,197 @@
 
 namespace rs_engine {
 
-// Uniforms for rendering
-struct ObjectUniforms {
+// Uniforms for rendering (bind group 0: shared by every draw of the frame)
+struct FrameUniforms {
     Mat4 viewProj;
-    Mat4 model;
     float time;
     float padding[3]; // Ensure 16-byte alignment
 };
 
+// Per-object record (bind group 1: read-only storage array, indexed by instance_index)
+struct ObjectData {
+    Mat4 model;
+};
+
 namespace rendering {
 
+/**
+ * @brief How a selection request combines with the current selection
+ */
+enum class SelectionMode {
+    Replace,    // Clear, then select the given objects
+    Add,        // Union
+    Subtract,   // Remove the given objects
+    Toggle      // Flip each object's state
+};
+
+/**
+ * @brief Per-frame level-of-detail statistics
+ */
+struct LODStats {
+    static constexpr uint32_t MAX_TRACKED_LODS = 8;
+    
+    size_t objectsDrawn = 0;
+    size_t drawCalls = 0;                    // DrawIndexed calls (one per mesh of each object)
+    size_t bufferBinds = 0;                  // SetVertexBuffer / SetIndexBuffer calls (arena changes)
+    size_t trianglesDrawn = 0;
+    size_t trianglesFullDetail = 0;          // What LOD 0 everywhere would have cost
+    size_t objectsPerLOD[MAX_TRACKED_LODS] = {};
+    
+    size_t getTrianglesSaved() const { return trianglesFullDetail - trianglesDrawn; }
+};
+
+/**
+ * @brief Per-frame GPU upload statistics (frame uniforms + object data)
+ */
+struct GPUUploadStats {
+    size_t dirtyObjects = 0;     // Object records rewritten
+    size_t writeCalls = 0;       // Queue::WriteBuffer calls (frame uniforms included)
+    size_t bytesUploaded = 0;
+};
+
+/**
+ * @brief Shared settings for objects spawned by Scene::createObjects()
+ */
+struct ObjectTemplate {
+    std::string namePrefix;                   // Names are prefix + number ("Cube0", ...); empty = unnamed
+    resource::ResourceHandle meshHandle = resource::INVALID_RESOURCE_HANDLE;  // Optional mesh
+    resource::Transform transform;
+    uint32_t layers = Layers::Default;
+    bool visible = true;
+    bool animated = true;                     // false = static (skipped by Scene::update)
+};
+
 class Scene {
 private:
     wgpu::Device* device;
     resource::ResourceManager* resourceManager;
+    JobSystem* jobSystem;               // Not owned (nullptr = serialJobs)
+    JobSystem serialJobs{0};            // Runs every loop on the calling thread
     std::unique_ptr<ShaderManager> shaderManager;
     std::unique_ptr<Camera> camera;
     
-    // Scene objects (name -> object)
-    std::unordered_map<std::string, std::unique_ptr<SceneObject>> sceneObjects;
+    // Scene objects (pooled; addressed by ObjectHandle)
+    SceneObjectPool objectPool;
+    
+    // Dense list of the live objects (swap-remove), split into chunks by update()
+    std::vector<SceneObject*> objectList;
+    
+    // Dense list of the animated objects (swap-remove); static objects are not visited by update()
+    std::vector<SceneObject*> animatedObjects;
+    
+    // Named objects: NameId -> handle (unnamed objects are not listed)
+    std::vector<ObjectHandle> nameIndex;
+    
+    // Destroyed objects may still sit in dirtyBoundsObjects until the next flush
+    bool destroyedObjectsPending = false;
     
-    // Selection management
-    SceneObject* selectedObject = nullptr;
+    // One Model per mesh, shared by every object showing that mesh
+    std::unordered_map<resource::ResourceHandle, std::shared_ptr<resource::Model>> meshModels;
+    
+    // Selection set (insertion order; the last entry is the primary selection)
+    std::vector<SceneObject*> selectedObjects;
+    bool selectionHighlightDirty = true;
+    
+    // Spatial index over object world bounds (updated incrementally)
+    friend class SceneObject;
+    DynamicAABBTree spatialIndex;
+    std::vector<SceneObject*> dirtyBoundsObjects;
+    
+    // Parent/child world matrices (pre-order arrays, dirty subtrees only)
+    TransformHierarchy transformHierarchy;
+    std::vector<SceneObject*> hierarchyRoots;           // Scratch for rebuilds
+    std::vector<SceneObject*> transformChangedObjects;  // Scratch for updates
 
     // Rendering resources (TEMPORARY - will be replaced with proper renderer)
-    wgpu::RenderPipeline renderPipeline;
-    wgpu::Buffer uniformBuffer;
-    wgpu::BindGroup bindGroup;
-    wgpu::BindGroupLayout bindGroupLayout;
+    wgpu::RenderPipeline renderPipeline;            // Float32x3 positions
+    wgpu::RenderPipeline quantizedRenderPipeline;   // Unorm16x4 positions (resource::VertexLayout::compact)
+    bool quantizedPipelineBound = false;            // Within the current pass
+    WGPUBuffer boundPositionBuffer = nullptr;       // Mesh arena buffers bound in the current pass
+    WGPUBuffer boundIndexBuffer = nullptr;
+    wgpu::IndexFormat boundIndexFormat = wgpu::IndexFormat::Undefined;
+    wgpu::Buffer frameUniformBuffer;             // Group 0: camera + time
+    wgpu::Buffer objectDataBuffer;               // Group 1: ObjectData[]
+    wgpu::BindGroupLayout frameBindGroupLayout;
+    wgpu::BindGroupLayout objectBindGroupLayout;
+    wgpu::BindGroup frameBindGroup;
+    wgpu::BindGroup objectBindGroup;
 
-    // Dynamic uniform buffer management
-    static constexpr uint32_t MAX_OBJECTS = 100;
-    static constexpr uint32_t UNIFORM_ALIGNMENT = 256; // WebGPU alignment requirement
-    uint32_t alignedUniformSize;
+    // Per-object data: every object keeps a stable slot (drawn as firstInstance)
+    // and only dirty slots are uploaded, coalesced into as few writes as possible
+    static constexpr uint32_t INITIAL_OBJECT_CAPACITY = 128;
+    static constexpr uint32_t MAX_COALESCE_GAP = 16;   // Clean slots (1 KB) re-sent to merge two writes
+    uint32_t objectCapacity = 0;                 // Slots allocated in objectDataBuffer
+    std::vector<SceneObject*> slotObjects;       // Slot -> object (nullptr = free)
+    std::vector<uint32_t> freeSlots;
+    std::vector<ObjectData> objectData;          // CPU mirror of objectDataBuffer
+    std::vector<uint8_t> slotDirty;
+    std::vector<uint32_t> dirtySlots;
+    float elapsedTime = 0.0f;                    // Sum of update() steps, sent as frame time
+    FrameUniforms frameUniforms;
+    bool frameUniformsValid = false;
+    GPUUploadStats uploadStats;
+    
+    // Level of detail
+    bool lodEnabled = true;
+    float lodHysteresis = 0.1f;  // Relative band around each screen-size threshold
+    float lodBias = 1.0f;        // Multiplies projected size (>1 keeps detail longer)
+    LODStats lodStats;
+    
+    // CPU occlusion culling (occluders rasterized, other objects tested per frame)
+    bool occlusionCullingEnabled = false;
+    OcclusionCuller occlusionCuller;
+    std::vector<SceneObject*> renderQueue;        // Scratch: objects to draw this frame
+    std::vector<AABB> occludeeBounds;             // Scratch: bounds of tested objects
+    std::vector<uint8_t> occludeeVisibility;      // Scratch: test results
     
     // Bounding box rendering (for selection highlight)
     wgpu::RenderPipeline boundingBoxPipeline;
     wgpu::Buffer boundingBoxVertexBuffer;
     wgpu::Buffer boundingBoxIndexBuffer;
     uint32_t boundingBoxIndexCount = 0;
+    
+    // Per-selected-object box instances (center.xyz, size.xyz), drawn in one call
+    wgpu::Buffer selectionInstanceBuffer;
+    uint32_t selectionInstanceCapacity = 0;
+    uint32_t selectionInstanceCount = 0;
+    std::vector<float> selectionInstanceData;
 
 public:
-    Scene(wgpu::Device* dev, resource::ResourceManager* resMgr);
+    /**
+     * @param jobs Worker pool for update, culling and batched queries
+     *             (nullptr = single-threaded); must outlive the scene
+     */
+    Scene(wgpu::Device* dev, resource::ResourceManager* resMgr, JobSystem* jobs = nullptr);
     ~Scene() = default;
 
     bool initialize();
+    
+    /**
+     * @brief Advance animation and refresh world matrices and bounds
+     * 
+     * Objects are processed in contiguous chunks on the scene's JobSystem.
+     * Each object only touches its own state, so the result does not depend
+     * on the thread count or scheduling.
+     */
     void update(float deltaTime);
     void render(wgpu::RenderPassEncoder& renderPass);
 
     // Camera management
     Camera* getCamera() { return camera.get(); }
     void setCamera(std::unique_ptr<Camera> cam) { camera = std::move(cam); }
+    
+    // Worker pool given at construction (nullptr if single-threaded)
+    JobSystem* getJobSystem() const { return jobSystem; }
 
     // ========== Object Management ==========
     
     /**
      * @brief Create an empty scene object
-     * @param name Unique object name
-     * @return Pointer to created object (or nullptr if name exists)
+     * @param name Unique object name (empty = unnamed, addressed by handle only)
+     * @return Pointer to created object (or nullptr if name exists or the pool is full)
      */
-    SceneObject* createObject(const std::string& name);
+    SceneObject* createObject(const std::string& name = std::string());
     
     /**
      * @brief Add a mesh to an existing object
@@ -87,17 +227,70 @@ public:
      * @return true if successful
      */
     bool addMeshToObject(const std::string& objectName, resource::ResourceHandle meshHandle);
+    bool addMeshToObject(ObjectHandle handle, resource::ResourceHandle meshHandle);
+    
+    /**
+     * @brief Create many objects at once
+     * 
+     * Storage is reserved up front, all objects share one Model for the
+     * template mesh, and nothing is logged per object. With a name prefix,
+     * names already in use are skipped (the numbering continues past them).
+     * @param count Number of objects to create
+     * @param objectTemplate Name prefix, mesh and initial state of every object
+     * @param outObjects Output: created objects, appended in creation order (optional)
+     * @return Number of objects created (0 if the template mesh is not found)
+     */
+    size_t createObjects(size_t count, const ObjectTemplate& objectTemplate,
+                         std::vector<SceneObject*>* outObjects = nullptr);
+    
+    /**
+     * @brief Create objects for a model's node hierarchy (e.g. a glTF scene)
+     * 
+     * A root object gets the given name and one child object is created
+     * per ModelNode, parented like the nodes, named "<name>/<node name>"
+     * when that name is free. Each node draws its own mesh range through a
+     * Model sharing the source meshes. Models without nodes become a single
+     * object drawing the whole model.
+     * @param outObjects Output: created objects, root first (optional)
+     * @return Root object (nullptr if the name exists or the pool is full)
+     */
+    SceneObject* instantiateModel(const std::shared_ptr<resource::Model>& model,
+                                  const std::string& name = std::string(),
+                                  std::vector<SceneObject*>* outObjects = nullptr);
     
     /**
      * @brief Get scene object by name
      */
     SceneObject* getObject(const std::string& name);
     
+    /**
+     * @brief Get scene object by handle (O(1), nullptr if destroyed)
+     */
+    SceneObject* getObject(ObjectHandle handle) const { return objectPool.get(handle); }
+    bool isValid(ObjectHandle handle) const { return objectPool.get(handle) != nullptr; }
+    
     /**
      * @brief Remove object from scene
      */
     void removeObject(const std::string& name);
     
+    /**
+     * @brief Remove object from scene (stale handles are ignored)
+     * @return true if an object was removed
+     */
+    bool destroyObject(ObjectHandle handle);
+    
+    /**
+     * @brief Remove many objects at once
+     * 
+     * Objects not owned by this scene (or listed twice) are ignored.
+     * @return Number of objects removed
+     */
+    size_t destroyObjects(SceneObject* const* objects, size_t count);
+    size_t destroyObjects(const std::vector<SceneObject*>& objects) {
+        return destroyObjects(objects.data(), objects.size());
+    }
+    
     /**
      * @brief Remove all objects
      */
@@ -106,47 +299,367 @@ public:
     /**
      * @brief Get object count
      */
-    size_t getObjectCount() const { return sceneObjects.size(); }
+    size_t getObjectCount() const { return objectList.size(); }
     
     /**
-     * @brief Get all scene objects (for iteration in picking)
+     * @brief Get all scene objects (for iteration in picking; order changes on removal)
      */
-    const std::unordered_map<std::string, std::unique_ptr<SceneObject>>& getAllObjects() const {
-        return sceneObjects;
-    }
+    const std::vector<SceneObject*>& getAllObjects() const { return objectList; }
+    
+    /**
+     * @brief Pool slots allocated (live + free); grows only when no slot is free
+     */
+    size_t getObjectPoolCapacity() const { return objectPool.getCapacity(); }
+    
+    // ========== Level of Detail ==========
+    
+    /**
+     * @brief Enable screen-size based LOD selection (disabled = always LOD 0)
+     */
+    void setLODEnabled(bool enabled) { lodEnabled = enabled; }
+    bool isLODEnabled() const { return lodEnabled; }
+    
+    void setLODHysteresis(float hysteresis) { lodHysteresis = hysteresis; }
+    float getLODHysteresis() const { return lodHysteresis; }
+    
+    void setLODBias(float bias) { lodBias = bias; }
+    float getLODBias() const { return lodBias; }
+    
+    /**
+     * @brief Statistics of the last rendered frame
+     */
+    const LODStats& getLODStats() const { return lodStats; }
+    
+    // ========== Occlusion Culling ==========
+    
+    /**
+     * @brief Skip objects hidden behind occluders (see SceneObject::setOccluder)
+     */
+    void setOcclusionCullingEnabled(bool enabled) { occlusionCullingEnabled = enabled; }
+    bool isOcclusionCullingEnabled() const { return occlusionCullingEnabled; }
+    
+    /**
+     * @brief Statistics of the last rendered frame
+     */
+    const OcclusionStats& getOcclusionStats() const { return occlusionCuller.getStats(); }
+    const OcclusionCuller& getOcclusionCuller() const { return occlusionCuller; }
+    
+    // ========== Hierarchy ==========
+    
+    /**
+     * @brief Attach an object to a parent (or detach with nullptr)
+     * 
+     * The child's Transform is kept and becomes relative to the new parent.
+     * @return false if the objects belong to another scene or it would create a cycle
+     */
+    bool setParent(SceneObject* child, SceneObject* parent);
+    
+    /**
+     * @brief Recompute world matrices of dirty subtrees
+     * 
+     * Called automatically by update() and before spatial re-indexing.
+     */
+    void updateTransforms();
+    
+    const TransformHierarchy& getTransformHierarchy() const { return transformHierarchy; }
+
+    // ========== Snapshots ==========
+
+    /**
+     * @brief Write all objects to a binary snapshot (see SceneSnapshot.h)
+     *
+     * Local transforms, hierarchy, names, layers and flags are stored in
+     * flat arrays; models are stored as references to ResourceManager
+     * meshes / models by name. Objects whose model is not registered with
+     * the ResourceManager are saved without one (with a warning).
+     * @return false if the file cannot be written
+     */
+    bool saveSnapshot(const std::string& filepath);
+
+    /**
+     * @brief Replace all objects with the contents of a snapshot
+     *
+     * The file is memory-mapped and its arrays are read in place, so load
+     * time is dominated by page-in and object registration. Referenced
+     * meshes must already exist in the ResourceManager; missing models are
+     * loaded from their recorded path. Unresolved references leave the
+     * objects without a model.
+     * @return false if the file is missing, truncated or of another version (scene unchanged)
+     */
+    bool loadSnapshot(const std::string& filepath);
+
+    // ========== GPU Uploads ==========
+    
+    /**
+     * @brief Frame uniform / object data upload statistics of the last rendered frame
+     */
+    const GPUUploadStats& getUploadStats() const { return uploadStats; }
+    
+    /**
+     * @brief Size of the object data storage buffer in bytes (grows by doubling)
+     */
+    uint64_t getObjectBufferSize() const { return static_cast<uint64_t>(objectCapacity) * sizeof(ObjectData); }
     
     // ========== Selection Management ==========
     
     /**
-     * @brief Set selected object
+     * @brief Replace the selection with a single object
      * @param object Object to select (or nullptr to clear selection)
      */
     void setSelectedObject(SceneObject* object);
     
     /**
-     * @brief Get currently selected object
+     * @brief Get the primary (most recently selected) object
+     */
+    SceneObject* getSelectedObject() {
+        return selectedObjects.empty() ? nullptr : selectedObjects.back();
+    }
+    
+    /**
+     * @brief Apply a selection operation to one object
+     */
+    void selectObject(SceneObject* object, SelectionMode mode = SelectionMode::Add);
+    
+    /**
+     * @brief Apply a selection operation to many objects (marquee / lasso results)
      */
-    SceneObject* getSelectedObject() { return selectedObject; }
+    void selectObjects(const std::vector<SceneObject*>& objects, SelectionMode mode);
+    
+    /**
+     * @brief Remove one object from the selection
+     */
+    void deselectObject(SceneObject* object);
+    
+    bool isObjectSelected(const SceneObject* object) const {
+        return object && object->selectionIndex >= 0;
+    }
+    
+    const std::vector<SceneObject*>& getSelectedObjects() const { return selectedObjects; }
+    size_t getSelectionCount() const { return selectedObjects.size(); }
     
     /**
      * @brief Clear selection
      */
-    void clearSelection() { setSelectedObject(nullptr); }
+    void clearSelection();
+    
+    // ========== Spatial Queries ==========
+    
+    /**
+     * @brief Ray query candidate (sorted nearest first)
+     */
+    struct RayCandidate {
+        SceneObject* object;
+        float distance;  // Entry distance into world AABB (negative if origin is inside)
+    };
+    
+    /**
+     * @brief Re-index objects whose bounds changed since the last update
+     * 
+     * Called automatically by update() and by every query.
+     */
+    void updateSpatialIndex();
+    
+    /**
+     * @brief Collect objects whose world AABB is hit by the ray
+     * @param ray Ray in world space
+     * @param maxDistance Ignore hits further than this
+     * @param results Output: candidates sorted by entry distance
+     */
+    void queryRay(const Ray& ray, float maxDistance, std::vector<RayCandidate>& results);
+    
+    /**
+     * @brief Collect objects whose world AABB intersects the frustum
+     */
+    void queryFrustum(const Frustum& frustum, std::vector<SceneObject*>& results);
+    
+    /**
+     * @brief Collect objects whose world AABB overlaps the box
+     */
+    void queryAABB(const AABB& box, std::vector<SceneObject*>& results);
+    
+    /**
+     * @brief Find the object whose world AABB is closest to a point
+     * @param point World-space position
+     * @param maxDistance Search radius
+     * @param outDistance Output: distance to the object's bounds (optional)
+     * @return Nearest object or nullptr if none within maxDistance
+     */
+    SceneObject* queryNearest(const Vec3& point,
+                              float maxDistance = std::numeric_limits<float>::max(),
+                              float* outDistance = nullptr);
+    
+    const DynamicAABBTree& getSpatialIndex() const { return spatialIndex; }
+    
+    // ========== Scene Queries (raycast / overlap) ==========
+    
+    /**
+     * @brief Exact ray hit against object triangles
+     */
+    struct RaycastHit {
+        SceneObject* object = nullptr;
+        float distance = -1.0f;         // Along the ray, in units of ray.direction
+        Vec3 point;                     // World-space hit position
+        Vec3 normal;                    // World-space geometric normal (unit length)
+        uint32_t meshIndex = 0;         // Mesh within the object's model
+        uint32_t triangleIndex = 0;     // Triangle within that mesh
+    };
+    
+    /**
+     * @brief Find the closest triangle hit along a ray
+     * 
+     * Uses the spatial index (nearest first, clipped by the best hit so far)
+     * and each mesh's BVH. Visibility is ignored; filter with layers.
+     * @param ray World-space ray
+     * @param hit Output: closest hit
+     * @param maxDistance Ignore hits further than this
+     * @param layerMask Only objects with (layers & layerMask) != 0
+     * @return true if something was hit
+     */
+    bool raycast(const Ray& ray, RaycastHit& hit,
+                 float maxDistance = std::numeric_limits<float>::max(),
+                 uint32_t layerMask = Layers::All);
+    
+    /**
+     * @brief Collect the closest hit on every object along a ray
+     * @param results Output: hits sorted by distance
+     * @return Number of hits
+     */
+    size_t raycastAll(const Ray& ray, std::vector<RaycastHit>& results,
+                      float maxDistance = std::numeric_limits<float>::max(),
+                      uint32_t layerMask = Layers::All);
+    
+    /**
+     * @brief Closest-hit raycast for many rays, spread across worker threads
+     * @param rays World-space rays
+     * @param count Number of rays
+     * @param hits Output: one result per ray (object = nullptr on miss)
+     * @return Number of rays that hit
+     */
+    size_t raycastBatch(const Ray* rays, size_t count, RaycastHit* hits,
+                        float maxDistance = std::numeric_limits<float>::max(),
+                        uint32_t layerMask = Layers::All);
+    
+    /**
+     * @brief Collect objects whose world bounds intersect a sphere
+     */
+    size_t overlapSphere(const Vec3& center, float radius, std::vector<SceneObject*>& results,
+                         uint32_t layerMask = Layers::All);
+    
+    /**
+     * @brief Collect objects whose world bounds intersect a box
+     */
+    size_t overlapBox(const AABB& box, std::vector<SceneObject*>& results,
+                      uint32_t layerMask = Layers::All);
 
 private:
+    /**
+     * @brief Pool for parallel loops (the serial one without workers)
+     */
+    JobSystem& getJobs() { return jobSystem ? *jobSystem : serialJobs; }
+    
+    /**
+     * @brief Closest-hit raycast against an up-to-date index (thread-safe, no re-indexing)
+     */
+    bool raycastIndexed(const Ray& ray, float maxDistance, uint32_t layerMask,
+                        RaycastHit& hit) const;
+    
+    /**
+     * @brief Closest triangle hit on a single object (object-space BVH query)
+     */
+    static bool intersectObject(const Ray& ray, SceneObject* object, float maxDistance,
+                                RaycastHit& hit);
+    
+
+    void onObjectBoundsDirty(SceneObject* object);
+    void onObjectTransformDirty(SceneObject* object);
+    
+    /**
+     * @brief Add an object to (or drop it from) the animated list
+     */
+    void onObjectAnimatedChanged(SceneObject* object);
+    void detachFromHierarchy(SceneObject* object);
+    void removeFromSpatialIndex(SceneObject* object);
+    
+    /**
+     * @brief Take a pool slot, recycling destroyed ones once the pool runs dry
+     */
+    SceneObject* acquireObject();
+    
+    /**
+     * @brief Hook a new object into the scene's structures
+     */
+    void registerObject(SceneObject* object);
+    
+    /**
+     * @brief Unhook an object from every scene structure and return it to the pool
+     */
+    void releaseObject(SceneObject* object);
+    
+    /**
+     * @brief Drop destroyed objects from dirtyBoundsObjects and make their slots reusable
+     */
+    void flushDestroyedObjects();
+    
+    /**
+     * @brief Move an object's name index entry (called by SceneObject::setName)
+     * @return false if another object already has the name
+     */
+    bool renameObject(SceneObject* object, NameId newName);
+    
+    SceneObject* findNamedObject(NameId name) const {
+        return name < nameIndex.size() ? objectPool.get(nameIndex[name]) : nullptr;
+    }
+    
+    /**
+     * @brief Model shared by all objects showing a mesh (created on first use)
+     * @return nullptr if the mesh is not found
+     */
+    std::shared_ptr<resource::Model> getMeshModel(resource::ResourceHandle meshHandle);
+
     bool createRenderingResources();
     bool createUniformBuffer();
-    bool createBindGroupLayout();
+    bool createBindGroupLayouts();
+    bool createObjectBindGroup();
     bool createRenderPipeline();
+    wgpu::RenderPipeline createPositionPipeline(resource::VertexEncoding positionEncoding);
     bool createBoundingBoxPipeline();
     bool createBoundingBoxGeometry();
-    void updateObjectUniforms(const SceneObject& object, size_t objectIndex);
     
-    void renderObject(wgpu::RenderPassEncoder& renderPass, 
-                     const SceneObject& object, 
-                     size_t objectIndex);
-    void renderBoundingBox(wgpu::RenderPassEncoder& renderPass,
-                           const SceneObject& object);
+    // Object data slots
+    uint32_t allocateObjectSlot(SceneObject* object);
+    void releaseObjectSlot(SceneObject* object);
+    void markObjectDataDirty(uint32_t slot);
+    
+    /**
+     * @brief Grow the object data buffer to fit every allocated slot
+     */
+    bool ensureObjectCapacity();
+    
+    /**
+     * @brief Upload frame uniforms (if changed) and all dirty object records
+     */
+    void uploadFrameData();
+    
+    /**
+     * @brief Rasterize occluders and drop hidden objects from renderQueue
+     */
+    void cullOccludedObjects();
+    
+    void renderObject(wgpu::RenderPassEncoder& renderPass, const SceneObject& object);
+    
+    /**
+     * @brief Choose the object's LOD from its projected bounding-sphere size
+     * @param projectionScale 1 / tan(fovY / 2) of the current camera
+     */
+    uint32_t selectObjectLOD(SceneObject& object, const Vec3& cameraPosition, float projectionScale);
+    void addToSelection(SceneObject* object);
+    void removeFromSelection(SceneObject* object);
+    
+    /**
+     * @brief Draw bounding boxes of all selected objects with one instanced draw
+     */
+    void renderSelectionHighlights(wgpu::RenderPassEncoder& renderPass);
+    bool updateSelectionInstances();
 };
 
 } // namespace rendering
@@ -1,15 +1,68 @@
 #include "SceneObject.h"
+#include "Scene.h"
 #include <limits>
 #include <algorithm>
 
 namespace rs_engine {
 namespace rendering {
 
+void SceneObject::setName(const std::string& objName) {
+    Name newName(objName);
+    if (newName.getId() == name.getId()) {
+        return;
+    }
+    if (ownerScene && !ownerScene->renameObject(this, newName.getId())) {
+        return;
+    }
+    name = std::move(newName);
+}
+
+void SceneObject::markBoundsDirty() {
+    if (boundsDirty) {
+        return; // Already queued
+    }
+    boundsDirty = true;
+    if (ownerScene) {
+        ownerScene->onObjectBoundsDirty(this);
+    }
+}
+
+void SceneObject::setAnimated(bool enabled) {
+    if (animated == enabled) {
+        return;
+    }
+    animated = enabled;
+    if (ownerScene) {
+        ownerScene->onObjectAnimatedChanged(this);
+    }
+}
+
+void SceneObject::markTransformDirty() {
+    if (ownerScene) {
+        ownerScene->onObjectTransformDirty(this);
+    }
+}
+
 Mat4 SceneObject::getModelMatrix() const {
+    if (ownerScene && hierarchyIndex >= 0) {
+        return ownerScene->transformHierarchy.getWorldMatrix(hierarchyIndex);
+    }
+    
+    // Not flattened yet (or no scene): compose the parent chain directly
+    Mat4 local = getLocalMatrix();
+    return parent ? parent->getModelMatrix() * local : local;
+}
+
+Mat4 SceneObject::getLocalMatrix() const {
     // Create transformation matrices
     Mat4 translationMat = Mat4::translation(transform.position);
-    Mat4 rotationMat = Mat4::rotationY(animationTime); // Simple Y-axis rotation for now
+    Mat4 rotationMat = Mat4::rotationY(animationTime + transform.rotation.y); // Animation spins around Y
     Mat4 scaleMat = Mat4::scale(transform.scale);
+    
+    // Euler order Y * X * Z (Z applied first); most objects only turn around Y
+    if (transform.rotation.x != 0.0f || transform.rotation.z != 0.0f) {
+        rotationMat = rotationMat * Mat4::rotationX(transform.rotation.x) * Mat4::rotationZ(transform.rotation.z);
+    }
 
     // Combine transformations: translation * rotation * scale
     return translationMat * rotationMat * scaleMat;
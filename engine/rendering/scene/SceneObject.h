@@ -2,13 +2,57 @@
 
 #include "../../core/math/Mat4.h"
 #include "../../core/math/Vec3.h"
+#include "../../core/math/AABB.h"
+#include "../../core/NameTable.h"
 #include "../../resource/model/Model.h"
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace rs_engine {
 namespace rendering {
 
+class Scene;
+class TransformHierarchy;
+
+/**
+ * @brief Layer bits for filtering scene queries (raycast, overlap)
+ * 
+ * An object matches a query when (object layers & query mask) != 0.
+ */
+namespace Layers {
+    constexpr uint32_t Default = 1u << 0;
+    constexpr uint32_t All = 0xFFFFFFFFu;
+}
+
+/**
+ * @brief 32-bit generational reference to a pooled SceneObject
+ * 
+ * Low 20 bits: pool slot index; high 12 bits: generation of that slot.
+ * The generation changes every time the slot's object is destroyed, so a
+ * stale handle resolves to nullptr instead of the slot's next occupant.
+ * Generations start at 1, so 0 is never a live handle.
+ */
+struct ObjectHandle {
+    static constexpr uint32_t INDEX_BITS = 20;
+    static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+    static constexpr uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+    
+    uint32_t value = 0;
+    
+    static ObjectHandle make(uint32_t index, uint32_t generation) {
+        return ObjectHandle{(generation << INDEX_BITS) | (index & INDEX_MASK)};
+    }
+    
+    uint32_t getIndex() const { return value & INDEX_MASK; }
+    uint32_t getGeneration() const { return value >> INDEX_BITS; }
+    bool isValid() const { return value != 0; }
+    
+    bool operator==(const ObjectHandle& other) const { return value == other.value; }
+    bool operator!=(const ObjectHandle& other) const { return value != other.value; }
+};
+
 /**
  * @brief Scene Object - An instance of a Model in the 3D scene
  * 
@@ -28,58 +72,173 @@ namespace rendering {
  *   obj2->setPosition(Vec3(5, 0, 0));    // Different transform
  * 
  * This follows the Unity/Unreal pattern: GameObject + MeshRenderer
+ * 
+ * Objects created by a Scene live in its SceneObjectPool and are best
+ * addressed by getHandle(); names are optional, held as reference-counted
+ * NameTable entries (freed with the last object using them) and meant for
+ * display and editor lookups.
+ * 
+ * Hierarchy: objects can be parented with Scene::setParent(). The
+ * Transform is then relative to the parent, and getModelMatrix() returns
+ * the world matrix computed by the Scene's TransformHierarchy.
  */
 class SceneObject {
 private:
-    std::string name;
+    Name name;                                  // Interned display name (optional)
     resource::Transform transform;              // ✅ SceneObject owns Transform
     std::shared_ptr<resource::Model> model;     // ✅ Shared Model reference
     float animationTime = 0.0f;
+    bool animated = true;     // Spins with animationTime each update (false = static)
     bool isVisible = true;
     bool isSelected = false;  // Selection state for picking
+    uint32_t layers = Layers::Default;  // Query filtering (see Layers)
+    bool occluder = false;    // Rasterized into the CPU occlusion buffer
+
+    // Spatial index bookkeeping (managed by Scene)
+    friend class Scene;
+    friend class SceneObjectPool;
+    Scene* ownerScene = nullptr;
+    ObjectHandle handle;          // Pool slot + generation (invalid outside a scene)
+    int32_t spatialProxyId = -1;
+    bool boundsDirty = true;
+    AABB cachedWorldBounds;
+    int32_t selectionIndex = -1;  // Position in Scene's selection set (-1 = not selected)
+    int32_t objectSlot = -1;      // Record in Scene's object data buffer (draw firstInstance)
+    
+    // Transform hierarchy (managed by Scene)
+    friend class TransformHierarchy;
+    SceneObject* parent = nullptr;
+    std::vector<SceneObject*> children;
+    int32_t hierarchyIndex = -1;  // Node in the Scene's TransformHierarchy arrays
+    
+    uint32_t currentLOD = 0;  // Level drawn last frame (kept for hysteresis)
+    int32_t listIndex = -1;   // Position in Scene's dense object list
+    int32_t animatedIndex = -1;  // Position in Scene's animated object list (-1 = static)
+
+    /**
+     * @brief Flag world bounds as stale and notify the owning scene
+     */
+    void markBoundsDirty();
+    
+    /**
+     * @brief Flag the local transform as changed (world matrix and bounds follow)
+     */
+    void markTransformDirty();
+    
+    /**
+     * @brief Per-object animation step without scene notification
+     * 
+     * Touches only this object, so Scene::update() runs it on many animated
+     * objects concurrently and flags their hierarchy nodes afterwards.
+     */
+    void advance(float deltaTime) { animationTime += deltaTime; }
 
 public:
-    SceneObject(const std::string& objName = "Object")
+    SceneObject() = default;
+    SceneObject(const std::string& objName)
         : name(objName) {}
 
     // ========== Identity ==========
     
-    void setName(const std::string& objName) { name = objName; }
-    const std::string& getName() const { return name; }
+    /**
+     * @brief Rename (rejected with an error if another object of the scene has the name)
+     */
+    void setName(const std::string& objName);
+    const std::string& getName() const { return name.getString(); }
+    NameId getNameId() const { return name.getId(); }
+    bool hasName() const { return name.isValid(); }
+    
+    /**
+     * @brief Handle for Scene::getObject(ObjectHandle) (invalid outside a scene)
+     */
+    ObjectHandle getHandle() const { return handle; }
 
     // ========== Transform ==========
     
-    void setTransform(const resource::Transform& trans) { transform = trans; }
+    void setTransform(const resource::Transform& trans) { transform = trans; markTransformDirty(); }
     const resource::Transform& getTransform() const { return transform; }
-    resource::Transform& getTransform() { return transform; }
+    resource::Transform& getTransform() { markTransformDirty(); return transform; }  // Caller may modify
     
-    void setPosition(const Vec3& pos) { transform.position = pos; }
-    void setRotation(const Vec3& rot) { transform.rotation = rot; }
-    void setScale(const Vec3& scale) { transform.scale = scale; }
+    void setPosition(const Vec3& pos) { transform.position = pos; markTransformDirty(); }
+    void setRotation(const Vec3& rot) { transform.rotation = rot; markTransformDirty(); }
+    void setScale(const Vec3& scale) { transform.scale = scale; markTransformDirty(); }
     
     const Vec3& getPosition() const { return transform.position; }
     const Vec3& getRotation() const { return transform.rotation; }
     const Vec3& getScale() const { return transform.scale; }
     
+    /**
+     * @brief Transform relative to the parent (or world, for roots)
+     */
+    Mat4 getLocalMatrix() const;
+    
+    /**
+     * @brief World matrix (parent chain applied)
+     * 
+     * Served from the Scene's hierarchy as of the last Scene::updateTransforms();
+     * objects outside a scene compose their parent chain directly.
+     */
     Mat4 getModelMatrix() const;
+    
+    // ========== Hierarchy ==========
+    
+    SceneObject* getParent() const { return parent; }
+    const std::vector<SceneObject*>& getChildren() const { return children; }
 
     // ========== Model ==========
     
-    void setModel(std::shared_ptr<resource::Model> mdl) { model = mdl; }
+    void setModel(std::shared_ptr<resource::Model> mdl) { model = mdl; currentLOD = 0; markBoundsDirty(); }
     std::shared_ptr<resource::Model> getModel() const { return model; }
     bool hasModel() const { return model != nullptr; }
 
     // ========== Animation ==========
     
-    void update(float deltaTime) { animationTime += deltaTime; }
+    void update(float deltaTime) {
+        if (!animated || deltaTime == 0.0f) return;
+        advance(deltaTime);
+        markTransformDirty();  // Animation rotates the object
+    }
+    
+    /**
+     * @brief Enable or disable the update() spin (default on)
+     * 
+     * Static objects cost nothing per Scene::update(): only animated ones
+     * are advanced and have their world matrix and bounds recomputed.
+     */
+    void setAnimated(bool enabled);
+    bool isAnimated() const { return animated; }
     float getAnimationTime() const { return animationTime; }
-    void setAnimationTime(float time) { animationTime = time; }
+    void setAnimationTime(float time) { animationTime = time; markTransformDirty(); }
 
     // ========== Visibility ==========
     
     void setVisible(bool visible) { isVisible = visible; }
     bool getVisible() const { return isVisible; }
     
+    // ========== Occlusion ==========
+    
+    /**
+     * @brief Mark as an occluder (large, solid, low-poly objects work best)
+     * 
+     * Occluders hide other objects when Scene occlusion culling is enabled;
+     * they are always drawn themselves.
+     */
+    void setOccluder(bool isOccluder) { occluder = isOccluder; }
+    bool isOccluder() const { return occluder; }
+    
+    // ========== Level of Detail ==========
+    
+    /**
+     * @brief LOD level selected by the Scene for the last rendered frame
+     */
+    uint32_t getCurrentLOD() const { return currentLOD; }
+    
+    // ========== Layers ==========
+    
+    void setLayers(uint32_t layerBits) { layers = layerBits; }
+    uint32_t getLayers() const { return layers; }
+    bool isInLayers(uint32_t mask) const { return (layers & mask) != 0; }
+    
     // ========== Selection ==========
     
     void setSelected(bool selected) { isSelected = selected; }
@@ -93,6 +252,14 @@ public:
      * @param max Output: maximum corner in world space
      */
     void getWorldBounds(Vec3& min, Vec3& max) const;
+    
+    /**
+     * @brief Get world bounds as last indexed by the owning Scene
+     * 
+     * Cheaper than getWorldBounds() (no corner transforms) but only valid
+     * after Scene::updateSpatialIndex() has processed pending changes.
+     */
+    const AABB& getCachedWorldBounds() const { return cachedWorldBounds; }
 };
 
 } // namespace rendering
@@ -0,0 +1,87 @@
+#include "SceneObjectPool.h"
+#include <algorithm>
+
+namespace rs_engine {
+namespace rendering {
+
+SceneObject* SceneObjectPool::acquire() {
+    uint32_t index;
+    if (!freeIndices.empty()) {
+        index = freeIndices.back();
+        freeIndices.pop_back();
+    } else {
+        if (slotCount >= MAX_OBJECTS) {
+            return nullptr;
+        }
+        index = slotCount++;
+        if (index / CHUNK_SIZE >= chunks.size()) {
+            chunks.push_back(std::make_unique<SceneObject[]>(CHUNK_SIZE));
+        }
+        generations.push_back(1);
+    }
+    
+    SceneObject& object = slot(index);
+    object.handle = ObjectHandle::make(index, generations[index]);
+    liveCount++;
+    return &object;
+}
+
+void SceneObjectPool::release(SceneObject* object) {
+    if (!object || get(object->handle) != object) {
+        return;
+    }
+    
+    uint32_t index = object->handle.getIndex();
+    
+    // Skip generation 0 so a live handle is never 0
+    uint32_t generation = (generations[index] + 1) & ObjectHandle::GENERATION_MASK;
+    generations[index] = static_cast<uint16_t>(generation == 0 ? 1 : generation);
+    
+    resetObject(*object);
+    releasedIndices.push_back(index);
+    liveCount--;
+}
+
+void SceneObjectPool::recycleReleased() {
+    freeIndices.insert(freeIndices.end(), releasedIndices.begin(), releasedIndices.end());
+    releasedIndices.clear();
+}
+
+void SceneObjectPool::clear() {
+    for (uint32_t index = 0; index < slotCount; ++index) {
+        SceneObject& object = slot(index);
+        if (object.handle.isValid()) {
+            release(&object);
+        }
+    }
+    
+    // Lowest slots first on the next acquire() calls
+    freeIndices.clear();
+    releasedIndices.clear();
+    for (uint32_t index = slotCount; index > 0; --index) {
+        freeIndices.push_back(index - 1);
+    }
+}
+
+void SceneObjectPool::reserve(size_t count) {
+    size_t target = std::min<size_t>(count, MAX_OBJECTS);
+    while (getCapacity() < target) {
+        chunks.push_back(std::make_unique<SceneObject[]>(CHUNK_SIZE));
+    }
+    generations.reserve(target);
+    freeIndices.reserve(target);
+    releasedIndices.reserve(target);
+}
+
+void SceneObjectPool::resetObject(SceneObject& object) {
+    // Back to a default object, but keep the children list's capacity for the next occupant
+    std::vector<SceneObject*> children;
+    children.swap(object.children);
+    children.clear();
+    
+    object = SceneObject();
+    object.children.swap(children);
+}
+
+} // namespace rendering
+} // namespace rs_engine
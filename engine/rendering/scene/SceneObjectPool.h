@@ -0,0 +1,91 @@
+#pragma once
+
+#include "SceneObject.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace rs_engine {
+namespace rendering {
+
+/**
+ * @brief Fixed-address storage for a Scene's objects
+ *
+ * Objects live in chunks of CHUNK_SIZE that are never freed or moved, so
+ * SceneObject pointers stay valid and destroyed slots are reused without
+ * touching the heap. Each slot carries a generation that is bumped on
+ * release; get(ObjectHandle) is an index plus a compare.
+ *
+ * Released slots are not reused immediately: they wait until
+ * recycleReleased(), so the owner can first drop any pointers it still
+ * keeps in per-frame lists.
+ *
+ * Platform Support: 100% shared
+ */
+class SceneObjectPool {
+public:
+    static constexpr uint32_t CHUNK_SIZE = 1024;
+    static constexpr uint32_t MAX_OBJECTS = ObjectHandle::INDEX_MASK + 1;
+
+    SceneObjectPool() = default;
+    SceneObjectPool(const SceneObjectPool&) = delete;
+    SceneObjectPool& operator=(const SceneObjectPool&) = delete;
+
+    /**
+     * @brief Take a free slot (a reset, default-constructed object)
+     * @return nullptr once MAX_OBJECTS are live
+     */
+    SceneObject* acquire();
+
+    /**
+     * @brief Reset an object and return its slot (reusable after recycleReleased())
+     */
+    void release(SceneObject* object);
+
+    /**
+     * @brief Make released slots available to acquire()
+     */
+    void recycleReleased();
+
+    /**
+     * @brief Release every live object and recycle all slots at once
+     */
+    void clear();
+
+    /**
+     * @brief Resolve a handle (nullptr if stale or invalid)
+     */
+    SceneObject* get(ObjectHandle handle) const {
+        uint32_t index = handle.getIndex();
+        if (!handle.isValid() || index >= slotCount) {
+            return nullptr;
+        }
+        SceneObject* object = &chunks[index / CHUNK_SIZE][index % CHUNK_SIZE];
+        return object->handle == handle ? object : nullptr;
+    }
+
+    /**
+     * @brief Allocate slots up front so the next acquire() calls do not grow the pool
+     */
+    void reserve(size_t count);
+
+    bool hasFreeSlot() const { return !freeIndices.empty() || slotCount < MAX_OBJECTS; }
+    size_t getLiveCount() const { return liveCount; }
+    size_t getReleasedCount() const { return releasedIndices.size(); }
+    size_t getCapacity() const { return chunks.size() * CHUNK_SIZE; }
+
+private:
+    std::vector<std::unique_ptr<SceneObject[]>> chunks;
+    std::vector<uint16_t> generations;       // Next generation per slot
+    std::vector<uint32_t> freeIndices;       // Reusable now (LIFO)
+    std::vector<uint32_t> releasedIndices;   // Reusable after recycleReleased()
+    uint32_t slotCount = 0;                  // Slots ever handed out
+    size_t liveCount = 0;
+
+    SceneObject& slot(uint32_t index) { return chunks[index / CHUNK_SIZE][index % CHUNK_SIZE]; }
+    void resetObject(SceneObject& object);
+};
+
+} // namespace rendering
+} // namespace rs_engine
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rs_engine {
+namespace rendering {
+
+/**
+ * @brief Binary scene snapshot format (.rsscene), written by Scene::saveSnapshot()
+ *
+ * The file is a header followed by flat, 16-byte aligned arrays that are
+ * used in place from a memory mapping - nothing is parsed field by field:
+ *
+ *   SceneSnapshotHeader
+ *   SnapshotTransform[objectCount]   local transform + animation phase
+ *   SnapshotObject[objectCount]      parent, model reference, name, flags
+ *   SnapshotModelRef[modelRefCount]  resources referenced by objects
+ *   char[stringsSize]                names and paths (not null-terminated)
+ *
+ * Objects are stored in hierarchy pre-order, so a parent always precedes
+ * its children (parent index < object index; this also rules out cycles)
+ * and children keep their order. Models are stored as references to
+ * ResourceManager resources by name, not as geometry.
+ *
+ * Byte order is little-endian; files from a different byte order are
+ * rejected by the endianness tag. Any change to the records bumps
+ * SNAPSHOT_VERSION.
+ */
+namespace snapshot {
+
+constexpr uint32_t SNAPSHOT_MAGIC = 0x4E535352;      // "RSSN"
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+constexpr uint32_t SNAPSHOT_ENDIAN_TAG = 0x01020304;
+constexpr uint32_t SNAPSHOT_ALIGNMENT = 16;          // Section alignment
+constexpr int32_t NO_PARENT = -1;
+constexpr uint32_t NO_MODEL = 0xFFFFFFFFu;
+
+/**
+ * @brief How a model reference is resolved on load
+ */
+enum class ModelRefKind : uint32_t {
+    Mesh = 0,   // ResourceManager mesh by name; objects share the scene's mesh model
+    Model = 1   // ResourceManager model by name (loaded from path if not present)
+};
+
+enum ObjectFlags : uint32_t {
+    OBJECT_VISIBLE = 1u << 0,
+    OBJECT_OCCLUDER = 1u << 1,
+    OBJECT_STATIC = 1u << 2     // Not animated (unset in older files: animated)
+};
+
+struct SceneSnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t endianTag;
+    uint32_t objectCount;
+    uint32_t modelRefCount;
+    uint64_t transformsOffset;
+    uint64_t objectsOffset;
+    uint64_t modelRefsOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    uint64_t fileSize;
+};
+
+struct SnapshotTransform {
+    float position[3];
+    float rotation[3];   // Euler angles in radians
+    float scale[3];
+    float animationTime;
+};
+
+struct SnapshotObject {
+    int32_t parent;       // Object index or NO_PARENT
+    uint32_t modelRef;    // Model reference index or NO_MODEL
+    uint32_t nameOffset;  // Into the string section (nameLength 0 = unnamed)
+    uint32_t nameLength;
+    uint32_t layers;
+    uint32_t flags;       // ObjectFlags
+};
+
+struct SnapshotModelRef {
+    uint32_t kind;        // ModelRefKind
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t pathOffset;  // Source file of Model references (pathLength 0 = none)
+    uint32_t pathLength;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(SceneSnapshotHeader) == 72, "Snapshot header layout changed");
+static_assert(sizeof(SnapshotTransform) == 40, "Snapshot transform layout changed");
+static_assert(sizeof(SnapshotObject) == 24, "Snapshot object layout changed");
+static_assert(sizeof(SnapshotModelRef) == 24, "Snapshot model reference layout changed");
+
+/**
+ * @brief Round a byte offset up to the section alignment
+ */
+inline uint64_t alignOffset(uint64_t offset) {
+    return (offset + SNAPSHOT_ALIGNMENT - 1) & ~static_cast<uint64_t>(SNAPSHOT_ALIGNMENT - 1);
+}
+
+} // namespace snapshot
+
+} // namespace rendering
+} // namespace rs_engine
@@ -0,0 +1,235 @@
+#include "TransformHierarchy.h"
+#include "SceneObject.h"
+#include "../../core/JobSystem.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace rs_engine {
+namespace rendering {
+
+namespace {
+    // Below this many nodes a parallel dispatch costs more than it saves
+    constexpr size_t PARALLEL_NODE_THRESHOLD = 4096;
+
+    // Target chunks per thread when splitting dirty ranges (load balancing)
+    constexpr size_t RANGES_PER_THREAD = 8;
+}
+
+void TransformHierarchy::addRoot(SceneObject* object) {
+    if (structureDirty) {
+        return;  // The rebuild picks it up from the roots
+    }
+    if (object->parent || !object->children.empty()) {
+        structureDirty = true;
+        return;
+    }
+
+    int32_t index = static_cast<int32_t>(objects.size());
+    object->hierarchyIndex = index;
+    objects.push_back(object);
+    parents.push_back(INVALID_INDEX);
+    subtreeEnds.push_back(index + 1);
+    localMatrices.push_back(object->getLocalMatrix());
+    worldMatrices.push_back(localMatrices.back());
+    localDirty.push_back(0);
+    dirtyNodes.push_back(index);  // Reported as changed on the next update
+}
+
+void TransformHierarchy::removeNode(SceneObject* object) {
+    int32_t index = object->hierarchyIndex;
+    if (structureDirty || index < 0) {
+        return;  // The rebuild drops it (it is no longer reachable from the roots)
+    }
+    if (parents[index] != INVALID_INDEX && !object->children.empty()) {
+        structureDirty = true;
+        return;
+    }
+
+    // The children's subtrees directly follow the node and stay contiguous:
+    // they become root subtrees, only their world matrices change
+    for (SceneObject* child : object->children) {
+        parents[child->hierarchyIndex] = INVALID_INDEX;
+        dirtyNodes.push_back(child->hierarchyIndex);
+    }
+
+    // Leave a hole; ancestors' ranges may still span it, updates skip it
+    objects[index] = nullptr;
+    subtreeEnds[index] = index + 1;
+    localDirty[index] = 0;
+    object->hierarchyIndex = INVALID_INDEX;
+
+    if (++removedNodeCount * 2 > objects.size()) {
+        structureDirty = true;  // Compact on the next update
+    }
+}
+
+void TransformHierarchy::markLocalDirty(int32_t index) {
+    if (structureDirty || index < 0 || index >= static_cast<int32_t>(localDirty.size())) {
+        return;  // Full rebuild pending (or node not flattened yet)
+    }
+    if (!localDirty[index]) {
+        localDirty[index] = 1;
+        dirtyNodes.push_back(index);
+    }
+}
+
+void TransformHierarchy::markAllLocalDirty() {
+    if (structureDirty) {
+        return;  // The rebuild recomputes every node anyway
+    }
+    std::fill(localDirty.begin(), localDirty.end(), 1);
+
+    // Root subtrees tile the whole array
+    dirtyNodes.clear();
+    for (int32_t root = 0; root < static_cast<int32_t>(objects.size()); root = subtreeEnds[root]) {
+        dirtyNodes.push_back(root);
+    }
+}
+
+void TransformHierarchy::clear() {
+    objects.clear();
+    parents.clear();
+    subtreeEnds.clear();
+    localMatrices.clear();
+    worldMatrices.clear();
+    localDirty.clear();
+    dirtyNodes.clear();
+    structureDirty = false;
+    removedNodeCount = 0;
+    previousObjects.clear();
+    previousWorldMatrices.clear();
+}
+
+size_t TransformHierarchy::update(const std::vector<SceneObject*>& roots,
+                                  std::vector<SceneObject*>& changedObjects, JobSystem& jobs) {
+    if (structureDirty) {
+        return rebuild(roots, changedObjects);
+    }
+
+    if (dirtyNodes.empty()) {
+        return 0;
+    }
+
+    // Collapse dirty nodes into disjoint subtree ranges. After sorting, a node
+    // inside the current range is a descendant of its start and is covered.
+    std::sort(dirtyNodes.begin(), dirtyNodes.end());
+    auto& ranges = dirtyRanges;
+    ranges.clear();
+    size_t nodeCount = 0;
+    int32_t coveredEnd = 0;
+    for (int32_t index : dirtyNodes) {
+        if (index < coveredEnd) continue;
+        coveredEnd = subtreeEnds[index];
+        ranges.emplace_back(index, coveredEnd);
+        nodeCount += static_cast<size_t>(coveredEnd - index);
+    }
+    dirtyNodes.clear();
+
+    if (ranges.size() > 1 && nodeCount >= PARALLEL_NODE_THRESHOLD) {
+        // Many small ranges (e.g. a flat scene) are batched so each chunk has real work
+        size_t grainSize = std::max<size_t>(1, ranges.size() / (jobs.getThreadCount() * RANGES_PER_THREAD));
+        jobs.parallelFor(ranges.size(), grainSize, [&](size_t begin, size_t end) {
+            for (size_t r = begin; r < end; ++r) {
+                updateRange(ranges[r].first, ranges[r].second);
+            }
+        });
+    } else {
+        for (const auto& [begin, end] : ranges) {
+            updateRange(begin, end);
+        }
+    }
+
+    size_t firstChanged = changedObjects.size();
+    changedObjects.reserve(firstChanged + nodeCount);
+    for (const auto& [begin, end] : ranges) {
+        for (int32_t i = begin; i < end; ++i) {
+            if (objects[i]) {
+                changedObjects.push_back(objects[i]);
+            }
+        }
+    }
+    return changedObjects.size() - firstChanged;
+}
+
+void TransformHierarchy::updateRange(int32_t begin, int32_t end) {
+    for (int32_t i = begin; i < end; ++i) {
+        if (!objects[i]) {
+            continue;  // Removed node (no node has it as parent)
+        }
+        if (localDirty[i]) {
+            localMatrices[i] = objects[i]->getLocalMatrix();
+            localDirty[i] = 0;
+        }
+
+        int32_t parent = parents[i];
+        worldMatrices[i] = parent == INVALID_INDEX
+            ? localMatrices[i]
+            : worldMatrices[parent] * localMatrices[i];
+    }
+}
+
+size_t TransformHierarchy::rebuild(const std::vector<SceneObject*>& roots,
+                                   std::vector<SceneObject*>& changedObjects) {
+    // Keep the old layout so only new nodes and moved world matrices are reported
+    previousObjects.swap(objects);
+    previousWorldMatrices.swap(worldMatrices);
+    objects.clear();
+    parents.clear();
+    subtreeEnds.clear();
+    previousIndices.clear();
+
+    // Iterative pre-order DFS: (object, parent index)
+    auto& stack = dfsStack;
+    for (SceneObject* root : roots) {
+        stack.emplace_back(root, INVALID_INDEX);
+
+        while (!stack.empty()) {
+            auto [object, parentIndex] = stack.back();
+            stack.pop_back();
+
+            int32_t index = static_cast<int32_t>(objects.size());
+            previousIndices.push_back(object->hierarchyIndex);
+            object->hierarchyIndex = index;
+            objects.push_back(object);
+            parents.push_back(parentIndex);
+            subtreeEnds.push_back(index + 1);
+
+            // Push in reverse so children keep their order in the arrays
+            for (auto it = object->children.rbegin(); it != object->children.rend(); ++it) {
+                stack.emplace_back(*it, index);
+            }
+        }
+    }
+
+    // Parents precede children, so a backward pass accumulates subtree ends
+    for (int32_t i = static_cast<int32_t>(objects.size()) - 1; i >= 0; --i) {
+        if (parents[i] != INVALID_INDEX) {
+            subtreeEnds[parents[i]] = std::max(subtreeEnds[parents[i]], subtreeEnds[i]);
+        }
+    }
+
+    localMatrices.resize(objects.size());
+    worldMatrices.resize(objects.size());
+    localDirty.assign(objects.size(), 1);
+    dirtyNodes.clear();
+    structureDirty = false;
+    removedNodeCount = 0;
+
+    updateRange(0, static_cast<int32_t>(objects.size()));
+
+    size_t firstChanged = changedObjects.size();
+    for (size_t i = 0; i < objects.size(); ++i) {
+        int32_t previous = previousIndices[i];
+        bool isNew = previous < 0 || previous >= static_cast<int32_t>(previousObjects.size()) ||
+                     previousObjects[previous] != objects[i];
+        if (isNew || std::memcmp(previousWorldMatrices[previous].m, worldMatrices[i].m,
+                                 sizeof(worldMatrices[i].m)) != 0) {
+            changedObjects.push_back(objects[i]);
+        }
+    }
+    return changedObjects.size() - firstChanged;
+}
+
+} // namespace rendering
+} // namespace rs_engine
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "../../core/math/Mat4.h"
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+namespace rs_engine {
+
+class JobSystem;
+
+namespace rendering {
+
+class SceneObject;
+
+/**
+ * @brief Flattened parent/child transform hierarchy
+ *
+ * Nodes are stored in pre-order arrays (parents always precede their
+ * children), so every subtree is the contiguous range
+ * [index, subtreeEnd[index]). World matrices live in one contiguous
+ * array and are recomputed with a single forward pass over each dirty
+ * range:
+ *
+ *   world[i] = world[parent[i]] * local[i]
+ *
+ * Moving a node only touches its own subtree. Disjoint dirty ranges
+ * (independent roots or branches) are processed in parallel.
+ *
+ * Adding a parentless node appends it and removing a node leaves a hole
+ * in place (both O(1)), so spawning and destroying objects never touches
+ * the rest of the arrays. Reparenting only flags the structure; the arrays
+ * are rebuilt from the roots on the next update (O(N), rare), which also
+ * compacts the holes. A rebuild reports only the nodes that are new or
+ * whose world matrix actually changed.
+ *
+ * Platform Support: 100% shared
+ */
+class TransformHierarchy {
+public:
+    static constexpr int32_t INVALID_INDEX = -1;
+
+    /**
+     * @brief Flag the layout for a rebuild (node added, removed or reparented)
+     */
+    void markStructureDirty() { structureDirty = true; }
+    bool isStructureDirty() const { return structureDirty; }
+
+    /**
+     * @brief Append a new parentless, childless object as a root node
+     */
+    void addRoot(SceneObject* object);
+
+    /**
+     * @brief Drop an object's node before it is unlinked from its parent and children
+     *
+     * Its children become roots. Falls back to a rebuild when the node has
+     * both a parent and children (its children would sit inside the
+     * ancestors' ranges) or when holes make up half the arrays.
+     */
+    void removeNode(SceneObject* object);
+
+    /**
+     * @brief Flag a node's local transform as changed
+     */
+    void markLocalDirty(int32_t index);
+
+    /**
+     * @brief Flag every node's local transform as changed (e.g. all objects animated)
+     *
+     * O(N) memset instead of N markLocalDirty() calls, and safe to use after
+     * objects were modified concurrently without notifying the hierarchy.
+     */
+    void markAllLocalDirty();
+
+    /**
+     * @brief Bring world matrices up to date
+     * @param roots Parentless objects (only read when the structure is dirty)
+     * @param changedObjects Output: objects whose world matrix changed (appended)
+     * @param jobs Pool disjoint ranges are split across
+     * @return Number of objects appended to changedObjects
+     */
+    size_t update(const std::vector<SceneObject*>& roots, std::vector<SceneObject*>& changedObjects,
+                  JobSystem& jobs);
+
+    /**
+     * @brief Drop all nodes
+     */
+    void clear();
+
+    const Mat4& getWorldMatrix(int32_t index) const { return worldMatrices[index]; }
+    int32_t getParentIndex(int32_t index) const { return parents[index]; }
+    int32_t getSubtreeEnd(int32_t index) const { return subtreeEnds[index]; }
+    size_t getNodeCount() const { return objects.size(); }
+
+private:
+    // Pre-order node arrays (same index across all of them)
+    std::vector<SceneObject*> objects;  // nullptr for removed nodes (holes)
+    std::vector<int32_t> parents;       // INVALID_INDEX for roots
+    std::vector<int32_t> subtreeEnds;   // One past the last descendant
+    std::vector<Mat4> localMatrices;
+    std::vector<Mat4> worldMatrices;
+    std::vector<uint8_t> localDirty;
+
+    std::vector<int32_t> dirtyNodes;    // Nodes flagged since the last update
+    bool structureDirty = false;
+    size_t removedNodeCount = 0;        // Holes left by removeNode()
+
+    // Scratch kept between updates so steady-state frames do not allocate
+    std::vector<std::pair<int32_t, int32_t>> dirtyRanges;    // [begin, end) subtrees to recompute
+    std::vector<std::pair<SceneObject*, int32_t>> dfsStack;  // Rebuild: (object, parent index)
+    std::vector<SceneObject*> previousObjects;   // Rebuild: layout before the rebuild
+    std::vector<Mat4> previousWorldMatrices;
+    std::vector<int32_t> previousIndices;        // Rebuild: node index before the rebuild (per new node)
+
+    /**
+     * @brief Re-flatten the tree from the roots and recompute every node
+     * @param changedObjects Output: nodes that are new or whose world matrix changed (appended)
+     * @return Number of objects appended to changedObjects
+     */
+    size_t rebuild(const std::vector<SceneObject*>& roots, std::vector<SceneObject*>& changedObjects);
+
+    /**
+     * @brief Recompute world matrices for nodes [begin, end), parents first
+     */
+    void updateRange(int32_t begin, int32_t end);
+};
+
+} // namespace rendering
+} // namespace rs_engine
@@ -1,24 +1,73 @@
 #include "ResourceManager.h"
+#include "../core/JobSystem.h"
+#include "model/GltfLoader.h"
+#include "model/ObjLoader.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
 
 namespace rs_engine {
 namespace resource {
 
-ResourceManager::ResourceManager() {
+// ========== Async Loading State ==========
+
+struct ResourceManager::AsyncLoadJob {
+    ResourceHandle handle = INVALID_RESOURCE_HANDLE;
+    ResourceType type = ResourceType::Unknown;
+    std::string name;
+    std::string filepath;
+    ModelCacheSettings cacheSettings;   // Copied at request time
+    VertexLayout vertexLayout;
+    LoadCallback onComplete;
+    std::chrono::steady_clock::time_point start;
+    
+    // Written by the worker, read by update() after the hand-off
+    std::shared_ptr<Model> stagedModel;
+    std::shared_ptr<Texture> stagedTexture;
+    bool success = false;
+    bool fromCache = false;
+    
+    // GPU upload progress (main thread)
+    std::vector<std::shared_ptr<Mesh>> uploadMeshes;   // LOD 0, then the LOD levels
+    size_t nextUploadMesh = 0;
+    size_t uploadedBytes = 0;
+    uint32_t uploadFrames = 0;
+};
+
+struct ResourceManager::AsyncLoadState {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<AsyncLoadJob>> finished;
+    size_t inFlight = 0;                    // Submitted, not yet in finished
+    std::condition_variable idle;           // Signalled when inFlight drops to 0
+    std::atomic<bool> cancelled{false};
+};
+
+ResourceManager::ResourceManager()
+    : asyncState(std::make_shared<AsyncLoadState>()) {
 }
 
 ResourceManager::~ResourceManager() {
     shutdown();
 }
 
-void ResourceManager::initialize(wgpu::Device wgpuDevice) {
+void ResourceManager::initialize(wgpu::Device wgpuDevice, JobSystem* jobs) {
     device = wgpuDevice;
+    jobSystem = jobs;
+    meshBufferPool.initialize(device);
     std::cout << "[SUCCESS] ResourceManager initialized" << std::endl;
 }
 
 void ResourceManager::shutdown() {
-    clearAllResources();
+    clearAllResources();        // Joins the async loads still on workers
+    meshBufferPool.release();   // Every mesh has returned its ranges by now
     device = nullptr;
+    jobSystem = nullptr;
     std::cout << "[INFO] ResourceManager shutdown" << std::endl;
 }
 
@@ -32,10 +81,125 @@ ResourceHandle ResourceManager::loadModel(const std::string& name, const std::st
         return it->second;
     }
     
-    // TODO: Implement actual model loading with ModelLoader
-    std::cerr << "[ERROR] Model loading not yet implemented: " << filepath << std::endl;
+    auto start = std::chrono::steady_clock::now();
+    auto model = std::make_shared<Model>(name);
+    model->metadata.filepath = filepath;
     
-    return INVALID_RESOURCE_HANDLE;
+    bool fromCache = false;
+    if (!buildModel(filepath, *model, modelCacheSettings, jobSystem, fromCache)) {
+        return INVALID_RESOURCE_HANDLE;
+    }
+    model->setVertexLayout(vertexLayout);
+    model->load();
+    
+    ResourceHandle handle = generateHandle();
+    model->metadata.handle = handle;
+    
+    registerResource(model, handle);
+    
+    if (device) {
+        model->createGPUResources(meshBufferPool);
+    }
+    
+    updateMemoryStats();
+    
+    double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[SUCCESS] Model loaded: " << name << " (" << filepath << ", " << model->getMeshCount()
+              << " meshes, " << model->getLODTriangleCount(0) << " triangles, " << loadMs << " ms"
+              << (fromCache ? ", from cache" : "") << ")" << std::endl;
+    return handle;
+}
+
+ResourceHandle ResourceManager::loadModelAsync(const std::string& name, const std::string& filepath,
+                                               LoadCallback onComplete) {
+    auto it = pathToHandle.find(filepath);
+    if (it != pathToHandle.end()) {
+        auto existing = getResource(it->second);
+        if (existing && existing->getState() != ResourceState::Failed) {
+            // Loaded: report at once. Loading: the caller gets the same handle
+            // (only the first request's callback runs).
+            if (onComplete && existing->getState() == ResourceState::Loaded) {
+                onComplete(it->second, true);
+            }
+            return it->second;
+        }
+        removeResource(it->second);   // Retry a failed load
+    }
+    
+    auto model = std::make_shared<Model>(name);
+    model->metadata.filepath = filepath;
+    return startAsyncLoad(model, std::move(onComplete));
+}
+
+bool ResourceManager::buildModel(const std::string& filepath, Model& model,
+                                 const ModelCacheSettings& settings, JobSystem* jobs, bool& fromCache) {
+    // Use the binary cache while the source is unchanged; otherwise import and rebuild it
+    const std::string cachePath = MeshCache::getCachePath(filepath);
+    fromCache = settings.enabled && MeshCache::load(cachePath, model, settings);
+    if (!fromCache) {
+        std::vector<std::string> sources;
+        if (!importModel(filepath, model, sources, jobs)) {
+            return false;
+        }
+        // Weld before the simplifier sees duplicates as seams; splitting keeps the order
+        if (settings.optimizeMeshes) {
+            model.optimizeMeshes(settings.optimizerSettings);
+        }
+        if (settings.splitLargeMeshes) {
+            model.splitLargeMeshes();
+        }
+        if (settings.generateLODs) {
+            model.generateLODs(settings.lodSettings);
+            if (settings.optimizeMeshes) {
+                model.optimizeMeshes(settings.optimizerSettings, false);
+            }
+        }
+        if (settings.buildBVH) {
+            for (const auto& mesh : model.getMeshes()) {
+                mesh->buildBVH();
+            }
+        }
+        if (settings.enabled) {
+            MeshCache::save(cachePath, model, sources, settings);
+        }
+    }
+    return true;
+}
+
+bool ResourceManager::importModel(const std::string& filepath, Model& model, std::vector<std::string>& sources,
+                                  JobSystem* jobs) {
+    // Pick a loader by extension
+    std::string extension = filepath.substr(std::min(filepath.size(), filepath.find_last_of('.')));
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    
+    std::vector<std::shared_ptr<Mesh>> meshes;
+    std::vector<ModelNode> nodes;
+    sources.assign(1, filepath);
+    if (extension == ".obj") {
+        ObjLoadSettings settings;
+        settings.jobSystem = jobs;
+        if (!ObjLoader::load(filepath, meshes, settings)) {
+            std::cerr << "[ERROR] Failed to load model: " << filepath << std::endl;
+            return false;
+        }
+    } else if (extension == ".gltf" || extension == ".glb") {
+        GltfLoadResult result;
+        if (!GltfLoader::load(filepath, meshes, nodes, &result, jobs)) {
+            std::cerr << "[ERROR] Failed to load model: " << filepath << std::endl;
+            return false;
+        }
+        sources.insert(sources.end(), result.bufferFiles.begin(), result.bufferFiles.end());
+    } else {
+        std::cerr << "[ERROR] Unsupported model format '" << extension << "': " << filepath << std::endl;
+        return false;
+    }
+    
+    for (auto& mesh : meshes) {
+        model.addMesh(mesh);
+    }
+    model.setNodes(std::move(nodes));
+    return true;
 }
 
 ResourceHandle ResourceManager::createModel(const std::string& name, std::shared_ptr<Model> model) {
@@ -54,10 +218,11 @@ ResourceHandle ResourceManager::createModel(const std::string& name, std::shared
     model->metadata.name = name;
     
     registerResource(model, handle);
+    model->setVertexLayout(vertexLayout);
     
     // Create GPU resources if device is available
     if (device) {
-        model->createGPUResources(device);
+        model->createGPUResources(meshBufferPool);
     }
     
     updateMemoryStats();
@@ -93,9 +258,10 @@ ResourceHandle ResourceManager::createMesh(const std::string& name, std::shared_
     mesh->metadata.name = name;
     
     registerResource(mesh, handle);
+    mesh->setVertexLayout(vertexLayout);
     
     if (device) {
-        mesh->createGPUResources(device);
+        mesh->createGPUResources(meshBufferPool);
     }
     
     updateMemoryStats();
@@ -129,6 +295,40 @@ ResourceHandle ResourceManager::createPlaneMesh(const std::string& name, float w
     return createMesh(name, mesh);
 }
 
+size_t ResourceManager::generateMeshLODs(ResourceHandle meshHandle, const LODSettings& settings) {
+    auto mesh = getMesh(meshHandle);
+    if (!mesh) {
+        std::cerr << "[ERROR] Cannot generate LODs: mesh " << meshHandle << " not found" << std::endl;
+        return 0;
+    }
+    
+    auto levels = Model::buildLODChain({ mesh }, settings);
+    
+    if (device) {
+        for (auto& level : levels) {
+            for (auto& lodMesh : level.meshes) {
+                lodMesh->createGPUResources(meshBufferPool);
+            }
+        }
+    }
+    
+    std::cout << "[SUCCESS] Generated " << levels.size() << " LOD levels for mesh '"
+              << mesh->getName() << "' (" << mesh->getIndexCount() / 3 << " triangles";
+    for (const auto& level : levels) {
+        std::cout << " -> " << level.triangleCount;
+    }
+    std::cout << ")" << std::endl;
+    
+    size_t levelCount = levels.size();
+    meshLODs[meshHandle] = std::move(levels);
+    return levelCount;
+}
+
+const std::vector<LODLevel>* ResourceManager::getMeshLODs(ResourceHandle meshHandle) const {
+    auto it = meshLODs.find(meshHandle);
+    return it != meshLODs.end() ? &it->second : nullptr;
+}
+
 // ========== Texture Management ==========
 
 ResourceHandle ResourceManager::loadTexture(const std::string& name, const std::string& filepath) {
@@ -140,6 +340,7 @@ ResourceHandle ResourceManager::loadTexture(const std::string& name, const std::
     
     auto texture = std::make_shared<Texture>(name);
     texture->metadata.filepath = filepath;
+    texture->setGenerateMipmaps(true);
     
     if (!texture->loadFromFile(filepath)) {
         std::cerr << "[ERROR] Failed to load texture: " << filepath << std::endl;
@@ -161,6 +362,26 @@ ResourceHandle ResourceManager::loadTexture(const std::string& name, const std::
     return handle;
 }
 
+ResourceHandle ResourceManager::loadTextureAsync(const std::string& name, const std::string& filepath,
+                                                 LoadCallback onComplete) {
+    auto it = pathToHandle.find(filepath);
+    if (it != pathToHandle.end()) {
+        auto existing = getResource(it->second);
+        if (existing && existing->getState() != ResourceState::Failed) {
+            if (onComplete && existing->getState() == ResourceState::Loaded) {
+                onComplete(it->second, true);
+            }
+            return it->second;
+        }
+        removeResource(it->second);
+    }
+    
+    auto texture = std::make_shared<Texture>(name);
+    texture->metadata.filepath = filepath;
+    texture->setGenerateMipmaps(true);
+    return startAsyncLoad(texture, std::move(onComplete));
+}
+
 ResourceHandle ResourceManager::createTexture(const std::string& name, std::shared_ptr<Texture> texture) {
     if (!texture) {
         return INVALID_RESOURCE_HANDLE;
@@ -241,6 +462,7 @@ void ResourceManager::removeResource(ResourceHandle handle) {
         unregisterResource(handle);
         it->second->unload();
         resources.erase(it);
+        meshLODs.erase(handle);
         updateMemoryStats();
         
         std::cout << "[INFO] Resource removed (Handle: " << handle << ")" << std::endl;
@@ -257,16 +479,35 @@ void ResourceManager::removeResource(const std::string& name) {
 void ResourceManager::clearAllResources() {
     std::cout << "[INFO] Clearing all resources (" << resources.size() << " total)" << std::endl;
     
+    cancelAsyncLoads();
+    
+    // Models only drop their references on unload; scene models may still hold
+    // the meshes, so their ranges go back to the pool explicitly
     for (auto& pair : resources) {
+        if (pair.second->getType() == ResourceType::Model) {
+            std::static_pointer_cast<Model>(pair.second)->releaseGPUResources();
+        }
         pair.second->unload();
     }
+    // LOD meshes may outlive the manager in scene models; their ranges go back now
+    for (auto& pair : meshLODs) {
+        for (auto& level : pair.second) {
+            for (auto& lodMesh : level.meshes) {
+                lodMesh->releaseGPUResources();
+            }
+        }
+    }
     
     resources.clear();
     nameToHandle.clear();
     pathToHandle.clear();
+    meshLODs.clear();
     nextHandle = 1;
     totalMemoryUsed = 0;
     gpuMemoryUsed = 0;
+    textureGPUMemoryUsed = 0;
+    textureUncompressedMemory = 0;
+    compressedTextureCount = 0;
 }
 
 // ========== GPU Resource Management ==========
@@ -284,9 +525,9 @@ bool ResourceManager::createGPUResources(ResourceHandle handle) {
     
     // Handle different resource types
     if (auto model = std::dynamic_pointer_cast<Model>(resource)) {
-        return model->createGPUResources(device);
+        return model->createGPUResources(meshBufferPool);
     } else if (auto mesh = std::dynamic_pointer_cast<Mesh>(resource)) {
-        return mesh->createGPUResources(device);
+        return mesh->createGPUResources(meshBufferPool);
     } else if (auto texture = std::dynamic_pointer_cast<Texture>(resource)) {
         return texture->createGPUResources(device);
     }
@@ -340,6 +581,244 @@ void ResourceManager::releaseAllGPUResources() {
     }
 }
 
+void ResourceManager::compactMeshBuffers(bool force) {
+    size_t compacted = meshBufferPool.defragment(force);
+    size_t destroyed = meshBufferPool.trim();
+    std::cout << "[INFO] Mesh buffers: " << compacted << " arenas compacted, "
+              << destroyed << " empty arenas destroyed" << std::endl;
+}
+
+// ========== Async Loading ==========
+
+ResourceHandle ResourceManager::startAsyncLoad(std::shared_ptr<IResource> placeholder, LoadCallback onComplete) {
+    ResourceHandle handle = generateHandle();
+    placeholder->metadata.handle = handle;
+    placeholder->metadata.state = ResourceState::Loading;
+    registerResource(placeholder, handle);
+    
+    auto job = std::make_shared<AsyncLoadJob>();
+    job->handle = handle;
+    job->type = placeholder->getType();
+    job->name = placeholder->getName();
+    job->filepath = placeholder->getFilePath();
+    job->cacheSettings = modelCacheSettings;
+    job->vertexLayout = vertexLayout;
+    job->onComplete = std::move(onComplete);
+    job->start = std::chrono::steady_clock::now();
+    
+    asyncLoadsPending++;
+    
+    // The worker only touches the job and the shared state, never the manager
+    std::shared_ptr<AsyncLoadState> state = asyncState;
+    JobSystem* jobs = jobSystem;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->inFlight++;
+    }
+    auto task = [state, job, jobs]() {
+        if (!state->cancelled.load(std::memory_order_relaxed)) {
+            if (job->type == ResourceType::Model) {
+                job->stagedModel = std::make_shared<Model>(job->name);
+                job->stagedModel->metadata.filepath = job->filepath;
+                job->success = buildModel(job->filepath, *job->stagedModel, job->cacheSettings, jobs, job->fromCache);
+                if (job->success) {
+                    job->stagedModel->setVertexLayout(job->vertexLayout);
+                    job->success = job->stagedModel->load();
+                }
+            } else {
+                // Decode, expand and build the mip chain here; the main thread only copies
+                job->stagedTexture = std::make_shared<Texture>(job->name);
+                job->stagedTexture->setGenerateMipmaps(true);
+                job->success = job->stagedTexture->loadFromFile(job->filepath) &&
+                               job->stagedTexture->prepareGPUData(jobs);
+            }
+        }
+        
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->finished.push_back(job);
+        if (--state->inFlight == 0) {
+            state->idle.notify_all();
+        }
+    };
+    if (jobSystem) {
+        jobSystem->submit(std::move(task));
+    } else {
+        task();
+    }
+    
+    std::cout << "[INFO] Async load queued: " << job->name << " (" << job->filepath
+              << ", Handle: " << handle << ")" << std::endl;
+    return handle;
+}
+
+void ResourceManager::update() {
+    // Unloads leave gaps in the mesh arenas; close them once they split up the free space
+    meshBufferPool.defragment();
+    
+    if (asyncLoadsPending == 0) {
+        return;
+    }
+    
+    std::vector<std::shared_ptr<AsyncLoadJob>> finished;
+    {
+        std::lock_guard<std::mutex> lock(asyncState->mutex);
+        finished.swap(asyncState->finished);
+    }
+    
+    for (auto& job : finished) {
+        if (job->success && job->stagedModel) {
+            job->uploadMeshes = job->stagedModel->getMeshes();
+            for (const auto& level : job->stagedModel->getLODs()) {
+                job->uploadMeshes.insert(job->uploadMeshes.end(), level.meshes.begin(), level.meshes.end());
+            }
+        }
+        uploadQueue.push_back(std::move(job));
+    }
+    
+    // Jobs complete in order; the front one may take several frames
+    size_t budget = uploadBudgetBytes > 0 ? uploadBudgetBytes : std::numeric_limits<size_t>::max();
+    while (!uploadQueue.empty()) {
+        std::shared_ptr<AsyncLoadJob> job = uploadQueue.front();
+        if (!uploadAsyncJob(*job, budget)) {
+            break;
+        }
+        uploadQueue.pop_front();
+        completeAsyncJob(*job);
+    }
+}
+
+bool ResourceManager::uploadAsyncJob(AsyncLoadJob& job, size_t& budget) {
+    if (!job.success || !device || !hasResource(job.handle)) {
+        return true;
+    }
+    
+    job.uploadFrames++;
+    
+    if (job.stagedTexture) {
+        // Textures go up in one piece (in a frame of their own if over budget)
+        size_t bytes = job.stagedTexture->getPreparedGPUDataSize();
+        if (bytes > budget && budget < uploadBudgetBytes) {
+            return false;
+        }
+        budget -= std::min(budget, bytes);
+        job.uploadedBytes += bytes;
+        return true;
+    }
+    
+    while (job.nextUploadMesh < job.uploadMeshes.size()) {
+        if (budget == 0) {
+            return false;
+        }
+        
+        Mesh& mesh = *job.uploadMeshes[job.nextUploadMesh];
+        size_t written = 0;
+        if (!mesh.uploadGPUResources(meshBufferPool, budget, written)) {
+            if (mesh.getVertexCount() > 0) {
+                std::cerr << "[WARNING] GPU upload failed for mesh '" << mesh.getName()
+                          << "' of " << job.name << std::endl;
+            }
+            job.nextUploadMesh++;
+            continue;
+        }
+        
+        budget -= std::min(budget, written);
+        job.uploadedBytes += written;
+        if (mesh.hasGPUResources()) {
+            job.nextUploadMesh++;
+        }
+    }
+    return true;
+}
+
+void ResourceManager::completeAsyncJob(AsyncLoadJob& job) {
+    asyncLoadsPending--;
+    
+    auto resource = getResource(job.handle);
+    bool success = job.success && resource && resource->getState() == ResourceState::Loading;
+    
+    if (success && job.stagedModel) {
+        // Hand the staged data to the registered model (the meshes, with
+        // their GPU buffers, are shared, not copied)
+        auto model = std::static_pointer_cast<Model>(resource);
+        Model& staged = *job.stagedModel;
+        Vec3 boundsMin, boundsMax;
+        staged.getBounds(boundsMin, boundsMax);
+        for (const auto& mesh : staged.getMeshes()) {
+            model->addMesh(mesh);
+        }
+        model->setLODs(staged.getLODs());
+        model->setNodes(staged.getNodes());
+        model->setBounds(boundsMin, boundsMax);
+        
+        // The staging copy is dropped with the job; only the registered model keeps the meshes
+        staged.clearMeshes();
+        staged.clearLODs();
+        success = model->load();
+    } else if (success && job.stagedTexture) {
+        auto texture = std::static_pointer_cast<Texture>(resource);
+        texture->takeData(*job.stagedTexture);
+        success = texture->load();
+        if (success && device) {
+            texture->createGPUResources(device);
+        }
+    }
+    job.stagedModel.reset();
+    job.stagedTexture.reset();
+    
+    if (!resource) {
+        // Removed while loading
+        if (job.onComplete) {
+            job.onComplete(job.handle, false);
+        }
+        return;
+    }
+    
+    if (success) {
+        updateMemoryStats();
+        double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - job.start).count();
+        std::cout << "[SUCCESS] Async load complete: " << job.name << " (" << job.filepath << ", "
+                  << loadMs << " ms, " << job.uploadedBytes / 1024 << " KB uploaded over "
+                  << job.uploadFrames << " frames" << (job.fromCache ? ", from cache" : "") << ")" << std::endl;
+    } else {
+        resource->metadata.state = ResourceState::Failed;
+        std::cerr << "[ERROR] Async load failed: " << job.name << " (" << job.filepath << ")" << std::endl;
+    }
+    
+    if (job.onComplete) {
+        job.onComplete(job.handle, success);
+    }
+}
+
+void ResourceManager::waitForAsyncLoads() {
+    while (asyncLoadsPending > 0) {
+        update();
+        if (asyncLoadsPending > 0 && uploadQueue.empty()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void ResourceManager::cancelAsyncLoads() {
+    if (asyncLoadsPending == 0) {
+        return;
+    }
+    
+    // Queued jobs see the flag and skip their work; wait out the ones already
+    // running so nothing is left on a worker once this returns
+    AsyncLoadState& state = *asyncState;
+    state.cancelled.store(true, std::memory_order_relaxed);
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.idle.wait(lock, [&state]() { return state.inFlight == 0; });
+        state.finished.clear();
+    }
+    state.cancelled.store(false, std::memory_order_relaxed);
+    uploadQueue.clear();
+    
+    std::cout << "[INFO] Cancelled " << asyncLoadsPending << " async loads" << std::endl;
+    asyncLoadsPending = 0;
+}
+
 // ========== Statistics ==========
 
 void ResourceManager::printStatistics() const {
@@ -347,6 +826,16 @@ void ResourceManager::printStatistics() const {
     std::cout << "Total Resources: " << resources.size() << std::endl;
     std::cout << "CPU Memory Used: " << (totalMemoryUsed / 1024.0 / 1024.0) << " MB" << std::endl;
     std::cout << "GPU Memory Used: " << (gpuMemoryUsed / 1024.0 / 1024.0) << " MB (estimate)" << std::endl;
+    std::cout << "Texture GPU Memory: " << (textureGPUMemoryUsed / 1024.0 / 1024.0) << " MB ("
+              << (textureUncompressedMemory / 1024.0 / 1024.0) << " MB uncompressed, "
+              << (getTextureMemorySaved() / 1024.0 / 1024.0) << " MB saved by compression)" << std::endl;
+    std::cout << "Mesh GPU Memory: " << (meshGPUMemoryUsed / 1024.0 / 1024.0) << " MB ("
+              << (getVertexMemorySaved() / 1024.0 / 1024.0) << " MB saved by the vertex layout)" << std::endl;
+    MeshBufferPool::Stats arenaStats = getMeshBufferStats();
+    std::cout << "Mesh Buffer Arenas: " << arenaStats.vertexArenas << " vertex + " << arenaStats.indexArenas
+              << " index (" << arenaStats.buffers << " buffers, " << arenaStats.allocations << " ranges, "
+              << (arenaStats.usedBytes / 1024.0 / 1024.0) << " / " << (arenaStats.capacityBytes / 1024.0 / 1024.0)
+              << " MB used)" << std::endl;
     
     // Count by type
     int modelCount = 0, meshCount = 0, textureCount = 0, otherCount = 0;
@@ -363,7 +852,7 @@ void ResourceManager::printStatistics() const {
     std::cout << "\nBy Type:" << std::endl;
     std::cout << "  Models: " << modelCount << std::endl;
     std::cout << "  Meshes: " << meshCount << std::endl;
-    std::cout << "  Textures: " << textureCount << std::endl;
+    std::cout << "  Textures: " << textureCount << " (" << compressedTextureCount << " block-compressed)" << std::endl;
     std::cout << "  Other: " << otherCount << std::endl;
     std::cout << "================================================\n" << std::endl;
 }
@@ -408,6 +897,11 @@ void ResourceManager::unregisterResource(ResourceHandle handle) {
 void ResourceManager::updateMemoryStats() {
     totalMemoryUsed = 0;
     gpuMemoryUsed = 0;
+    textureGPUMemoryUsed = 0;
+    textureUncompressedMemory = 0;
+    compressedTextureCount = 0;
+    meshGPUMemoryUsed = 0;
+    meshUnpackedMemory = 0;
     
     for (const auto& pair : resources) {
         totalMemoryUsed += pair.second->getMemorySize();
@@ -415,14 +909,21 @@ void ResourceManager::updateMemoryStats() {
         // Estimate GPU memory (rough approximation)
         if (auto mesh = std::dynamic_pointer_cast<Mesh>(pair.second)) {
             if (mesh->hasGPUResources()) {
-                gpuMemoryUsed += mesh->getMemorySize();
+                meshGPUMemoryUsed += mesh->getGPUMemorySize();
+                meshUnpackedMemory += mesh->getUnpackedGPUMemorySize();
             }
+        } else if (auto model = std::dynamic_pointer_cast<Model>(pair.second)) {
+            meshGPUMemoryUsed += model->getGPUMemorySize();
+            meshUnpackedMemory += model->getUnpackedGPUMemorySize();
         } else if (auto texture = std::dynamic_pointer_cast<Texture>(pair.second)) {
             if (texture->hasGPUResources()) {
-                gpuMemoryUsed += texture->getMemorySize();
+                textureGPUMemoryUsed += texture->getGPUMemorySize();
+                textureUncompressedMemory += texture->getUncompressedGPUMemorySize();
+                compressedTextureCount += texture->isCompressed() ? 1 : 0;
             }
         }
     }
+    gpuMemoryUsed += meshGPUMemoryUsed + textureGPUMemoryUsed;
 }
 
 } // namespace resource
@@ -1,15 +1,21 @@
 #pragma once
 
 #include "ResourceTypes.h"
+#include "model/MeshCache.h"
 #include "model/Model.h"
 #include "model/Mesh.h"
 #include "texture/Texture.h"
+#include <deque>
+#include <functional>
 #include <unordered_map>
 #include <memory>
 #include <string>
 #include <webgpu/webgpu_cpp.h>
 
 namespace rs_engine {
+
+class JobSystem;
+
 namespace resource {
 
 /**
@@ -20,27 +26,67 @@ namespace resource {
  * - Reference counting
  * - GPU resource management
  * - Memory tracking
+ * - Asynchronous loading (parse on JobSystem workers, GPU upload in update())
  * 
  * Platform Support: 100% shared
  * - Resource loading: identical on all platforms
  * - File system: Web uses virtual FS, Native uses real FS
  */
 class ResourceManager {
+public:
+    /**
+     * @brief Async load completion (main thread, from update())
+     */
+    using LoadCallback = std::function<void(ResourceHandle handle, bool success)>;
+    
+    static constexpr size_t DEFAULT_UPLOAD_BUDGET = 16 * 1024 * 1024;  // Bytes per update()
+
 private:
+    struct AsyncLoadJob;
+    struct AsyncLoadState;
+    
+    // Shared vertex / index buffers of every mesh created through this manager
+    // (declared first so it outlives the resources holding ranges of it)
+    MeshBufferPool meshBufferPool;
+    
     // Resource storage
     std::unordered_map<ResourceHandle, std::shared_ptr<IResource>> resources;
     std::unordered_map<std::string, ResourceHandle> nameToHandle;
     std::unordered_map<std::string, ResourceHandle> pathToHandle;
     
+    // LOD chains generated per mesh (shared by every model built from that mesh)
+    std::unordered_map<ResourceHandle, std::vector<LODLevel>> meshLODs;
+    
+    // Binary mesh caches used by loadModel()
+    ModelCacheSettings modelCacheSettings;
+    
+    // GPU vertex encoding of meshes created or loaded from now on
+    VertexLayout vertexLayout;
+    
+    // Async loading: finished jobs come back through asyncState, then wait
+    // in uploadQueue until their GPU data has been written
+    std::shared_ptr<AsyncLoadState> asyncState;
+    std::deque<std::shared_ptr<AsyncLoadJob>> uploadQueue;
+    size_t asyncLoadsPending = 0;
+    size_t uploadBudgetBytes = DEFAULT_UPLOAD_BUDGET;
+    
     // Handle generation
     ResourceHandle nextHandle = 1;
     
     // WebGPU device for GPU resource creation
     wgpu::Device device;
     
+    // Workers for async loads and parallel parsing (nullptr = calling thread)
+    JobSystem* jobSystem = nullptr;
+    
     // Statistics
     size_t totalMemoryUsed = 0;
     size_t gpuMemoryUsed = 0;
+    size_t textureGPUMemoryUsed = 0;
+    size_t textureUncompressedMemory = 0;   // Same textures as RGBA8 / RG8
+    size_t compressedTextureCount = 0;
+    size_t meshGPUMemoryUsed = 0;
+    size_t meshUnpackedMemory = 0;          // Same meshes with 48-byte vertices
 
 public:
     ResourceManager();
@@ -51,24 +97,74 @@ public:
     /**
      * @brief Initialize resource manager with WebGPU device
      * @param wgpuDevice WebGPU device for GPU resource creation
+     * @param jobs Worker pool for loading (nullptr = everything on the calling
+     *             thread); must outlive shutdown()
      */
-    void initialize(wgpu::Device wgpuDevice);
+    void initialize(wgpu::Device wgpuDevice, JobSystem* jobs = nullptr);
     
     /**
      * @brief Shutdown and release all resources
+     * 
+     * Cancels async loads and waits for the ones still running on workers,
+     * so no worker touches a model or texture after the device is released.
      */
     void shutdown();
     
+    /**
+     * @brief Per-frame work: finish async loads and upload their GPU data
+     * 
+     * Writes at most the upload budget to the GPU per call; a large mesh
+     * is spread over several frames. Completion callbacks run from here.
+     * Fragmented mesh buffer arenas are compacted here as well (outside
+     * any render pass).
+     */
+    void update();
+    
     // ========== Model Management ==========
     
     /**
      * @brief Load a model from file
+     * 
+     * With caching enabled (default), the model is read from
+     * "<filepath>.rsmesh" while that cache matches the source content;
+     * otherwise the source is imported and the cache rewritten.
      * @param name Resource name (for lookup)
-     * @param filepath Path to model file (.obj, .gltf, etc.)
+     * @param filepath Path to model file (.obj, .gltf, .glb)
      * @return Resource handle (INVALID_RESOURCE_HANDLE on failure)
      */
     ResourceHandle loadModel(const std::string& name, const std::string& filepath);
     
+    /**
+     * @brief Load a model without blocking
+     * 
+     * Returns at once with a handle to an empty model in state Loading.
+     * Parsing (or the mesh cache read, LODs and BVHs) runs on a worker of
+     * the manager's JobSystem (inline without one); update() then uploads the meshes within the per-frame budget
+     * and fills the model in. Its state becomes Loaded or Failed before the
+     * callback runs. Attach the model to scene objects from the callback:
+     * object bounds are taken from the model when it is set.
+     * @param onComplete Optional, called once from update() (not for loads
+     *                   dropped by clearAllResources() or shutdown())
+     * @return Resource handle (the existing one if the path is already loaded or loading)
+     */
+    ResourceHandle loadModelAsync(const std::string& name, const std::string& filepath,
+                                  LoadCallback onComplete = nullptr);
+    
+    /**
+     * @brief Mesh cache use and what is precomputed into new caches (LODs, BVHs)
+     */
+    void setModelCacheSettings(const ModelCacheSettings& settings) { modelCacheSettings = settings; }
+    const ModelCacheSettings& getModelCacheSettings() const { return modelCacheSettings; }
+    
+    /**
+     * @brief GPU vertex encoding for meshes and models created or loaded afterwards
+     * 
+     * Default: VertexLayout::standard(). VertexLayout::compact() also
+     * quantizes positions (one box per model; Scene dequantizes them).
+     */
+    void setVertexLayout(const VertexLayout& layout) { vertexLayout = layout; }
+    const VertexLayout& getVertexLayout() const { return vertexLayout; }
+    
     /**
      * @brief Create a procedural model
      * @param name Resource name
@@ -116,16 +212,50 @@ public:
     ResourceHandle createPlaneMesh(const std::string& name = "Plane",
                                   float width = 1.0f, float height = 1.0f);
     
+    /**
+     * @brief Generate a LOD chain for a mesh with the QEM simplifier (load time)
+     * 
+     * GPU buffers are created for every level. Models created from this mesh
+     * afterwards (e.g. Scene::addMeshToObject) pick the chain up automatically.
+     * @return Number of LOD levels generated (0 on failure)
+     */
+    size_t generateMeshLODs(ResourceHandle meshHandle,
+                            const LODSettings& settings = LODSettings());
+    
+    /**
+     * @brief Get the LOD chain generated for a mesh
+     * @return nullptr if none was generated
+     */
+    const std::vector<LODLevel>* getMeshLODs(ResourceHandle meshHandle) const;
+    
     // ========== Texture Management ==========
     
     /**
      * @brief Load texture from file
+     * 
+     * File textures get a full mip chain (Texture::setGenerateMipmaps).
      * @param name Resource name
-     * @param filepath Path to texture file (.png, .jpg, etc.)
+     * @param filepath Path to texture file (.png, .tga, .bmp, .ppm / .pgm)
      * @return Resource handle (INVALID_RESOURCE_HANDLE on failure)
      */
     ResourceHandle loadTexture(const std::string& name, const std::string& filepath);
     
+    /**
+     * @brief Whether the device can use a texture format
+     * 
+     * Block-compressed formats depend on the adapter (BC on desktop, ETC2 /
+     * ASTC mostly on mobile); use this to pick which KTX2 variant to load.
+     */
+    bool isTextureFormatSupported(TextureFormat format) const { return Texture::isFormatSupported(device, format); }
+    
+    /**
+     * @brief Load a texture without blocking (see loadModelAsync)
+     * 
+     * Decoding and mip generation run on the worker; update() only uploads.
+     */
+    ResourceHandle loadTextureAsync(const std::string& name, const std::string& filepath,
+                                    LoadCallback onComplete = nullptr);
+    
     /**
      * @brief Create a texture resource
      * @param name Resource name
@@ -203,6 +333,38 @@ public:
      */
     void releaseAllGPUResources();
     
+    /**
+     * @brief Compact the shared mesh buffer arenas and destroy empty ones
+     * 
+     * update() already compacts arenas past MeshBufferPool's fragmentation
+     * threshold; call this after unloading many meshes (e.g. a level) to
+     * also close small gaps (force) and give unused arenas back.
+     */
+    void compactMeshBuffers(bool force = true);
+    
+    // ========== Async Loading ==========
+    
+    /**
+     * @brief Bytes of GPU data update() may write per call (default 16 MB, 0 = no limit)
+     */
+    void setUploadBudget(size_t bytesPerUpdate) { uploadBudgetBytes = bytesPerUpdate; }
+    size_t getUploadBudget() const { return uploadBudgetBytes; }
+    
+    /**
+     * @brief Async loads not yet completed (parsing or uploading)
+     */
+    size_t getPendingLoadCount() const { return asyncLoadsPending; }
+    
+    /**
+     * @brief Call update() until every async load has completed (loading screens, tools)
+     */
+    void waitForAsyncLoads();
+    
+    /**
+     * @brief Worker pool given to initialize() (nullptr if none)
+     */
+    JobSystem* getJobSystem() const { return jobSystem; }
+    
     // ========== Statistics ==========
     
     /**
@@ -220,12 +382,86 @@ public:
      */
     size_t getGPUMemoryUsed() const { return gpuMemoryUsed; }
     
+    /**
+     * @brief GPU memory of uploaded textures (all mip levels)
+     */
+    size_t getTextureGPUMemoryUsed() const { return textureGPUMemoryUsed; }
+    
+    /**
+     * @brief GPU memory block compression saves over the same textures uncompressed
+     */
+    size_t getTextureMemorySaved() const { return textureUncompressedMemory - textureGPUMemoryUsed; }
+    
+    /**
+     * @brief Number of uploaded block-compressed textures
+     */
+    size_t getCompressedTextureCount() const { return compressedTextureCount; }
+    
+    /**
+     * @brief GPU memory of uploaded mesh vertex and index data (LODs included)
+     */
+    size_t getMeshGPUMemoryUsed() const { return meshGPUMemoryUsed; }
+    
+    /**
+     * @brief GPU memory the vertex layout saves over 48-byte vertices
+     */
+    size_t getVertexMemorySaved() const { return meshUnpackedMemory - meshGPUMemoryUsed; }
+    
+    /**
+     * @brief Arenas, buffers and occupancy of the shared mesh buffers
+     */
+    MeshBufferPool::Stats getMeshBufferStats() const { return meshBufferPool.getStats(); }
+    
+    /**
+     * @brief Buffer pool for meshes created outside the manager (bound to its device)
+     */
+    MeshBufferPool& getMeshBufferPool() { return meshBufferPool; }
+    
     /**
      * @brief Print resource statistics
      */
     void printStatistics() const;
 
 private:
+    /**
+     * @brief Parse a model source file with the loader for its extension
+     * @param sources Output: files read (for cache invalidation)
+     * @param jobs Workers for the loader (nullptr = calling thread only)
+     */
+    static bool importModel(const std::string& filepath, Model& model, std::vector<std::string>& sources,
+                            JobSystem* jobs);
+    
+    /**
+     * @brief Fill a model from its mesh cache or by importing the source (any thread)
+     * @param fromCache Output: true if the cache was used
+     */
+    static bool buildModel(const std::string& filepath, Model& model,
+                           const ModelCacheSettings& settings, JobSystem* jobs, bool& fromCache);
+    
+    /**
+     * @brief Register a Loading placeholder and hand the job to a worker
+     */
+    ResourceHandle startAsyncLoad(std::shared_ptr<IResource> placeholder, LoadCallback onComplete);
+    
+    /**
+     * @brief Upload part of a finished job's GPU data
+     * @return true once the job needs no more uploads
+     */
+    bool uploadAsyncJob(AsyncLoadJob& job, size_t& budget);
+    
+    /**
+     * @brief Move a finished job's data into its placeholder and run the callback
+     */
+    void completeAsyncJob(AsyncLoadJob& job);
+    
+    /**
+     * @brief Drop in-flight async loads (their results are discarded)
+     * 
+     * Queued jobs are skipped; blocks until jobs already running on a
+     * worker have returned.
+     */
+    void cancelAsyncLoads();
+    
     /**
      * @brief Generate unique resource handle
      */
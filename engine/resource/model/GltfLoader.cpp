@@ -0,0 +1,774 @@
+#include "GltfLoader.h"
+#include "../../core/JobSystem.h"
+#include "../../core/MappedFile.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t GLB_MAGIC = 0x46546C67;        // "glTF"
+constexpr uint32_t GLB_CHUNK_JSON = 0x4E4F534A;   // "JSON"
+constexpr uint32_t GLB_CHUNK_BIN = 0x004E4942;    // "BIN\0"
+constexpr int MAX_JSON_DEPTH = 64;
+
+// Accessor component types
+constexpr uint32_t COMPONENT_BYTE = 5120;
+constexpr uint32_t COMPONENT_UNSIGNED_BYTE = 5121;
+constexpr uint32_t COMPONENT_SHORT = 5122;
+constexpr uint32_t COMPONENT_UNSIGNED_SHORT = 5123;
+constexpr uint32_t COMPONENT_UNSIGNED_INT = 5125;
+constexpr uint32_t COMPONENT_FLOAT = 5126;
+
+// Primitive modes
+constexpr int MODE_TRIANGLES = 4;
+constexpr int MODE_TRIANGLE_STRIP = 5;
+constexpr int MODE_TRIANGLE_FAN = 6;
+
+// ========== JSON ==========
+
+/**
+ * @brief Minimal JSON DOM (glTF documents are small next to their buffers)
+ */
+struct JsonValue {
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> elements;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    const JsonValue& operator[](std::string_view key) const {
+        for (const auto& member : members) {
+            if (member.first == key) return member.second;
+        }
+        return null();
+    }
+    const JsonValue& operator[](size_t index) const {
+        return index < elements.size() ? elements[index] : null();
+    }
+
+    bool isNull() const { return type == Type::Null; }
+    size_t size() const { return type == Type::Array ? elements.size() : 0; }
+    double asNumber(double fallback = 0.0) const { return type == Type::Number ? number : fallback; }
+    int64_t asInt(int64_t fallback = -1) const {
+        return type == Type::Number ? static_cast<int64_t>(number) : fallback;
+    }
+    const std::string& asString() const { return string; }
+
+    static const JsonValue& null() {
+        static const JsonValue value;
+        return value;
+    }
+};
+
+class JsonParser {
+public:
+    JsonParser(const char* text, size_t size) : p(text), end(text + size) {}
+
+    bool parse(JsonValue& root) {
+        if (!parseValue(root, 0)) return false;
+        skipWhitespace();
+        return p == end;
+    }
+
+private:
+    const char* p;
+    const char* end;
+
+    void skipWhitespace() {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) ++p;
+    }
+
+    bool literal(const char* word) {
+        size_t length = std::strlen(word);
+        if (static_cast<size_t>(end - p) < length || std::memcmp(p, word, length) != 0) return false;
+        p += length;
+        return true;
+    }
+
+    static void appendUtf8(std::string& out, uint32_t codePoint) {
+        if (codePoint < 0x80) {
+            out += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codePoint >> 6));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            out += static_cast<char>(0xE0 | (codePoint >> 12));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (codePoint >> 18));
+            out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    bool parseHex4(uint32_t& value) {
+        if (end - p < 4) return false;
+        value = 0;
+        for (int i = 0; i < 4; ++i, ++p) {
+            char c = *p;
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= static_cast<uint32_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') value |= static_cast<uint32_t>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') value |= static_cast<uint32_t>(c - 'A' + 10);
+            else return false;
+        }
+        return true;
+    }
+
+    bool parseString(std::string& out) {
+        if (p >= end || *p != '"') return false;
+        ++p;
+        while (p < end && *p != '"') {
+            if (*p != '\\') {
+                out += *p++;
+                continue;
+            }
+            if (++p >= end) return false;
+            char escape = *p++;
+            switch (escape) {
+                case '"': out += '"'; break;
+                case '\\': out += '\\'; break;
+                case '/': out += '/'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u': {
+                    uint32_t codePoint;
+                    if (!parseHex4(codePoint)) return false;
+                    if (codePoint >= 0xD800 && codePoint < 0xDC00 && end - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+                        p += 2;
+                        uint32_t low;
+                        if (!parseHex4(low)) return false;
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(out, codePoint);
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        if (p >= end) return false;
+        ++p;
+        return true;
+    }
+
+    bool parseValue(JsonValue& value, int depth) {
+        skipWhitespace();
+        if (p >= end || depth > MAX_JSON_DEPTH) return false;
+
+        switch (*p) {
+            case '{': {
+                value.type = JsonValue::Type::Object;
+                ++p;
+                skipWhitespace();
+                if (p < end && *p == '}') { ++p; return true; }
+                while (true) {
+                    skipWhitespace();
+                    std::pair<std::string, JsonValue> member;
+                    if (!parseString(member.first)) return false;
+                    skipWhitespace();
+                    if (p >= end || *p++ != ':') return false;
+                    if (!parseValue(member.second, depth + 1)) return false;
+                    value.members.push_back(std::move(member));
+                    skipWhitespace();
+                    if (p < end && *p == ',') { ++p; continue; }
+                    if (p < end && *p == '}') { ++p; return true; }
+                    return false;
+                }
+            }
+            case '[': {
+                value.type = JsonValue::Type::Array;
+                ++p;
+                skipWhitespace();
+                if (p < end && *p == ']') { ++p; return true; }
+                while (true) {
+                    value.elements.emplace_back();
+                    if (!parseValue(value.elements.back(), depth + 1)) return false;
+                    skipWhitespace();
+                    if (p < end && *p == ',') { ++p; continue; }
+                    if (p < end && *p == ']') { ++p; return true; }
+                    return false;
+                }
+            }
+            case '"':
+                value.type = JsonValue::Type::String;
+                return parseString(value.string);
+            case 't':
+                value.type = JsonValue::Type::Bool;
+                value.boolean = true;
+                return literal("true");
+            case 'f':
+                value.type = JsonValue::Type::Bool;
+                return literal("false");
+            case 'n':
+                return literal("null");
+            default: {
+                // strtod needs a terminated copy of the token
+                char token[64];
+                size_t length = 0;
+                while (p + length < end && length < sizeof(token) - 1 &&
+                       std::strchr("+-0123456789.eE", p[length])) {
+                    token[length] = p[length];
+                    ++length;
+                }
+                token[length] = '\0';
+                char* stop = nullptr;
+                value.type = JsonValue::Type::Number;
+                value.number = std::strtod(token, &stop);
+                if (stop == token) return false;
+                p += stop - token;
+                return true;
+            }
+        }
+    }
+};
+
+// ========== Buffers ==========
+
+/**
+ * @brief Bytes of one glTF buffer (mapped file range or decoded data URI)
+ */
+struct BufferData {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+bool decodeBase64(std::string_view text, std::vector<uint8_t>& out) {
+    auto sextet = [](char c) -> int {
+        if (c >= 'A' && c <= 'Z') return c - 'A';
+        if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+        if (c >= '0' && c <= '9') return c - '0' + 52;
+        if (c == '+' || c == '-') return 62;
+        if (c == '/' || c == '_') return 63;
+        return -1;
+    };
+    out.clear();
+    out.reserve(text.size() / 4 * 3);
+    uint32_t bits = 0;
+    int bitCount = 0;
+    for (char c : text) {
+        if (c == '=') break;
+        int value = sextet(c);
+        if (value < 0) return false;
+        bits = (bits << 6) | static_cast<uint32_t>(value);
+        bitCount += 6;
+        if (bitCount >= 8) {
+            bitCount -= 8;
+            out.push_back(static_cast<uint8_t>(bits >> bitCount));
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Resolved accessor: element i starts at data + i * stride
+ */
+struct AccessorView {
+    const uint8_t* data = nullptr;
+    size_t count = 0;
+    size_t stride = 0;
+    uint32_t componentType = 0;
+    uint32_t components = 0;
+    bool normalized = false;
+};
+
+size_t componentSize(uint32_t componentType) {
+    switch (componentType) {
+        case COMPONENT_BYTE:
+        case COMPONENT_UNSIGNED_BYTE: return 1;
+        case COMPONENT_SHORT:
+        case COMPONENT_UNSIGNED_SHORT: return 2;
+        case COMPONENT_UNSIGNED_INT:
+        case COMPONENT_FLOAT: return 4;
+        default: return 0;
+    }
+}
+
+uint32_t componentCount(const std::string& type) {
+    if (type == "SCALAR") return 1;
+    if (type == "VEC2") return 2;
+    if (type == "VEC3") return 3;
+    if (type == "VEC4") return 4;
+    return 0;
+}
+
+/**
+ * @brief Validate an accessor against its buffer view and buffer
+ */
+bool resolveAccessor(const JsonValue& gltf, int64_t index, const std::vector<BufferData>& buffers,
+                     AccessorView& view) {
+    const JsonValue& accessor = gltf["accessors"][static_cast<size_t>(index)];
+    if (index < 0 || accessor.isNull() || !accessor["sparse"].isNull()) {
+        return false;
+    }
+    view.count = static_cast<size_t>(accessor["count"].asInt(0));
+    view.componentType = static_cast<uint32_t>(accessor["componentType"].asInt(0));
+    view.components = componentCount(accessor["type"].asString());
+    view.normalized = accessor["normalized"].boolean;
+    size_t elementSize = componentSize(view.componentType) * view.components;
+    if (elementSize == 0 || view.count == 0) {
+        return false;
+    }
+
+    const JsonValue& bufferView = gltf["bufferViews"][static_cast<size_t>(accessor["bufferView"].asInt())];
+    int64_t bufferIndex = bufferView["buffer"].asInt();
+    if (bufferView.isNull() || bufferIndex < 0 || static_cast<size_t>(bufferIndex) >= buffers.size()) {
+        return false;
+    }
+    const BufferData& buffer = buffers[static_cast<size_t>(bufferIndex)];
+    uint64_t viewOffset = static_cast<uint64_t>(bufferView["byteOffset"].asInt(0));
+    uint64_t viewLength = static_cast<uint64_t>(bufferView["byteLength"].asInt(0));
+    uint64_t accessorOffset = static_cast<uint64_t>(accessor["byteOffset"].asInt(0));
+    view.stride = static_cast<size_t>(bufferView["byteStride"].asInt(0));
+    if (view.stride == 0) {
+        view.stride = elementSize;
+    }
+
+    uint64_t lastByte = accessorOffset + static_cast<uint64_t>(view.stride) * (view.count - 1) + elementSize;
+    if (view.stride < elementSize || viewOffset + viewLength > buffer.size || lastByte > viewLength) {
+        return false;
+    }
+    view.data = buffer.data + viewOffset + accessorOffset;
+    return true;
+}
+
+/**
+ * @brief Component as float (normalized integers map to [0, 1] / [-1, 1])
+ */
+inline float readComponent(const uint8_t* p, uint32_t componentType, bool normalized) {
+    switch (componentType) {
+        case COMPONENT_FLOAT: { float v; std::memcpy(&v, p, 4); return v; }
+        case COMPONENT_UNSIGNED_BYTE: return normalized ? *p / 255.0f : *p;
+        case COMPONENT_BYTE: { float v = static_cast<int8_t>(*p); return normalized ? std::max(v / 127.0f, -1.0f) : v; }
+        case COMPONENT_UNSIGNED_SHORT: { uint16_t v; std::memcpy(&v, p, 2); return normalized ? v / 65535.0f : v; }
+        case COMPONENT_SHORT: { int16_t v; std::memcpy(&v, p, 2); return normalized ? std::max(v / 32767.0f, -1.0f) : v; }
+        case COMPONENT_UNSIGNED_INT: { uint32_t v; std::memcpy(&v, p, 4); return static_cast<float>(v); }
+        default: return 0.0f;
+    }
+}
+
+/**
+ * @brief Write an accessor into one Vec3 member of every vertex
+ * @return Bytes copied without per-component decoding
+ */
+size_t readVec3Attribute(const AccessorView& view, std::vector<Vertex>& vertices, Vec3 Vertex::*member,
+                         const Vec3& fill) {
+    const size_t componentBytes = componentSize(view.componentType);
+    const uint32_t components = std::min<uint32_t>(view.components, 3);
+    if (view.componentType == COMPONENT_FLOAT && view.components >= 3) {
+        // Layout matches Vec3: one 12-byte copy per vertex
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            std::memcpy(&(vertices[i].*member), view.data + i * view.stride, sizeof(Vec3));
+        }
+        return vertices.size() * sizeof(Vec3);
+    }
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const uint8_t* element = view.data + i * view.stride;
+        float v[3] = {fill.x, fill.y, fill.z};
+        for (uint32_t c = 0; c < components; ++c) {
+            v[c] = readComponent(element + c * componentBytes, view.componentType, view.normalized);
+        }
+        vertices[i].*member = Vec3(v[0], v[1], v[2]);
+    }
+    return 0;
+}
+
+// ========== Primitives ==========
+
+struct PrimitiveJob {
+    const JsonValue* primitive = nullptr;
+    std::string name;
+    std::shared_ptr<Mesh> mesh;
+    std::string error;           // Reason the primitive was skipped
+    size_t bulkCopiedBytes = 0;
+};
+
+void decodePrimitive(const JsonValue& gltf, const std::vector<BufferData>& buffers, PrimitiveJob& job) {
+    const JsonValue& primitive = *job.primitive;
+    const JsonValue& attributes = primitive["attributes"];
+    int64_t mode = primitive["mode"].asInt(MODE_TRIANGLES);
+    if (mode != MODE_TRIANGLES && mode != MODE_TRIANGLE_STRIP && mode != MODE_TRIANGLE_FAN) {
+        job.error = "not a triangle primitive";
+        return;
+    }
+    if (!primitive["extensions"].members.empty()) {
+        job.error = "compressed primitive (" + primitive["extensions"].members.front().first + ")";
+        return;
+    }
+
+    AccessorView positions;
+    if (!resolveAccessor(gltf, attributes["POSITION"].asInt(), buffers, positions) || positions.components < 3) {
+        job.error = "missing or invalid POSITION accessor";
+        return;
+    }
+
+    std::vector<Vertex> vertices(positions.count, Vertex(Vec3(0, 0, 0), Vec3(0, 0, 0)));
+    job.bulkCopiedBytes += readVec3Attribute(positions, vertices, &Vertex::position, Vec3(0, 0, 0));
+
+    AccessorView view;
+    bool hasNormals = false;
+    if (!attributes["NORMAL"].isNull()) {
+        hasNormals = resolveAccessor(gltf, attributes["NORMAL"].asInt(), buffers, view) && view.count == vertices.size();
+        if (hasNormals) {
+            job.bulkCopiedBytes += readVec3Attribute(view, vertices, &Vertex::normal, Vec3(0, 0, 0));
+        }
+    }
+    if (resolveAccessor(gltf, attributes["TEXCOORD_0"].asInt(), buffers, view) && view.count == vertices.size()) {
+        // glTF UVs already have their origin at the top-left
+        readVec3Attribute(view, vertices, &Vertex::texCoord, Vec3(0, 0, 0));
+        if (view.components > 2) {
+            for (Vertex& vertex : vertices) vertex.texCoord.z = 0.0f;
+        }
+    }
+    if (resolveAccessor(gltf, attributes["COLOR_0"].asInt(), buffers, view) && view.count == vertices.size()) {
+        readVec3Attribute(view, vertices, &Vertex::color, Vec3(1, 1, 1));
+    }
+
+    // Indices (uint32 ranges are copied as a block)
+    std::vector<uint32_t> indices;
+    if (!primitive["indices"].isNull()) {
+        if (!resolveAccessor(gltf, primitive["indices"].asInt(), buffers, view) || view.components != 1) {
+            job.error = "invalid index accessor";
+            return;
+        }
+        indices.resize(view.count);
+        if (view.componentType == COMPONENT_UNSIGNED_INT && view.stride == 4) {
+            std::memcpy(indices.data(), view.data, view.count * 4);
+            job.bulkCopiedBytes += view.count * 4;
+        } else if (view.componentType == COMPONENT_UNSIGNED_SHORT) {
+            for (size_t i = 0; i < view.count; ++i) {
+                uint16_t index;
+                std::memcpy(&index, view.data + i * view.stride, 2);
+                indices[i] = index;
+            }
+        } else if (view.componentType == COMPONENT_UNSIGNED_BYTE) {
+            for (size_t i = 0; i < view.count; ++i) indices[i] = view.data[i * view.stride];
+        } else if (view.componentType == COMPONENT_UNSIGNED_INT) {
+            for (size_t i = 0; i < view.count; ++i) std::memcpy(&indices[i], view.data + i * view.stride, 4);
+        } else {
+            job.error = "invalid index component type";
+            return;
+        }
+        for (uint32_t index : indices) {
+            if (index >= vertices.size()) {
+                job.error = "index out of range";
+                return;
+            }
+        }
+    } else {
+        indices.resize(vertices.size());
+        for (size_t i = 0; i < indices.size(); ++i) indices[i] = static_cast<uint32_t>(i);
+    }
+
+    // Strips and fans become lists
+    if (mode != MODE_TRIANGLES) {
+        std::vector<uint32_t> list;
+        list.reserve(indices.size() >= 3 ? (indices.size() - 2) * 3 : 0);
+        for (size_t i = 2; i < indices.size(); ++i) {
+            if (mode == MODE_TRIANGLE_FAN) {
+                list.insert(list.end(), {indices[0], indices[i - 1], indices[i]});
+            } else if (i % 2 == 0) {
+                list.insert(list.end(), {indices[i - 2], indices[i - 1], indices[i]});
+            } else {
+                list.insert(list.end(), {indices[i - 1], indices[i - 2], indices[i]});
+            }
+        }
+        indices.swap(list);
+    }
+    indices.resize(indices.size() / 3 * 3);
+    if (indices.empty()) {
+        job.error = "no triangles";
+        return;
+    }
+
+    job.mesh = std::make_shared<Mesh>(job.name);
+    job.mesh->setVertices(std::move(vertices));
+    job.mesh->setIndices(std::move(indices));
+    if (!hasNormals) {
+        job.mesh->calculateNormals();
+    }
+    job.mesh->load();
+}
+
+// ========== Nodes ==========
+
+/**
+ * @brief Euler angles (Y * X * Z order, see Transform) of a rotation matrix
+ * @param r Row-major 3x3 rotation
+ */
+Vec3 eulerFromRotation(const float r[3][3]) {
+    float sinX = std::max(-1.0f, std::min(1.0f, -r[1][2]));
+    float x = std::asin(sinX);
+    if (std::fabs(sinX) < 0.9999f) {
+        return Vec3(x, std::atan2(r[0][2], r[2][2]), std::atan2(r[1][0], r[1][1]));
+    }
+    // Gimbal lock: Y and Z turn around the same axis; put it all in Y
+    return Vec3(x, std::atan2(-r[2][0], r[0][0]), 0.0f);
+}
+
+Transform nodeTransform(const JsonValue& node) {
+    Transform transform;
+    float r[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+
+    const JsonValue& matrix = node["matrix"];
+    if (matrix.size() == 16) {
+        // Column-major; decompose into translation, scale and rotation (no shear)
+        float m[16];
+        for (size_t i = 0; i < 16; ++i) m[i] = static_cast<float>(matrix[i].asNumber());
+        transform.position = Vec3(m[12], m[13], m[14]);
+        float scale[3];
+        for (int column = 0; column < 3; ++column) {
+            const float* axis = &m[column * 4];
+            scale[column] = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+            for (int row = 0; row < 3; ++row) {
+                r[row][column] = scale[column] > 0.0f ? axis[row] / scale[column] : 0.0f;
+            }
+        }
+        transform.scale = Vec3(scale[0], scale[1], scale[2]);
+    } else {
+        const JsonValue& t = node["translation"];
+        const JsonValue& s = node["scale"];
+        const JsonValue& q = node["rotation"];
+        if (t.size() == 3) {
+            transform.position = Vec3(float(t[0].asNumber()), float(t[1].asNumber()), float(t[2].asNumber()));
+        }
+        if (s.size() == 3) {
+            transform.scale = Vec3(float(s[0].asNumber(1)), float(s[1].asNumber(1)), float(s[2].asNumber(1)));
+        }
+        if (q.size() == 4) {
+            float x = float(q[0].asNumber()), y = float(q[1].asNumber());
+            float z = float(q[2].asNumber()), w = float(q[3].asNumber(1));
+            r[0][0] = 1 - 2 * (y * y + z * z); r[0][1] = 2 * (x * y - w * z);     r[0][2] = 2 * (x * z + w * y);
+            r[1][0] = 2 * (x * y + w * z);     r[1][1] = 1 - 2 * (x * x + z * z); r[1][2] = 2 * (y * z - w * x);
+            r[2][0] = 2 * (x * z - w * y);     r[2][1] = 2 * (y * z + w * x);     r[2][2] = 1 - 2 * (x * x + y * y);
+        }
+    }
+    transform.rotation = eulerFromRotation(r);
+    return transform;
+}
+
+double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+// ========== GltfLoader ==========
+
+bool GltfLoader::load(const std::string& filepath, std::vector<std::shared_ptr<Mesh>>& outMeshes,
+                      std::vector<ModelNode>& outNodes, GltfLoadResult* result, JobSystem* jobSystem) {
+    auto start = Clock::now();
+    MappedFile file;
+    if (!file.open(filepath)) {
+        std::cerr << "[ERROR] Cannot open glTF file: " << filepath << std::endl;
+        return false;
+    }
+    const uint8_t* bytes = file.getData();
+    const size_t size = file.getSize();
+
+    // GLB: 12-byte header, JSON chunk, optional BIN chunk
+    const char* jsonText = reinterpret_cast<const char*>(bytes);
+    size_t jsonSize = size;
+    BufferData binChunk;
+    uint32_t magic = 0;
+    if (size >= 12) {
+        std::memcpy(&magic, bytes, 4);
+    }
+    if (magic == GLB_MAGIC) {
+        uint32_t header[3];
+        std::memcpy(header, bytes, 12);
+        uint32_t chunk[2] = {0, 0};
+        if (header[1] != 2 || header[2] > size || size < 20 ||
+            (std::memcpy(chunk, bytes + 12, 8), chunk[1] != GLB_CHUNK_JSON) || chunk[0] > header[2] - 20) {
+            std::cerr << "[ERROR] Invalid GLB header: " << filepath << std::endl;
+            return false;
+        }
+        jsonText = reinterpret_cast<const char*>(bytes + 20);
+        jsonSize = chunk[0];
+        size_t binOffset = 20 + ((jsonSize + 3) & ~size_t(3));
+        if (binOffset + 8 <= header[2]) {
+            std::memcpy(chunk, bytes + binOffset, 8);
+            if (chunk[1] == GLB_CHUNK_BIN && chunk[0] <= header[2] - binOffset - 8) {
+                binChunk.data = bytes + binOffset + 8;
+                binChunk.size = chunk[0];
+            }
+        }
+    }
+
+    JsonValue gltf;
+    if (!JsonParser(jsonText, jsonSize).parse(gltf) || gltf.type != JsonValue::Type::Object) {
+        std::cerr << "[ERROR] Invalid glTF JSON: " << filepath << std::endl;
+        return false;
+    }
+    if (gltf["asset"]["version"].asString().compare(0, 1, "2") != 0) {
+        std::cerr << "[ERROR] Unsupported glTF version '" << gltf["asset"]["version"].asString()
+                  << "': " << filepath << std::endl;
+        return false;
+    }
+
+    // Buffers: GLB chunk, external files (mapped) or base64 data URIs
+    std::string directory = filepath.substr(0, filepath.find_last_of("/\\") + 1);
+    std::vector<BufferData> buffers(gltf["buffers"].size());
+    std::vector<MappedFile> externalFiles(buffers.size());
+    std::vector<std::string> bufferFiles;
+    std::vector<std::vector<uint8_t>> decodedBuffers(buffers.size());
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        const JsonValue& buffer = gltf["buffers"][i];
+        const std::string& uri = buffer["uri"].asString();
+        if (uri.empty()) {
+            buffers[i] = binChunk;
+        } else if (uri.compare(0, 5, "data:") == 0) {
+            size_t comma = uri.find(',');
+            if (comma == std::string::npos || uri.rfind(";base64", comma) == std::string::npos ||
+                !decodeBase64(std::string_view(uri).substr(comma + 1), decodedBuffers[i])) {
+                std::cerr << "[ERROR] Invalid data URI in buffer " << i << ": " << filepath << std::endl;
+                return false;
+            }
+            buffers[i] = {decodedBuffers[i].data(), decodedBuffers[i].size()};
+        } else {
+            bufferFiles.push_back(directory + uri);
+            if (!externalFiles[i].open(bufferFiles.back())) {
+                std::cerr << "[ERROR] Cannot open glTF buffer '" << uri << "': " << filepath << std::endl;
+                return false;
+            }
+            buffers[i] = {externalFiles[i].getData(), externalFiles[i].getSize()};
+        }
+        // Declared length bounds every view
+        buffers[i].size = std::min(buffers[i].size, static_cast<size_t>(buffer["byteLength"].asInt(0)));
+    }
+
+    // One job per primitive, decoded in parallel
+    const JsonValue& gltfMeshes = gltf["meshes"];
+    std::vector<PrimitiveJob> jobs;
+    std::vector<size_t> meshFirstJob(gltfMeshes.size() + 1, 0);
+    for (size_t m = 0; m < gltfMeshes.size(); ++m) {
+        meshFirstJob[m] = jobs.size();
+        const JsonValue& primitives = gltfMeshes[m]["primitives"];
+        std::string meshName = gltfMeshes[m]["name"].asString();
+        if (meshName.empty()) {
+            meshName = "Mesh" + std::to_string(m);
+        }
+        for (size_t p = 0; p < primitives.size(); ++p) {
+            PrimitiveJob job;
+            job.primitive = &primitives[p];
+            job.name = primitives.size() > 1 ? meshName + "/" + std::to_string(p) : meshName;
+            jobs.push_back(std::move(job));
+        }
+    }
+    meshFirstJob[gltfMeshes.size()] = jobs.size();
+
+    auto decodeRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) decodePrimitive(gltf, buffers, jobs[i]);
+    };
+    if (jobSystem) {
+        jobSystem->parallelFor(jobs.size(), 1, decodeRange);
+    } else {
+        decodeRange(0, jobs.size());
+    }
+
+    // Collect meshes; each glTF mesh maps to a consecutive range
+    GltfLoadResult stats;
+    stats.fileBytes = size;
+    stats.bufferFiles = std::move(bufferFiles);
+    const size_t meshBase = outMeshes.size();
+    std::vector<std::pair<uint32_t, uint32_t>> meshRanges(gltfMeshes.size());
+    for (size_t m = 0; m < gltfMeshes.size(); ++m) {
+        meshRanges[m].first = static_cast<uint32_t>(outMeshes.size() - meshBase);
+        for (size_t i = meshFirstJob[m]; i < meshFirstJob[m + 1]; ++i) {
+            PrimitiveJob& job = jobs[i];
+            if (!job.mesh) {
+                std::cerr << "[WARNING] glTF primitive '" << job.name << "' skipped: " << job.error << std::endl;
+                ++stats.skippedPrimitives;
+                continue;
+            }
+            stats.triangles += job.mesh->getIndexCount() / 3;
+            stats.vertices += job.mesh->getVertexCount();
+            stats.bulkCopiedBytes += job.bulkCopiedBytes;
+            outMeshes.push_back(std::move(job.mesh));
+        }
+        meshRanges[m].second = static_cast<uint32_t>(outMeshes.size() - meshBase) - meshRanges[m].first;
+    }
+    stats.meshes = outMeshes.size() - meshBase;
+
+    // Nodes of the default scene (or every root node), parents first
+    const JsonValue& gltfNodes = gltf["nodes"];
+    std::vector<std::pair<int64_t, int32_t>> stack;  // (glTF node, parent ModelNode)
+    const JsonValue& scene = gltf["scenes"][static_cast<size_t>(std::max<int64_t>(0, gltf["scene"].asInt(0)))];
+    if (!scene.isNull()) {
+        for (size_t i = scene["nodes"].size(); i-- > 0;) {
+            stack.emplace_back(scene["nodes"][i].asInt(), -1);
+        }
+    } else {
+        std::vector<bool> isChild(gltfNodes.size(), false);
+        for (size_t n = 0; n < gltfNodes.size(); ++n) {
+            for (const JsonValue& child : gltfNodes[n]["children"].elements) {
+                int64_t c = child.asInt();
+                if (c >= 0 && static_cast<size_t>(c) < isChild.size()) isChild[c] = true;
+            }
+        }
+        for (size_t n = gltfNodes.size(); n-- > 0;) {
+            if (!isChild[n]) stack.emplace_back(static_cast<int64_t>(n), -1);
+        }
+    }
+
+    std::vector<bool> visited(gltfNodes.size(), false);
+    const size_t nodeBase = outNodes.size();
+    while (!stack.empty()) {
+        auto [index, parent] = stack.back();
+        stack.pop_back();
+        if (index < 0 || static_cast<size_t>(index) >= gltfNodes.size() || visited[index]) {
+            continue;  // glTF nodes form a tree; ignore invalid or repeated references
+        }
+        visited[index] = true;
+
+        const JsonValue& node = gltfNodes[static_cast<size_t>(index)];
+        ModelNode modelNode;
+        modelNode.name = node["name"].asString();
+        modelNode.parent = parent;
+        modelNode.transform = nodeTransform(node);
+        int64_t mesh = node["mesh"].asInt();
+        if (mesh >= 0 && static_cast<size_t>(mesh) < meshRanges.size()) {
+            modelNode.firstMesh = meshRanges[mesh].first;
+            modelNode.meshCount = meshRanges[mesh].second;
+        }
+        int32_t self = static_cast<int32_t>(outNodes.size() - nodeBase);
+        outNodes.push_back(std::move(modelNode));
+
+        const JsonValue& children = node["children"];
+        for (size_t i = children.size(); i-- > 0;) {
+            stack.emplace_back(children[i].asInt(), self);
+        }
+    }
+    stats.nodes = outNodes.size() - nodeBase;
+    stats.loadMs = millisecondsSince(start);
+    if (result) {
+        *result = stats;
+    }
+
+    if (stats.meshes == 0) {
+        std::cerr << "[ERROR] glTF file has no triangle primitives: " << filepath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace resource
+} // namespace rs_engine
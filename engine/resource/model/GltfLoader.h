@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Model.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rs_engine {
+
+class JobSystem;
+
+namespace resource {
+
+/**
+ * @brief GltfLoader statistics
+ */
+struct GltfLoadResult {
+    size_t fileBytes = 0;
+    size_t meshes = 0;              // Output meshes (one per triangle primitive)
+    size_t nodes = 0;
+    size_t triangles = 0;
+    size_t vertices = 0;
+    size_t skippedPrimitives = 0;   // Points / lines, compressed or invalid data
+    size_t bulkCopiedBytes = 0;     // Attribute / index bytes copied without per-element decoding
+    double loadMs = 0.0;
+    std::vector<std::string> bufferFiles;  // External .bin files read (cache dependencies)
+};
+
+/**
+ * @brief glTF 2.0 loader (.gltf with external or embedded buffers, .glb)
+ *
+ * GLB files and external .bin buffers are memory-mapped; accessors are
+ * read in place from the mapping and written once into the Mesh arrays
+ * (no intermediate per-attribute copies). Where the source layout already
+ * matches the engine's (uint32 indices, tightly packed float vec3
+ * positions / normals) whole ranges are copied without per-element
+ * decoding. Primitives are decoded in parallel on the given JobSystem.
+ *
+ * Mapping to engine types:
+ * - Each triangle primitive (modes 4, 5, 6) becomes one Mesh; primitives
+ *   of the same glTF mesh are consecutive.
+ * - Nodes of the default scene become ModelNodes in pre-order, with
+ *   matrices or TRS converted to Transform (rotation as Y * X * Z Euler).
+ * - Read attributes: POSITION, NORMAL, TEXCOORD_0, COLOR_0. Materials,
+ *   skins, morph targets and animations are ignored; sparse accessors and
+ *   Draco / meshopt compressed primitives are skipped with a warning.
+ *
+ * Platform Support: 100% shared (serial on Web)
+ */
+class GltfLoader {
+public:
+    /**
+     * @brief Load a .gltf or .glb file
+     * @param outMeshes Output: meshes (appended)
+     * @param outNodes Output: node hierarchy, mesh ranges relative to outMeshes' new entries
+     * @param jobSystem Workers for primitive decoding (nullptr = calling thread only)
+     * @return false if the file is invalid or has no triangle primitives
+     */
+    static bool load(const std::string& filepath,
+                     std::vector<std::shared_ptr<Mesh>>& outMeshes,
+                     std::vector<ModelNode>& outNodes,
+                     GltfLoadResult* result = nullptr,
+                     JobSystem* jobSystem = nullptr);
+};
+
+} // namespace resource
+} // namespace rs_engine
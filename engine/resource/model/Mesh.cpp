@@ -1,4 +1,5 @@
 #include "Mesh.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -40,95 +41,380 @@ void Mesh::unload() {
     releaseGPUResources();
     vertices.clear();
     indices.clear();
+    invalidateBVH();
     metadata.state = ResourceState::Unloaded;
     metadata.memorySize = 0;
 }
 
 void Mesh::setVertices(const std::vector<Vertex>& verts) {
     vertices = verts;
-    gpuDataCreated = false; // Need to recreate GPU resources
+    invalidateGPUData();
+    invalidateBVH();
 }
 
 void Mesh::setIndices(const std::vector<uint32_t>& inds) {
     indices = inds;
-    gpuDataCreated = false;
+    invalidateGPUData();
+    invalidateBVH();
+}
+
+void Mesh::setVertices(std::vector<Vertex>&& verts) {
+    vertices = std::move(verts);
+    invalidateGPUData();
+    invalidateBVH();
+}
+
+void Mesh::setIndices(std::vector<uint32_t>&& inds) {
+    indices = std::move(inds);
+    invalidateGPUData();
+    invalidateBVH();
 }
 
 void Mesh::addVertex(const Vertex& vertex) {
     vertices.push_back(vertex);
-    gpuDataCreated = false;
+    invalidateGPUData();
 }
 
 void Mesh::addTriangle(uint32_t i0, uint32_t i1, uint32_t i2) {
     indices.push_back(i0);
     indices.push_back(i1);
     indices.push_back(i2);
-    gpuDataCreated = false;
+    invalidateGPUData();
+    invalidateBVH();
 }
 
 void Mesh::clear() {
     vertices.clear();
     indices.clear();
+    invalidateBVH();
     releaseGPUResources();
 }
 
-bool Mesh::createGPUResources(wgpu::Device device) {
-    if (!device || vertices.empty()) {
+// ========== Ray Queries ==========
+
+const MeshBVH* Mesh::getBVH() const {
+    std::lock_guard<std::mutex> lock(bvhMutex);
+    if (!bvh) {
+        auto built = std::make_unique<MeshBVH>();
+        if (!built->build(vertices, indices)) {
+            return nullptr;
+        }
+        std::cout << "[INFO] Built BVH for mesh '" << metadata.name << "': "
+                  << built->getTriangleCount() << " triangles, "
+                  << built->getNodes().size() << " nodes, depth " << built->getDepth()
+                  << std::endl;
+        bvh = std::move(built);
+    }
+    return bvh.get();
+}
+
+bool Mesh::hasBVH() const {
+    std::lock_guard<std::mutex> lock(bvhMutex);
+    return bvh != nullptr;
+}
+
+void Mesh::setBVH(std::unique_ptr<MeshBVH> tree) {
+    std::lock_guard<std::mutex> lock(bvhMutex);
+    bvh = std::move(tree);
+}
+
+void Mesh::invalidateBVH() {
+    std::lock_guard<std::mutex> lock(bvhMutex);
+    bvh.reset();
+}
+
+void Mesh::invalidateGPUData() {
+    // A same-size change must not resume an in-flight upload of the old packed data
+    gpuDataCreated = false;
+    gpuUploadInProgress = false;
+}
+
+// ========== GPU Resources ==========
+
+void Mesh::setVertexLayout(const VertexLayout& layout) {
+    vertexLayout = layout;
+    if (vertexLayout.hasQuantizedPositions() && !vertexLayout.hasQuantizationBox && !vertices.empty()) {
+        VertexPacker::computeQuantizationBox(vertices.data(), vertices.size(),
+                                             vertexLayout.quantizationMin, vertexLayout.quantizationExtent);
+        vertexLayout.hasQuantizationBox = true;
+    }
+    invalidateGPUData();
+}
+
+wgpu::IndexFormat Mesh::chooseIndexFormat() const {
+    return vertices.size() <= MAX_UINT16_VERTICES ? wgpu::IndexFormat::Uint16 : wgpu::IndexFormat::Uint32;
+}
+
+size_t Mesh::getIndexBufferSize() const {
+    // Padded to 4 bytes: WriteBuffer sizes must be multiples of 4
+    const size_t indexSize = chooseIndexFormat() == wgpu::IndexFormat::Uint16 ? sizeof(uint16_t) : sizeof(uint32_t);
+    return (indices.size() * indexSize + 3) & ~static_cast<size_t>(3);
+}
+
+void Mesh::packGPUData(std::vector<uint8_t>& out) {
+    if (vertexLayout.hasQuantizedPositions() && !vertexLayout.hasQuantizationBox) {
+        setVertexLayout(vertexLayout);
+    }
+    const size_t positionBytes = vertices.size() * vertexLayout.getPositionStride();
+    const size_t vertexBytes = vertices.size() * vertexLayout.getVertexSize();
+    const bool narrowIndices = chooseIndexFormat() == wgpu::IndexFormat::Uint16;
+    out.assign(vertexBytes + (narrowIndices ? getIndexBufferSize() : 0), 0);
+    VertexPacker::packPositions(vertices.data(), vertices.size(), vertexLayout, out.data());
+    VertexPacker::packAttributes(vertices.data(), vertices.size(), vertexLayout, out.data() + positionBytes);
+    
+    // 32-bit indices are uploaded straight from the CPU array
+    if (narrowIndices) {
+        uint16_t* target = reinterpret_cast<uint16_t*>(out.data() + vertexBytes);
+        for (size_t i = 0; i < indices.size(); ++i) {
+            target[i] = static_cast<uint16_t>(indices[i]);
+        }
+    }
+}
+
+const uint8_t* Mesh::getIndexUploadData(const std::vector<uint8_t>& packed) const {
+    if (gpuIndexFormat == wgpu::IndexFormat::Uint16) {
+        return packed.data() + vertices.size() * vertexLayout.getVertexSize();
+    }
+    return reinterpret_cast<const uint8_t*>(indices.data());
+}
+
+size_t Mesh::getGPUMemorySize() const {
+    return vertices.size() * vertexLayout.getVertexSize() + getIndexBufferSize();
+}
+
+size_t Mesh::getUnpackedGPUMemorySize() const {
+    return vertices.size() * sizeof(Vertex) + indices.size() * sizeof(uint32_t);
+}
+
+bool Mesh::allocateGPURanges(MeshBufferPool& pool) {
+    // Both vertex streams share one range (same vertex index in each)
+    vertexAllocation = pool.allocateVertices(vertexLayout, static_cast<uint32_t>(vertices.size()));
+    if (vertexAllocation == MeshBufferPool::INVALID_ALLOCATION) {
+        std::cerr << "Failed to allocate vertex data for mesh: " << metadata.name << std::endl;
+        return false;
+    }
+    
+    // Index range (if indices exist), 16-bit whenever the vertex count allows
+    gpuIndexFormat = chooseIndexFormat();
+    if (!indices.empty()) {
+        indexAllocation = pool.allocateIndices(getIndexBufferSize());
+        if (indexAllocation == MeshBufferPool::INVALID_ALLOCATION) {
+            std::cerr << "Failed to allocate index data for mesh: " << metadata.name << std::endl;
+            pool.free(vertexAllocation);
+            vertexAllocation = MeshBufferPool::INVALID_ALLOCATION;
+            return false;
+        }
+    }
+    
+    bufferPool = &pool;
+    return true;
+}
+
+wgpu::Buffer Mesh::getPositionBuffer() const {
+    return bufferPool ? bufferPool->getBuffer(vertexAllocation, 0) : nullptr;
+}
+
+wgpu::Buffer Mesh::getAttributeBuffer() const {
+    return bufferPool ? bufferPool->getBuffer(vertexAllocation, 1) : nullptr;
+}
+
+wgpu::Buffer Mesh::getIndexBuffer() const {
+    return bufferPool ? bufferPool->getBuffer(indexAllocation) : nullptr;
+}
+
+uint32_t Mesh::getBaseVertex() const {
+    return bufferPool ? bufferPool->getOffset(vertexAllocation) : 0;
+}
+
+uint32_t Mesh::getFirstIndex() const {
+    if (!bufferPool) {
+        return 0;
+    }
+    // Index arenas count 4-byte words: two 16-bit indices or one 32-bit index each
+    const uint32_t word = bufferPool->getOffset(indexAllocation);
+    return gpuIndexFormat == wgpu::IndexFormat::Uint16 ? word * 2 : word;
+}
+
+bool Mesh::createGPUResources(MeshBufferPool& pool) {
+    if (!pool.isInitialized() || vertices.empty()) {
         return false;
     }
     
     // Release old resources
     releaseGPUResources();
     
-    // Create vertex buffer
-    wgpu::BufferDescriptor vertexBufferDesc;
-    vertexBufferDesc.size = vertices.size() * sizeof(Vertex);
-    vertexBufferDesc.usage = wgpu::BufferUsage::Vertex | wgpu::BufferUsage::CopyDst;
-    vertexBufferDesc.mappedAtCreation = false;
-    
-    vertexBuffer = device.CreateBuffer(&vertexBufferDesc);
-    if (!vertexBuffer) {
-        std::cerr << "Failed to create vertex buffer for mesh: " << metadata.name << std::endl;
+    if (!allocateGPURanges(pool)) {
         return false;
     }
     
-    device.GetQueue().WriteBuffer(vertexBuffer, 0, vertices.data(), vertexBufferDesc.size);
+    std::vector<uint8_t> packed;
+    packGPUData(packed);
+    const size_t positionBytes = vertices.size() * vertexLayout.getPositionStride();
+    const size_t vertexBytes = vertices.size() * vertexLayout.getVertexSize();
     
-    // Create index buffer (if indices exist)
+    wgpu::Queue queue = pool.getDevice().GetQueue();
+    queue.WriteBuffer(pool.getBuffer(vertexAllocation, 0), pool.getByteOffset(vertexAllocation, 0),
+                      packed.data(), positionBytes);
+    if (vertexBytes > positionBytes) {
+        queue.WriteBuffer(pool.getBuffer(vertexAllocation, 1), pool.getByteOffset(vertexAllocation, 1),
+                          packed.data() + positionBytes, vertexBytes - positionBytes);
+    }
     if (!indices.empty()) {
-        wgpu::BufferDescriptor indexBufferDesc;
-        indexBufferDesc.size = indices.size() * sizeof(uint32_t);
-        indexBufferDesc.usage = wgpu::BufferUsage::Index | wgpu::BufferUsage::CopyDst;
-        indexBufferDesc.mappedAtCreation = false;
-        
-        indexBuffer = device.CreateBuffer(&indexBufferDesc);
-        if (!indexBuffer) {
-            std::cerr << "Failed to create index buffer for mesh: " << metadata.name << std::endl;
-            vertexBuffer = nullptr;
+        queue.WriteBuffer(pool.getBuffer(indexAllocation), pool.getByteOffset(indexAllocation),
+                          getIndexUploadData(packed), getIndexBufferSize());
+    }
+    
+    gpuDataCreated = true;
+    return true;
+}
+
+bool Mesh::uploadGPUResources(MeshBufferPool& pool, size_t maxBytes, size_t& bytesWritten) {
+    bytesWritten = 0;
+    if (gpuDataCreated) {
+        return true;
+    }
+    if (!pool.isInitialized() || vertices.empty()) {
+        return false;
+    }
+    
+    const uint64_t positionBytes = vertices.size() * vertexLayout.getPositionStride();
+    const uint64_t vertexBytes = vertices.size() * vertexLayout.getVertexSize();
+    const uint64_t indexBytes = indices.empty() ? 0 : getIndexBufferSize();
+    
+    // (Re)start if nothing is in flight (the geometry setters cancel it) or the pool / sizes changed
+    if (!gpuUploadInProgress || bufferPool != &pool || gpuUploadVertexBytes != vertexBytes ||
+        gpuUploadPositionBytes != positionBytes || gpuUploadIndexBytes != indexBytes) {
+        releaseGPUResources();
+        if (!allocateGPURanges(pool)) {
             return false;
         }
-        
-        device.GetQueue().WriteBuffer(indexBuffer, 0, indices.data(), indexBufferDesc.size);
+        packGPUData(packedGPUData);
+        gpuUploadInProgress = true;
+        gpuUploadOffset = 0;
+        gpuUploadPositionBytes = positionBytes;
+        gpuUploadVertexBytes = vertexBytes;
+        gpuUploadIndexBytes = indexBytes;
     }
     
-    gpuDataCreated = true;
+    // WriteBuffer needs 4-byte aligned offsets and sizes; every stride and
+    // the padded index size are multiples of 4, so slices stay aligned.
+    // Always move by at least 4 bytes.
+    uint64_t budget = std::max<uint64_t>(maxBytes & ~static_cast<size_t>(3), 4);
+    wgpu::Queue queue = pool.getDevice().GetQueue();
+    const uint8_t* indexData = getIndexUploadData(packedGPUData);
+    
+    // Ranges are looked up now: a compaction between calls may have moved them
+    const wgpu::Buffer positionBuffer = pool.getBuffer(vertexAllocation, 0);
+    const wgpu::Buffer attributeBuffer = pool.getBuffer(vertexAllocation, 1);
+    const wgpu::Buffer indexBuffer = pool.getBuffer(indexAllocation);
+    const uint64_t positionBase = pool.getByteOffset(vertexAllocation, 0);
+    const uint64_t attributeBase = pool.getByteOffset(vertexAllocation, 1);
+    const uint64_t indexBase = pool.getByteOffset(indexAllocation);
+    
+    // Position bytes, attribute bytes, then index bytes, as one continuous range
+    while (budget > 0 && gpuUploadOffset < vertexBytes + indexBytes) {
+        uint64_t size;
+        if (gpuUploadOffset < positionBytes) {
+            size = std::min(budget, positionBytes - gpuUploadOffset);
+            queue.WriteBuffer(positionBuffer, positionBase + gpuUploadOffset,
+                              packedGPUData.data() + gpuUploadOffset, size);
+        } else if (gpuUploadOffset < vertexBytes) {
+            size = std::min(budget, vertexBytes - gpuUploadOffset);
+            queue.WriteBuffer(attributeBuffer, attributeBase + gpuUploadOffset - positionBytes,
+                              packedGPUData.data() + gpuUploadOffset, size);
+        } else {
+            uint64_t offset = gpuUploadOffset - vertexBytes;
+            size = std::min(budget, indexBytes - offset);
+            queue.WriteBuffer(indexBuffer, indexBase + offset, indexData + offset, size);
+        }
+        gpuUploadOffset += size;
+        bytesWritten += static_cast<size_t>(size);
+        budget -= size;
+    }
+    
+    if (gpuUploadOffset >= vertexBytes + indexBytes) {
+        gpuUploadInProgress = false;
+        gpuDataCreated = true;
+        std::vector<uint8_t>().swap(packedGPUData);
+    }
     return true;
 }
 
 void Mesh::releaseGPUResources() {
-    if (vertexBuffer) {
-        vertexBuffer.Destroy();
-        vertexBuffer = nullptr;
-    }
-    if (indexBuffer) {
-        indexBuffer.Destroy();
-        indexBuffer = nullptr;
+    // Meshes that never had GPU data (e.g. built on loader threads) leave the pool alone
+    if (bufferPool) {
+        bufferPool->free(vertexAllocation);
+        bufferPool->free(indexAllocation);
+        bufferPool = nullptr;
     }
+    vertexAllocation = MeshBufferPool::INVALID_ALLOCATION;
+    indexAllocation = MeshBufferPool::INVALID_ALLOCATION;
     gpuDataCreated = false;
+    gpuUploadInProgress = false;
+    gpuUploadOffset = 0;
+    std::vector<uint8_t>().swap(packedGPUData);
 }
 
 // ========== Mesh Generation ==========
 
+std::vector<std::shared_ptr<Mesh>> Mesh::splitByVertexCount(const std::shared_ptr<Mesh>& mesh, size_t maxVertices) {
+    maxVertices = std::max<size_t>(maxVertices, 3);
+    if (!mesh || mesh->vertices.size() <= maxVertices || mesh->indices.size() < 3) {
+        return { mesh };
+    }
+    
+    const std::vector<Vertex>& sourceVertices = mesh->vertices;
+    const std::vector<uint32_t>& sourceIndices = mesh->indices;
+    
+    // Source vertex -> cluster vertex, valid while stamp matches the cluster
+    std::vector<uint32_t> remap(sourceVertices.size());
+    std::vector<uint32_t> stamp(sourceVertices.size(), 0);
+    uint32_t cluster = 1;
+    
+    std::vector<std::shared_ptr<Mesh>> clusters;
+    std::vector<Vertex> clusterVertices;
+    std::vector<uint32_t> clusterIndices;
+    
+    auto flush = [&]() {
+        auto part = std::make_shared<Mesh>(mesh->getName() + "_part" + std::to_string(clusters.size()));
+        part->setVertices(std::move(clusterVertices));
+        part->setIndices(std::move(clusterIndices));
+        part->setVertexLayout(mesh->vertexLayout);
+        part->load();
+        clusters.push_back(std::move(part));
+        clusterVertices.clear();
+        clusterIndices.clear();
+        cluster++;
+    };
+    
+    for (size_t i = 0; i + 2 < sourceIndices.size(); i += 3) {
+        // Vertices this triangle would add to the current cluster
+        size_t added = 0;
+        for (size_t k = 0; k < 3; ++k) {
+            uint32_t index = sourceIndices[i + k];
+            bool duplicate = (k > 0 && sourceIndices[i] == index) || (k > 1 && sourceIndices[i + 1] == index);
+            added += (stamp[index] != cluster && !duplicate) ? 1 : 0;
+        }
+        if (clusterVertices.size() + added > maxVertices) {
+            flush();
+        }
+        
+        for (size_t k = 0; k < 3; ++k) {
+            uint32_t index = sourceIndices[i + k];
+            if (stamp[index] != cluster) {
+                stamp[index] = cluster;
+                remap[index] = static_cast<uint32_t>(clusterVertices.size());
+                clusterVertices.push_back(sourceVertices[index]);
+            }
+            clusterIndices.push_back(remap[index]);
+        }
+    }
+    if (!clusterIndices.empty()) {
+        flush();
+    }
+    return clusters;
+}
+
 Mesh* Mesh::createCube(const std::string& name, float size) {
     Mesh* mesh = new Mesh(name);
     
@@ -388,7 +674,7 @@ void Mesh::calculateNormals() {
         vertex.normal = vertex.normal.normalize();
     }
     
-    gpuDataCreated = false; // Need to update GPU buffers
+    invalidateGPUData();
 }
 
 } // namespace resource
@@ -2,6 +2,11 @@
 
 #include "../ResourceTypes.h"
 #include "../../core/math/Vec3.h"
+#include "MeshBVH.h"
+#include "MeshBufferPool.h"
+#include "VertexFormat.h"
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <webgpu/webgpu_cpp.h>
 
@@ -9,7 +14,10 @@ namespace rs_engine {
 namespace resource {
 
 /**
- * @brief Vertex data structure for mesh rendering
+ * @brief Vertex data structure for mesh authoring (CPU side)
+ * 
+ * Loaders, the simplifier, the BVH and the mesh cache work on this form;
+ * the GPU copy is packed into the mesh's VertexLayout on upload.
  */
 struct Vertex {
     Vec3 position;
@@ -29,6 +37,15 @@ struct Vertex {
  * Platform Support: 100% shared
  * - Vertex data: identical on all platforms
  * - GPU buffers: created via WebGPU (both Web and Native)
+ * 
+ * GPU vertex data is split into a position stream and an attribute stream
+ * (normal, texCoord, color), each encoded as the VertexLayout says. The
+ * default layout takes 24 bytes per vertex instead of the 48 of Vertex.
+ * 
+ * GPU data lives in ranges of a MeshBufferPool's arenas (the one the
+ * ResourceManager owns) rather than in buffers of its own: bind the arena
+ * buffers at offset 0 and draw with getFirstIndex() / getBaseVertex().
+ * The mesh keeps a pointer to that pool until releaseGPUResources().
  */
 class Mesh : public IResource {
 private:
@@ -37,11 +54,38 @@ private:
     std::vector<uint32_t> indices;
     
     // GPU-side data
-    wgpu::Buffer vertexBuffer;
-    wgpu::Buffer indexBuffer;
+    VertexLayout vertexLayout;
+    MeshBufferPool* bufferPool = nullptr;    // Pool the allocations below came from
+    MeshBufferPool::AllocationId vertexAllocation = MeshBufferPool::INVALID_ALLOCATION;  // Both vertex streams
+    MeshBufferPool::AllocationId indexAllocation = MeshBufferPool::INVALID_ALLOCATION;
+    wgpu::IndexFormat gpuIndexFormat = wgpu::IndexFormat::Uint32;
     bool gpuDataCreated = false;
+    
+    // Incremental upload state (see uploadGPUResources)
+    bool gpuUploadInProgress = false;
+    uint64_t gpuUploadOffset = 0;         // Into packed vertex bytes, then index bytes
+    uint64_t gpuUploadPositionBytes = 0;
+    uint64_t gpuUploadVertexBytes = 0;
+    uint64_t gpuUploadIndexBytes = 0;
+    std::vector<uint8_t> packedGPUData;   // Position stream, attribute stream, 16-bit indices (during uploads)
+    
+    // Picking acceleration (built lazily, dropped whenever geometry changes)
+    mutable std::unique_ptr<MeshBVH> bvh;
+    mutable std::mutex bvhMutex;
+    
+    void invalidateBVH();
+    void invalidateGPUData();   // Geometry or layout changed: re-upload from scratch
+    bool allocateGPURanges(MeshBufferPool& pool);
+    wgpu::IndexFormat chooseIndexFormat() const;
+    void packGPUData(std::vector<uint8_t>& out);
+    const uint8_t* getIndexUploadData(const std::vector<uint8_t>& packed) const;
 
 public:
+    /**
+     * @brief Most vertices a mesh can have and still use 16-bit indices
+     */
+    static constexpr size_t MAX_UINT16_VERTICES = 65536;
+    
     Mesh();
     Mesh(const std::string& name);
     virtual ~Mesh();
@@ -62,6 +106,8 @@ public:
     
     void setVertices(const std::vector<Vertex>& verts);
     void setIndices(const std::vector<uint32_t>& inds);
+    void setVertices(std::vector<Vertex>&& verts);   // Takes the storage (loaders)
+    void setIndices(std::vector<uint32_t>&& inds);
     
     void addVertex(const Vertex& vertex);
     void addTriangle(uint32_t i0, uint32_t i1, uint32_t i2);
@@ -71,23 +117,121 @@ public:
     // ========== GPU Resources ==========
     
     /**
-     * @brief Create GPU buffers from CPU data
-     * @param device WebGPU device
+     * @brief Set the GPU vertex encoding (takes effect on the next upload)
+     * 
+     * A quantized layout without a box gets the box of the current vertices.
+     * Positions outside the box are clamped, so set the layout again after
+     * moving vertices beyond it.
+     */
+    void setVertexLayout(const VertexLayout& layout);
+    const VertexLayout& getVertexLayout() const { return vertexLayout; }
+    
+    /**
+     * @brief Suballocate GPU ranges from the pool and upload CPU data
+     * @param pool Pool bound to the device the mesh is drawn with
      * @return true if successful
      */
-    bool createGPUResources(wgpu::Device device);
+    bool createGPUResources(MeshBufferPool& pool);
+    
+    /**
+     * @brief Upload CPU data in slices, spreading a large mesh over frames
+     * 
+     * The first call packs the vertex streams and allocates the ranges; each
+     * call then writes at most maxBytes (rounded down to 4, at least 4) of
+     * position data, attribute data and index data, in that order. hasGPUResources() turns true once everything is written.
+     * Do not draw the mesh before that.
+     * @param bytesWritten Output: bytes written by this call
+     * @return false if the ranges cannot be allocated
+     */
+    bool uploadGPUResources(MeshBufferPool& pool, size_t maxBytes, size_t& bytesWritten);
+    bool isGPUUploadInProgress() const { return gpuUploadInProgress; }
     
     /**
-     * @brief Release GPU buffers
+     * @brief Return the GPU ranges to the pool
      */
     void releaseGPUResources();
     
-    wgpu::Buffer getVertexBuffer() const { return vertexBuffer; }
-    wgpu::Buffer getIndexBuffer() const { return indexBuffer; }
+    /**
+     * @brief Position stream arena (vertex buffer slot 0), all a position-only pass binds
+     * 
+     * Arena buffers are shared with other meshes and replaced when the pool
+     * compacts, so query them per draw rather than keeping them.
+     */
+    wgpu::Buffer getPositionBuffer() const;
+    
+    /**
+     * @brief Normal / texCoord / color stream arena (vertex buffer slot 1)
+     */
+    wgpu::Buffer getAttributeBuffer() const;
+    wgpu::Buffer getIndexBuffer() const;
+    
+    /**
+     * @brief First vertex of this mesh in the vertex arena (DrawIndexed baseVertex)
+     */
+    uint32_t getBaseVertex() const;
+    
+    /**
+     * @brief First index of this mesh in the index arena, in getIndexFormat() units (DrawIndexed firstIndex)
+     */
+    uint32_t getFirstIndex() const;
+    
+    /**
+     * @brief Format of the uploaded index buffer (Uint16 up to MAX_UINT16_VERTICES vertices)
+     */
+    wgpu::IndexFormat getIndexFormat() const { return gpuIndexFormat; }
+    
+    /**
+     * @brief Bytes of index data for the current data (4-byte padded)
+     */
+    size_t getIndexBufferSize() const;
     bool hasGPUResources() const { return gpuDataCreated; }
     
+    /**
+     * @brief Bytes of GPU data for the current data and layout
+     */
+    size_t getGPUMemorySize() const;
+    
+    /**
+     * @brief Same, with vertices stored as the 48-byte Vertex (for comparison)
+     */
+    size_t getUnpackedGPUMemorySize() const;
+    
+    // ========== Ray Queries ==========
+    
+    /**
+     * @brief Get the triangle BVH, building it on first use
+     * 
+     * Thread-safe. Returns nullptr if the mesh has no triangles.
+     * The pointer stays valid until the geometry is modified.
+     */
+    const MeshBVH* getBVH() const;
+    
+    /**
+     * @brief Build the BVH ahead of time (e.g. right after loading)
+     */
+    void buildBVH() const { getBVH(); }
+    
+    bool hasBVH() const;
+    
+    /**
+     * @brief Adopt a prebuilt BVH for the current geometry (e.g. from a mesh cache)
+     */
+    void setBVH(std::unique_ptr<MeshBVH> tree);
+    
     // ========== Mesh Generation ==========
     
+    /**
+     * @brief Split a mesh into clusters of at most maxVertices vertices
+     * 
+     * Triangles are taken in index order and a new cluster starts when the
+     * next triangle would exceed the limit, so clusters stay as coherent as
+     * the source ordering. Each cluster is a new mesh named "<name>_partN"
+     * that can use 16-bit indices. A mesh already within the limit is
+     * returned as is (the only element).
+     */
+    static std::vector<std::shared_ptr<Mesh>> splitByVertexCount(const std::shared_ptr<Mesh>& mesh,
+                                                                 size_t maxVertices = MAX_UINT16_VERTICES);
+    
     /**
      * @brief Generate a cube mesh
      * @param size Cube size (default 1.0)
@@ -0,0 +1,588 @@
+#include "MeshBVH.h"
+#include "Mesh.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+constexpr int SAH_BIN_COUNT = 12;
+constexpr float NO_HIT = std::numeric_limits<float>::infinity();
+
+/**
+ * @brief Per-triangle data used only while building
+ */
+struct BuildTriangle {
+    AABB bounds;
+    Vec3 centroid;
+};
+
+struct Bin {
+    AABB bounds = AABB::empty();
+    uint32_t count = 0;
+};
+
+class Builder {
+public:
+    Builder(std::vector<MeshBVH::Node>& nodes, std::vector<BuildTriangle>& prims,
+            std::vector<uint32_t>& order)
+        : nodes(nodes), prims(prims), order(order) {}
+
+    uint32_t maxDepth = 0;
+
+    void subdivide(uint32_t nodeIndex, uint32_t first, uint32_t count, uint32_t depth) {
+        maxDepth = std::max(maxDepth, depth);
+
+        AABB bounds = AABB::empty();
+        AABB centroidBounds = AABB::empty();
+        for (uint32_t i = first; i < first + count; ++i) {
+            const BuildTriangle& prim = prims[order[i]];
+            bounds.expand(prim.bounds);
+            centroidBounds.expand(prim.centroid);
+        }
+
+        nodes[nodeIndex].bounds = bounds;
+        nodes[nodeIndex].leftFirst = first;
+        nodes[nodeIndex].triangleCount = count;
+
+        // A full leaf is a single SIMD test, so never split below one block
+        if (count <= MeshBVH::MAX_LEAF_TRIANGLES || depth + 1 >= MeshBVH::MAX_DEPTH) {
+            return;
+        }
+
+        // Find the best binned SAH split over all three axes
+        int bestAxis = -1;
+        int bestSplit = 0;
+        float bestCost = NO_HIT;
+        Vec3 extent = centroidBounds.size();
+
+        for (int axis = 0; axis < 3; ++axis) {
+            if (extent[axis] <= 0.0f) continue;
+
+            Bin bins[SAH_BIN_COUNT];
+            float scale = SAH_BIN_COUNT / extent[axis];
+            for (uint32_t i = first; i < first + count; ++i) {
+                const BuildTriangle& prim = prims[order[i]];
+                int b = binIndex(prim.centroid[axis], centroidBounds.min[axis], scale);
+                bins[b].count++;
+                bins[b].bounds.expand(prim.bounds);
+            }
+
+            // Sweep from both sides to get area * count for every split plane
+            float leftCost[SAH_BIN_COUNT - 1];
+            AABB leftBox = AABB::empty();
+            uint32_t leftCount = 0;
+            for (int i = 0; i < SAH_BIN_COUNT - 1; ++i) {
+                leftCount += bins[i].count;
+                if (bins[i].count > 0) leftBox.expand(bins[i].bounds);
+                leftCost[i] = leftCount > 0 ? leftBox.surfaceArea() * leftCount : 0.0f;
+            }
+
+            AABB rightBox = AABB::empty();
+            uint32_t rightCount = 0;
+            for (int i = SAH_BIN_COUNT - 1; i > 0; --i) {
+                rightCount += bins[i].count;
+                if (bins[i].count > 0) rightBox.expand(bins[i].bounds);
+                float cost = leftCost[i - 1] +
+                             (rightCount > 0 ? rightBox.surfaceArea() * rightCount : 0.0f);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = i;
+                }
+            }
+        }
+
+        uint32_t leftCount = 0;
+        if (bestAxis >= 0) {
+            float scale = SAH_BIN_COUNT / extent[bestAxis];
+            float axisMin = centroidBounds.min[bestAxis];
+            auto middle = std::partition(order.begin() + first, order.begin() + first + count,
+                [&](uint32_t prim) {
+                    return binIndex(prims[prim].centroid[bestAxis], axisMin, scale) < bestSplit;
+                });
+            leftCount = static_cast<uint32_t>(middle - (order.begin() + first));
+        } else {
+            // All centroids coincide - split by order to keep leaves small
+            leftCount = count / 2;
+        }
+
+        if (leftCount == 0 || leftCount == count) {
+            return;
+        }
+
+        // Children are allocated as an adjacent pair
+        uint32_t leftChild = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+        nodes.emplace_back();
+
+        nodes[nodeIndex].leftFirst = leftChild;
+        nodes[nodeIndex].triangleCount = 0;
+
+        subdivide(leftChild, first, leftCount, depth + 1);
+        subdivide(leftChild + 1, first + leftCount, count - leftCount, depth + 1);
+    }
+
+private:
+    std::vector<MeshBVH::Node>& nodes;
+    std::vector<BuildTriangle>& prims;
+    std::vector<uint32_t>& order;
+
+    static int binIndex(float value, float axisMin, float scale) {
+        int b = static_cast<int>((value - axisMin) * scale);
+        return std::min(std::max(b, 0), SAH_BIN_COUNT - 1);
+    }
+};
+
+/**
+ * @brief Slab test with precomputed inverse direction
+ * @return Entry distance, or NO_HIT
+ */
+inline float intersectBounds(const AABB& box, const Vec3& origin, const Vec3& invDir,
+                             float maxDistance) {
+    float tx1 = (box.min.x - origin.x) * invDir.x;
+    float tx2 = (box.max.x - origin.x) * invDir.x;
+    float tMin = std::min(tx1, tx2);
+    float tMax = std::max(tx1, tx2);
+
+    float ty1 = (box.min.y - origin.y) * invDir.y;
+    float ty2 = (box.max.y - origin.y) * invDir.y;
+    tMin = std::max(tMin, std::min(ty1, ty2));
+    tMax = std::min(tMax, std::max(ty1, ty2));
+
+    float tz1 = (box.min.z - origin.z) * invDir.z;
+    float tz2 = (box.max.z - origin.z) * invDir.z;
+    tMin = std::max(tMin, std::min(tz1, tz2));
+    tMax = std::min(tMax, std::max(tz1, tz2));
+
+    if (tMax >= tMin && tMax >= 0.0f && tMin < maxDistance) {
+        return tMin;
+    }
+    return NO_HIT;
+}
+
+} // namespace
+
+// ========== Build ==========
+
+bool MeshBVH::build(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
+    nodes.clear();
+    triangleBlocks.clear();
+    triangleIndices.clear();
+    triangleCount = 0;
+    depth = 0;
+
+    const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+    const uint32_t inputTriangles = static_cast<uint32_t>(indices.size() / 3);
+
+    std::vector<BuildTriangle> prims(inputTriangles);
+    std::vector<uint32_t> order;
+    order.reserve(inputTriangles);
+
+    for (uint32_t tri = 0; tri < inputTriangles; ++tri) {
+        uint32_t i0 = indices[tri * 3 + 0];
+        uint32_t i1 = indices[tri * 3 + 1];
+        uint32_t i2 = indices[tri * 3 + 2];
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+            continue;
+        }
+
+        BuildTriangle& prim = prims[tri];
+        prim.bounds = AABB::empty();
+        prim.bounds.expand(vertices[i0].position);
+        prim.bounds.expand(vertices[i1].position);
+        prim.bounds.expand(vertices[i2].position);
+        prim.centroid = (vertices[i0].position + vertices[i1].position + vertices[i2].position) *
+                        (1.0f / 3.0f);
+        order.push_back(tri);
+    }
+
+    if (order.empty()) {
+        return false;
+    }
+
+    nodes.reserve(order.size() * 2);
+    nodes.emplace_back();
+
+    Builder builder(nodes, prims, order);
+    builder.subdivide(0, 0, static_cast<uint32_t>(order.size()), 0);
+    depth = builder.maxDepth + 1;
+    nodes.shrink_to_fit();
+
+    // Pack leaf triangles into SoA blocks of 4; leaves are re-pointed at their blocks
+    triangleCount = order.size();
+    triangleBlocks.reserve((order.size() + 3) / 4 + nodes.size() / 2);
+    triangleIndices.reserve(triangleBlocks.capacity() * 4);
+    for (Node& node : nodes) {
+        if (!node.isLeaf()) continue;
+
+        uint32_t firstBlock = static_cast<uint32_t>(triangleBlocks.size());
+        for (uint32_t i = 0; i < node.triangleCount; i += 4) {
+            Vec3 positions[12];
+            int lanes = static_cast<int>(std::min<uint32_t>(4, node.triangleCount - i));
+            for (int lane = 0; lane < 4; ++lane) {
+                if (lane < lanes) {
+                    uint32_t tri = order[node.leftFirst + i + lane];
+                    positions[lane * 3 + 0] = vertices[indices[tri * 3 + 0]].position;
+                    positions[lane * 3 + 1] = vertices[indices[tri * 3 + 1]].position;
+                    positions[lane * 3 + 2] = vertices[indices[tri * 3 + 2]].position;
+                    triangleIndices.push_back(tri);
+                } else {
+                    triangleIndices.push_back(INVALID_TRIANGLE);
+                }
+            }
+            triangleBlocks.push_back(Triangle4::fromTriangles(positions, lanes));
+        }
+        node.leftFirst = firstBlock;
+    }
+
+    return true;
+}
+
+size_t MeshBVH::getMemorySize() const {
+    return nodes.capacity() * sizeof(Node) +
+           triangleBlocks.capacity() * sizeof(Triangle4) +
+           triangleIndices.capacity() * sizeof(uint32_t);
+}
+
+bool MeshBVH::restore(const Node* nodeData, size_t nodeCount, const Triangle4* blocks, size_t blockCount,
+                      const uint32_t* indexData, size_t triangles, uint32_t treeDepth) {
+    nodes.clear();
+    triangleBlocks.clear();
+    triangleIndices.clear();
+    triangleCount = 0;
+    depth = 0;
+    
+    // Every child / block reference must stay in range (traversal does not check).
+    // Leaves may span several blocks: build() stops splitting at MAX_DEPTH or
+    // when no split separates the triangles, whatever the leaf size.
+    for (size_t i = 0; i < nodeCount; ++i) {
+        const Node& node = nodeData[i];
+        bool valid = node.isLeaf()
+            ? static_cast<size_t>(node.leftFirst) + (static_cast<size_t>(node.triangleCount) + 3) / 4 <= blockCount
+            : node.leftFirst > i && static_cast<size_t>(node.leftFirst) + 1 < nodeCount;
+        if (!valid) {
+            return false;
+        }
+        
+        // Used lanes must name a triangle of the mesh (hits index its index buffer)
+        if (node.isLeaf()) {
+            for (uint32_t lane = 0; lane < node.triangleCount; ++lane) {
+                if (indexData[static_cast<size_t>(node.leftFirst) * 4 + lane] >= triangles) {
+                    return false;
+                }
+            }
+        }
+    }
+    if (nodeCount == 0) {
+        return false;
+    }
+    
+    // Traversal stacks are sized by MAX_DEPTH: measure the real depth rather
+    // than trusting the stored one (children always follow their parent)
+    std::vector<uint32_t> levels(nodeCount, 0);
+    levels[0] = 1;
+    uint32_t measuredDepth = 0;
+    for (size_t i = 0; i < nodeCount; ++i) {
+        if (levels[i] == 0) {
+            continue;   // Unreachable
+        }
+        measuredDepth = std::max(measuredDepth, levels[i]);
+        if (!nodeData[i].isLeaf()) {
+            levels[nodeData[i].leftFirst] = levels[i] + 1;
+            levels[nodeData[i].leftFirst + 1] = levels[i] + 1;
+        }
+    }
+    if (measuredDepth > MAX_DEPTH || measuredDepth != treeDepth) {
+        return false;
+    }
+    
+    nodes.assign(nodeData, nodeData + nodeCount);
+    triangleBlocks.assign(blocks, blocks + blockCount);
+    triangleIndices.assign(indexData, indexData + blockCount * 4);
+    triangleCount = triangles;
+    depth = treeDepth;
+    return true;
+}
+
+// ========== Queries ==========
+
+bool MeshBVH::intersect(const Ray& ray, float maxDistance, Hit& hit) const {
+    return traverse<false>(ray, maxDistance, hit);
+}
+
+bool MeshBVH::intersectsAny(const Ray& ray, float maxDistance) const {
+    Hit hit;
+    return traverse<true>(ray, maxDistance, hit);
+}
+
+template<bool AnyHit>
+bool MeshBVH::traverse(const Ray& ray, float maxDistance, Hit& hit) const {
+    if (nodes.empty()) {
+        return false;
+    }
+
+    const Vec3 origin = ray.origin;
+    const Vec3 invDir(detail::safeInverse(ray.direction.x),
+                      detail::safeInverse(ray.direction.y),
+                      detail::safeInverse(ray.direction.z));
+    const RaySIMD raySIMD(ray);
+
+    float closest = maxDistance;
+    bool found = false;
+
+    if (intersectBounds(nodes[0].bounds, origin, invDir, closest) == NO_HIT) {
+        return false;
+    }
+
+    // Only the farther child is pushed at each level, so depth bounds the stack
+    uint32_t stack[MAX_DEPTH];
+    float stackDistance[MAX_DEPTH];
+    uint32_t stackSize = 0;
+    uint32_t index = 0;
+
+    while (true) {
+        const Node& node = nodes[index];
+
+        if (node.isLeaf()) {
+            // One SIMD test per block of 4 triangles
+            uint32_t blockEnd = node.leftFirst + (node.triangleCount + 3) / 4;
+            for (uint32_t block = node.leftFirst; block < blockEnd; ++block) {
+                simd::Float4 t, u, v;
+                int mask = intersectTriangle4(raySIMD, triangleBlocks[block], closest, t, u, v);
+                if (mask == 0) continue;
+
+                float tLanes[4], uLanes[4], vLanes[4];
+                t.store(tLanes);
+                u.store(uLanes);
+                v.store(vLanes);
+                for (int lane = 0; lane < 4; ++lane) {
+                    if ((mask & (1 << lane)) && tLanes[lane] < closest) {
+                        closest = tLanes[lane];
+                        found = true;
+                        hit.t = tLanes[lane];
+                        hit.u = uLanes[lane];
+                        hit.v = vLanes[lane];
+                        hit.triangleIndex = triangleIndices[block * 4 + lane];
+                    }
+                }
+                if (AnyHit && found) {
+                    return true;
+                }
+            }
+        } else {
+            uint32_t near = node.leftFirst;
+            uint32_t far = node.leftFirst + 1;
+            float nearDistance = intersectBounds(nodes[near].bounds, origin, invDir, closest);
+            float farDistance = intersectBounds(nodes[far].bounds, origin, invDir, closest);
+            if (farDistance < nearDistance) {
+                std::swap(near, far);
+                std::swap(nearDistance, farDistance);
+            }
+
+            if (nearDistance != NO_HIT) {
+                if (farDistance != NO_HIT) {
+                    stack[stackSize] = far;
+                    stackDistance[stackSize] = farDistance;
+                    ++stackSize;
+                }
+                index = near;
+                continue;
+            }
+        }
+
+        // Pop the next subtree that can still contain a closer hit
+        bool advanced = false;
+        while (stackSize > 0) {
+            --stackSize;
+            if (stackDistance[stackSize] < closest) {
+                index = stack[stackSize];
+                advanced = true;
+                break;
+            }
+        }
+        if (!advanced) {
+            break;
+        }
+    }
+
+    return found;
+}
+
+bool MeshBVH::overlapsFrustum(const Frustum& frustum) const {
+    if (nodes.empty()) {
+        return false;
+    }
+
+    uint32_t stack[MAX_DEPTH * 2];
+    uint32_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const Node& node = nodes[stack[--stackSize]];
+
+        Frustum::Containment containment = frustum.classifyAABB(node.bounds);
+        if (containment == Frustum::Containment::Outside) continue;
+        if (containment == Frustum::Containment::Inside) return true;
+
+        if (!node.isLeaf()) {
+            stack[stackSize++] = node.leftFirst;
+            stack[stackSize++] = node.leftFirst + 1;
+            continue;
+        }
+
+        uint32_t blockEnd = node.leftFirst + (node.triangleCount + 3) / 4;
+        for (uint32_t block = node.leftFirst; block < blockEnd; ++block) {
+            const Triangle4& tris = triangleBlocks[block];
+            float v0x[4], v0y[4], v0z[4], e1x[4], e1y[4], e1z[4], e2x[4], e2y[4], e2z[4];
+            tris.v0x.store(v0x); tris.v0y.store(v0y); tris.v0z.store(v0z);
+            tris.e1x.store(e1x); tris.e1y.store(e1y); tris.e1z.store(e1z);
+            tris.e2x.store(e2x); tris.e2y.store(e2y); tris.e2z.store(e2z);
+
+            for (int lane = 0; lane < 4; ++lane) {
+                if (triangleIndices[block * 4 + lane] == INVALID_TRIANGLE) break;
+
+                Vec3 v0(v0x[lane], v0y[lane], v0z[lane]);
+                Vec3 v1 = v0 + Vec3(e1x[lane], e1y[lane], e1z[lane]);
+                Vec3 v2 = v0 + Vec3(e2x[lane], e2y[lane], e2z[lane]);
+                if (frustum.intersectsTriangle(v0, v1, v2)) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+// ========== Packet Queries ==========
+
+int MeshBVH::intersectPacket(const RayPacket4& packet, Hit hits[4]) const {
+    for (int lane = 0; lane < 4; ++lane) {
+        hits[lane] = Hit();
+    }
+    if (nodes.empty() || packet.activeMask == 0) {
+        return 0;
+    }
+
+    simd::Float4 closest = packet.tMax;
+    simd::Float4 tEntry;
+    if (intersectAABB(packet, nodes[0].bounds, closest, tEntry) == 0) {
+        return 0;
+    }
+
+    int hitMask = 0;
+    uint32_t stack[MAX_DEPTH];
+    uint32_t stackSize = 0;
+    uint32_t index = 0;
+
+    while (true) {
+        const Node& node = nodes[index];
+
+        if (node.isLeaf()) {
+            uint32_t blockEnd = node.leftFirst + (node.triangleCount + 3) / 4;
+            for (uint32_t block = node.leftFirst; block < blockEnd; ++block) {
+                // Unpack the block once, then test each triangle against all 4 rays
+                const Triangle4& tris = triangleBlocks[block];
+                float v0x[4], v0y[4], v0z[4], e1x[4], e1y[4], e1z[4], e2x[4], e2y[4], e2z[4];
+                tris.v0x.store(v0x); tris.v0y.store(v0y); tris.v0z.store(v0z);
+                tris.e1x.store(e1x); tris.e1y.store(e1y); tris.e1z.store(e1z);
+                tris.e2x.store(e2x); tris.e2y.store(e2y); tris.e2z.store(e2z);
+
+                for (int tri = 0; tri < 4; ++tri) {
+                    uint32_t triangleIndex = triangleIndices[block * 4 + tri];
+                    if (triangleIndex == INVALID_TRIANGLE) break;
+
+                    simd::Float4 t, u, v;
+                    int mask = intersectTriangle(packet,
+                                                 Vec3(v0x[tri], v0y[tri], v0z[tri]),
+                                                 Vec3(e1x[tri], e1y[tri], e1z[tri]),
+                                                 Vec3(e2x[tri], e2y[tri], e2z[tri]),
+                                                 closest, t, u, v);
+                    if (mask == 0) continue;
+
+                    closest = simd::select(simd::maskFromBits(mask), t, closest);
+                    hitMask |= mask;
+
+                    float tLanes[4], uLanes[4], vLanes[4];
+                    t.store(tLanes);
+                    u.store(uLanes);
+                    v.store(vLanes);
+                    for (int lane = 0; lane < 4; ++lane) {
+                        if (mask & (1 << lane)) {
+                            hits[lane].t = tLanes[lane];
+                            hits[lane].u = uLanes[lane];
+                            hits[lane].v = vLanes[lane];
+                            hits[lane].triangleIndex = triangleIndex;
+                        }
+                    }
+                }
+            }
+        } else {
+            uint32_t near = node.leftFirst;
+            uint32_t far = node.leftFirst + 1;
+            simd::Float4 nearEntry, farEntry;
+            int nearMask = intersectAABB(packet, nodes[near].bounds, closest, nearEntry);
+            int farMask = intersectAABB(packet, nodes[far].bounds, closest, farEntry);
+
+            if (nearMask && farMask) {
+                // Order by the smallest entry distance of any ray that hits each child
+                const simd::Float4 inf(NO_HIT);
+                simd::Float4 nearT = simd::select(simd::maskFromBits(nearMask), nearEntry, inf);
+                simd::Float4 farT = simd::select(simd::maskFromBits(farMask), farEntry, inf);
+                float nearLanes[4], farLanes[4];
+                nearT.store(nearLanes);
+                farT.store(farLanes);
+                float nearMin = std::min(std::min(nearLanes[0], nearLanes[1]),
+                                         std::min(nearLanes[2], nearLanes[3]));
+                float farMin = std::min(std::min(farLanes[0], farLanes[1]),
+                                        std::min(farLanes[2], farLanes[3]));
+                if (farMin < nearMin) {
+                    std::swap(near, far);
+                }
+                stack[stackSize++] = far;
+                index = near;
+                continue;
+            }
+            if (nearMask) {
+                index = near;
+                continue;
+            }
+            if (farMask) {
+                index = far;
+                continue;
+            }
+        }
+
+        if (stackSize == 0) {
+            break;
+        }
+        index = stack[--stackSize];
+    }
+
+    return hitMask;
+}
+
+size_t MeshBVH::intersectBatch(const Ray* rays, size_t count, float maxDistance, Hit* hits) const {
+    size_t hitCount = 0;
+    for (size_t first = 0; first < count; first += 4) {
+        int packetSize = static_cast<int>(std::min<size_t>(4, count - first));
+        RayPacket4 packet = RayPacket4::fromRays(rays + first, packetSize, maxDistance);
+
+        Hit packetHits[4];
+        int mask = intersectPacket(packet, packetHits);
+        for (int lane = 0; lane < packetSize; ++lane) {
+            hits[first + lane] = packetHits[lane];
+            if (mask & (1 << lane)) {
+                ++hitCount;
+            }
+        }
+    }
+    return hitCount;
+}
+
+} // namespace resource
+} // namespace rs_engine
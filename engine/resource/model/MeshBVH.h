@@ -0,0 +1,147 @@
+#pragma once
+
+#include "../../core/math/AABB.h"
+#include "../../core/math/Frustum.h"
+#include "../../core/math/Ray.h"
+#include "../../core/math/RayPacket.h"
+#include <cstdint>
+#include <vector>
+
+namespace rs_engine {
+namespace resource {
+
+struct Vertex;
+
+/**
+ * @brief Static triangle BVH for exact ray queries against a mesh
+ *
+ * Built once per mesh with binned SAH and stored as a flat array of
+ * 32-byte nodes (children of an internal node are adjacent). Leaf
+ * triangles are copied into SoA blocks of 4 (Triangle4) so one ray is
+ * tested against a whole leaf with a single SIMD pass, and traversal
+ * never touches the original vertex/index arrays.
+ *
+ * Queries are done in object space: transform the ray with the inverse
+ * model matrix once and pass it in. The direction does not need to be
+ * normalized; returned t values are in units of the given direction.
+ *
+ * Platform Support: 100% shared
+ */
+class MeshBVH {
+public:
+    /**
+     * @brief Flattened node (32 bytes)
+     *
+     * Internal node: leftFirst = index of first child, triangleCount = 0
+     * Leaf node:     leftFirst = first Triangle4 block, triangleCount > 0
+     *                (the leaf spans (triangleCount + 3) / 4 blocks)
+     */
+    struct Node {
+        AABB bounds;
+        uint32_t leftFirst = 0;
+        uint32_t triangleCount = 0;
+
+        bool isLeaf() const { return triangleCount > 0; }
+    };
+
+    /**
+     * @brief Closest hit result
+     */
+    struct Hit {
+        float t = -1.0f;
+        uint32_t triangleIndex = 0;  // Index into the mesh's triangle list
+        float u = 0.0f;
+        float v = 0.0f;
+    };
+
+    static constexpr uint32_t MAX_LEAF_TRIANGLES = 4;  // Split target (one Triangle4 block); unsplittable leaves hold more
+    static constexpr uint32_t INVALID_TRIANGLE = 0xFFFFFFFFu;
+    static constexpr uint32_t MAX_DEPTH = 64;
+
+    MeshBVH() = default;
+
+    /**
+     * @brief Build from indexed triangle data
+     * @return false if there are no triangles
+     */
+    bool build(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+
+    /**
+     * @brief Find the closest triangle hit along the ray
+     * @param ray Ray in object space (direction need not be normalized)
+     * @param maxDistance Ignore hits farther than this
+     * @param hit Output: closest hit
+     * @return true if a triangle was hit
+     */
+    bool intersect(const Ray& ray, float maxDistance, Hit& hit) const;
+
+    /**
+     * @brief Test whether anything is hit closer than maxDistance (any-hit)
+     */
+    bool intersectsAny(const Ray& ray, float maxDistance) const;
+    
+    /**
+     * @brief Trace a ray packet (4 rays) through the tree together
+     *
+     * Nodes are tested against all 4 rays at once and a subtree is visited
+     * if any ray hits it. Works best for coherent rays (neighbouring pixels,
+     * jittered picking samples, sampling cones).
+     * @param hits Output: 4 results, t = -1 for misses and inactive lanes
+     * @return Mask of lanes that hit something
+     */
+    int intersectPacket(const RayPacket4& packet, Hit hits[4]) const;
+    
+    /**
+     * @brief Trace many rays, 4 at a time
+     *
+     * Consecutive rays are grouped into packets, so order the input for
+     * coherence (e.g. 2x2 pixel quads).
+     * @param hits Output: one result per ray, t = -1 on miss
+     * @return Number of rays that hit
+     */
+    size_t intersectBatch(const Ray* rays, size_t count, float maxDistance, Hit* hits) const;
+
+    /**
+     * @brief Test whether any triangle touches the frustum
+     *
+     * Subtrees fully inside the frustum are accepted immediately; leaf
+     * triangles use the conservative Frustum::intersectsTriangle test.
+     * @param frustum Frustum in object space (see Frustum::transformed)
+     */
+    bool overlapsFrustum(const Frustum& frustum) const;
+
+    bool empty() const { return nodes.empty(); }
+    const AABB& getBounds() const { return nodes[0].bounds; }
+    const std::vector<Node>& getNodes() const { return nodes; }
+    size_t getTriangleCount() const { return triangleCount; }
+    uint32_t getDepth() const { return depth; }
+    size_t getMemorySize() const;
+
+    // ========== Serialization ==========
+    
+    const std::vector<Triangle4>& getTriangleBlocks() const { return triangleBlocks; }
+    const std::vector<uint32_t>& getTriangleIndices() const { return triangleIndices; }  // 4 per block
+    
+    /**
+     * @brief Restore a tree saved from the arrays above (e.g. a mesh cache)
+     * @param indexData blockCount * 4 triangle indices
+     * @param triangles Triangles of the mesh the tree belongs to (every used lane must be below)
+     * @param treeDepth Stored depth; must match the measured one and MAX_DEPTH
+     * @return false if the arrays are inconsistent (the tree is left empty)
+     */
+    bool restore(const Node* nodeData, size_t nodeCount, const Triangle4* blocks, size_t blockCount,
+                 const uint32_t* indexData, size_t triangles, uint32_t treeDepth);
+
+private:
+    std::vector<Node> nodes;
+    std::vector<Triangle4> triangleBlocks;    // Leaf order, padded to 4 per block
+    std::vector<uint32_t> triangleIndices;    // Block lane -> original triangle
+    size_t triangleCount = 0;
+    uint32_t depth = 0;
+
+    template<bool AnyHit>
+    bool traverse(const Ray& ray, float maxDistance, Hit& hit) const;
+};
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,332 @@
+#include "MeshBufferPool.h"
+#include <algorithm>
+#include <iostream>
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+// Live ranges plus free ranges per arena; meshes are rarely smaller than a few hundred bytes
+constexpr uint32_t MAX_ARENA_ALLOCATIONS = 64 * 1024;
+
+} // namespace
+
+MeshBufferPool::~MeshBufferPool() {
+    release();
+}
+
+void MeshBufferPool::initialize(wgpu::Device wgpuDevice) {
+    release();
+    device = wgpuDevice;
+}
+
+void MeshBufferPool::release() {
+    for (auto& arena : arenas) {
+        if (arena) {
+            for (uint32_t stream = 0; stream < arena->getStreamCount(); ++stream) {
+                arena->buffers[stream].Destroy();
+            }
+        }
+    }
+    arenas.clear();
+    records.clear();
+    freeRecords.clear();
+    device = nullptr;
+}
+
+uint64_t MeshBufferPool::Arena::getCapacityBytes() const {
+    return static_cast<uint64_t>(capacity) * (strides[0] + strides[1]);
+}
+
+// ========== Allocation ==========
+
+MeshBufferPool::AllocationId MeshBufferPool::allocateVertices(const VertexLayout& layout, uint32_t vertexCount) {
+    return allocate(false, layout.getPositionStride(), layout.getAttributeStride(),
+                    vertexCount, settings.vertexArenaVertices);
+}
+
+MeshBufferPool::AllocationId MeshBufferPool::allocateIndices(uint64_t byteSize) {
+    const uint64_t units = (byteSize + INDEX_UNIT_SIZE - 1) / INDEX_UNIT_SIZE;
+    if (units > OffsetAllocator::NO_SPACE / 2) {
+        std::cerr << "[ERROR] Index data too large for a buffer arena: " << byteSize << " bytes" << std::endl;
+        return INVALID_ALLOCATION;
+    }
+    return allocate(true, INDEX_UNIT_SIZE, 0, static_cast<uint32_t>(units),
+                    std::max<uint32_t>(settings.indexArenaBytes / INDEX_UNIT_SIZE, 1));
+}
+
+MeshBufferPool::AllocationId MeshBufferPool::allocate(bool indexArena, uint32_t positionStride,
+                                                      uint32_t attributeStride, uint32_t units,
+                                                      uint32_t defaultCapacity) {
+    if (!device || units == 0 || positionStride == 0) {
+        return INVALID_ALLOCATION;
+    }
+
+    auto matches = [&](const std::unique_ptr<Arena>& arena) {
+        return arena && arena->indexArena == indexArena &&
+               arena->strides[0] == positionStride && arena->strides[1] == attributeStride;
+    };
+
+    // First fit among the existing arenas (each lookup is O(1))
+    for (uint32_t i = 0; i < arenas.size(); ++i) {
+        if (matches(arenas[i])) {
+            AllocationId id = allocateFrom(i, units);
+            if (id != INVALID_ALLOCATION) {
+                return id;
+            }
+        }
+    }
+
+    // New arena; large requests get one of their own size (rounded so a
+    // fresh allocator's single free range is guaranteed to fit them).
+    // Never compact here: a pass being recorded may still use the old
+    // buffers. Fragmented arenas wait for defragment().
+    auto arena = std::make_unique<Arena>();
+    arena->indexArena = indexArena;
+    arena->strides[0] = positionStride;
+    arena->strides[1] = attributeStride;
+    arena->capacity = std::max(defaultCapacity,
+                               OffsetAllocator::binToSize(OffsetAllocator::sizeToBinRoundUp(units)));
+    if (!createArenaBuffers(*arena, arena->buffers)) {
+        return INVALID_ALLOCATION;
+    }
+    arena->allocator = std::make_unique<OffsetAllocator>(arena->capacity, MAX_ARENA_ALLOCATIONS);
+
+    // Reuse a trimmed slot so arena indices stay small
+    uint32_t arenaIndex = static_cast<uint32_t>(arenas.size());
+    for (uint32_t i = 0; i < arenas.size(); ++i) {
+        if (!arenas[i]) {
+            arenaIndex = i;
+            break;
+        }
+    }
+    if (arenaIndex == arenas.size()) {
+        arenas.push_back(nullptr);
+    }
+
+    std::cout << "[INFO] Created " << (indexArena ? "index" : "vertex") << " buffer arena " << arenaIndex
+              << ": " << (arena->getCapacityBytes() / 1024.0 / 1024.0) << " MB" << std::endl;
+    arenas[arenaIndex] = std::move(arena);
+    return allocateFrom(arenaIndex, units);
+}
+
+MeshBufferPool::AllocationId MeshBufferPool::allocateFrom(uint32_t arenaIndex, uint32_t units) {
+    OffsetAllocator::Allocation allocation = arenas[arenaIndex]->allocator->allocate(units);
+    if (!allocation.isValid()) {
+        return INVALID_ALLOCATION;
+    }
+
+    AllocationId id;
+    if (!freeRecords.empty()) {
+        id = freeRecords.back();
+        freeRecords.pop_back();
+    } else {
+        id = static_cast<AllocationId>(records.size());
+        records.emplace_back();
+    }
+    Record& record = records[id];
+    record.arena = arenaIndex;
+    record.size = units;
+    record.allocation = allocation;
+    record.live = true;
+    return id;
+}
+
+void MeshBufferPool::free(AllocationId id) {
+    if (id >= records.size() || !records[id].live) {
+        return;
+    }
+    Record& record = records[id];
+    Arena& arena = *arenas[record.arena];
+    arena.allocator->free(record.allocation);
+    arena.packed = arena.allocator->getAllocationCount() == 0;   // Otherwise there may be a gap now
+    record = Record();
+    freeRecords.push_back(id);
+}
+
+bool MeshBufferPool::createArenaBuffers(const Arena& arena, wgpu::Buffer* outBuffers) const {
+    // CopySrc: compaction copies live ranges into a new buffer
+    const wgpu::BufferUsage usage = (arena.indexArena ? wgpu::BufferUsage::Index : wgpu::BufferUsage::Vertex) |
+                                    wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
+    for (uint32_t stream = 0; stream < arena.getStreamCount(); ++stream) {
+        wgpu::BufferDescriptor bufferDesc;
+        bufferDesc.size = static_cast<uint64_t>(arena.capacity) * arena.strides[stream];
+        bufferDesc.usage = usage;
+        bufferDesc.mappedAtCreation = false;
+
+        outBuffers[stream] = device.CreateBuffer(&bufferDesc);
+        if (!outBuffers[stream]) {
+            std::cerr << "[ERROR] Failed to create buffer arena (" << bufferDesc.size << " bytes)" << std::endl;
+            outBuffers[0] = nullptr;
+            outBuffers[1] = nullptr;
+            return false;
+        }
+    }
+    return true;
+}
+
+// ========== Lookup ==========
+
+const MeshBufferPool::Record* MeshBufferPool::findRecord(AllocationId id) const {
+    if (id >= records.size() || !records[id].live) {
+        return nullptr;
+    }
+    return &records[id];
+}
+
+wgpu::Buffer MeshBufferPool::getBuffer(AllocationId id, uint32_t stream) const {
+    const Record* record = findRecord(id);
+    if (!record || stream > 1) {
+        return nullptr;
+    }
+    return arenas[record->arena]->buffers[stream];
+}
+
+uint32_t MeshBufferPool::getOffset(AllocationId id) const {
+    const Record* record = findRecord(id);
+    return record ? record->allocation.offset : 0;
+}
+
+uint64_t MeshBufferPool::getByteOffset(AllocationId id, uint32_t stream) const {
+    const Record* record = findRecord(id);
+    if (!record || stream > 1) {
+        return 0;
+    }
+    return static_cast<uint64_t>(record->allocation.offset) * arenas[record->arena]->strides[stream];
+}
+
+uint32_t MeshBufferPool::getArenaIndex(AllocationId id) const {
+    const Record* record = findRecord(id);
+    return record ? record->arena : INVALID_ALLOCATION;
+}
+
+// ========== Maintenance ==========
+
+size_t MeshBufferPool::defragment(bool force) {
+    if (!device) {
+        return 0;
+    }
+
+    size_t compacted = 0;
+    for (uint32_t i = 0; i < arenas.size(); ++i) {
+        if (!arenas[i] || arenas[i]->packed) {
+            continue;
+        }
+        const OffsetAllocator::StorageReport report = arenas[i]->allocator->getStorageReport();
+        const bool fragmented = force || report.largestFree < report.totalFree * settings.defragmentThreshold;
+        if (fragmented && compactArena(i)) {
+            compacted++;
+        }
+    }
+    return compacted;
+}
+
+bool MeshBufferPool::compactArena(uint32_t arenaIndex) {
+    Arena& arena = *arenas[arenaIndex];
+
+    // Live ranges in address order keep their relative order when packed
+    std::vector<AllocationId> live;
+    for (AllocationId id = 0; id < records.size(); ++id) {
+        if (records[id].live && records[id].arena == arenaIndex) {
+            live.push_back(id);
+        }
+    }
+    std::sort(live.begin(), live.end(), [&](AllocationId a, AllocationId b) {
+        return records[a].allocation.offset < records[b].allocation.offset;
+    });
+
+    wgpu::Buffer newBuffers[2];
+    if (!createArenaBuffers(arena, newBuffers)) {
+        return false;
+    }
+
+    std::vector<uint32_t> sizes(live.size());
+    std::vector<uint32_t> oldOffsets(live.size());
+    for (size_t i = 0; i < live.size(); ++i) {
+        sizes[i] = records[live[i]].size;
+        oldOffsets[i] = records[live[i]].allocation.offset;
+    }
+    std::vector<OffsetAllocator::Allocation> packed(live.size());
+    if (!arena.allocator->allocatePacked(sizes.data(), sizes.size(), packed.data())) {
+        // Cannot happen while the ranges fit the arena; the arena is left as it was
+        std::cerr << "[ERROR] Buffer arena " << arenaIndex << " compaction failed" << std::endl;
+        for (uint32_t stream = 0; stream < arena.getStreamCount(); ++stream) {
+            newBuffers[stream].Destroy();
+        }
+        return false;
+    }
+
+    // Copy runs of ranges that were already adjacent as one copy
+    wgpu::CommandEncoderDescriptor encoderDesc;
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder(&encoderDesc);
+    uint64_t moved = 0;
+    size_t runStart = 0;
+    for (size_t i = 0; i < live.size(); ++i) {
+        const bool runEnds = i + 1 == live.size() || oldOffsets[i + 1] != oldOffsets[i] + sizes[i];
+        if (!runEnds) {
+            continue;
+        }
+        const uint64_t runUnits = static_cast<uint64_t>(oldOffsets[i]) + sizes[i] - oldOffsets[runStart];
+        for (uint32_t stream = 0; stream < arena.getStreamCount(); ++stream) {
+            const uint64_t stride = arena.strides[stream];
+            encoder.CopyBufferToBuffer(arena.buffers[stream], oldOffsets[runStart] * stride,
+                                       newBuffers[stream], packed[runStart].offset * stride, runUnits * stride);
+            moved += runUnits * stride;
+        }
+        runStart = i + 1;
+    }
+    wgpu::CommandBuffer commands = encoder.Finish();
+    device.GetQueue().Submit(1, &commands);
+
+    // Writes queued before this submit land in the old buffer and are carried over
+    for (size_t i = 0; i < live.size(); ++i) {
+        records[live[i]].allocation = packed[i];
+    }
+    for (uint32_t stream = 0; stream < arena.getStreamCount(); ++stream) {
+        arena.buffers[stream].Destroy();
+        arena.buffers[stream] = newBuffers[stream];
+    }
+    arena.packed = true;
+
+    compactions++;
+    bytesMoved += moved;
+    std::cout << "[INFO] Compacted buffer arena " << arenaIndex << ": " << live.size() << " ranges, "
+              << (moved / 1024.0 / 1024.0) << " MB copied" << std::endl;
+    return true;
+}
+
+size_t MeshBufferPool::trim() {
+    size_t destroyed = 0;
+    for (auto& arena : arenas) {
+        if (arena && arena->allocator->getAllocationCount() == 0) {
+            for (uint32_t stream = 0; stream < arena->getStreamCount(); ++stream) {
+                arena->buffers[stream].Destroy();
+            }
+            arena.reset();
+            destroyed++;
+        }
+    }
+    return destroyed;
+}
+
+MeshBufferPool::Stats MeshBufferPool::getStats() const {
+    Stats stats;
+    for (const auto& arena : arenas) {
+        if (!arena) {
+            continue;
+        }
+        (arena->indexArena ? stats.indexArenas : stats.vertexArenas)++;
+        stats.buffers += arena->getStreamCount();
+        stats.allocations += arena->allocator->getAllocationCount();
+        stats.capacityBytes += arena->getCapacityBytes();
+        const uint32_t usedUnits = arena->capacity - arena->allocator->getStorageReport().totalFree;
+        stats.usedBytes += static_cast<uint64_t>(usedUnits) * (arena->strides[0] + arena->strides[1]);
+    }
+    stats.compactions = compactions;
+    stats.bytesMoved = bytesMoved;
+    return stats;
+}
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "../../core/OffsetAllocator.h"
+#include "VertexFormat.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rs_engine {
+namespace resource {
+
+/**
+ * @brief Shared GPU buffers (arenas) that mesh vertex and index data is suballocated from
+ *
+ * Instead of two or three wgpu::Buffers per mesh, meshes take ranges of a
+ * few large buffers, so thousands of small meshes cost a handful of buffer
+ * objects and consecutive draws rarely rebind anything:
+ *
+ * - Vertex arenas hold a position buffer and an attribute buffer side by
+ *   side, one arena per pair of stream strides (i.e. per VertexLayout
+ *   size). A vertex range has the same index in both buffers, so a draw
+ *   binds both at offset 0 and passes the range start as baseVertex.
+ * - Index arenas hold 16-bit and 32-bit indices alike, in 4-byte units.
+ *   A draw binds the arena with the mesh's format and passes the range
+ *   start (in indices of that format) as firstIndex.
+ *
+ * Ranges come from an OffsetAllocator per arena (O(1) allocate and free).
+ * When no arena has room, the pool adds a new arena (sized to the request
+ * if larger than the default); allocation never moves existing ranges.
+ * Only defragment() compacts, at a point the caller chooses (the
+ * ResourceManager does so in update(), between frames): live ranges are
+ * copied on the GPU into a fresh buffer, packed from offset 0, and the
+ * old buffer is destroyed.
+ *
+ * Allocations are addressed by a stable AllocationId; look the buffer and
+ * offset up at draw time instead of caching them, since compaction moves
+ * ranges and replaces buffers. Do not compact while a render pass that
+ * uses the arenas is being recorded.
+ *
+ * Each pool is bound to one device (ResourceManager owns the pool of its
+ * device). Meshes remember the pool they allocated from and must release
+ * their ranges before the pool is released or destroyed.
+ *
+ * Not thread-safe: allocate, free and defragment on the thread that owns
+ * the device (meshes do so in createGPUResources / releaseGPUResources).
+ *
+ * Platform Support: 100% shared
+ */
+class MeshBufferPool {
+public:
+    using AllocationId = uint32_t;
+    static constexpr AllocationId INVALID_ALLOCATION = 0xFFFFFFFFu;
+
+    static constexpr uint32_t INDEX_UNIT_SIZE = 4;          // Bytes per index arena unit
+
+    struct Settings {
+        uint32_t vertexArenaVertices = 256 * 1024;          // Per vertex arena (6 MB at 24 bytes per vertex)
+        uint32_t indexArenaBytes = 8 * 1024 * 1024;         // Per index arena
+        float defragmentThreshold = 0.5f;                   // defragment(): compact arenas whose largest
+                                                            // free range is below this share of their free space
+    };
+
+    struct Stats {
+        size_t vertexArenas = 0;
+        size_t indexArenas = 0;
+        size_t buffers = 0;              // wgpu::Buffers held (vertex arenas hold one or two)
+        size_t allocations = 0;          // Live ranges
+        uint64_t capacityBytes = 0;
+        uint64_t usedBytes = 0;
+        size_t compactions = 0;          // Since creation
+        uint64_t bytesMoved = 0;         // By compactions, since creation
+    };
+
+    MeshBufferPool() = default;
+    ~MeshBufferPool();
+
+    MeshBufferPool(const MeshBufferPool&) = delete;
+    MeshBufferPool& operator=(const MeshBufferPool&) = delete;
+
+    /**
+     * @brief Bind the pool to the device its arena buffers are created on
+     */
+    void initialize(wgpu::Device wgpuDevice);
+
+    /**
+     * @brief Destroy every arena and unbind the device
+     *
+     * Live allocations are dropped with their arenas; free() ignores their
+     * ids afterwards.
+     */
+    void release();
+
+    bool isInitialized() const { return static_cast<bool>(device); }
+    wgpu::Device getDevice() const { return device; }
+
+    /**
+     * @brief Arena sizes for arenas created from now on
+     */
+    void setSettings(const Settings& newSettings) { settings = newSettings; }
+    const Settings& getSettings() const { return settings; }
+
+    // ========== Allocation ==========
+
+    /**
+     * @brief Reserve vertexCount vertices in an arena matching the layout's stream strides
+     * @return INVALID_ALLOCATION if no arena buffer can be created (or no device is bound)
+     */
+    AllocationId allocateVertices(const VertexLayout& layout, uint32_t vertexCount);
+
+    /**
+     * @brief Reserve index data (byteSize is rounded up to INDEX_UNIT_SIZE)
+     */
+    AllocationId allocateIndices(uint64_t byteSize);
+
+    /**
+     * @brief Release a range (INVALID_ALLOCATION is ignored)
+     */
+    void free(AllocationId id);
+
+    // ========== Lookup ==========
+
+    /**
+     * @brief Arena buffer of an allocation
+     * @param stream Vertex arenas: 0 = positions, 1 = attributes (null if the layout has none).
+     *               Index arenas: 0
+     */
+    wgpu::Buffer getBuffer(AllocationId id, uint32_t stream = 0) const;
+
+    /**
+     * @brief Range start in arena units: vertices (baseVertex) or 4-byte index words
+     */
+    uint32_t getOffset(AllocationId id) const;
+
+    /**
+     * @brief Range start in bytes within getBuffer(id, stream)
+     */
+    uint64_t getByteOffset(AllocationId id, uint32_t stream = 0) const;
+
+    /**
+     * @brief Arena holding the allocation (stable until the arena is trimmed)
+     */
+    uint32_t getArenaIndex(AllocationId id) const;
+
+    // ========== Maintenance ==========
+
+    /**
+     * @brief Compact arenas fragmented beyond Settings::defragmentThreshold
+     * @param force Compact every arena with a gap below its last range
+     * @return Arenas compacted
+     */
+    size_t defragment(bool force = false);
+
+    /**
+     * @brief Destroy arenas without live ranges
+     * @return Arenas destroyed
+     */
+    size_t trim();
+
+    Stats getStats() const;
+
+private:
+    struct Arena {
+        bool indexArena = false;
+        uint32_t strides[2] = {};        // Bytes per unit of each stream (0 = stream unused)
+        uint32_t capacity = 0;           // Units
+        wgpu::Buffer buffers[2];
+        std::unique_ptr<OffsetAllocator> allocator;
+        bool packed = true;              // No gaps below the last range (fresh or just compacted)
+
+        uint32_t getStreamCount() const { return strides[1] > 0 ? 2 : 1; }
+        uint64_t getCapacityBytes() const;
+    };
+
+    struct Record {
+        uint32_t arena = 0;
+        uint32_t size = 0;               // Units
+        OffsetAllocator::Allocation allocation;
+        bool live = false;
+    };
+
+    wgpu::Device device;
+    Settings settings;
+    std::vector<std::unique_ptr<Arena>> arenas;     // Null after trim(); indices stay stable
+    std::vector<Record> records;
+    std::vector<AllocationId> freeRecords;
+    size_t compactions = 0;
+    uint64_t bytesMoved = 0;
+
+    AllocationId allocate(bool indexArena, uint32_t positionStride,
+                          uint32_t attributeStride, uint32_t units, uint32_t defaultCapacity);
+    AllocationId allocateFrom(uint32_t arenaIndex, uint32_t units);
+    bool createArenaBuffers(const Arena& arena, wgpu::Buffer* outBuffers) const;
+    bool compactArena(uint32_t arenaIndex);
+    const Record* findRecord(AllocationId id) const;
+};
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,464 @@
+#include "MeshCache.h"
+#include "../../core/MappedFile.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+namespace rs_engine {
+namespace resource {
+
+static_assert(std::is_trivially_copyable<Vertex>::value, "Vertex is stored as raw bytes");
+static_assert(std::is_trivially_copyable<MeshBVH::Node>::value, "BVH nodes are stored as raw bytes");
+static_assert(std::is_trivially_copyable<Triangle4>::value, "BVH blocks are stored as raw bytes");
+
+namespace {
+
+constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9ull;
+constexpr uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t PRIME64_5 = 0x27D4EB2F165667C5ull;
+
+inline uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t value;
+    std::memcpy(&value, p, 8);
+    return value;
+}
+
+inline uint64_t hashRound(uint64_t accumulator, uint64_t input) {
+    accumulator += input * PRIME64_2;
+    return rotateLeft(accumulator, 31) * PRIME64_1;
+}
+
+inline uint64_t mergeRound(uint64_t accumulator, uint64_t value) {
+    accumulator ^= hashRound(0, value);
+    return accumulator * PRIME64_1 + PRIME64_4;
+}
+
+uint32_t appendString(std::vector<char>& strings, const std::string& text) {
+    uint32_t offset = static_cast<uint32_t>(strings.size());
+    strings.insert(strings.end(), text.begin(), text.end());
+    return offset;
+}
+
+/**
+ * @brief Identifies the LOD settings a stored chain was built with
+ */
+uint64_t hashLODSettings(const LODSettings& settings) {
+    const float values[6] = {static_cast<float>(settings.maxLevels), settings.reductionPerLevel,
+                             settings.firstScreenSize, settings.screenSizeFalloff, settings.maxError,
+                             static_cast<float>(settings.minTriangles)};
+    return MeshCache::hashBytes(values, sizeof(values));
+}
+
+bool hashFile(const std::string& path, uint64_t& size, uint64_t& hash) {
+    MappedFile file;
+    if (!file.open(path)) {
+        return false;
+    }
+    size = file.getSize();
+    hash = MeshCache::hashBytes(file.getData(), file.getSize());
+    return true;
+}
+
+} // namespace
+
+// ========== Hashing ==========
+
+uint64_t MeshCache::hashBytes(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* end = p + size;
+    uint64_t hash;
+
+    if (size >= 32) {
+        // Four independent lanes keep the multipliers busy
+        uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+        uint64_t v2 = seed + PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME64_1;
+        const uint8_t* limit = end - 32;
+        do {
+            v1 = hashRound(v1, read64(p));
+            v2 = hashRound(v2, read64(p + 8));
+            v3 = hashRound(v3, read64(p + 16));
+            v4 = hashRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        hash = rotateLeft(v1, 1) + rotateLeft(v2, 7) + rotateLeft(v3, 12) + rotateLeft(v4, 18);
+        hash = mergeRound(hash, v1);
+        hash = mergeRound(hash, v2);
+        hash = mergeRound(hash, v3);
+        hash = mergeRound(hash, v4);
+    } else {
+        hash = seed + PRIME64_5;
+    }
+    hash += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        hash ^= hashRound(0, read64(p));
+        hash = rotateLeft(hash, 27) * PRIME64_1 + PRIME64_4;
+    }
+    if (p + 4 <= end) {
+        uint32_t value;
+        std::memcpy(&value, p, 4);
+        hash ^= static_cast<uint64_t>(value) * PRIME64_1;
+        hash = rotateLeft(hash, 23) * PRIME64_2 + PRIME64_3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        hash ^= *p * PRIME64_5;
+        hash = rotateLeft(hash, 11) * PRIME64_1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= PRIME64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// ========== Save ==========
+
+bool MeshCache::save(const std::string& cachePath, Model& model,
+                     const std::vector<std::string>& sources,
+                     const ModelCacheSettings& settings) {
+    using namespace meshcache;
+    std::vector<char> strings;
+
+    std::vector<CacheSource> sourceRecords(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+        CacheSource& record = sourceRecords[i];
+        if (!hashFile(sources[i], record.size, record.contentHash)) {
+            std::cerr << "[ERROR] Mesh cache: cannot read source '" << sources[i] << "'" << std::endl;
+            return false;
+        }
+        record.pathOffset = appendString(strings, sources[i]);
+        record.pathLength = static_cast<uint32_t>(sources[i].size());
+    }
+
+    // LOD 0 meshes first, then every level's meshes
+    std::vector<const Mesh*> meshes;
+    for (const auto& mesh : model.getMeshes()) {
+        meshes.push_back(mesh.get());
+    }
+    const auto& lods = model.getLODs();
+    std::vector<CacheLODLevel> lodRecords(lods.size());
+    for (size_t l = 0; l < lods.size(); ++l) {
+        lodRecords[l] = {};
+        lodRecords[l].firstMesh = static_cast<uint32_t>(meshes.size());
+        lodRecords[l].meshCount = static_cast<uint32_t>(lods[l].meshes.size());
+        lodRecords[l].screenSize = lods[l].screenSize;
+        lodRecords[l].triangleCount = lods[l].triangleCount;
+        for (const auto& mesh : lods[l].meshes) {
+            meshes.push_back(mesh.get());
+        }
+    }
+
+    const auto& nodes = model.getNodes();
+    std::vector<CacheNode> nodeRecords(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const ModelNode& node = nodes[i];
+        const Transform& t = node.transform;
+        nodeRecords[i] = {appendString(strings, node.name), static_cast<uint32_t>(node.name.size()),
+                          node.parent, node.firstMesh, node.meshCount,
+                          {t.position.x, t.position.y, t.position.z},
+                          {t.rotation.x, t.rotation.y, t.rotation.z},
+                          {t.scale.x, t.scale.y, t.scale.z}};
+    }
+
+    // BVHs only exist for LOD 0 (picking never uses reduced levels)
+    std::vector<const MeshBVH*> trees(meshes.size(), nullptr);
+    for (size_t i = 0; i < model.getMeshCount(); ++i) {
+        trees[i] = meshes[i]->hasBVH() ? meshes[i]->getBVH() : nullptr;
+    }
+
+    MeshCacheHeader header = {};
+    header.magic = MESH_CACHE_MAGIC;
+    header.version = MESH_CACHE_VERSION;
+    header.headerSize = sizeof(MeshCacheHeader);
+    header.endianTag = MESH_CACHE_ENDIAN_TAG;
+    header.vertexSize = sizeof(Vertex);
+    header.bvhNodeSize = sizeof(MeshBVH::Node);
+    header.bvhBlockSize = sizeof(Triangle4);
+    // Flags record what was requested: a chain may legitimately have no levels
+    header.contentFlags = (settings.generateLODs ? CONTENT_LODS : 0u) | (settings.buildBVH ? CONTENT_BVH : 0u) |
+                          (settings.splitLargeMeshes ? CONTENT_SPLIT : 0u) |
+                          (settings.optimizeMeshes ? CONTENT_OPTIMIZED : 0u);
+    header.sourceCount = static_cast<uint32_t>(sourceRecords.size());
+    header.meshCount = static_cast<uint32_t>(meshes.size());
+    header.lodLevelCount = static_cast<uint32_t>(lodRecords.size());
+    header.nodeCount = static_cast<uint32_t>(nodeRecords.size());
+    header.lodSettingsHash = settings.generateLODs ? hashLODSettings(settings.lodSettings) : 0;
+
+    Vec3 boundsMin, boundsMax;
+    model.getBounds(boundsMin, boundsMax);
+    std::memcpy(header.boundsMin, &boundsMin, sizeof(header.boundsMin));
+    std::memcpy(header.boundsMax, &boundsMax, sizeof(header.boundsMax));
+
+    std::vector<CacheMesh> meshRecords(meshes.size());
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        meshRecords[i] = {};
+        meshRecords[i].nameOffset = appendString(strings, meshes[i]->getName());
+        meshRecords[i].nameLength = static_cast<uint32_t>(meshes[i]->getName().size());
+    }
+    header.sourcesOffset = alignOffset(sizeof(MeshCacheHeader));
+    header.meshesOffset = alignOffset(header.sourcesOffset + sourceRecords.size() * sizeof(CacheSource));
+    header.lodLevelsOffset = alignOffset(header.meshesOffset + meshRecords.size() * sizeof(CacheMesh));
+    header.nodesOffset = alignOffset(header.lodLevelsOffset + lodRecords.size() * sizeof(CacheLODLevel));
+    header.stringsOffset = alignOffset(header.nodesOffset + nodeRecords.size() * sizeof(CacheNode));
+    header.stringsSize = strings.size();
+
+    // Data arrays follow the strings
+    uint64_t position = alignOffset(header.stringsOffset + header.stringsSize);
+    auto place = [&](size_t bytes) {
+        uint64_t offset = position;
+        position = alignOffset(position + bytes);
+        return offset;
+    };
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        CacheMesh& record = meshRecords[i];
+        const Mesh* mesh = meshes[i];
+        record.vertexCount = static_cast<uint32_t>(mesh->getVertexCount());
+        record.indexCount = static_cast<uint32_t>(mesh->getIndexCount());
+        record.verticesOffset = place(mesh->getVertexCount() * sizeof(Vertex));
+        record.indicesOffset = place(mesh->getIndexCount() * sizeof(uint32_t));
+        if (const MeshBVH* tree = trees[i]) {
+            record.bvhNodeCount = static_cast<uint32_t>(tree->getNodes().size());
+            record.bvhBlockCount = static_cast<uint32_t>(tree->getTriangleBlocks().size());
+            record.bvhTriangleCount = static_cast<uint32_t>(tree->getTriangleCount());
+            record.bvhDepth = tree->getDepth();
+            record.bvhNodesOffset = place(record.bvhNodeCount * sizeof(MeshBVH::Node));
+            record.bvhBlocksOffset = place(record.bvhBlockCount * sizeof(Triangle4));
+            record.bvhIndicesOffset = place(record.bvhBlockCount * 4 * sizeof(uint32_t));
+        }
+    }
+    header.fileSize = position;
+
+    // Write to a temporary file first so a crash never leaves a torn cache
+    const std::string tempPath = cachePath + ".tmp";
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "[WARNING] Cannot write mesh cache '" << cachePath << "'" << std::endl;
+        return false;
+    }
+
+    uint64_t written = 0;
+    auto writeSection = [&](uint64_t offset, const void* data, size_t bytes) {
+        static const char padding[MESH_CACHE_ALIGNMENT] = {};
+        file.write(padding, static_cast<std::streamsize>(offset - written));
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        written = offset + bytes;
+    };
+    writeSection(0, &header, sizeof(header));
+    writeSection(header.sourcesOffset, sourceRecords.data(), sourceRecords.size() * sizeof(CacheSource));
+    writeSection(header.meshesOffset, meshRecords.data(), meshRecords.size() * sizeof(CacheMesh));
+    writeSection(header.lodLevelsOffset, lodRecords.data(), lodRecords.size() * sizeof(CacheLODLevel));
+    writeSection(header.nodesOffset, nodeRecords.data(), nodeRecords.size() * sizeof(CacheNode));
+    writeSection(header.stringsOffset, strings.data(), strings.size());
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        const CacheMesh& record = meshRecords[i];
+        writeSection(record.verticesOffset, meshes[i]->getVertices().data(), record.vertexCount * sizeof(Vertex));
+        writeSection(record.indicesOffset, meshes[i]->getIndices().data(), record.indexCount * sizeof(uint32_t));
+        if (const MeshBVH* tree = trees[i]) {
+            writeSection(record.bvhNodesOffset, tree->getNodes().data(), record.bvhNodeCount * sizeof(MeshBVH::Node));
+            writeSection(record.bvhBlocksOffset, tree->getTriangleBlocks().data(),
+                         record.bvhBlockCount * sizeof(Triangle4));
+            writeSection(record.bvhIndicesOffset, tree->getTriangleIndices().data(),
+                         record.bvhBlockCount * 4 * sizeof(uint32_t));
+        }
+    }
+    writeSection(header.fileSize, nullptr, 0);
+    file.close();
+
+    // rename() does not replace an existing file everywhere
+    std::remove(cachePath.c_str());
+    if (!file || std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        std::cerr << "[WARNING] Failed to write mesh cache '" << cachePath << "'" << std::endl;
+        return false;
+    }
+
+    std::cout << "[INFO] Wrote mesh cache '" << cachePath << "' (" << meshes.size() << " meshes, "
+              << header.fileSize / 1024 << " KB)" << std::endl;
+    return true;
+}
+
+// ========== Load ==========
+
+bool MeshCache::load(const std::string& cachePath, Model& outModel, const ModelCacheSettings& settings) {
+    using namespace meshcache;
+    MappedFile file;
+    if (!file.open(cachePath)) {
+        return false;  // No cache yet
+    }
+    const uint8_t* data = file.getData();
+    const size_t size = file.getSize();
+
+    MeshCacheHeader header;
+    if (size < sizeof(header)) {
+        std::cerr << "[WARNING] Ignoring truncated mesh cache '" << cachePath << "'" << std::endl;
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    // Sections and arrays must lie inside the file (and be aligned for in-place reads)
+    auto fits = [&](uint64_t offset, uint64_t count, uint64_t elementSize) {
+        return offset % MESH_CACHE_ALIGNMENT == 0 && offset <= header.fileSize &&
+               count <= (header.fileSize - offset) / std::max<uint64_t>(elementSize, 1);
+    };
+    if (header.magic != MESH_CACHE_MAGIC || header.version != MESH_CACHE_VERSION ||
+        header.headerSize != sizeof(MeshCacheHeader) || header.endianTag != MESH_CACHE_ENDIAN_TAG ||
+        header.vertexSize != sizeof(Vertex) || header.bvhNodeSize != sizeof(MeshBVH::Node) ||
+        header.bvhBlockSize != sizeof(Triangle4) || header.fileSize > size ||
+        !fits(header.sourcesOffset, header.sourceCount, sizeof(CacheSource)) ||
+        !fits(header.meshesOffset, header.meshCount, sizeof(CacheMesh)) ||
+        !fits(header.lodLevelsOffset, header.lodLevelCount, sizeof(CacheLODLevel)) ||
+        !fits(header.nodesOffset, header.nodeCount, sizeof(CacheNode)) ||
+        !fits(header.stringsOffset, header.stringsSize, 1) || header.meshCount == 0) {
+        std::cout << "[INFO] Mesh cache '" << cachePath << "' is invalid or from another version, rebuilding" << std::endl;
+        return false;
+    }
+
+    // Content the settings ask for
+    if ((settings.generateLODs && (!(header.contentFlags & CONTENT_LODS) ||
+                                   header.lodSettingsHash != hashLODSettings(settings.lodSettings))) ||
+        (settings.buildBVH && !(header.contentFlags & CONTENT_BVH)) ||
+        (settings.splitLargeMeshes && !(header.contentFlags & CONTENT_SPLIT)) ||
+        (settings.optimizeMeshes && !(header.contentFlags & CONTENT_OPTIMIZED))) {
+        std::cout << "[INFO] Mesh cache '" << cachePath << "' lacks requested content, rebuilding" << std::endl;
+        return false;
+    }
+
+    const char* strings = reinterpret_cast<const char*>(data + header.stringsOffset);
+    auto getString = [&](uint32_t offset, uint32_t length, std::string& out) {
+        if (static_cast<uint64_t>(offset) + length > header.stringsSize) {
+            return false;
+        }
+        out.assign(strings + offset, length);
+        return true;
+    };
+
+    // Every source must be unchanged
+    const auto* sources = reinterpret_cast<const CacheSource*>(data + header.sourcesOffset);
+    std::string path;
+    for (uint32_t i = 0; i < header.sourceCount; ++i) {
+        uint64_t sourceSize = 0, sourceHash = 0;
+        if (!getString(sources[i].pathOffset, sources[i].pathLength, path) ||
+            !hashFile(path, sourceSize, sourceHash) ||
+            sourceSize != sources[i].size || sourceHash != sources[i].contentHash) {
+            std::cout << "[INFO] Mesh cache '" << cachePath << "' is out of date ('" << path
+                      << "' changed), rebuilding" << std::endl;
+            return false;
+        }
+    }
+
+    // Meshes: one bulk copy per array straight from the mapping
+    const auto* meshRecords = reinterpret_cast<const CacheMesh*>(data + header.meshesOffset);
+    std::vector<std::shared_ptr<Mesh>> meshes(header.meshCount);
+    std::string name;
+    for (uint32_t i = 0; i < header.meshCount; ++i) {
+        const CacheMesh& record = meshRecords[i];
+        bool valid = getString(record.nameOffset, record.nameLength, name) &&
+                     fits(record.verticesOffset, record.vertexCount, sizeof(Vertex)) &&
+                     fits(record.indicesOffset, record.indexCount, sizeof(uint32_t)) &&
+                     record.vertexCount > 0 && record.indexCount % 3 == 0;
+        if (record.bvhNodeCount > 0) {
+            valid = valid && fits(record.bvhNodesOffset, record.bvhNodeCount, sizeof(MeshBVH::Node)) &&
+                    fits(record.bvhBlocksOffset, record.bvhBlockCount, sizeof(Triangle4)) &&
+                    fits(record.bvhIndicesOffset, static_cast<uint64_t>(record.bvhBlockCount) * 4, sizeof(uint32_t));
+        }
+        if (!valid) {
+            std::cerr << "[WARNING] Ignoring corrupt mesh cache '" << cachePath << "'" << std::endl;
+            return false;
+        }
+
+        const auto* vertices = reinterpret_cast<const Vertex*>(data + record.verticesOffset);
+        const auto* indices = reinterpret_cast<const uint32_t*>(data + record.indicesOffset);
+        uint32_t maxIndex = 0;
+        for (uint32_t j = 0; j < record.indexCount; ++j) {
+            maxIndex = std::max(maxIndex, indices[j]);
+        }
+        if (maxIndex >= record.vertexCount) {
+            std::cerr << "[WARNING] Ignoring corrupt mesh cache '" << cachePath << "'" << std::endl;
+            return false;
+        }
+
+        auto mesh = std::make_shared<Mesh>(name);
+        mesh->setVertices(std::vector<Vertex>(vertices, vertices + record.vertexCount));
+        mesh->setIndices(std::vector<uint32_t>(indices, indices + record.indexCount));
+        // A BVH for other geometry is dropped (rebuilt on demand), not trusted
+        const uint32_t triangleCount = record.indexCount / 3;
+        if (record.bvhNodeCount > 0 && record.bvhTriangleCount == triangleCount) {
+            auto tree = std::make_unique<MeshBVH>();
+            if (tree->restore(reinterpret_cast<const MeshBVH::Node*>(data + record.bvhNodesOffset),
+                              record.bvhNodeCount,
+                              reinterpret_cast<const Triangle4*>(data + record.bvhBlocksOffset),
+                              record.bvhBlockCount,
+                              reinterpret_cast<const uint32_t*>(data + record.bvhIndicesOffset),
+                              triangleCount, record.bvhDepth)) {
+                mesh->setBVH(std::move(tree));
+            }
+        }
+        mesh->load();
+        meshes[i] = std::move(mesh);
+    }
+
+    const auto* lodRecords = reinterpret_cast<const CacheLODLevel*>(data + header.lodLevelsOffset);
+    const uint32_t baseMeshCount = header.lodLevelCount > 0 ? lodRecords[0].firstMesh : header.meshCount;
+    if (baseMeshCount == 0) {
+        std::cerr << "[WARNING] Ignoring corrupt mesh cache '" << cachePath << "'" << std::endl;
+        return false;
+    }
+    std::vector<LODLevel> lods(header.lodLevelCount);
+    for (uint32_t l = 0; l < header.lodLevelCount; ++l) {
+        const CacheLODLevel& record = lodRecords[l];
+        if (record.firstMesh < baseMeshCount || record.meshCount != baseMeshCount ||
+            static_cast<uint64_t>(record.firstMesh) + record.meshCount > header.meshCount) {
+            std::cerr << "[WARNING] Ignoring corrupt mesh cache '" << cachePath << "'" << std::endl;
+            return false;
+        }
+        lods[l].meshes.assign(meshes.begin() + record.firstMesh,
+                              meshes.begin() + record.firstMesh + record.meshCount);
+        lods[l].screenSize = record.screenSize;
+        lods[l].triangleCount = static_cast<size_t>(record.triangleCount);
+    }
+
+    const auto* nodeRecords = reinterpret_cast<const CacheNode*>(data + header.nodesOffset);
+    std::vector<ModelNode> nodes(header.nodeCount);
+    for (uint32_t i = 0; i < header.nodeCount; ++i) {
+        const CacheNode& record = nodeRecords[i];
+        ModelNode& node = nodes[i];
+        if (!getString(record.nameOffset, record.nameLength, node.name) ||
+            record.parent >= static_cast<int32_t>(i) ||
+            static_cast<uint64_t>(record.firstMesh) + record.meshCount > baseMeshCount) {
+            std::cerr << "[WARNING] Ignoring corrupt mesh cache '" << cachePath << "'" << std::endl;
+            return false;
+        }
+        node.parent = record.parent < 0 ? -1 : record.parent;
+        node.firstMesh = record.firstMesh;
+        node.meshCount = record.meshCount;
+        node.transform.position = Vec3(record.position[0], record.position[1], record.position[2]);
+        node.transform.rotation = Vec3(record.rotation[0], record.rotation[1], record.rotation[2]);
+        node.transform.scale = Vec3(record.scale[0], record.scale[1], record.scale[2]);
+    }
+
+    for (uint32_t i = 0; i < baseMeshCount; ++i) {
+        outModel.addMesh(meshes[i]);
+    }
+    outModel.setLODs(lods);
+    outModel.setNodes(std::move(nodes));
+    outModel.setBounds(Vec3(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]),
+                       Vec3(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]));
+    return true;
+}
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "Model.h"
+#include "MeshOptimizer.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rs_engine {
+namespace resource {
+
+/**
+ * @brief Binary mesh cache format (.rsmesh), written by MeshCache::save()
+ *
+ * Holds a loaded model in its final in-memory form, so loading it is a
+ * memory mapping plus one bulk copy per array - no parsing and no
+ * per-vertex work:
+ *
+ *   MeshCacheHeader
+ *   CacheSource[sourceCount]      source files and their content hashes
+ *   CacheMesh[meshCount]          LOD 0 meshes, then each LOD level's meshes
+ *   CacheLODLevel[lodLevelCount]
+ *   CacheNode[nodeCount]          ModelNode hierarchy (parents first)
+ *   char[stringsSize]             names and paths (not null-terminated)
+ *   data                          Vertex / index / BVH arrays, 16-byte aligned
+ *
+ * A cache is valid only while every source file still hashes to the
+ * recorded value, and only for the vertex / BVH record layouts it was
+ * written with (their sizes are part of the header). Byte order is
+ * little-endian. Any change to the records or to what the loaders
+ * produce bumps MESH_CACHE_VERSION.
+ */
+namespace meshcache {
+
+constexpr uint32_t MESH_CACHE_MAGIC = 0x484D5352;     // "RSMH"
+constexpr uint32_t MESH_CACHE_VERSION = 1;
+constexpr uint32_t MESH_CACHE_ENDIAN_TAG = 0x01020304;
+constexpr uint32_t MESH_CACHE_ALIGNMENT = 16;         // Section / array alignment
+
+enum ContentFlags : uint32_t {
+    CONTENT_LODS = 1u << 0,   // LOD chain stored (lodSettingsHash identifies the settings)
+    CONTENT_BVH = 1u << 1,    // Picking BVHs stored for the LOD 0 meshes
+    CONTENT_SPLIT = 1u << 2,  // Meshes split into clusters that fit 16-bit indices
+    CONTENT_OPTIMIZED = 1u << 3  // Meshes reordered by MeshOptimizer
+};
+
+struct MeshCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t endianTag;
+    uint32_t vertexSize;          // sizeof(Vertex)
+    uint32_t bvhNodeSize;         // sizeof(MeshBVH::Node)
+    uint32_t bvhBlockSize;        // sizeof(Triangle4)
+    uint32_t contentFlags;        // ContentFlags
+    uint32_t sourceCount;
+    uint32_t meshCount;           // All LODs
+    uint32_t lodLevelCount;       // Excluding LOD 0
+    uint32_t nodeCount;
+    float boundsMin[3];           // Model::getBounds() of LOD 0
+    float boundsMax[3];
+    uint64_t lodSettingsHash;
+    uint64_t sourcesOffset;
+    uint64_t meshesOffset;
+    uint64_t lodLevelsOffset;
+    uint64_t nodesOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    uint64_t fileSize;
+};
+
+struct CacheSource {
+    uint64_t size;
+    uint64_t contentHash;         // MeshCache::hashBytes of the whole file
+    uint32_t pathOffset;
+    uint32_t pathLength;
+};
+
+struct CacheMesh {
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint64_t verticesOffset;
+    uint64_t indicesOffset;
+    uint32_t bvhNodeCount;        // 0 = no BVH
+    uint32_t bvhBlockCount;       // Triangle4 blocks (4 triangle indices each)
+    uint32_t bvhTriangleCount;
+    uint32_t bvhDepth;
+    uint64_t bvhNodesOffset;
+    uint64_t bvhBlocksOffset;
+    uint64_t bvhIndicesOffset;
+};
+
+struct CacheLODLevel {
+    uint32_t firstMesh;           // Into the mesh records
+    uint32_t meshCount;
+    float screenSize;
+    uint32_t reserved;
+    uint64_t triangleCount;
+};
+
+struct CacheNode {
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    int32_t parent;               // Node index or -1
+    uint32_t firstMesh;
+    uint32_t meshCount;
+    float position[3];
+    float rotation[3];            // Euler angles in radians
+    float scale[3];
+};
+
+static_assert(sizeof(MeshCacheHeader) == 136, "Mesh cache header layout changed");
+static_assert(sizeof(CacheSource) == 24, "Mesh cache source layout changed");
+static_assert(sizeof(CacheMesh) == 72, "Mesh cache mesh layout changed");
+static_assert(sizeof(CacheLODLevel) == 24, "Mesh cache LOD layout changed");
+static_assert(sizeof(CacheNode) == 56, "Mesh cache node layout changed");
+
+/**
+ * @brief Round a byte offset up to the section alignment
+ */
+inline uint64_t alignOffset(uint64_t offset) {
+    return (offset + MESH_CACHE_ALIGNMENT - 1) & ~static_cast<uint64_t>(MESH_CACHE_ALIGNMENT - 1);
+}
+
+} // namespace meshcache
+
+/**
+ * @brief What ResourceManager::loadModel() stores in (and expects from) mesh caches
+ */
+struct ModelCacheSettings {
+    bool enabled = true;            // Read / write "<source>.rsmesh" next to the source
+    bool generateLODs = false;      // Build a LOD chain with lodSettings before caching
+    LODSettings lodSettings;
+    bool buildBVH = false;          // Build picking BVHs before caching
+    bool splitLargeMeshes = false;  // Split meshes over 65536 vertices (16-bit indices) before LODs
+    bool optimizeMeshes = true;     // Weld and reorder meshes (and LODs) with MeshOptimizer
+    MeshOptimizer::Settings optimizerSettings;
+};
+
+/**
+ * @brief Reads and writes .rsmesh files (see meshcache above)
+ *
+ * Platform Support: 100% shared (on Web the cache lives in the virtual FS)
+ */
+class MeshCache {
+public:
+    /**
+     * @brief Cache file used for a source asset
+     */
+    static std::string getCachePath(const std::string& sourcePath) { return sourcePath + ".rsmesh"; }
+
+    /**
+     * @brief Fast 64-bit content hash (xxHash64 construction, several GB/s)
+     */
+    static uint64_t hashBytes(const void* data, size_t size, uint64_t seed = 0);
+
+    /**
+     * @brief Write a loaded model
+     * @param sources Files the model was built from (first = the asset itself)
+     * @return false if a source cannot be read or the cache cannot be written
+     */
+    static bool save(const std::string& cachePath, Model& model,
+                     const std::vector<std::string>& sources,
+                     const ModelCacheSettings& settings);
+
+    /**
+     * @brief Fill an empty model from a cache, if it is still valid
+     *
+     * Fails without touching the model when the file is missing, corrupt,
+     * written with other layouts, lacks content the settings ask for, or
+     * any source file changed.
+     */
+    static bool load(const std::string& cachePath, Model& outModel,
+                     const ModelCacheSettings& settings);
+};
+
+} // namespace resource
+} // namespace rs_engine
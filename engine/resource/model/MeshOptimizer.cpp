@@ -0,0 +1,373 @@
+#include "MeshOptimizer.h"
+#include "Mesh.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+uint64_t hashVertex(const Vertex& vertex) {
+    uint32_t words[sizeof(Vertex) / sizeof(uint32_t)];
+    std::memcpy(words, &vertex, sizeof(Vertex));
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (uint32_t word : words) {
+        hash = (hash ^ word) * 0x100000001B3ull;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+/**
+ * @brief Triangles using each vertex (compressed rows)
+ */
+struct VertexAdjacency {
+    std::vector<uint32_t> offsets;      // vertexCount + 1
+    std::vector<uint32_t> triangles;
+
+    void build(const std::vector<uint32_t>& indices, size_t vertexCount) {
+        offsets.assign(vertexCount + 1, 0);
+        for (uint32_t index : indices) {
+            offsets[index + 1]++;
+        }
+        for (size_t v = 0; v < vertexCount; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        triangles.resize(indices.size());
+        std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < indices.size(); ++i) {
+            triangles[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+};
+
+} // namespace
+
+// ========== Pipeline ==========
+
+bool MeshOptimizer::optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+                             const Settings& settings, Result* result) {
+    if (indices.size() < 3 || vertices.empty()) {
+        return false;
+    }
+    indices.resize(indices.size() - indices.size() % 3);
+    const uint32_t cacheSize = std::max<uint32_t>(settings.cacheSize, 3);
+
+    Result local;
+    local.sourceVertices = vertices.size();
+    local.before = analyzeVertexCache(indices, vertices.size(), cacheSize);
+
+    if (settings.weldVertices) {
+        weldVertices(vertices, indices);
+    }
+    if (settings.optimizeVertexCache || settings.optimizeOverdraw) {
+        std::vector<uint32_t> clusters;
+        optimizeVertexCache(indices, vertices.size(), cacheSize, settings.optimizeOverdraw ? &clusters : nullptr);
+        if (settings.optimizeOverdraw) {
+            optimizeOverdraw(indices, vertices, clusters, cacheSize, settings.overdrawThreshold);
+        }
+    }
+    if (settings.optimizeVertexFetch) {
+        optimizeVertexFetch(vertices, indices);
+    }
+
+    local.resultVertices = vertices.size();
+    local.after = analyzeVertexCache(indices, vertices.size(), cacheSize);
+    if (result) {
+        *result = local;
+    }
+    return true;
+}
+
+bool MeshOptimizer::optimize(Mesh& mesh, const Settings& settings, Result* result) {
+    std::vector<Vertex> vertices = mesh.getVertices();
+    std::vector<uint32_t> indices = mesh.getIndices();
+    if (!optimize(vertices, indices, settings, result)) {
+        return false;
+    }
+    mesh.setVertices(std::move(vertices));
+    mesh.setIndices(std::move(indices));
+    return true;
+}
+
+// ========== Stages ==========
+
+size_t MeshOptimizer::weldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    // Open addressing over vertex indices; the first of each identical run survives
+    size_t capacity = 16;
+    while (capacity < vertices.size() * 2) {
+        capacity <<= 1;
+    }
+    std::vector<uint32_t> table(capacity, INVALID_INDEX);
+    std::vector<uint32_t> remap(vertices.size());
+    std::vector<Vertex> welded;
+    welded.reserve(vertices.size());
+
+    for (size_t v = 0; v < vertices.size(); ++v) {
+        size_t slot = static_cast<size_t>(hashVertex(vertices[v])) & (capacity - 1);
+        while (table[slot] != INVALID_INDEX &&
+               std::memcmp(&welded[table[slot]], &vertices[v], sizeof(Vertex)) != 0) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        if (table[slot] == INVALID_INDEX) {
+            table[slot] = static_cast<uint32_t>(welded.size());
+            welded.push_back(vertices[v]);
+        }
+        remap[v] = table[slot];
+    }
+
+    const size_t removed = vertices.size() - welded.size();
+    for (uint32_t& index : indices) {
+        index = remap[index];
+    }
+    vertices = std::move(welded);
+    return removed;
+}
+
+void MeshOptimizer::optimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize,
+                                        std::vector<uint32_t>* outClusters) {
+    const size_t triangleCount = indices.size() / 3;
+    if (outClusters) {
+        outClusters->clear();
+    }
+    if (triangleCount == 0) {
+        return;
+    }
+
+    VertexAdjacency adjacency;
+    adjacency.build(indices, vertexCount);
+
+    std::vector<uint32_t> liveTriangles(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        liveTriangles[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+    }
+    std::vector<uint32_t> cacheTime(vertexCount, 0);
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    std::vector<uint32_t> deadEnd;          // Recently used vertices, to restart near the last fan
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+
+    // Timestamps: a vertex is in the cache while time - cacheTime <= cacheSize
+    uint32_t time = cacheSize + 1;
+    size_t cursor = 0;
+    while (cursor < vertexCount && liveTriangles[cursor] == 0) {
+        cursor++;
+    }
+    int64_t fan = cursor < vertexCount ? static_cast<int64_t>(cursor) : -1;
+    if (outClusters && fan >= 0) {
+        outClusters->push_back(0);
+    }
+
+    while (fan >= 0) {
+        // Emit every remaining triangle around the fan vertex
+        candidates.clear();
+        const uint32_t f = static_cast<uint32_t>(fan);
+        for (uint32_t k = adjacency.offsets[f]; k < adjacency.offsets[f + 1]; ++k) {
+            const uint32_t triangle = adjacency.triangles[k];
+            if (emitted[triangle]) continue;
+            emitted[triangle] = 1;
+            for (int corner = 0; corner < 3; ++corner) {
+                const uint32_t v = indices[triangle * 3 + corner];
+                output.push_back(v);
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                liveTriangles[v]--;
+                if (time - cacheTime[v] > cacheSize) {
+                    cacheTime[v] = time++;
+                }
+            }
+        }
+
+        // Next fan: the neighbor that will still be cached once its remaining triangles are emitted
+        int64_t best = -1;
+        int64_t bestPriority = -1;
+        for (uint32_t v : candidates) {
+            if (liveTriangles[v] == 0) continue;
+            int64_t priority = 0;
+            if (time - cacheTime[v] + 2 * liveTriangles[v] <= cacheSize) {
+                priority = time - cacheTime[v];
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                best = v;
+            }
+        }
+
+        if (best < 0) {
+            // Dead end: back up through recent vertices, then scan for any live one
+            while (!deadEnd.empty() && best < 0) {
+                const uint32_t v = deadEnd.back();
+                deadEnd.pop_back();
+                if (liveTriangles[v] > 0) {
+                    best = v;
+                }
+            }
+            while (best < 0 && cursor < vertexCount) {
+                if (liveTriangles[cursor] > 0) {
+                    best = static_cast<int64_t>(cursor);
+                } else {
+                    cursor++;
+                }
+            }
+            if (best >= 0 && outClusters) {
+                outClusters->push_back(static_cast<uint32_t>(output.size() / 3));
+            }
+        }
+        fan = best;
+    }
+
+    indices = std::move(output);
+}
+
+void MeshOptimizer::optimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices,
+                                     const std::vector<uint32_t>& clusters, uint32_t cacheSize, float threshold) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) {
+        return;
+    }
+
+    // Split the cache-ordered clusters further wherever the running ACMR of
+    // the current piece is already within threshold of the whole mesh; each
+    // piece restarts with a cold cache, so this bounds the cost of sorting
+    const float targetACMR = analyzeVertexCache(indices, vertices.size(), cacheSize).acmr * threshold;
+    std::vector<uint32_t> pieces;
+    std::vector<uint32_t> cacheTime(vertices.size(), 0);
+    uint32_t time = cacheSize + 1;
+    size_t nextCluster = 0;
+    size_t pieceStart = 0;
+    size_t pieceMisses = 0;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        const bool clusterStart = nextCluster < clusters.size() && clusters[nextCluster] == t;
+        if (t == 0 || clusterStart) {
+            nextCluster += clusterStart ? 1 : 0;
+            if (pieces.empty() || pieces.back() != t) {
+                pieces.push_back(static_cast<uint32_t>(t));
+            }
+            pieceStart = t;
+            pieceMisses = 0;
+            time += cacheSize + 1;      // Cold cache
+        }
+        for (int corner = 0; corner < 3; ++corner) {
+            const uint32_t v = indices[t * 3 + corner];
+            if (time - cacheTime[v] > cacheSize) {
+                cacheTime[v] = time++;
+                pieceMisses++;
+            }
+        }
+        const size_t pieceTriangles = t + 1 - pieceStart;
+        const bool nextIsCluster = nextCluster < clusters.size() && clusters[nextCluster] == t + 1;
+        if (t + 1 < triangleCount && !nextIsCluster &&
+            static_cast<float>(pieceMisses) <= targetACMR * static_cast<float>(pieceTriangles)) {
+            pieces.push_back(static_cast<uint32_t>(t + 1));
+            pieceStart = t + 1;
+            pieceMisses = 0;
+            time += cacheSize + 1;
+        }
+    }
+    pieces.push_back(static_cast<uint32_t>(triangleCount));
+
+    // Area-weighted centroid and normal of each piece and of the whole mesh
+    struct Piece {
+        uint32_t begin, end;
+        Vec3 centroid;
+        Vec3 normal;
+        float area;
+        float sortKey;
+    };
+    std::vector<Piece> sorted(pieces.size() - 1);
+    Vec3 meshCentroid(0, 0, 0);
+    float meshArea = 0.0f;
+    for (size_t p = 0; p + 1 < pieces.size(); ++p) {
+        Piece& piece = sorted[p];
+        piece.begin = pieces[p];
+        piece.end = pieces[p + 1];
+        piece.centroid = piece.normal = Vec3(0, 0, 0);
+        piece.area = 0.0f;
+        for (uint32_t t = piece.begin; t < piece.end; ++t) {
+            const Vec3& a = vertices[indices[t * 3]].position;
+            const Vec3& b = vertices[indices[t * 3 + 1]].position;
+            const Vec3& c = vertices[indices[t * 3 + 2]].position;
+            const Vec3 cross = (b - a).cross(c - a);
+            const float area = cross.length() * 0.5f;
+            piece.normal = piece.normal + cross;
+            piece.centroid = piece.centroid + (a + b + c) * (area / 3.0f);
+            piece.area += area;
+        }
+        meshCentroid = meshCentroid + piece.centroid;
+        meshArea += piece.area;
+        piece.centroid = piece.area > 0.0f ? piece.centroid * (1.0f / piece.area) : vertices[indices[piece.begin * 3]].position;
+    }
+    if (meshArea > 0.0f) {
+        meshCentroid = meshCentroid * (1.0f / meshArea);
+    }
+    for (Piece& piece : sorted) {
+        const float length = piece.normal.length();
+        piece.sortKey = length > 0.0f ? (piece.centroid - meshCentroid).dot(piece.normal) / length : 0.0f;
+    }
+
+    // Outward-facing (likely occluding) pieces first
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const Piece& a, const Piece& b) { return a.sortKey > b.sortKey; });
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+    for (const Piece& piece : sorted) {
+        output.insert(output.end(), indices.begin() + piece.begin * 3, indices.begin() + piece.end * 3);
+    }
+    indices = std::move(output);
+}
+
+size_t MeshOptimizer::optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    std::vector<uint32_t> remap(vertices.size(), INVALID_INDEX);
+    std::vector<Vertex> ordered;
+    ordered.reserve(vertices.size());
+    for (uint32_t& index : indices) {
+        if (remap[index] == INVALID_INDEX) {
+            remap[index] = static_cast<uint32_t>(ordered.size());
+            ordered.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+    vertices = std::move(ordered);
+    return vertices.size();
+}
+
+// ========== Analysis ==========
+
+VertexCacheStats MeshOptimizer::analyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount,
+                                                   uint32_t cacheSize) {
+    VertexCacheStats stats;
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) {
+        return stats;
+    }
+
+    // FIFO: a vertex is cached while fewer than cacheSize misses happened since it entered
+    std::vector<uint64_t> entered(vertexCount, 0);
+    std::vector<uint8_t> used(vertexCount, 0);
+    uint64_t misses = 0;
+    size_t usedVertices = 0;
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        const uint32_t v = indices[i];
+        if (!used[v]) {
+            used[v] = 1;
+            usedVertices++;
+        }
+        if (entered[v] == 0 || misses - entered[v] >= cacheSize) {
+            misses++;
+            entered[v] = misses;
+        }
+    }
+
+    stats.vertexTransforms = static_cast<size_t>(misses);
+    stats.acmr = static_cast<float>(misses) / static_cast<float>(triangleCount);
+    stats.atvr = static_cast<float>(misses) / static_cast<float>(std::max<size_t>(usedVertices, 1));
+    return stats;
+}
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rs_engine {
+namespace resource {
+
+struct Vertex;
+class Mesh;
+
+/**
+ * @brief Post-transform vertex cache statistics of an index buffer (FIFO model)
+ */
+struct VertexCacheStats {
+    float acmr = 0.0f;              // Average cache miss ratio: transformed vertices per triangle (0.5 - 3)
+    float atvr = 0.0f;              // Average transform to vertex ratio: 1.0 = every vertex shaded once
+    size_t vertexTransforms = 0;    // Cache misses
+};
+
+/**
+ * @brief Reorders meshes for the GPU: weld, vertex cache, overdraw, vertex fetch
+ *
+ * - Weld: merges bit-identical vertices (loaders emit one per face corner)
+ * - Vertex cache: Tipsify (Sander, Nehab, Barczak 2007), linear time,
+ *   tuned for a cacheSize-entry post-transform cache
+ * - Overdraw (optional): splits the Tipsify order into clusters where the
+ *   cache cost allows, then draws outward-facing clusters first, using the
+ *   view-independent key dot(cluster centroid - mesh centroid, cluster normal)
+ * - Vertex fetch: renumbers vertices in first-use order, dropping unused ones
+ *
+ * Only orders change (and duplicates disappear); every triangle and every
+ * attribute is kept, so results are interchangeable with the input.
+ *
+ * Platform Support: 100% shared
+ */
+class MeshOptimizer {
+public:
+    struct Settings {
+        bool weldVertices = true;
+        bool optimizeVertexCache = true;
+        bool optimizeOverdraw = false;
+        float overdrawThreshold = 1.05f;    // Allowed ACMR growth for overdraw clusters (1.0 = none)
+        bool optimizeVertexFetch = true;
+        uint32_t cacheSize = 16;            // Post-transform cache entries (optimization and statistics)
+    };
+
+    struct Result {
+        size_t sourceVertices = 0;
+        size_t resultVertices = 0;
+        VertexCacheStats before;
+        VertexCacheStats after;
+    };
+
+    /**
+     * @brief Run the enabled stages in order on indexed triangle data
+     * @return false if the input has no triangles (data left untouched)
+     */
+    static bool optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+                         const Settings& settings, Result* result = nullptr);
+
+    /**
+     * @brief Optimize a mesh in place (drops its BVH and GPU buffers)
+     */
+    static bool optimize(Mesh& mesh, const Settings& settings, Result* result = nullptr);
+
+    // ========== Stages ==========
+
+    /**
+     * @brief Merge bit-identical vertices
+     * @return Vertices removed
+     */
+    static size_t weldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    /**
+     * @brief Reorder triangles for the post-transform vertex cache (Tipsify)
+     * @param outClusters Optional: first triangle of each cluster (dead-end restarts), for overdraw
+     */
+    static void optimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize,
+                                    std::vector<uint32_t>* outClusters = nullptr);
+
+    /**
+     * @brief Sort cache-friendly clusters so outward-facing ones draw first
+     * @param clusters First triangle of each cluster from optimizeVertexCache
+     * @param threshold Clusters are split further while their ACMR stays within threshold * mesh ACMR
+     */
+    static void optimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices,
+                                 const std::vector<uint32_t>& clusters, uint32_t cacheSize, float threshold);
+
+    /**
+     * @brief Renumber vertices in first-use order and drop unreferenced ones
+     * @return Vertices remaining
+     */
+    static size_t optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    // ========== Analysis ==========
+
+    /**
+     * @brief Simulate a FIFO post-transform cache over the index buffer
+     */
+    static VertexCacheStats analyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount,
+                                               uint32_t cacheSize = 16);
+};
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,338 @@
+#include "MeshSimplifier.h"
+#include "Mesh.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <queue>
+#include <unordered_map>
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+/**
+ * @brief Symmetric 4x4 quadric (sum of squared plane distances) plus accumulated area
+ */
+struct Quadric {
+    // xx, xy, xz, xw, yy, yz, yw, zz, zw, ww
+    double q[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    double weight = 0.0;
+
+    static Quadric fromPlane(double a, double b, double c, double d, double w) {
+        Quadric result;
+        result.q[0] = a * a * w; result.q[1] = a * b * w; result.q[2] = a * c * w; result.q[3] = a * d * w;
+        result.q[4] = b * b * w; result.q[5] = b * c * w; result.q[6] = b * d * w;
+        result.q[7] = c * c * w; result.q[8] = c * d * w;
+        result.q[9] = d * d * w;
+        result.weight = w;
+        return result;
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        for (int i = 0; i < 10; ++i) q[i] += other.q[i];
+        weight += other.weight;
+        return *this;
+    }
+
+    /**
+     * @brief Area-weighted mean squared distance of a point to the accumulated planes
+     */
+    double evaluate(const Vec3& p) const {
+        double x = p.x, y = p.y, z = p.z;
+        double value = q[0] * x * x + 2.0 * q[1] * x * y + 2.0 * q[2] * x * z + 2.0 * q[3] * x
+                     + q[4] * y * y + 2.0 * q[5] * y * z + 2.0 * q[6] * y
+                     + q[7] * z * z + 2.0 * q[8] * z
+                     + q[9];
+        return std::max(value, 0.0) / std::max(weight, 1e-30);
+    }
+};
+
+struct Collapse {
+    double cost;
+    uint32_t from;          // Vertex removed
+    uint32_t to;            // Vertex kept (position of the result)
+    uint32_t fromVersion;
+    uint32_t toVersion;
+
+    bool operator>(const Collapse& other) const { return cost > other.cost; }
+};
+
+inline uint64_t edgeKey(uint32_t a, uint32_t b) {
+    return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+}
+
+/**
+ * @brief Key for exact vertex deduplication (all attributes compared bitwise)
+ */
+struct VertexKey {
+    float data[12];
+
+    bool operator==(const VertexKey& other) const {
+        return std::memcmp(data, other.data, sizeof(data)) == 0;
+    }
+};
+
+struct VertexKeyHash {
+    size_t operator()(const VertexKey& key) const {
+        uint32_t bits[12];
+        std::memcpy(bits, key.data, sizeof(bits));
+        size_t hash = 2166136261u;
+        for (uint32_t b : bits) {
+            hash = (hash ^ b) * 16777619u;
+        }
+        return hash;
+    }
+};
+
+} // namespace
+
+bool MeshSimplifier::simplify(const std::vector<Vertex>& vertices,
+                              const std::vector<uint32_t>& indices,
+                              const Settings& settings,
+                              std::vector<Vertex>& outVertices,
+                              std::vector<uint32_t>& outIndices,
+                              Result* result) {
+    outVertices.clear();
+    outIndices.clear();
+
+    const size_t sourceTriangles = indices.size() / 3;
+    if (sourceTriangles == 0 || vertices.empty()) {
+        return false;
+    }
+
+    // ========== Weld exact duplicates ==========
+
+    std::vector<uint32_t> remap(vertices.size());
+    std::vector<uint32_t> representative;  // Welded vertex -> source vertex
+    {
+        std::unordered_map<VertexKey, uint32_t, VertexKeyHash> unique;
+        unique.reserve(vertices.size());
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            const Vertex& v = vertices[i];
+            VertexKey key = {{v.position.x, v.position.y, v.position.z,
+                              v.normal.x, v.normal.y, v.normal.z,
+                              v.texCoord.x, v.texCoord.y, v.texCoord.z,
+                              v.color.x, v.color.y, v.color.z}};
+            auto [it, inserted] = unique.emplace(key, static_cast<uint32_t>(representative.size()));
+            if (inserted) {
+                representative.push_back(static_cast<uint32_t>(i));
+            }
+            remap[i] = it->second;
+        }
+    }
+
+    const size_t vertexCount = representative.size();
+    auto position = [&](uint32_t v) -> const Vec3& { return vertices[representative[v]].position; };
+
+    std::vector<uint32_t> triangles;
+    triangles.reserve(sourceTriangles * 3);
+    for (size_t t = 0; t < sourceTriangles; ++t) {
+        uint32_t a = remap[indices[t * 3]];
+        uint32_t b = remap[indices[t * 3 + 1]];
+        uint32_t c = remap[indices[t * 3 + 2]];
+        if (a == b || b == c || a == c) continue;
+        triangles.push_back(a);
+        triangles.push_back(b);
+        triangles.push_back(c);
+    }
+    const size_t triangleCount = triangles.size() / 3;
+
+    // ========== Quadrics, borders and adjacency ==========
+
+    Vec3 boundsMin = position(0), boundsMax = position(0);
+    for (uint32_t v = 1; v < vertexCount; ++v) {
+        const Vec3& p = position(v);
+        boundsMin = Vec3(std::min(boundsMin.x, p.x), std::min(boundsMin.y, p.y), std::min(boundsMin.z, p.z));
+        boundsMax = Vec3(std::max(boundsMax.x, p.x), std::max(boundsMax.y, p.y), std::max(boundsMax.z, p.z));
+    }
+    const double radius = std::max(0.5 * (boundsMax - boundsMin).length(), 1e-12);
+    const double maxCost = static_cast<double>(settings.maxError) * settings.maxError * radius * radius;
+
+    std::vector<Quadric> quadrics(vertexCount);
+    std::vector<std::vector<uint32_t>> vertexTriangles(vertexCount);
+    std::unordered_map<uint64_t, uint32_t> edgeUse;
+    edgeUse.reserve(triangleCount * 3);
+
+    for (size_t t = 0; t < triangleCount; ++t) {
+        const uint32_t* tri = &triangles[t * 3];
+        Vec3 normal = (position(tri[1]) - position(tri[0])).cross(position(tri[2]) - position(tri[0]));
+        double area2 = normal.length();
+        if (area2 > 0.0) {
+            double nx = normal.x / area2, ny = normal.y / area2, nz = normal.z / area2;
+            const Vec3& p0 = position(tri[0]);
+            double d = -(nx * p0.x + ny * p0.y + nz * p0.z);
+            Quadric plane = Quadric::fromPlane(nx, ny, nz, d, area2 * 0.5);
+            for (int k = 0; k < 3; ++k) quadrics[tri[k]] += plane;
+        }
+        for (int k = 0; k < 3; ++k) {
+            vertexTriangles[tri[k]].push_back(static_cast<uint32_t>(t));
+            ++edgeUse[edgeKey(tri[k], tri[(k + 1) % 3])];
+        }
+    }
+
+    // Edges used by exactly one triangle are borders (open edges and attribute seams);
+    // non-manifold edges are treated the same way
+    std::vector<uint8_t> locked(vertexCount, 0);
+    if (settings.lockBorders) {
+        for (const auto& [key, count] : edgeUse) {
+            if (count != 2) {
+                locked[static_cast<uint32_t>(key >> 32)] = 1;
+                locked[static_cast<uint32_t>(key & 0xFFFFFFFFu)] = 1;
+            }
+        }
+    }
+
+    // ========== Collapse queue ==========
+
+    std::vector<uint32_t> versions(vertexCount, 0);
+    std::vector<uint8_t> removed(vertexCount, 0);
+    std::vector<uint8_t> triangleAlive(triangleCount, 1);
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> queue;
+
+    auto pushEdge = [&](uint32_t a, uint32_t b) {
+        Quadric combined = quadrics[a];
+        combined += quadrics[b];
+        // Collapse onto an endpoint; only unlocked vertices may move
+        if (!locked[a]) {
+            queue.push({combined.evaluate(position(b)), a, b, versions[a], versions[b]});
+        }
+        if (!locked[b]) {
+            queue.push({combined.evaluate(position(a)), b, a, versions[b], versions[a]});
+        }
+    };
+
+    for (const auto& [key, count] : edgeUse) {
+        pushEdge(static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key & 0xFFFFFFFFu));
+    }
+    edgeUse.clear();
+
+    size_t targetTriangles = static_cast<size_t>(std::ceil(sourceTriangles * settings.targetRatio));
+    targetTriangles = std::max(targetTriangles, settings.minTriangles);
+    size_t aliveTriangles = triangleCount;
+    double acceptedCost = 0.0;
+
+    auto triangleNormal = [&](const uint32_t* tri, uint32_t replace, const Vec3& with) {
+        Vec3 p[3];
+        for (int k = 0; k < 3; ++k) p[k] = tri[k] == replace ? with : position(tri[k]);
+        return (p[1] - p[0]).cross(p[2] - p[0]);
+    };
+
+    std::vector<uint32_t> neighbours;
+    while (aliveTriangles > targetTriangles && !queue.empty()) {
+        Collapse collapse = queue.top();
+        queue.pop();
+
+        uint32_t from = collapse.from, to = collapse.to;
+        if (removed[from] || removed[to] ||
+            versions[from] != collapse.fromVersion || versions[to] != collapse.toVersion) {
+            continue;  // Stale entry
+        }
+        if (collapse.cost > maxCost) {
+            break;
+        }
+
+        // Reject collapses that flip a surviving triangle
+        const Vec3& target = position(to);
+        bool flips = false;
+        for (uint32_t t : vertexTriangles[from]) {
+            if (!triangleAlive[t]) continue;
+            const uint32_t* tri = &triangles[t * 3];
+            if (tri[0] == to || tri[1] == to || tri[2] == to) continue;
+
+            Vec3 before = triangleNormal(tri, from, position(from));
+            Vec3 after = triangleNormal(tri, from, target);
+            if (before.dot(after) <= 0.0f) {
+                flips = true;
+                break;
+            }
+        }
+        if (flips) continue;
+
+        // Apply: triangles on the edge disappear, the rest are re-pointed to 'to'
+        for (uint32_t t : vertexTriangles[from]) {
+            if (!triangleAlive[t]) continue;
+            uint32_t* tri = &triangles[t * 3];
+            if (tri[0] == to || tri[1] == to || tri[2] == to) {
+                triangleAlive[t] = 0;
+                --aliveTriangles;
+                continue;
+            }
+            for (int k = 0; k < 3; ++k) {
+                if (tri[k] == from) tri[k] = to;
+            }
+            vertexTriangles[to].push_back(t);
+        }
+        vertexTriangles[from].clear();
+        vertexTriangles[from].shrink_to_fit();
+
+        removed[from] = 1;
+        quadrics[to] += quadrics[from];
+        ++versions[to];
+        acceptedCost = std::max(acceptedCost, collapse.cost);
+
+        // Compact the survivor's triangle list and queue its edges with the new quadric
+        auto& toTriangles = vertexTriangles[to];
+        toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(),
+                                         [&](uint32_t t) { return !triangleAlive[t]; }),
+                          toTriangles.end());
+
+        neighbours.clear();
+        for (uint32_t t : toTriangles) {
+            const uint32_t* tri = &triangles[t * 3];
+            for (int k = 0; k < 3; ++k) {
+                if (tri[k] != to) neighbours.push_back(tri[k]);
+            }
+        }
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        for (uint32_t n : neighbours) {
+            pushEdge(to, n);
+        }
+    }
+
+    // ========== Output ==========
+
+    std::vector<uint32_t> outputIndex(vertexCount, UINT32_MAX);
+    outIndices.reserve(aliveTriangles * 3);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        if (!triangleAlive[t]) continue;
+        for (int k = 0; k < 3; ++k) {
+            uint32_t v = triangles[t * 3 + k];
+            if (outputIndex[v] == UINT32_MAX) {
+                outputIndex[v] = static_cast<uint32_t>(outVertices.size());
+                outVertices.push_back(vertices[representative[v]]);
+            }
+            outIndices.push_back(outputIndex[v]);
+        }
+    }
+
+    if (result) {
+        result->sourceTriangles = sourceTriangles;
+        result->resultTriangles = outIndices.size() / 3;
+        result->error = static_cast<float>(std::sqrt(acceptedCost) / radius);
+    }
+    return !outIndices.empty();
+}
+
+std::shared_ptr<Mesh> MeshSimplifier::simplify(const Mesh& mesh,
+                                               const Settings& settings,
+                                               const std::string& name,
+                                               Result* result) {
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    if (!simplify(mesh.getVertices(), mesh.getIndices(), settings, vertices, indices, result)) {
+        std::cerr << "[ERROR] Failed to simplify mesh '" << mesh.getName() << "'" << std::endl;
+        return nullptr;
+    }
+
+    auto simplified = std::make_shared<Mesh>(name);
+    simplified->setVertices(vertices);
+    simplified->setIndices(indices);
+    simplified->load();
+    return simplified;
+}
+
+} // namespace resource
+} // namespace rs_engine
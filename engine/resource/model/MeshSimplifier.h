@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rs_engine {
+namespace resource {
+
+struct Vertex;
+class Mesh;
+
+/**
+ * @brief Quadric error metric (Garland-Heckbert) mesh simplifier
+ *
+ * Repeatedly collapses the edge whose collapse adds the least squared
+ * distance to the original surface, until the triangle target or the
+ * error limit is reached. Vertices collapse onto one of the edge's
+ * endpoints, so every output vertex is an input vertex and all
+ * attributes (normal, UV, color) stay valid.
+ *
+ * Attribute seams (same position, different normal/UV) appear as
+ * borders in the index topology; borders are locked by default so
+ * seams and open edges never crack.
+ *
+ * Platform Support: 100% shared
+ */
+class MeshSimplifier {
+public:
+    struct Settings {
+        float targetRatio = 0.5f;       // Fraction of triangles to keep
+        size_t minTriangles = 8;        // Never go below this many triangles
+        float maxError = 0.05f;         // Stop once a collapse errs more than this (fraction of bounding radius)
+        bool lockBorders = true;        // Keep border / seam vertices fixed
+    };
+
+    struct Result {
+        size_t sourceTriangles = 0;
+        size_t resultTriangles = 0;
+        float error = 0.0f;             // Largest accepted collapse error (relative)
+    };
+
+    /**
+     * @brief Simplify indexed triangle data
+     * @param outVertices Output: referenced vertices only (compacted)
+     * @param outIndices Output: triangle list
+     * @return false if the input has no triangles
+     */
+    static bool simplify(const std::vector<Vertex>& vertices,
+                         const std::vector<uint32_t>& indices,
+                         const Settings& settings,
+                         std::vector<Vertex>& outVertices,
+                         std::vector<uint32_t>& outIndices,
+                         Result* result = nullptr);
+
+    /**
+     * @brief Simplify a mesh into a new mesh resource
+     * @return New mesh, or nullptr on failure
+     */
+    static std::shared_ptr<Mesh> simplify(const Mesh& mesh,
+                                          const Settings& settings,
+                                          const std::string& name,
+                                          Result* result = nullptr);
+};
+
+} // namespace resource
+} // namespace rs_engine
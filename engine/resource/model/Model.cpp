@@ -1,4 +1,6 @@
 #include "Model.h"
+#include "MeshSimplifier.h"
+#include <iostream>
 #include <algorithm>
 #include <limits>
 
@@ -42,7 +44,9 @@ bool Model::load() {
     if (allLoaded) {
         metadata.state = ResourceState::Loaded;
         metadata.memorySize = totalMemory;
-        calculateBounds();
+        if (boundsDirty) {
+            calculateBounds();
+        }
         return true;
     }
     
@@ -51,13 +55,9 @@ bool Model::load() {
 }
 
 void Model::unload() {
-    releaseGPUResources();
-    
-    for (auto& mesh : meshes) {
-        mesh->unload();
-    }
-    
+    // Other models (or the ResourceManager) may still draw these meshes
     meshes.clear();
+    lodLevels.clear();
     metadata.state = ResourceState::Unloaded;
     metadata.memorySize = 0;
 }
@@ -78,6 +78,7 @@ void Model::removeMesh(size_t index) {
 
 void Model::clearMeshes() {
     meshes.clear();
+    lodLevels.clear();
     boundsDirty = true;
 }
 
@@ -117,6 +118,12 @@ void Model::calculateBounds() {
     boundsDirty = false;
 }
 
+void Model::setBounds(const Vec3& min, const Vec3& max) {
+    boundingMin = min;
+    boundingMax = max;
+    boundsDirty = false;
+}
+
 void Model::getBounds(Vec3& min, Vec3& max) {
     if (boundsDirty) {
         calculateBounds();
@@ -126,26 +133,289 @@ void Model::getBounds(Vec3& min, Vec3& max) {
     max = boundingMax;
 }
 
-bool Model::createGPUResources(wgpu::Device device) {
-    if (!device) {
+bool Model::createGPUResources(MeshBufferPool& pool) {
+    if (!pool.isInitialized()) {
         return false;
     }
     
     bool allCreated = true;
     
     for (auto& mesh : meshes) {
-        if (!mesh->createGPUResources(device)) {
+        if (!mesh->createGPUResources(pool)) {
             allCreated = false;
         }
     }
     
+    for (auto& level : lodLevels) {
+        for (auto& mesh : level.meshes) {
+            if (!mesh->hasGPUResources() && !mesh->createGPUResources(pool)) {
+                allCreated = false;
+            }
+        }
+    }
+    
     return allCreated;
 }
 
+void Model::setVertexLayout(const VertexLayout& layout) {
+    VertexLayout shared = layout;
+    if (shared.hasQuantizedPositions() && !shared.hasQuantizationBox) {
+        // One box over every mesh and LOD, so one dequantization serves all draws
+        bool first = true;
+        Vec3 min, max;
+        auto include = [&](const Mesh& mesh) {
+            Vec3 meshMin, meshExtent;
+            if (mesh.getVertexCount() == 0) return;
+            VertexPacker::computeQuantizationBox(mesh.getVertices().data(), mesh.getVertexCount(), meshMin, meshExtent);
+            Vec3 meshMax = meshMin + meshExtent;
+            min = first ? meshMin : Vec3(std::min(min.x, meshMin.x), std::min(min.y, meshMin.y), std::min(min.z, meshMin.z));
+            max = first ? meshMax : Vec3(std::max(max.x, meshMax.x), std::max(max.y, meshMax.y), std::max(max.z, meshMax.z));
+            first = false;
+        };
+        for (const auto& mesh : meshes) {
+            include(*mesh);
+        }
+        for (const auto& level : lodLevels) {
+            for (const auto& mesh : level.meshes) {
+                include(*mesh);
+            }
+        }
+        shared.quantizationMin = min;
+        shared.quantizationExtent = max - min;
+        shared.hasQuantizationBox = !first;
+    }
+    
+    for (auto& mesh : meshes) {
+        mesh->setVertexLayout(shared);
+    }
+    for (auto& level : lodLevels) {
+        for (auto& mesh : level.meshes) {
+            mesh->setVertexLayout(shared);
+        }
+    }
+}
+
+Mat4 Model::getPositionDequantization() const {
+    return meshes.empty() ? Mat4() : meshes[0]->getVertexLayout().getPositionDequantization();
+}
+
+std::vector<const Mesh*> Model::getUniqueMeshes() const {
+    std::vector<const Mesh*> unique;
+    for (const auto& mesh : meshes) {
+        unique.push_back(mesh.get());
+    }
+    for (const auto& level : lodLevels) {
+        for (size_t i = 0; i < level.meshes.size(); ++i) {
+            // A level that could not be reduced shares the LOD 0 mesh
+            if (i >= meshes.size() || level.meshes[i] != meshes[i]) {
+                unique.push_back(level.meshes[i].get());
+            }
+        }
+    }
+    return unique;
+}
+
+size_t Model::getGPUMemorySize() const {
+    size_t size = 0;
+    for (const Mesh* mesh : getUniqueMeshes()) {
+        size += mesh->hasGPUResources() ? mesh->getGPUMemorySize() : 0;
+    }
+    return size;
+}
+
+size_t Model::getUnpackedGPUMemorySize() const {
+    size_t size = 0;
+    for (const Mesh* mesh : getUniqueMeshes()) {
+        size += mesh->hasGPUResources() ? mesh->getUnpackedGPUMemorySize() : 0;
+    }
+    return size;
+}
+
 void Model::releaseGPUResources() {
     for (auto& mesh : meshes) {
         mesh->releaseGPUResources();
     }
+    
+    for (auto& level : lodLevels) {
+        for (auto& mesh : level.meshes) {
+            mesh->releaseGPUResources();
+        }
+    }
+}
+
+size_t Model::splitLargeMeshes(size_t maxVertices) {
+    std::vector<std::shared_ptr<Mesh>> splitMeshes;
+    std::vector<uint32_t> firstSplitMesh;   // Source mesh -> first cluster, plus end
+    size_t splitCount = 0;
+    for (const auto& mesh : meshes) {
+        firstSplitMesh.push_back(static_cast<uint32_t>(splitMeshes.size()));
+        auto clusters = Mesh::splitByVertexCount(mesh, maxVertices);
+        if (clusters.size() > 1) {
+            std::cout << "[INFO] Split mesh '" << mesh->getName() << "' (" << mesh->getVertexCount()
+                      << " vertices) into " << clusters.size() << " clusters" << std::endl;
+            splitCount++;
+        }
+        splitMeshes.insert(splitMeshes.end(), clusters.begin(), clusters.end());
+    }
+    firstSplitMesh.push_back(static_cast<uint32_t>(splitMeshes.size()));
+    if (splitCount == 0) {
+        return 0;
+    }
+    
+    // Node mesh ranges follow their meshes; LOD meshes would no longer be parallel
+    for (ModelNode& node : nodes) {
+        uint32_t end = std::min<uint32_t>(node.firstMesh + node.meshCount, static_cast<uint32_t>(meshes.size()));
+        uint32_t first = std::min<uint32_t>(node.firstMesh, end);
+        node.firstMesh = firstSplitMesh[first];
+        node.meshCount = firstSplitMesh[end] - firstSplitMesh[first];
+    }
+    if (!lodLevels.empty()) {
+        std::cout << "[WARNING] Dropped the LOD levels of '" << getName() << "' after splitting its meshes" << std::endl;
+        lodLevels.clear();
+    }
+    
+    meshes = std::move(splitMeshes);
+    boundsDirty = true;
+    return splitCount;
+}
+
+size_t Model::optimizeMeshes(const MeshOptimizer::Settings& settings, bool includeBaseMeshes) {
+    std::vector<Mesh*> targets;
+    if (includeBaseMeshes) {
+        for (const auto& mesh : meshes) {
+            targets.push_back(mesh.get());
+        }
+    }
+    for (const auto& level : lodLevels) {
+        for (size_t i = 0; i < level.meshes.size(); ++i) {
+            if (i >= meshes.size() || level.meshes[i] != meshes[i]) {
+                targets.push_back(level.meshes[i].get());
+            }
+        }
+    }
+    
+    // Totals weighted by triangles / vertices, so the summary reads like one mesh
+    size_t optimized = 0, triangles = 0, sourceVertices = 0, resultVertices = 0;
+    size_t transformsBefore = 0, transformsAfter = 0;
+    for (Mesh* mesh : targets) {
+        MeshOptimizer::Result result;
+        if (!MeshOptimizer::optimize(*mesh, settings, &result)) {
+            continue;
+        }
+        optimized++;
+        triangles += mesh->getIndexCount() / 3;
+        sourceVertices += result.sourceVertices;
+        resultVertices += result.resultVertices;
+        transformsBefore += result.before.vertexTransforms;
+        transformsAfter += result.after.vertexTransforms;
+    }
+    
+    if (optimized > 0 && triangles > 0) {
+        std::cout << "[INFO] Optimized " << optimized << (includeBaseMeshes ? " meshes" : " LOD meshes")
+                  << " of '" << getName() << "': ACMR " << static_cast<double>(transformsBefore) / triangles
+                  << " -> " << static_cast<double>(transformsAfter) / triangles
+                  << ", ATVR " << static_cast<double>(transformsBefore) / std::max<size_t>(sourceVertices, 1)
+                  << " -> " << static_cast<double>(transformsAfter) / std::max<size_t>(resultVertices, 1)
+                  << ", vertices " << sourceVertices << " -> " << resultVertices << std::endl;
+    }
+    boundsDirty = true;
+    return optimized;
+}
+
+// ========== Level of Detail ==========
+
+std::vector<LODLevel> Model::buildLODChain(const std::vector<std::shared_ptr<Mesh>>& baseMeshes,
+                                                  const LODSettings& settings) {
+    std::vector<LODLevel> levels;
+    
+    size_t previousTriangles = 0;
+    for (const auto& mesh : baseMeshes) {
+        previousTriangles += mesh ? mesh->getIndexCount() / 3 : 0;
+    }
+    
+    float ratio = 1.0f;
+    float screenSize = settings.firstScreenSize;
+    for (uint32_t level = 1; level <= settings.maxLevels; ++level) {
+        ratio *= settings.reductionPerLevel;
+        
+        // Always simplify from LOD 0 so errors do not compound across levels
+        LODLevel lod;
+        lod.screenSize = screenSize;
+        for (const auto& mesh : baseMeshes) {
+            if (!mesh) continue;
+            
+            MeshSimplifier::Settings simplifierSettings;
+            simplifierSettings.targetRatio = ratio;
+            simplifierSettings.maxError = settings.maxError;
+            simplifierSettings.minTriangles = settings.minTriangles;
+            
+            auto simplified = MeshSimplifier::simplify(
+                *mesh, simplifierSettings, mesh->getName() + "_LOD" + std::to_string(level));
+            if (!simplified) {
+                simplified = mesh;  // Keep meshes parallel to LOD 0
+            } else {
+                simplified->setVertexLayout(mesh->getVertexLayout());  // Same encoding and box
+            }
+            lod.triangleCount += simplified->getIndexCount() / 3;
+            lod.meshes.push_back(std::move(simplified));
+        }
+        
+        if (lod.triangleCount * 4 > previousTriangles * 3 || lod.triangleCount < settings.minTriangles) {
+            break;  // Not worth another level
+        }
+        
+        previousTriangles = lod.triangleCount;
+        levels.push_back(std::move(lod));
+        screenSize *= settings.screenSizeFalloff;
+    }
+    
+    return levels;
+}
+
+size_t Model::generateLODs(const LODSettings& settings) {
+    lodLevels = buildLODChain(meshes, settings);
+    
+    std::cout << "[INFO] Generated " << lodLevels.size() << " LOD levels for '"
+              << getName() << "' (" << getLODTriangleCount(0) << " triangles";
+    for (const auto& level : lodLevels) {
+        std::cout << " -> " << level.triangleCount;
+    }
+    std::cout << ")" << std::endl;
+    
+    return lodLevels.size();
+}
+
+const std::vector<std::shared_ptr<Mesh>>& Model::getLODMeshes(size_t lod) const {
+    if (lod == 0 || lod > lodLevels.size()) {
+        return meshes;
+    }
+    return lodLevels[lod - 1].meshes;
+}
+
+size_t Model::getLODTriangleCount(size_t lod) const {
+    if (lod > 0 && lod <= lodLevels.size()) {
+        return lodLevels[lod - 1].triangleCount;
+    }
+    
+    size_t triangles = 0;
+    for (const auto& mesh : meshes) {
+        triangles += mesh ? mesh->getIndexCount() / 3 : 0;
+    }
+    return triangles;
+}
+
+uint32_t Model::selectLOD(float screenSize, uint32_t currentLOD, float hysteresis) const {
+    uint32_t lod = std::min<uint32_t>(currentLOD, static_cast<uint32_t>(lodLevels.size()));
+    
+    // Coarser: the object must shrink clearly below the next level's threshold
+    while (lod < lodLevels.size() && screenSize < lodLevels[lod].screenSize * (1.0f - hysteresis)) {
+        ++lod;
+    }
+    // Finer: it must grow clearly above the current level's threshold
+    while (lod > 0 && screenSize > lodLevels[lod - 1].screenSize * (1.0f + hysteresis)) {
+        --lod;
+    }
+    return lod;
 }
 
 } // namespace resource
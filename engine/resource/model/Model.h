@@ -2,10 +2,12 @@
 
 #include "../ResourceTypes.h"
 #include "Mesh.h"
+#include "MeshOptimizer.h"
 #include "../../core/math/Vec3.h"
 #include <vector>
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace rs_engine {
 namespace resource {
@@ -15,7 +17,7 @@ namespace resource {
  */
 struct Transform {
     Vec3 position = Vec3(0, 0, 0);
-    Vec3 rotation = Vec3(0, 0, 0);  // Euler angles in radians
+    Vec3 rotation = Vec3(0, 0, 0);  // Euler angles in radians (applied Z, then X, then Y)
     Vec3 scale = Vec3(1, 1, 1);
     
     Transform() = default;
@@ -23,6 +25,40 @@ struct Transform {
         : position(pos), rotation(rot), scale(scl) {}
 };
 
+/**
+ * @brief One reduced-detail level (LOD 1..N; LOD 0 is the model's meshes)
+ */
+struct LODLevel {
+    std::vector<std::shared_ptr<Mesh>> meshes;  // Parallel to the LOD 0 meshes
+    float screenSize = 0.0f;                    // Used below this projected size
+    size_t triangleCount = 0;
+};
+
+/**
+ * @brief Node of a model's own hierarchy (e.g. glTF nodes)
+ * 
+ * Scene::instantiateModel() turns each node into a SceneObject.
+ */
+struct ModelNode {
+    std::string name;
+    int32_t parent = -1;        // Index into the model's nodes (parents precede children)
+    Transform transform;        // Relative to the parent
+    uint32_t firstMesh = 0;     // Model meshes drawn by this node: [firstMesh, firstMesh + meshCount)
+    uint32_t meshCount = 0;
+};
+
+/**
+ * @brief LOD chain generation parameters
+ */
+struct LODSettings {
+    uint32_t maxLevels = 4;              // Reduced levels to generate (LOD 1..maxLevels)
+    float reductionPerLevel = 0.5f;      // Triangle ratio of each level vs. the previous one
+    float firstScreenSize = 0.5f;        // LOD 1 below this fraction of screen height
+    float screenSizeFalloff = 0.5f;      // Each further level halves the threshold
+    float maxError = 0.05f;              // Simplifier error limit (fraction of mesh radius)
+    size_t minTriangles = 16;            // Stop generating below this
+};
+
 /**
  * @brief Model resource - collection of meshes (shared resource)
  * 
@@ -38,16 +74,36 @@ struct Transform {
  * - Model = Shared Resource (geometry + material)
  * - SceneObject = Instance (transform + model reference)
  * 
+ * Meshes are shared, not owned: several models may hold the same mesh
+ * (e.g. the per-node models Scene::instantiateModel builds over a
+ * loaded model's meshes). Unloading or destroying a model only drops its
+ * references; a mesh frees its data and GPU ranges when its last holder
+ * releases it, or when its owner (ResourceManager) unloads it.
+ * 
  * Platform Support: 100% shared
  */
 class Model : public IResource {
+public:
+    /**
+     * @brief Build a LOD chain for a set of meshes with the QEM simplifier
+     * 
+     * Levels that cannot remove at least a quarter of the previous level's
+     * triangles (within maxError) end the chain.
+     */
+    static std::vector<LODLevel> buildLODChain(const std::vector<std::shared_ptr<Mesh>>& baseMeshes,
+                                               const LODSettings& settings);
+
 private:
     std::vector<std::shared_ptr<Mesh>> meshes;
+    std::vector<LODLevel> lodLevels;  // LOD 1..N
+    std::vector<ModelNode> nodes;     // Empty = every mesh at the model origin
     
     // Bounding information (in model space, origin-centered)
     Vec3 boundingMin;
     Vec3 boundingMax;
     bool boundsDirty = true;
+    
+    std::vector<const Mesh*> getUniqueMeshes() const;  // LOD 0 and LOD meshes, each once
 
 public:
     Model();
@@ -56,6 +112,10 @@ public:
     
     // IResource interface
     bool load() override;
+    
+    /**
+     * @brief Drop the mesh and LOD references (the meshes themselves are left intact)
+     */
     void unload() override;
     
     // ========== Mesh Management ==========
@@ -64,19 +124,99 @@ public:
     void removeMesh(size_t index);
     void clearMeshes();
     
+    /**
+     * @brief Split meshes over maxVertices vertices into clusters (see Mesh::splitByVertexCount)
+     * 
+     * Node mesh ranges are remapped. Call before generating LODs; existing
+     * levels are dropped since they would no longer match the meshes.
+     * @return Number of meshes that were split
+     */
+    size_t splitLargeMeshes(size_t maxVertices = Mesh::MAX_UINT16_VERTICES);
+    
+    /**
+     * @brief Run MeshOptimizer on the meshes and log ACMR / ATVR before and after
+     * @param includeBaseMeshes false = LOD levels only (e.g. after generateLODs)
+     * @return Number of meshes optimized
+     */
+    size_t optimizeMeshes(const MeshOptimizer::Settings& settings = MeshOptimizer::Settings(),
+                          bool includeBaseMeshes = true);
+    
     size_t getMeshCount() const { return meshes.size(); }
     std::shared_ptr<Mesh> getMesh(size_t index) const;
     const std::vector<std::shared_ptr<Mesh>>& getMeshes() const { return meshes; }
     
+    // ========== Nodes ==========
+    
+    /**
+     * @brief Node hierarchy placing the meshes (set by file loaders)
+     * 
+     * A Model drawn directly by one SceneObject ignores its nodes; use
+     * Scene::instantiateModel() to get one object per node.
+     */
+    void setNodes(std::vector<ModelNode> modelNodes) { nodes = std::move(modelNodes); }
+    const std::vector<ModelNode>& getNodes() const { return nodes; }
+    bool hasNodes() const { return !nodes.empty(); }
+    
+    // ========== Level of Detail ==========
+    
+    /**
+     * @brief Generate LOD levels from the current meshes
+     * @return Number of levels generated
+     */
+    size_t generateLODs(const LODSettings& settings = LODSettings());
+    
+    void setLODs(const std::vector<LODLevel>& levels) { lodLevels = levels; }
+    const std::vector<LODLevel>& getLODs() const { return lodLevels; }
+    void clearLODs() { lodLevels.clear(); }
+    
+    /**
+     * @brief Number of levels including LOD 0
+     */
+    size_t getLODCount() const { return lodLevels.size() + 1; }
+    const std::vector<std::shared_ptr<Mesh>>& getLODMeshes(size_t lod) const;
+    size_t getLODTriangleCount(size_t lod) const;
+    
+    /**
+     * @brief Pick a LOD for a projected size, with hysteresis around each threshold
+     * @param screenSize Projected bounding-sphere diameter as a fraction of screen height
+     * @param currentLOD LOD used last frame
+     * @param hysteresis Relative band (e.g. 0.1 = switch 10% past the threshold)
+     */
+    uint32_t selectLOD(float screenSize, uint32_t currentLOD, float hysteresis) const;
+    
     // ========== Bounding Volume (Model Space) ==========
     
     void calculateBounds();
     void getBounds(Vec3& min, Vec3& max);
+    void setBounds(const Vec3& min, const Vec3& max);  // Precomputed (e.g. mesh cache)
     
     // ========== GPU Resources ==========
     
-    bool createGPUResources(wgpu::Device device);
+    bool createGPUResources(MeshBufferPool& pool);
     void releaseGPUResources();
+    
+    /**
+     * @brief Apply a vertex layout to every mesh, LODs included
+     * 
+     * A quantized layout without a box gets one box around all of them, so
+     * getPositionDequantization() holds for every mesh the model draws.
+     */
+    void setVertexLayout(const VertexLayout& layout);
+    
+    /**
+     * @brief Matrix from stored positions to model space (identity for float positions)
+     */
+    Mat4 getPositionDequantization() const;
+    
+    /**
+     * @brief Bytes of the uploaded vertex and index buffers, LODs included
+     */
+    size_t getGPUMemorySize() const;
+    
+    /**
+     * @brief Same, with vertices stored as the 48-byte Vertex
+     */
+    size_t getUnpackedGPUMemorySize() const;
 };
 
 } // namespace resource
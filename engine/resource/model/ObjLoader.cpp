@@ -0,0 +1,628 @@
+#include "ObjLoader.h"
+#include "Mesh.h"
+#include "../../core/JobSystem.h"
+#include "../../core/MappedFile.h"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+#include <unordered_map>
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t NO_INDEX = 0xFFFFFFFFu;
+constexpr size_t MIN_CHUNK_BYTES = 1 << 20;            // Parse chunks of at least 1 MB
+constexpr size_t CHUNKS_PER_THREAD = 4;                // Load balance between uneven chunks
+constexpr size_t DEDUP_BLOCK_SIZE = 1 << 16;           // Corners per dedup work item
+constexpr size_t PARALLEL_DEDUP_MIN_CORNERS = 1 << 18; // Smaller meshes dedup in one partition
+constexpr uint32_t DEDUP_PARTITION_BITS = 6;           // 64 hash partitions for large meshes
+
+/**
+ * @brief One triangle corner: 0-based indices into the file's v / vt / vn arrays
+ */
+struct Corner {
+    uint32_t position;
+    uint32_t texCoord;
+    uint32_t normal;
+
+    bool operator==(const Corner& other) const {
+        return position == other.position && texCoord == other.texCoord && normal == other.normal;
+    }
+};
+
+inline uint64_t hashCorner(const Corner& corner) {
+    uint64_t h = (static_cast<uint64_t>(corner.position) << 32 | corner.texCoord) ^
+                 (static_cast<uint64_t>(corner.normal) * 0x9E3779B97F4A7C15ull);
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * @brief 'o' / 'g' / 'usemtl' statement, applied from cornerBegin on
+ */
+struct StateChange {
+    size_t cornerBegin;
+    bool material;
+    std::string_view name;
+};
+
+struct ParseChunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    size_t positions = 0, texCoords = 0, normals = 0;             // Count pass
+    size_t positionBase = 0, texCoordBase = 0, normalBase = 0;    // Global index of the first element
+    std::vector<Corner> corners;
+    std::vector<StateChange> changes;
+    size_t skippedFaces = 0;
+};
+
+// Output arrays shared by all chunks (each chunk writes its own range)
+struct ElementArrays {
+    std::vector<Vec3> positions;
+    std::vector<Vec3> colors;
+    std::vector<Vec3> texCoords;
+    std::vector<Vec3> normals;
+};
+
+// ========== Tokenizing ==========
+
+inline const char* skipSpaces(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+        ++p;
+    }
+    return p;
+}
+
+inline bool parseFloat(const char*& p, const char* end, float& value) {
+    p = skipSpaces(p, end);
+    if (p < end && *p == '+') {
+        ++p;
+    }
+#if defined(__cpp_lib_to_chars)
+    auto parsed = std::from_chars(p, end, value);
+    if (parsed.ec != std::errc()) {
+        return false;
+    }
+    p = parsed.ptr;
+    return true;
+#else
+    // No floating-point from_chars in this standard library: strtof on a bounded copy
+    char token[64];
+    size_t length = 0;
+    while (p + length < end && length < sizeof(token) - 1 &&
+           p[length] != ' ' && p[length] != '\t' && p[length] != '\r' && p[length] != '\n') {
+        token[length] = p[length];
+        ++length;
+    }
+    token[length] = '\0';
+    char* stop = nullptr;
+    value = std::strtof(token, &stop);
+    if (stop == token) {
+        return false;
+    }
+    p += stop - token;
+    return true;
+#endif
+}
+
+/**
+ * @brief Parse one face index and resolve it to a 0-based global index
+ * @param defined Elements of this kind defined before the current line
+ * @param total Elements of this kind in the whole file
+ */
+inline bool parseIndex(const char*& p, const char* end, size_t defined, size_t total, uint32_t& index) {
+    int64_t value = 0;
+    auto parsed = std::from_chars(p, end, value);
+    if (parsed.ec != std::errc() || value == 0) {
+        return false;
+    }
+    p = parsed.ptr;
+    int64_t resolved = value > 0 ? value - 1 : static_cast<int64_t>(defined) + value;
+    if (resolved < 0 || static_cast<uint64_t>(resolved) >= total) {
+        return false;
+    }
+    index = static_cast<uint32_t>(resolved);
+    return true;
+}
+
+inline std::string_view lineName(const char* p, const char* lineEnd) {
+    p = skipSpaces(p, lineEnd);
+    const char* last = lineEnd;
+    while (last > p && (last[-1] == ' ' || last[-1] == '\t' || last[-1] == '\r')) {
+        --last;
+    }
+    return std::string_view(p, static_cast<size_t>(last - p));
+}
+
+/**
+ * @brief Statement keyword of a line: 'v', 't' (vt), 'n' (vn), 'f', 'g' (o / g), 'm' (usemtl) or 0
+ * @param p Input: line start; output: first character after the keyword
+ */
+inline char classifyLine(const char*& p, const char* lineEnd) {
+    p = skipSpaces(p, lineEnd);
+    if (lineEnd - p < 2) {
+        return 0;
+    }
+    auto separated = [&](size_t length) {
+        return p + length < lineEnd && (p[length] == ' ' || p[length] == '\t');
+    };
+    char keyword = 0;
+    size_t length = 0;
+    switch (p[0]) {
+        case 'v':
+            if (separated(1)) { keyword = 'v'; length = 1; }
+            else if (p[1] == 't' && separated(2)) { keyword = 't'; length = 2; }
+            else if (p[1] == 'n' && separated(2)) { keyword = 'n'; length = 2; }
+            break;
+        case 'f':
+            if (separated(1)) { keyword = 'f'; length = 1; }
+            break;
+        case 'o':
+        case 'g':
+            if (separated(1)) { keyword = 'g'; length = 1; }
+            break;
+        case 'u':
+            if (lineEnd - p > 6 && std::memcmp(p, "usemtl", 6) == 0 && separated(6)) { keyword = 'm'; length = 6; }
+            break;
+    }
+    p += length;
+    return keyword;
+}
+
+template<typename Fn>
+void forEachLine(const char* begin, const char* end, Fn&& fn) {
+    for (const char* p = begin; p < end;) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!lineEnd) {
+            lineEnd = end;
+        }
+        fn(p, lineEnd);
+        p = lineEnd + 1;
+    }
+}
+
+// ========== Passes ==========
+
+void countChunk(ParseChunk& chunk) {
+    forEachLine(chunk.begin, chunk.end, [&](const char* p, const char* lineEnd) {
+        switch (classifyLine(p, lineEnd)) {
+            case 'v': ++chunk.positions; break;
+            case 't': ++chunk.texCoords; break;
+            case 'n': ++chunk.normals; break;
+            default: break;
+        }
+    });
+}
+
+void parseChunk(ParseChunk& chunk, ElementArrays& arrays, bool flipTexCoordV) {
+    size_t position = chunk.positionBase;
+    size_t texCoord = chunk.texCoordBase;
+    size_t normal = chunk.normalBase;
+    const size_t positionCount = arrays.positions.size();
+    const size_t texCoordCount = arrays.texCoords.size();
+    const size_t normalCount = arrays.normals.size();
+
+    forEachLine(chunk.begin, chunk.end, [&](const char* p, const char* lineEnd) {
+        switch (classifyLine(p, lineEnd)) {
+            case 'v': {
+                float v[6] = {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f};
+                size_t read = 0;
+                while (read < 6 && parseFloat(p, lineEnd, v[read])) {
+                    ++read;
+                }
+                arrays.positions[position] = Vec3(v[0], v[1], v[2]);
+                arrays.colors[position] = read == 6 ? Vec3(v[3], v[4], v[5]) : Vec3(1.0f, 1.0f, 1.0f);
+                ++position;
+                break;
+            }
+            case 't': {
+                float uv[2] = {0.0f, 0.0f};
+                for (size_t read = 0; read < 2 && parseFloat(p, lineEnd, uv[read]); ++read) {}
+                arrays.texCoords[texCoord++] = Vec3(uv[0], flipTexCoordV ? 1.0f - uv[1] : uv[1], 0.0f);
+                break;
+            }
+            case 'n': {
+                float n[3] = {0.0f, 0.0f, 0.0f};
+                for (size_t read = 0; read < 3 && parseFloat(p, lineEnd, n[read]); ++read) {}
+                arrays.normals[normal++] = Vec3(n[0], n[1], n[2]);
+                break;
+            }
+            case 'f': {
+                // Fan triangulation: (0, i-1, i) for every corner i >= 2
+                const size_t faceStart = chunk.corners.size();
+                Corner first = {}, previous = {};
+                size_t cornerCount = 0;
+                bool valid = true;
+                for (p = skipSpaces(p, lineEnd); valid && p < lineEnd; p = skipSpaces(p, lineEnd)) {
+                    Corner corner = {NO_INDEX, NO_INDEX, NO_INDEX};
+                    valid = parseIndex(p, lineEnd, position, positionCount, corner.position);
+                    if (valid && p < lineEnd && *p == '/') {
+                        ++p;
+                        if (p < lineEnd && *p != '/') {
+                            valid = parseIndex(p, lineEnd, texCoord, texCoordCount, corner.texCoord);
+                        }
+                        if (valid && p < lineEnd && *p == '/') {
+                            ++p;
+                            valid = parseIndex(p, lineEnd, normal, normalCount, corner.normal);
+                        }
+                    }
+                    if (!valid) {
+                        break;
+                    }
+                    if (cornerCount == 0) {
+                        first = corner;
+                    } else if (cornerCount >= 2) {
+                        chunk.corners.push_back(first);
+                        chunk.corners.push_back(previous);
+                        chunk.corners.push_back(corner);
+                    }
+                    previous = corner;
+                    ++cornerCount;
+                }
+                if (!valid || cornerCount < 3) {
+                    chunk.corners.resize(faceStart);
+                    ++chunk.skippedFaces;
+                }
+                break;
+            }
+            case 'g':
+                chunk.changes.push_back({chunk.corners.size(), false, lineName(p, lineEnd)});
+                break;
+            case 'm':
+                chunk.changes.push_back({chunk.corners.size(), true, lineName(p, lineEnd)});
+                break;
+            default:
+                break;
+        }
+    });
+}
+
+/**
+ * @brief Corners of one output mesh, as ranges of the chunks' corner lists
+ */
+struct MeshCorners {
+    std::string name;
+    std::vector<std::pair<const Corner*, size_t>> spans;
+    size_t cornerCount = 0;
+};
+
+/**
+ * @brief Build vertices (first-use order) and indices from a corner list
+ * @return false if a corner lacks a normal (caller computes normals)
+ */
+bool buildIndexedVertices(JobSystem& jobs, const Corner* corners, size_t count, const ElementArrays& arrays,
+                          std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    const uint32_t partitionBits = count >= PARALLEL_DEDUP_MIN_CORNERS ? DEDUP_PARTITION_BITS : 0;
+    const size_t partitionCount = size_t(1) << partitionBits;
+    const size_t blockCount = (count + DEDUP_BLOCK_SIZE - 1) / DEDUP_BLOCK_SIZE;
+    auto partitionOf = [&](uint64_t hash) {
+        return partitionBits ? static_cast<size_t>(hash >> (64 - partitionBits)) : size_t(0);
+    };
+
+    // Bucket corner ids by hash partition (order within a partition = corner order)
+    std::vector<uint32_t> partitionCorners;
+    std::vector<size_t> partitionBegin(partitionCount + 1, 0);
+    if (partitionCount > 1) {
+        std::vector<size_t> blockOffsets(blockCount * partitionCount, 0);
+        jobs.parallelFor(blockCount, 1, [&](size_t blockBegin, size_t blockEnd) {
+            for (size_t block = blockBegin; block < blockEnd; ++block) {
+                size_t* counts = &blockOffsets[block * partitionCount];
+                size_t end = std::min(count, (block + 1) * DEDUP_BLOCK_SIZE);
+                for (size_t c = block * DEDUP_BLOCK_SIZE; c < end; ++c) {
+                    ++counts[partitionOf(hashCorner(corners[c]))];
+                }
+            }
+        });
+        size_t offset = 0;
+        for (size_t partition = 0; partition < partitionCount; ++partition) {
+            partitionBegin[partition] = offset;
+            for (size_t block = 0; block < blockCount; ++block) {
+                size_t blockCornerCount = blockOffsets[block * partitionCount + partition];
+                blockOffsets[block * partitionCount + partition] = offset;
+                offset += blockCornerCount;
+            }
+        }
+        partitionBegin[partitionCount] = offset;
+
+        partitionCorners.resize(count);
+        jobs.parallelFor(blockCount, 1, [&](size_t blockBegin, size_t blockEnd) {
+            for (size_t block = blockBegin; block < blockEnd; ++block) {
+                size_t* offsets = &blockOffsets[block * partitionCount];
+                size_t end = std::min(count, (block + 1) * DEDUP_BLOCK_SIZE);
+                for (size_t c = block * DEDUP_BLOCK_SIZE; c < end; ++c) {
+                    partitionCorners[offsets[partitionOf(hashCorner(corners[c]))]++] = static_cast<uint32_t>(c);
+                }
+            }
+        });
+    } else {
+        partitionBegin[1] = count;
+    }
+
+    // Per partition: map each corner to the first corner with the same triplet
+    std::vector<uint32_t> firstCorner(count);
+    jobs.parallelFor(partitionCount, 1, [&](size_t partitionFirst, size_t partitionLast) {
+        std::vector<uint32_t> table;  // Corner id per slot (NO_INDEX = empty)
+        for (size_t partition = partitionFirst; partition < partitionLast; ++partition) {
+            size_t begin = partitionBegin[partition];
+            size_t end = partitionBegin[partition + 1];
+
+            // Closed meshes share each vertex ~6 times; grow if that guess is low
+            size_t capacity = 16;
+            while (capacity < (end - begin) / 2) capacity <<= 1;
+            table.assign(capacity, NO_INDEX);
+            size_t used = 0;
+
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t c = partitionCount > 1 ? partitionCorners[i] : static_cast<uint32_t>(i);
+                const Corner& corner = corners[c];
+                size_t mask = table.size() - 1;
+                size_t slot = static_cast<size_t>(hashCorner(corner)) & mask;
+                while (table[slot] != NO_INDEX && !(corners[table[slot]] == corner)) {
+                    slot = (slot + 1) & mask;
+                }
+                if (table[slot] != NO_INDEX) {
+                    firstCorner[c] = table[slot];
+                    continue;
+                }
+
+                table[slot] = c;
+                firstCorner[c] = c;
+                if (++used * 2 > table.size()) {
+                    std::vector<uint32_t> grown(table.size() * 2, NO_INDEX);
+                    size_t grownMask = grown.size() - 1;
+                    for (uint32_t entry : table) {
+                        if (entry == NO_INDEX) continue;
+                        size_t s = static_cast<size_t>(hashCorner(corners[entry])) & grownMask;
+                        while (grown[s] != NO_INDEX) s = (s + 1) & grownMask;
+                        grown[s] = entry;
+                    }
+                    table.swap(grown);
+                }
+            }
+        }
+    });
+
+    // Number first uses in corner order: vertex order is independent of the partitioning
+    std::vector<size_t> blockVertexBase(blockCount + 1, 0);
+    jobs.parallelFor(blockCount, 1, [&](size_t blockBegin, size_t blockEnd) {
+        for (size_t block = blockBegin; block < blockEnd; ++block) {
+            size_t end = std::min(count, (block + 1) * DEDUP_BLOCK_SIZE);
+            size_t firstUses = 0;
+            for (size_t c = block * DEDUP_BLOCK_SIZE; c < end; ++c) {
+                firstUses += firstCorner[c] == c;
+            }
+            blockVertexBase[block + 1] = firstUses;
+        }
+    });
+    for (size_t block = 0; block < blockCount; ++block) {
+        blockVertexBase[block + 1] += blockVertexBase[block];
+    }
+
+    std::vector<uint32_t> vertexOfCorner(count);
+    vertices.resize(blockVertexBase[blockCount]);
+    std::atomic<bool> missingNormals{false};
+    jobs.parallelFor(blockCount, 1, [&](size_t blockBegin, size_t blockEnd) {
+        bool missing = false;
+        for (size_t block = blockBegin; block < blockEnd; ++block) {
+            uint32_t vertex = static_cast<uint32_t>(blockVertexBase[block]);
+            size_t end = std::min(count, (block + 1) * DEDUP_BLOCK_SIZE);
+            for (size_t c = block * DEDUP_BLOCK_SIZE; c < end; ++c) {
+                if (firstCorner[c] != c) continue;
+                const Corner& corner = corners[c];
+                Vertex& out = vertices[vertex];
+                out.position = arrays.positions[corner.position];
+                out.color = arrays.colors[corner.position];
+                out.texCoord = corner.texCoord != NO_INDEX ? arrays.texCoords[corner.texCoord] : Vec3(0, 0, 0);
+                out.normal = corner.normal != NO_INDEX ? arrays.normals[corner.normal] : Vec3(0, 0, 0);
+                missing |= corner.normal == NO_INDEX;
+                vertexOfCorner[c] = vertex++;
+            }
+        }
+        if (missing) missingNormals = true;
+    });
+
+    indices.resize(count);
+    jobs.parallelFor(blockCount, 1, [&](size_t blockBegin, size_t blockEnd) {
+        size_t end = std::min(count, blockEnd * DEDUP_BLOCK_SIZE);
+        for (size_t c = blockBegin * DEDUP_BLOCK_SIZE; c < end; ++c) {
+            indices[c] = vertexOfCorner[firstCorner[c]];
+        }
+    });
+    return !missingNormals;
+}
+
+double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+// ========== ObjLoader ==========
+
+bool ObjLoader::load(const std::string& filepath, std::vector<std::shared_ptr<Mesh>>& outMeshes,
+                     const ObjLoadSettings& settings, ObjLoadResult* result) {
+    auto start = Clock::now();
+    MappedFile file;
+    if (!file.open(filepath)) {
+        std::cerr << "[ERROR] Cannot open OBJ file: " << filepath << std::endl;
+        return false;
+    }
+
+    // Faces outside any group are named after the file
+    size_t nameBegin = filepath.find_last_of("/\\");
+    nameBegin = nameBegin == std::string::npos ? 0 : nameBegin + 1;
+    size_t nameEnd = filepath.find_last_of('.');
+    std::string name = filepath.substr(nameBegin, nameEnd > nameBegin ? nameEnd - nameBegin : std::string::npos);
+
+    ObjLoadResult localResult;
+    ObjLoadResult& stats = result ? *result : localResult;
+    bool loaded = parse(reinterpret_cast<const char*>(file.getData()), file.getSize(), name,
+                        outMeshes, settings, &stats);
+    stats.parseMs = millisecondsSince(start) - stats.buildMs;  // Mapping included
+    return loaded;
+}
+
+bool ObjLoader::parse(const char* data, size_t size, const std::string& name,
+                      std::vector<std::shared_ptr<Mesh>>& outMeshes,
+                      const ObjLoadSettings& settings, ObjLoadResult* result) {
+    auto start = Clock::now();
+    JobSystem serialJobs(0);
+    JobSystem& jobs = settings.jobSystem ? *settings.jobSystem : serialJobs;
+
+    // Line-aligned chunks
+    size_t chunkCount = std::max<size_t>(1, std::min(size / MIN_CHUNK_BYTES,
+                                                     size_t(jobs.getThreadCount()) * CHUNKS_PER_THREAD));
+    std::vector<ParseChunk> chunks(chunkCount);
+    const char* end = data + size;
+    const char* chunkBegin = data;
+    for (size_t i = 0; i < chunkCount; ++i) {
+        const char* chunkEnd = end;
+        if (i + 1 < chunkCount) {
+            chunkEnd = std::max(chunkBegin, data + size / chunkCount * (i + 1));
+            const char* newline = static_cast<const char*>(std::memchr(chunkEnd, '\n', static_cast<size_t>(end - chunkEnd)));
+            chunkEnd = newline ? newline + 1 : end;
+        }
+        chunks[i].begin = chunkBegin;
+        chunks[i].end = chunkEnd;
+        chunkBegin = chunkEnd;
+    }
+
+    jobs.parallelFor(chunkCount, 1, [&](size_t begin, size_t last) {
+        for (size_t i = begin; i < last; ++i) countChunk(chunks[i]);
+    });
+
+    ElementArrays arrays;
+    size_t positionCount = 0, texCoordCount = 0, normalCount = 0;
+    for (ParseChunk& chunk : chunks) {
+        chunk.positionBase = positionCount;
+        chunk.texCoordBase = texCoordCount;
+        chunk.normalBase = normalCount;
+        positionCount += chunk.positions;
+        texCoordCount += chunk.texCoords;
+        normalCount += chunk.normals;
+    }
+    if (positionCount >= NO_INDEX || texCoordCount >= NO_INDEX || normalCount >= NO_INDEX) {
+        std::cerr << "[ERROR] OBJ '" << name << "' has more than 4G elements of one kind" << std::endl;
+        return false;
+    }
+    arrays.positions.resize(positionCount);
+    arrays.colors.resize(positionCount);
+    arrays.texCoords.resize(texCoordCount);
+    arrays.normals.resize(normalCount);
+
+    jobs.parallelFor(chunkCount, 1, [&](size_t begin, size_t last) {
+        for (size_t i = begin; i < last; ++i) parseChunk(chunks[i], arrays, settings.flipTexCoordV);
+    });
+    double parseMs = millisecondsSince(start);
+    auto buildStart = Clock::now();
+
+    // Group corner ranges by (group, material), carrying state across chunks
+    std::vector<MeshCorners> meshes;
+    std::unordered_map<std::string, size_t> meshIndex;
+    std::string_view group, material;
+    size_t skippedFaces = 0;
+    auto addSpan = [&](const ParseChunk& chunk, size_t begin, size_t spanEnd) {
+        if (begin == spanEnd) return;
+        std::string key(settings.splitByGroup ? group : std::string_view());
+        key += '\n';
+        key += settings.splitByMaterial ? material : std::string_view();
+        auto inserted = meshIndex.emplace(key, meshes.size());
+        if (inserted.second) {
+            MeshCorners mesh;
+            mesh.name = settings.splitByGroup && !group.empty() ? std::string(group) : name;
+            if (settings.splitByMaterial && !material.empty()) {
+                mesh.name += "/" + std::string(material);
+            }
+            meshes.push_back(std::move(mesh));
+        }
+        MeshCorners& mesh = meshes[inserted.first->second];
+        mesh.spans.emplace_back(chunk.corners.data() + begin, spanEnd - begin);
+        mesh.cornerCount += spanEnd - begin;
+    };
+    for (const ParseChunk& chunk : chunks) {
+        size_t spanBegin = 0;
+        for (const StateChange& change : chunk.changes) {
+            addSpan(chunk, spanBegin, change.cornerBegin);
+            (change.material ? material : group) = change.name;
+            spanBegin = change.cornerBegin;
+        }
+        addSpan(chunk, spanBegin, chunk.corners.size());
+        skippedFaces += chunk.skippedFaces;
+    }
+
+    size_t totalVertices = 0, totalTriangles = 0;
+    std::vector<std::shared_ptr<Mesh>> built;
+    built.reserve(meshes.size());
+    for (MeshCorners& meshCorners : meshes) {
+        if (meshCorners.cornerCount >= NO_INDEX) {
+            std::cerr << "[ERROR] OBJ mesh '" << meshCorners.name << "' has more than 4G corners" << std::endl;
+            return false;
+        }
+
+        // Meshes split across chunks (or interleaved groups) are gathered first
+        std::vector<Corner> gathered;
+        const Corner* corners = meshCorners.spans.front().first;
+        if (meshCorners.spans.size() > 1) {
+            gathered.reserve(meshCorners.cornerCount);
+            for (const auto& span : meshCorners.spans) {
+                gathered.insert(gathered.end(), span.first, span.first + span.second);
+            }
+            corners = gathered.data();
+        }
+
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+        bool hasNormals = buildIndexedVertices(jobs, corners, meshCorners.cornerCount, arrays, vertices, indices);
+
+        auto mesh = std::make_shared<Mesh>(meshCorners.name);
+        totalVertices += vertices.size();
+        totalTriangles += indices.size() / 3;
+        mesh->setVertices(std::move(vertices));
+        mesh->setIndices(std::move(indices));
+        if (!hasNormals) {
+            mesh->calculateNormals();
+        }
+        mesh->load();
+        built.push_back(std::move(mesh));
+    }
+
+    if (skippedFaces > 0) {
+        std::cerr << "[WARNING] OBJ '" << name << "': skipped " << skippedFaces
+                  << " faces with invalid indices" << std::endl;
+    }
+    if (result) {
+        result->fileBytes = size;
+        result->positions = positionCount;
+        result->texCoords = texCoordCount;
+        result->normals = normalCount;
+        result->triangles = totalTriangles;
+        result->vertices = totalVertices;
+        result->meshes = built.size();
+        result->skippedFaces = skippedFaces;
+        result->parseMs = parseMs;
+        result->buildMs = millisecondsSince(buildStart);
+    }
+    if (built.empty()) {
+        std::cerr << "[ERROR] OBJ '" << name << "' contains no faces" << std::endl;
+        return false;
+    }
+
+    outMeshes.insert(outMeshes.end(), built.begin(), built.end());
+    return true;
+}
+
+} // namespace resource
+} // namespace rs_engine
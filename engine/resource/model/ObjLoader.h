@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rs_engine {
+
+class JobSystem;
+
+namespace resource {
+
+class Mesh;
+
+/**
+ * @brief ObjLoader options
+ */
+struct ObjLoadSettings {
+    bool splitByGroup = true;       // New mesh per 'o' / 'g' name
+    bool splitByMaterial = true;    // New mesh per 'usemtl' name
+    bool flipTexCoordV = true;      // OBJ v points up, texture rows go down
+    JobSystem* jobSystem = nullptr; // Workers for the parallel passes (nullptr = calling thread only)
+};
+
+/**
+ * @brief ObjLoader statistics
+ */
+struct ObjLoadResult {
+    size_t fileBytes = 0;
+    size_t positions = 0;
+    size_t texCoords = 0;
+    size_t normals = 0;
+    size_t triangles = 0;
+    size_t vertices = 0;            // Unique triplets, summed over meshes
+    size_t meshes = 0;
+    size_t skippedFaces = 0;        // Faces with invalid indices
+    double parseMs = 0.0;           // Map + count + parse passes
+    double buildMs = 0.0;           // Grouping, deduplication, Mesh creation
+};
+
+/**
+ * @brief Parallel Wavefront OBJ loader
+ *
+ * The file is memory-mapped and split into line-aligned chunks that are
+ * parsed concurrently on the settings' JobSystem with std::from_chars:
+ * 1. Count pass: v / vt / vn lines per chunk, so every chunk knows the
+ *    global index of its first element (resolves relative indices).
+ * 2. Parse pass: elements are written straight into the shared arrays;
+ *    faces are fan-triangulated into per-chunk corner lists.
+ * 3. Meshes: corners are grouped by 'o' / 'g' name and 'usemtl' material,
+ *    and each (position, uv, normal) triplet becomes one vertex. The
+ *    triplets are deduplicated with open-addressing hash tables, one per
+ *    hash partition, in parallel.
+ *
+ * Vertices are numbered in order of first use, so the output is identical
+ * for any thread count. Supported: v (with optional r g b), vt, vn, f
+ * (any polygon size, positive or negative indices), o, g, usemtl. Other
+ * statements (mtllib, s, l, p, ...) and line continuations are ignored.
+ * Faces with out-of-range indices are skipped with a warning; meshes
+ * with corners lacking a normal get computed normals.
+ *
+ * Platform Support: 100% shared (serial on Web)
+ */
+class ObjLoader {
+public:
+    /**
+     * @brief Load an OBJ file into one mesh per group / material
+     * @param outMeshes Output: meshes in order of first appearance (appended)
+     * @return false if the file cannot be read or holds no faces
+     */
+    static bool load(const std::string& filepath,
+                     std::vector<std::shared_ptr<Mesh>>& outMeshes,
+                     const ObjLoadSettings& settings = ObjLoadSettings(),
+                     ObjLoadResult* result = nullptr);
+
+    /**
+     * @brief Parse OBJ text already in memory (same rules as load())
+     * @param name Mesh name used for faces outside any group
+     */
+    static bool parse(const char* data, size_t size, const std::string& name,
+                      std::vector<std::shared_ptr<Mesh>>& outMeshes,
+                      const ObjLoadSettings& settings = ObjLoadSettings(),
+                      ObjLoadResult* result = nullptr);
+};
+
+} // namespace resource
+} // namespace rs_engine
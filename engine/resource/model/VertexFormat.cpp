@@ -0,0 +1,298 @@
+#include "VertexFormat.h"
+#include "Mesh.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+inline int16_t toSnorm16(float value) {
+    return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+
+inline uint16_t toUnorm16(float value) {
+    return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+}
+
+inline uint8_t toUnorm8(float value) {
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+}
+
+inline float quantizeAxis(float value, float min, float extent) {
+    return extent > 0.0f ? (value - min) / extent : 0.0f;
+}
+
+/**
+ * @brief Write one attribute, returning the bytes written
+ */
+uint32_t writeAttribute(VertexEncoding encoding, const Vec3& value, bool isColor, uint8_t* out) {
+    switch (encoding) {
+        case VertexEncoding::Float32x2: {
+            const float data[2] = { value.x, value.y };
+            std::memcpy(out, data, sizeof(data));
+            return 8;
+        }
+        case VertexEncoding::Float32x3: {
+            const float data[3] = { value.x, value.y, value.z };
+            std::memcpy(out, data, sizeof(data));
+            return 12;
+        }
+        case VertexEncoding::Float16x2: {
+            const uint16_t data[2] = { VertexPacker::floatToHalf(value.x), VertexPacker::floatToHalf(value.y) };
+            std::memcpy(out, data, sizeof(data));
+            return 4;
+        }
+        case VertexEncoding::Snorm16x2Oct: {
+            const uint32_t data = VertexPacker::encodeOctahedral(value);
+            std::memcpy(out, &data, sizeof(data));
+            return 4;
+        }
+        case VertexEncoding::Unorm8x4:
+            out[0] = toUnorm8(value.x);
+            out[1] = toUnorm8(value.y);
+            out[2] = toUnorm8(value.z);
+            out[3] = isColor ? 255 : 0;
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+} // namespace
+
+// ========== VertexLayout ==========
+
+VertexLayout VertexLayout::standard() {
+    return VertexLayout();
+}
+
+VertexLayout VertexLayout::compact() {
+    VertexLayout layout;
+    layout.position = VertexEncoding::Unorm16x4;
+    return layout;
+}
+
+VertexLayout VertexLayout::uncompressed() {
+    VertexLayout layout;
+    layout.normal = VertexEncoding::Float32x3;
+    layout.texCoord = VertexEncoding::Float32x2;
+    layout.color = VertexEncoding::Float32x3;
+    return layout;
+}
+
+uint32_t VertexLayout::getPositionStride() const {
+    return VertexPacker::getEncodingSize(position);
+}
+
+uint32_t VertexLayout::getAttributeStride() const {
+    return VertexPacker::getEncodingSize(normal) + VertexPacker::getEncodingSize(texCoord) +
+           VertexPacker::getEncodingSize(color);
+}
+
+uint32_t VertexLayout::getTexCoordOffset() const {
+    return VertexPacker::getEncodingSize(normal);
+}
+
+uint32_t VertexLayout::getColorOffset() const {
+    return getTexCoordOffset() + VertexPacker::getEncodingSize(texCoord);
+}
+
+Mat4 VertexLayout::getPositionDequantization() const {
+    if (!hasQuantizedPositions()) {
+        return Mat4();
+    }
+    return Mat4::translation(quantizationMin) * Mat4::scale(quantizationExtent);
+}
+
+bool VertexLayout::sameEncodings(const VertexLayout& other) const {
+    return position == other.position && normal == other.normal &&
+           texCoord == other.texCoord && color == other.color;
+}
+
+// ========== VertexPacker ==========
+
+uint32_t VertexPacker::getEncodingSize(VertexEncoding encoding) {
+    switch (encoding) {
+        case VertexEncoding::Float32x2: return 8;
+        case VertexEncoding::Float32x3: return 12;
+        case VertexEncoding::Float16x2: return 4;
+        case VertexEncoding::Unorm16x4: return 8;
+        case VertexEncoding::Snorm16x2Oct: return 4;
+        case VertexEncoding::Unorm8x4: return 4;
+        default: return 0;
+    }
+}
+
+wgpu::VertexFormat VertexPacker::getWebGPUFormat(VertexEncoding encoding) {
+    switch (encoding) {
+        case VertexEncoding::Float32x2: return wgpu::VertexFormat::Float32x2;
+        case VertexEncoding::Float32x3: return wgpu::VertexFormat::Float32x3;
+        case VertexEncoding::Float16x2: return wgpu::VertexFormat::Float16x2;
+        case VertexEncoding::Unorm16x4: return wgpu::VertexFormat::Unorm16x4;
+        case VertexEncoding::Snorm16x2Oct: return wgpu::VertexFormat::Snorm16x2;
+        case VertexEncoding::Unorm8x4: return wgpu::VertexFormat::Unorm8x4;
+        default: return wgpu::VertexFormat::Undefined;
+    }
+}
+
+void VertexPacker::computeQuantizationBox(const Vertex* vertices, size_t count, Vec3& outMin, Vec3& outExtent) {
+    if (count == 0) {
+        outMin = outExtent = Vec3(0, 0, 0);
+        return;
+    }
+    Vec3 min = vertices[0].position;
+    Vec3 max = min;
+    for (size_t i = 1; i < count; ++i) {
+        const Vec3& p = vertices[i].position;
+        min = Vec3(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+        max = Vec3(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+    }
+    outMin = min;
+    outExtent = max - min;
+}
+
+void VertexPacker::packPositions(const Vertex* vertices, size_t count, const VertexLayout& layout, uint8_t* out) {
+    const uint32_t stride = layout.getPositionStride();
+    if (!layout.hasQuantizedPositions()) {
+        for (size_t i = 0; i < count; ++i) {
+            writeAttribute(layout.position, vertices[i].position, false, out + i * stride);
+        }
+        return;
+    }
+
+    const Vec3& min = layout.quantizationMin;
+    const Vec3& extent = layout.quantizationExtent;
+    for (size_t i = 0; i < count; ++i) {
+        const Vec3& p = vertices[i].position;
+        const uint16_t data[4] = {
+            toUnorm16(quantizeAxis(p.x, min.x, extent.x)),
+            toUnorm16(quantizeAxis(p.y, min.y, extent.y)),
+            toUnorm16(quantizeAxis(p.z, min.z, extent.z)),
+            0
+        };
+        std::memcpy(out + i * stride, data, sizeof(data));
+    }
+}
+
+void VertexPacker::packAttributes(const Vertex* vertices, size_t count, const VertexLayout& layout, uint8_t* out) {
+    const uint32_t stride = layout.getAttributeStride();
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t* target = out + i * stride;
+        target += writeAttribute(layout.normal, vertices[i].normal, false, target);
+        target += writeAttribute(layout.texCoord, vertices[i].texCoord, false, target);
+        writeAttribute(layout.color, vertices[i].color, true, target);
+    }
+}
+
+uint32_t VertexPacker::getAttributeStreamAttributes(const VertexLayout& layout, wgpu::VertexAttribute* outAttributes) {
+    const VertexEncoding encodings[3] = { layout.normal, layout.texCoord, layout.color };
+    const uint32_t locations[3] = { VERTEX_LOCATION_NORMAL, VERTEX_LOCATION_TEXCOORD, VERTEX_LOCATION_COLOR };
+    uint32_t count = 0;
+    uint64_t offset = 0;
+    for (int i = 0; i < 3; ++i) {
+        if (encodings[i] == VertexEncoding::None) {
+            continue;
+        }
+        outAttributes[count] = wgpu::VertexAttribute{};
+        outAttributes[count].format = getWebGPUFormat(encodings[i]);
+        outAttributes[count].offset = offset;
+        outAttributes[count].shaderLocation = locations[i];
+        offset += getEncodingSize(encodings[i]);
+        count++;
+    }
+    return count;
+}
+
+// ========== Encodings ==========
+
+uint16_t VertexPacker::floatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    const uint32_t exponent = (bits >> 23) & 0xFFu;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (exponent == 0xFFu) {
+        return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));   // Inf / NaN
+    }
+    const int32_t halfExponent = static_cast<int32_t>(exponent) - 127 + 15;
+    if (halfExponent >= 31) {
+        return static_cast<uint16_t>(sign | 0x7C00u);   // Overflow to infinity
+    }
+    if (halfExponent <= 0) {
+        // Subnormal half (or zero): shift the implicit bit in, round to nearest even
+        if (halfExponent < -10) {
+            return sign;
+        }
+        mantissa |= 0x800000u;
+        const uint32_t shift = static_cast<uint32_t>(14 - halfExponent);
+        uint32_t result = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (result & 1u))) {
+            result++;
+        }
+        return static_cast<uint16_t>(sign | result);
+    }
+
+    // Normal: round the 23-bit mantissa to 10 bits (a carry may bump the exponent)
+    uint32_t result = (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+    const uint32_t remainder = mantissa & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1u))) {
+        result++;
+    }
+    return static_cast<uint16_t>(sign | std::min(result, 0x7C00u));
+}
+
+float VertexPacker::halfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1Fu;
+    const uint32_t mantissa = half & 0x3FFu;
+    uint32_t bits;
+    if (exponent == 0) {
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -value : value;
+    } else if (exponent == 31) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint32_t VertexPacker::encodeOctahedral(const Vec3& normal) {
+    const float sum = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+    if (sum <= 0.0f) {
+        return 0;   // Degenerate normal: decodes to +Z
+    }
+    float u = normal.x / sum;
+    float v = normal.y / sum;
+    if (normal.z < 0.0f) {
+        // Fold the lower hemisphere over the diagonals
+        const float foldedU = (1.0f - std::abs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+        const float foldedV = (1.0f - std::abs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+        u = foldedU;
+        v = foldedV;
+    }
+    return static_cast<uint16_t>(toSnorm16(u)) | (static_cast<uint32_t>(static_cast<uint16_t>(toSnorm16(v))) << 16);
+}
+
+Vec3 VertexPacker::decodeOctahedral(uint32_t encoded) {
+    // Snorm decode as WebGPU does it: max(value / 32767, -1)
+    const float u = std::max(static_cast<int16_t>(encoded & 0xFFFFu) / 32767.0f, -1.0f);
+    const float v = std::max(static_cast<int16_t>(encoded >> 16) / 32767.0f, -1.0f);
+    Vec3 n(u, v, 1.0f - std::abs(u) - std::abs(v));
+    if (n.z < 0.0f) {
+        n.x = (1.0f - std::abs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+        n.y = (1.0f - std::abs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+    }
+    return n.normalize();
+}
+
+} // namespace resource
+} // namespace rs_engine
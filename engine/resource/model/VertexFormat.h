@@ -0,0 +1,150 @@
+#pragma once
+
+#include "../../core/math/Vec3.h"
+#include "../../core/math/Mat4.h"
+#include <cstddef>
+#include <cstdint>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rs_engine {
+namespace resource {
+
+struct Vertex;
+
+/**
+ * @brief How one vertex attribute is stored in a GPU vertex stream
+ */
+enum class VertexEncoding : uint8_t {
+    None,           // Attribute not stored
+    Float32x2,      // 8 bytes
+    Float32x3,      // 12 bytes
+    Float16x2,      // 4 bytes, half floats (texture coordinates)
+    Unorm16x4,      // 8 bytes, positions normalized to the layout's quantization box (w = 0)
+    Snorm16x2Oct,   // 4 bytes, unit vector in octahedral mapping (normals)
+    Unorm8x4        // 4 bytes, colors (alpha = 1)
+};
+
+/**
+ * @brief Shader locations of the mesh vertex attributes
+ */
+constexpr uint32_t VERTEX_LOCATION_POSITION = 0;   // Position stream (buffer slot 0)
+constexpr uint32_t VERTEX_LOCATION_NORMAL = 1;     // Attribute stream (buffer slot 1)
+constexpr uint32_t VERTEX_LOCATION_TEXCOORD = 2;
+constexpr uint32_t VERTEX_LOCATION_COLOR = 3;
+
+/**
+ * @brief GPU vertex format of a mesh: two streams, positions and attributes
+ *
+ * Positions live in their own buffer so position-only passes (depth,
+ * picking, occlusion, the scene's current pipeline) fetch nothing else.
+ * Normal, texture coordinate and color are interleaved in the attribute
+ * stream in that order, skipping attributes encoded as None.
+ *
+ * Quantized positions (Unorm16x4) are stored relative to the quantization
+ * box; shaders read them as 0..1 and getPositionDequantization() maps them
+ * back (Scene folds it into the object matrix). Every mesh drawn with one
+ * object matrix must share the box, see Model::setVertexLayout().
+ *
+ * Octahedral normals decode in WGSL as:
+ *   var n = vec3f(e.xy, 1.0 - abs(e.x) - abs(e.y));
+ *   if (n.z < 0.0) { n = vec3f((1.0 - abs(n.yx)) * select(vec2f(-1.0), vec2f(1.0), n.xy >= vec2f(0.0)), n.z); }
+ *   n = normalize(n);
+ */
+struct VertexLayout {
+    VertexEncoding position = VertexEncoding::Float32x3;
+    VertexEncoding normal = VertexEncoding::Snorm16x2Oct;
+    VertexEncoding texCoord = VertexEncoding::Float16x2;
+    VertexEncoding color = VertexEncoding::Unorm8x4;
+
+    // Unorm16x4 positions only (model space); resolved from the geometry when not set
+    Vec3 quantizationMin = Vec3(0, 0, 0);
+    Vec3 quantizationExtent = Vec3(0, 0, 0);
+    bool hasQuantizationBox = false;
+
+    /**
+     * @brief Float positions, packed attributes: 12 + 12 bytes per vertex (default)
+     */
+    static VertexLayout standard();
+
+    /**
+     * @brief 16-bit positions, packed attributes: 8 + 12 bytes per vertex
+     */
+    static VertexLayout compact();
+
+    /**
+     * @brief Every attribute as 32-bit floats: 12 + 32 bytes per vertex
+     */
+    static VertexLayout uncompressed();
+
+    uint32_t getPositionStride() const;
+    uint32_t getAttributeStride() const;
+    uint32_t getVertexSize() const { return getPositionStride() + getAttributeStride(); }
+
+    /**
+     * @brief Byte offset of normal / texCoord / color inside the attribute stream
+     */
+    uint32_t getNormalOffset() const { return 0; }
+    uint32_t getTexCoordOffset() const;
+    uint32_t getColorOffset() const;
+
+    bool hasQuantizedPositions() const { return position == VertexEncoding::Unorm16x4; }
+
+    /**
+     * @brief Matrix taking stored positions to model space (identity for float positions)
+     */
+    Mat4 getPositionDequantization() const;
+
+    /**
+     * @brief Same encodings (the quantization box is not compared)
+     */
+    bool sameEncodings(const VertexLayout& other) const;
+};
+
+/**
+ * @brief Packs resource::Vertex data into the streams of a VertexLayout
+ *
+ * Platform Support: 100% shared
+ */
+class VertexPacker {
+public:
+    static uint32_t getEncodingSize(VertexEncoding encoding);
+    static wgpu::VertexFormat getWebGPUFormat(VertexEncoding encoding);
+
+    /**
+     * @brief Smallest box holding the positions (a zero extent stays zero)
+     */
+    static void computeQuantizationBox(const Vertex* vertices, size_t count, Vec3& outMin, Vec3& outExtent);
+
+    /**
+     * @brief Write count * layout.getPositionStride() bytes
+     *
+     * Quantized positions outside the layout's box are clamped to it.
+     */
+    static void packPositions(const Vertex* vertices, size_t count, const VertexLayout& layout, uint8_t* out);
+
+    /**
+     * @brief Write count * layout.getAttributeStride() bytes
+     */
+    static void packAttributes(const Vertex* vertices, size_t count, const VertexLayout& layout, uint8_t* out);
+
+    /**
+     * @brief Describe the attribute stream for a pipeline
+     * @param outAttributes Room for 3 entries
+     * @return Number of attributes written
+     */
+    static uint32_t getAttributeStreamAttributes(const VertexLayout& layout, wgpu::VertexAttribute* outAttributes);
+
+    // ========== Encodings ==========
+
+    static uint16_t floatToHalf(float value);
+    static float halfToFloat(uint16_t half);
+
+    /**
+     * @brief Unit vector to two snorm16 values (x in the low half)
+     */
+    static uint32_t encodeOctahedral(const Vec3& normal);
+    static Vec3 decodeOctahedral(uint32_t encoded);
+};
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,934 @@
+#include "ImageDecoder.h"
+#include "../../core/MappedFile.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+constexpr uint32_t MAX_IMAGE_DIMENSION = 32768;
+constexpr uint64_t MAX_IMAGE_BYTES = 1ull << 31;
+
+bool fail(const std::string& source, const char* reason) {
+    std::cerr << "[ERROR] Cannot decode image '" << source << "': " << reason << std::endl;
+    return false;
+}
+
+bool validSize(uint64_t width, uint64_t height, uint32_t channels) {
+    return width > 0 && height > 0 && width <= MAX_IMAGE_DIMENSION && height <= MAX_IMAGE_DIMENSION &&
+           width * height * channels <= MAX_IMAGE_BYTES;
+}
+
+inline uint16_t readLE16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+inline uint32_t readLE32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+inline uint32_t readBE32(const uint8_t* p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+           (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+}
+
+// ========== Inflate ==========
+
+constexpr int HUFFMAN_FAST_BITS = 9;
+constexpr uint32_t HUFFMAN_FAST_MASK = (1u << HUFFMAN_FAST_BITS) - 1;
+
+const uint16_t LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const uint16_t DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                    8193, 12289, 16385, 24577};
+const uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+const uint8_t CODE_LENGTH_ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+inline uint32_t reverseBits(uint32_t value, int bits) {
+    value = ((value & 0xAAAAu) >> 1) | ((value & 0x5555u) << 1);
+    value = ((value & 0xCCCCu) >> 2) | ((value & 0x3333u) << 2);
+    value = ((value & 0xF0F0u) >> 4) | ((value & 0x0F0Fu) << 4);
+    value = ((value & 0xFF00u) >> 8) | ((value & 0x00FFu) << 8);
+    return value >> (16 - bits);
+}
+
+/**
+ * Canonical Huffman decoder: codes up to HUFFMAN_FAST_BITS long resolve
+ * with one table lookup, longer ones by comparing against per-length limits.
+ */
+struct Huffman {
+    uint16_t fast[1 << HUFFMAN_FAST_BITS];   // (length << 9) | symbol, 0 = slow path
+    uint16_t firstCode[16];
+    uint32_t maxCode[17];                    // Exclusive limit, left-aligned to 16 bits
+    uint16_t firstSymbol[16];
+    uint8_t size[288];
+    uint16_t value[288];
+
+    bool build(const uint8_t* lengths, int count) {
+        int sizes[16] = {0};
+        int nextCode[16] = {0};
+        std::memset(fast, 0, sizeof(fast));
+        for (int i = 0; i < count; ++i) {
+            sizes[lengths[i]]++;
+        }
+        sizes[0] = 0;
+
+        int code = 0;
+        int symbol = 0;
+        for (int i = 1; i < 16; ++i) {
+            if (sizes[i] > (1 << i)) {
+                return false;
+            }
+            nextCode[i] = code;
+            firstCode[i] = static_cast<uint16_t>(code);
+            firstSymbol[i] = static_cast<uint16_t>(symbol);
+            code += sizes[i];
+            if (sizes[i] && code - 1 >= (1 << i)) {
+                return false;   // Over-subscribed
+            }
+            maxCode[i] = static_cast<uint32_t>(code) << (16 - i);
+            code <<= 1;
+            symbol += sizes[i];
+        }
+        maxCode[16] = 0x10000;
+
+        for (int i = 0; i < count; ++i) {
+            int length = lengths[i];
+            if (length == 0) {
+                continue;
+            }
+            int slot = nextCode[length] - firstCode[length] + firstSymbol[length];
+            size[slot] = static_cast<uint8_t>(length);
+            value[slot] = static_cast<uint16_t>(i);
+            if (length <= HUFFMAN_FAST_BITS) {
+                uint16_t entry = static_cast<uint16_t>((length << 9) | i);
+                for (uint32_t j = reverseBits(nextCode[length], length); j <= HUFFMAN_FAST_MASK; j += 1u << length) {
+                    fast[j] = entry;
+                }
+            }
+            nextCode[length]++;
+        }
+        return true;
+    }
+};
+
+struct BitReader {
+    const uint8_t* data;
+    size_t size;
+    size_t pos = 0;         // Next byte to load (may run past size; see overrun())
+    uint64_t bits = 0;
+    int count = 0;
+
+    BitReader(const uint8_t* bytes, size_t length) : data(bytes), size(length) {}
+
+    void refill() {
+        while (count <= 56) {
+            uint64_t byte = pos < size ? data[pos] : 0;
+            ++pos;
+            bits |= byte << count;
+            count += 8;
+        }
+    }
+
+    uint32_t take(int n) {
+        if (count < n) {
+            refill();
+        }
+        uint32_t result = static_cast<uint32_t>(bits & ((1ull << n) - 1));
+        bits >>= n;
+        count -= n;
+        return result;
+    }
+
+    // True once more bits were consumed than the input holds
+    bool overrun() const { return pos * 8 - static_cast<size_t>(count) > size * 8; }
+
+    int decode(const Huffman& huffman) {
+        if (count < 16) {
+            refill();
+        }
+        uint32_t entry = huffman.fast[bits & HUFFMAN_FAST_MASK];
+        if (entry) {
+            int length = static_cast<int>(entry >> 9);
+            bits >>= length;
+            count -= length;
+            return static_cast<int>(entry & 511);
+        }
+        uint32_t code = reverseBits(static_cast<uint32_t>(bits & 0xFFFF), 16);
+        int length = HUFFMAN_FAST_BITS + 1;
+        while (code >= huffman.maxCode[length]) {
+            ++length;
+        }
+        if (length >= 16) {
+            return -1;
+        }
+        int slot = static_cast<int>(code >> (16 - length)) - huffman.firstCode[length] + huffman.firstSymbol[length];
+        if (slot < 0 || slot >= 288 || huffman.size[slot] != length) {
+            return -1;
+        }
+        bits >>= length;
+        count -= length;
+        return huffman.value[slot];
+    }
+};
+
+bool inflateBlock(BitReader& reader, const Huffman& literals, const Huffman& distances,
+                  std::vector<uint8_t>& out, size_t& outSize) {
+    for (;;) {
+        int symbol = reader.decode(literals);
+        if (symbol < 256) {
+            if (symbol < 0) {
+                return false;
+            }
+            if (outSize == out.size()) {
+                out.resize(std::max<size_t>(out.size() * 2, 4096));
+            }
+            out[outSize++] = static_cast<uint8_t>(symbol);
+            continue;
+        }
+        if (symbol == 256) {
+            return !reader.overrun();
+        }
+
+        symbol -= 257;
+        if (symbol >= 29) {
+            return false;
+        }
+        size_t length = LENGTH_BASE[symbol] + reader.take(LENGTH_EXTRA[symbol]);
+        int distanceSymbol = reader.decode(distances);
+        if (distanceSymbol < 0 || distanceSymbol >= 30) {
+            return false;
+        }
+        size_t distance = DISTANCE_BASE[distanceSymbol] + reader.take(DISTANCE_EXTRA[distanceSymbol]);
+        if (distance > outSize || reader.overrun()) {
+            return false;
+        }
+
+        if (outSize + length > out.size()) {
+            out.resize(std::max(out.size() * 2, outSize + length));
+        }
+        uint8_t* dst = out.data() + outSize;
+        const uint8_t* src = dst - distance;
+        if (distance >= length) {
+            std::memcpy(dst, src, length);
+        } else {
+            for (size_t i = 0; i < length; ++i) {   // Overlapping run
+                dst[i] = src[i];
+            }
+        }
+        outSize += length;
+    }
+}
+
+bool readDynamicTables(BitReader& reader, Huffman& literals, Huffman& distances) {
+    int literalCount = static_cast<int>(reader.take(5)) + 257;
+    int distanceCount = static_cast<int>(reader.take(5)) + 1;
+    int codeLengthCount = static_cast<int>(reader.take(4)) + 4;
+    if (literalCount > 286 || distanceCount > 30) {
+        return false;
+    }
+
+    uint8_t codeLengthSizes[19] = {0};
+    for (int i = 0; i < codeLengthCount; ++i) {
+        codeLengthSizes[CODE_LENGTH_ORDER[i]] = static_cast<uint8_t>(reader.take(3));
+    }
+    Huffman codeLengths;
+    if (!codeLengths.build(codeLengthSizes, 19)) {
+        return false;
+    }
+
+    uint8_t lengths[286 + 30];
+    int total = literalCount + distanceCount;
+    int n = 0;
+    while (n < total) {
+        int symbol = reader.decode(codeLengths);
+        if (symbol < 0 || symbol > 18) {
+            return false;
+        }
+        if (symbol < 16) {
+            lengths[n++] = static_cast<uint8_t>(symbol);
+            continue;
+        }
+        int repeat;
+        uint8_t fill = 0;
+        if (symbol == 16) {
+            if (n == 0) {
+                return false;
+            }
+            repeat = 3 + static_cast<int>(reader.take(2));
+            fill = lengths[n - 1];
+        } else if (symbol == 17) {
+            repeat = 3 + static_cast<int>(reader.take(3));
+        } else {
+            repeat = 11 + static_cast<int>(reader.take(7));
+        }
+        if (n + repeat > total) {
+            return false;
+        }
+        std::memset(lengths + n, fill, repeat);
+        n += repeat;
+    }
+    if (lengths[256] == 0 || reader.overrun()) {
+        return false;   // No end-of-block code
+    }
+    return literals.build(lengths, literalCount) && distances.build(lengths + literalCount, distanceCount);
+}
+
+bool inflateRaw(const uint8_t* data, size_t size, std::vector<uint8_t>& out, size_t expectedSize) {
+    BitReader reader(data, size);
+    out.resize(std::max<size_t>(expectedSize, 4096));
+    size_t outSize = 0;
+
+    Huffman literals;
+    Huffman distances;
+    bool final = false;
+    while (!final) {
+        final = reader.take(1) != 0;
+        uint32_t type = reader.take(2);
+
+        if (type == 0) {
+            // Stored: drop to the byte boundary, hand unread buffered bytes back
+            reader.take(reader.count & 7);
+            reader.pos -= static_cast<size_t>(reader.count / 8);
+            reader.bits = 0;
+            reader.count = 0;
+            if (reader.pos + 4 > size) {
+                return false;
+            }
+            uint16_t length = readLE16(data + reader.pos);
+            uint16_t inverse = readLE16(data + reader.pos + 2);
+            reader.pos += 4;
+            if (static_cast<uint16_t>(~length) != inverse || reader.pos + length > size) {
+                return false;
+            }
+            if (outSize + length > out.size()) {
+                out.resize(std::max(out.size() * 2, outSize + length));
+            }
+            std::memcpy(out.data() + outSize, data + reader.pos, length);
+            outSize += length;
+            reader.pos += length;
+            continue;
+        }
+
+        if (type == 1) {
+            uint8_t lengths[288 + 30];
+            std::memset(lengths, 8, 144);
+            std::memset(lengths + 144, 9, 112);
+            std::memset(lengths + 256, 7, 24);
+            std::memset(lengths + 280, 8, 8);
+            std::memset(lengths + 288, 5, 30);
+            literals.build(lengths, 288);
+            distances.build(lengths + 288, 30);
+        } else if (type == 2) {
+            if (!readDynamicTables(reader, literals, distances)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+
+        if (!inflateBlock(reader, literals, distances, out, outSize)) {
+            return false;
+        }
+    }
+
+    out.resize(outSize);
+    return true;
+}
+
+// ========== PNG ==========
+
+const uint8_t PNG_SIGNATURE[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+
+const uint32_t ADAM7_X0[7] = {0, 4, 0, 2, 0, 1, 0};
+const uint32_t ADAM7_Y0[7] = {0, 0, 4, 0, 2, 0, 1};
+const uint32_t ADAM7_DX[7] = {8, 8, 4, 4, 2, 2, 1};
+const uint32_t ADAM7_DY[7] = {8, 8, 8, 4, 4, 2, 2};
+
+inline uint8_t paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = std::abs(p - a);
+    int pb = std::abs(p - b);
+    int pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return static_cast<uint8_t>(a);
+    }
+    return static_cast<uint8_t>(pb <= pc ? b : c);
+}
+
+bool unfilterRow(uint8_t filter, uint8_t* row, const uint8_t* previous, size_t rowBytes, size_t bpp) {
+    switch (filter) {
+        case 0:
+            break;
+        case 1:
+            for (size_t i = bpp; i < rowBytes; ++i) {
+                row[i] = static_cast<uint8_t>(row[i] + row[i - bpp]);
+            }
+            break;
+        case 2:
+            for (size_t i = 0; i < rowBytes; ++i) {
+                row[i] = static_cast<uint8_t>(row[i] + previous[i]);
+            }
+            break;
+        case 3:
+            for (size_t i = 0; i < bpp && i < rowBytes; ++i) {
+                row[i] = static_cast<uint8_t>(row[i] + (previous[i] >> 1));
+            }
+            for (size_t i = bpp; i < rowBytes; ++i) {
+                row[i] = static_cast<uint8_t>(row[i] + ((row[i - bpp] + previous[i]) >> 1));
+            }
+            break;
+        case 4:
+            for (size_t i = 0; i < bpp && i < rowBytes; ++i) {
+                row[i] = static_cast<uint8_t>(row[i] + previous[i]);   // paeth(0, up, 0) = up
+            }
+            for (size_t i = bpp; i < rowBytes; ++i) {
+                row[i] = static_cast<uint8_t>(row[i] + paeth(row[i - bpp], previous[i], previous[i - bpp]));
+            }
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+struct PngInfo {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint8_t bitDepth = 0;
+    uint8_t colorType = 0;
+    uint8_t interlace = 0;
+    uint32_t samples = 0;               // Per pixel in the file
+    uint8_t palette[256][4];
+    uint32_t paletteSize = 0;
+    bool hasTransparency = false;       // tRNS present
+    uint16_t transparentKey[3] = {0, 0, 0};
+};
+
+// Raw sample k of pixel x in an unfiltered row (full bit depth)
+inline uint32_t pngSample(const PngInfo& png, const uint8_t* row, uint32_t x, uint32_t k) {
+    switch (png.bitDepth) {
+        case 8:  return row[x * png.samples + k];
+        case 16: return (static_cast<uint32_t>(row[(x * png.samples + k) * 2]) << 8) | row[(x * png.samples + k) * 2 + 1];
+        default: {
+            // Sub-byte depths only occur with one sample per pixel
+            uint32_t bit = x * png.bitDepth;
+            return (row[bit >> 3] >> (8 - png.bitDepth - (bit & 7))) & ((1u << png.bitDepth) - 1);
+        }
+    }
+}
+
+inline uint8_t pngTo8Bit(const PngInfo& png, uint32_t value) {
+    switch (png.bitDepth) {
+        case 16: return static_cast<uint8_t>(value >> 8);
+        case 8:  return static_cast<uint8_t>(value);
+        default: return static_cast<uint8_t>(value * (255u / ((1u << png.bitDepth) - 1)));
+    }
+}
+
+bool decodePngRow(const PngInfo& png, const uint8_t* row, uint32_t rowWidth, uint8_t* out,
+                  size_t outStep, uint32_t channels) {
+    // Straight copy when the file already holds the output layout
+    if (png.bitDepth == 8 && png.colorType != 3 && channels == png.samples && outStep == channels) {
+        std::memcpy(out, row, static_cast<size_t>(rowWidth) * channels);
+        return true;
+    }
+
+    for (uint32_t x = 0; x < rowWidth; ++x, out += outStep) {
+        switch (png.colorType) {
+            case 0: {
+                uint32_t gray = pngSample(png, row, x, 0);
+                out[0] = pngTo8Bit(png, gray);
+                if (channels == 2) {
+                    out[1] = (gray == png.transparentKey[0]) ? 0 : 255;
+                }
+                break;
+            }
+            case 2: {
+                uint32_t r = pngSample(png, row, x, 0);
+                uint32_t g = pngSample(png, row, x, 1);
+                uint32_t b = pngSample(png, row, x, 2);
+                out[0] = pngTo8Bit(png, r);
+                out[1] = pngTo8Bit(png, g);
+                out[2] = pngTo8Bit(png, b);
+                if (channels == 4) {
+                    bool key = r == png.transparentKey[0] && g == png.transparentKey[1] && b == png.transparentKey[2];
+                    out[3] = key ? 0 : 255;
+                }
+                break;
+            }
+            case 3: {
+                uint32_t index = pngSample(png, row, x, 0);
+                if (index >= png.paletteSize) {
+                    return false;
+                }
+                std::memcpy(out, png.palette[index], channels);
+                break;
+            }
+            case 4:
+                out[0] = pngTo8Bit(png, pngSample(png, row, x, 0));
+                out[1] = pngTo8Bit(png, pngSample(png, row, x, 1));
+                break;
+            case 6:
+                for (uint32_t k = 0; k < 4; ++k) {
+                    out[k] = pngTo8Bit(png, pngSample(png, row, x, k));
+                }
+                break;
+        }
+    }
+    return true;
+}
+
+bool decodePng(const uint8_t* data, size_t size, DecodedImage& image, const std::string& source) {
+    PngInfo png;
+    std::vector<std::pair<const uint8_t*, size_t>> idatChunks;
+    size_t idatBytes = 0;
+    bool headerSeen = false;
+
+    size_t pos = 8;
+    for (;;) {
+        if (pos + 12 > size) {
+            return fail(source, "truncated PNG chunk");
+        }
+        uint32_t length = readBE32(data + pos);
+        const uint8_t* type = data + pos + 4;
+        const uint8_t* body = data + pos + 8;
+        if (length > size - pos - 12) {
+            return fail(source, "truncated PNG chunk");
+        }
+        pos += 12 + static_cast<size_t>(length);
+
+        if (std::memcmp(type, "IHDR", 4) == 0) {
+            if (length < 13) {
+                return fail(source, "bad IHDR");
+            }
+            png.width = readBE32(body);
+            png.height = readBE32(body + 4);
+            png.bitDepth = body[8];
+            png.colorType = body[9];
+            png.interlace = body[12];
+            if (body[10] != 0 || body[11] != 0 || png.interlace > 1) {
+                return fail(source, "unknown PNG compression, filter or interlace method");
+            }
+            const uint8_t depth = png.bitDepth;
+            bool validDepth;
+            switch (png.colorType) {
+                case 0: png.samples = 1; validDepth = depth == 1 || depth == 2 || depth == 4 || depth == 8 || depth == 16; break;
+                case 2: png.samples = 3; validDepth = depth == 8 || depth == 16; break;
+                case 3: png.samples = 1; validDepth = depth == 1 || depth == 2 || depth == 4 || depth == 8; break;
+                case 4: png.samples = 2; validDepth = depth == 8 || depth == 16; break;
+                case 6: png.samples = 4; validDepth = depth == 8 || depth == 16; break;
+                default: validDepth = false; break;
+            }
+            if (!validDepth) {
+                return fail(source, "invalid PNG color type / bit depth");
+            }
+            if (!validSize(png.width, png.height, 4)) {
+                return fail(source, "image too large");
+            }
+            headerSeen = true;
+        } else if (!headerSeen) {
+            return fail(source, "missing IHDR");
+        } else if (std::memcmp(type, "PLTE", 4) == 0) {
+            png.paletteSize = std::min<uint32_t>(length / 3, 256);
+            for (uint32_t i = 0; i < png.paletteSize; ++i) {
+                png.palette[i][0] = body[i * 3 + 0];
+                png.palette[i][1] = body[i * 3 + 1];
+                png.palette[i][2] = body[i * 3 + 2];
+                png.palette[i][3] = 255;
+            }
+        } else if (std::memcmp(type, "tRNS", 4) == 0) {
+            png.hasTransparency = true;
+            if (png.colorType == 3) {
+                for (uint32_t i = 0; i < std::min<uint32_t>(length, png.paletteSize); ++i) {
+                    png.palette[i][3] = body[i];
+                }
+            } else if (png.colorType == 0 && length >= 2) {
+                png.transparentKey[0] = static_cast<uint16_t>((body[0] << 8) | body[1]);
+            } else if (png.colorType == 2 && length >= 6) {
+                for (int k = 0; k < 3; ++k) {
+                    png.transparentKey[k] = static_cast<uint16_t>((body[k * 2] << 8) | body[k * 2 + 1]);
+                }
+            } else {
+                png.hasTransparency = false;
+            }
+        } else if (std::memcmp(type, "IDAT", 4) == 0) {
+            idatChunks.emplace_back(body, length);
+            idatBytes += length;
+        } else if (std::memcmp(type, "IEND", 4) == 0) {
+            break;
+        } else if (!(type[0] & 0x20)) {
+            return fail(source, "unknown critical PNG chunk");
+        }
+    }
+    if (idatChunks.empty()) {
+        return fail(source, "no image data");
+    }
+    if (png.colorType == 3 && png.paletteSize == 0) {
+        return fail(source, "missing palette");
+    }
+
+    // Output channel count
+    uint32_t channels = png.samples;
+    if (png.colorType == 3) {
+        channels = png.hasTransparency ? 4 : 3;
+    } else if (png.hasTransparency && (png.colorType == 0 || png.colorType == 2)) {
+        channels += 1;
+    }
+
+    // Passes (one unless interlaced) and the filtered size they take
+    const uint32_t bitsPerPixel = png.samples * png.bitDepth;
+    const size_t filterBpp = std::max(1u, bitsPerPixel / 8);
+    const int passCount = png.interlace ? 7 : 1;
+    uint32_t passWidth[7], passHeight[7];
+    size_t rawSize = 0;
+    for (int pass = 0; pass < passCount; ++pass) {
+        uint32_t x0 = png.interlace ? ADAM7_X0[pass] : 0, dx = png.interlace ? ADAM7_DX[pass] : 1;
+        uint32_t y0 = png.interlace ? ADAM7_Y0[pass] : 0, dy = png.interlace ? ADAM7_DY[pass] : 1;
+        passWidth[pass] = png.width > x0 ? (png.width - x0 + dx - 1) / dx : 0;
+        passHeight[pass] = png.height > y0 ? (png.height - y0 + dy - 1) / dy : 0;
+        if (passWidth[pass] && passHeight[pass]) {
+            rawSize += passHeight[pass] * (1 + (static_cast<size_t>(passWidth[pass]) * bitsPerPixel + 7) / 8);
+        }
+    }
+
+    // Inflate the concatenated IDAT payload (no copy for the usual single chunk)
+    std::vector<uint8_t> compressed;
+    const uint8_t* zdata = idatChunks[0].first;
+    if (idatChunks.size() > 1) {
+        compressed.reserve(idatBytes);
+        for (const auto& chunk : idatChunks) {
+            compressed.insert(compressed.end(), chunk.first, chunk.first + chunk.second);
+        }
+        zdata = compressed.data();
+    }
+    std::vector<uint8_t> raw;
+    if (!ImageDecoder::inflateZlib(zdata, idatBytes, raw, rawSize)) {
+        return fail(source, "corrupt compressed data");
+    }
+    if (raw.size() < rawSize) {
+        return fail(source, "image data too short");
+    }
+
+    image.width = png.width;
+    image.height = png.height;
+    image.channels = channels;
+    image.pixels.resize(static_cast<size_t>(png.width) * png.height * channels);
+
+    uint8_t* cursor = raw.data();
+    std::vector<uint8_t> zeroRow;
+    for (int pass = 0; pass < passCount; ++pass) {
+        if (!passWidth[pass] || !passHeight[pass]) {
+            continue;
+        }
+        uint32_t x0 = png.interlace ? ADAM7_X0[pass] : 0, dx = png.interlace ? ADAM7_DX[pass] : 1;
+        uint32_t y0 = png.interlace ? ADAM7_Y0[pass] : 0, dy = png.interlace ? ADAM7_DY[pass] : 1;
+        size_t rowBytes = (static_cast<size_t>(passWidth[pass]) * bitsPerPixel + 7) / 8;
+        zeroRow.assign(rowBytes, 0);
+        const uint8_t* previous = zeroRow.data();
+
+        for (uint32_t y = 0; y < passHeight[pass]; ++y) {
+            uint8_t filter = cursor[0];
+            uint8_t* row = cursor + 1;
+            if (!unfilterRow(filter, row, previous, rowBytes, filterBpp)) {
+                return fail(source, "unknown PNG filter");
+            }
+            uint8_t* out = image.pixels.data() +
+                           ((static_cast<size_t>(y0) + y * dy) * png.width + x0) * channels;
+            if (!decodePngRow(png, row, passWidth[pass], out, static_cast<size_t>(dx) * channels, channels)) {
+                return fail(source, "palette index out of range");
+            }
+            previous = row;
+            cursor += 1 + rowBytes;
+        }
+    }
+    return true;
+}
+
+// ========== BMP ==========
+
+// Shift and bit count of a channel mask, for scaling the channel to 8 bits
+inline uint8_t bmpChannel(uint32_t pixel, uint32_t mask) {
+    if (mask == 0) {
+        return 255;
+    }
+    int shift = 0;
+    while (!(mask & (1u << shift))) {
+        ++shift;
+    }
+    uint32_t maxValue = mask >> shift;
+    uint32_t value = (pixel & mask) >> shift;
+    return static_cast<uint8_t>((value * 255 + maxValue / 2) / maxValue);
+}
+
+bool decodeBmp(const uint8_t* data, size_t size, DecodedImage& image, const std::string& source) {
+    if (size < 54) {
+        return fail(source, "truncated BMP header");
+    }
+    uint32_t pixelOffset = readLE32(data + 10);
+    uint32_t headerSize = readLE32(data + 14);
+    int32_t width = static_cast<int32_t>(readLE32(data + 18));
+    int32_t height = static_cast<int32_t>(readLE32(data + 22));
+    uint16_t bitCount = readLE16(data + 28);
+    uint32_t compression = readLE32(data + 30);
+
+    if (headerSize < 40 || width <= 0 || height == 0 || height == INT32_MIN) {
+        return fail(source, "unsupported BMP header");
+    }
+    if (bitCount != 24 && bitCount != 32) {
+        return fail(source, "only 24-bit and 32-bit BMP files are supported");
+    }
+    bool bitfields = compression == 3;
+    if (compression != 0 && !bitfields) {
+        return fail(source, "compressed BMP files are not supported");
+    }
+
+    uint32_t redMask = 0x00FF0000u, greenMask = 0x0000FF00u, blueMask = 0x000000FFu, alphaMask = 0;
+    if (bitfields) {
+        if (bitCount != 32 || size < 14 + 40 + 12) {
+            return fail(source, "bad BMP bitfields");
+        }
+        redMask = readLE32(data + 54);
+        greenMask = readLE32(data + 58);
+        blueMask = readLE32(data + 62);
+        if (headerSize >= 56 && size >= 70) {
+            alphaMask = readLE32(data + 66);
+        }
+    }
+
+    bool topDown = height < 0;
+    uint32_t w = static_cast<uint32_t>(width);
+    uint32_t h = static_cast<uint32_t>(topDown ? -height : height);
+    uint32_t channels = alphaMask ? 4 : 3;
+    if (!validSize(w, h, channels)) {
+        return fail(source, "image too large");
+    }
+    size_t stride = ((static_cast<size_t>(w) * bitCount / 8) + 3) & ~static_cast<size_t>(3);
+    if (pixelOffset > size || stride * h > size - pixelOffset) {
+        return fail(source, "truncated BMP pixel data");
+    }
+
+    image.width = w;
+    image.height = h;
+    image.channels = channels;
+    image.pixels.resize(static_cast<size_t>(w) * h * channels);
+    for (uint32_t y = 0; y < h; ++y) {
+        const uint8_t* row = data + pixelOffset + stride * (topDown ? y : h - 1 - y);
+        uint8_t* out = image.pixels.data() + static_cast<size_t>(y) * w * channels;
+        for (uint32_t x = 0; x < w; ++x, out += channels) {
+            if (bitCount == 24 || !bitfields) {
+                const uint8_t* px = row + x * (bitCount / 8);
+                out[0] = px[2];
+                out[1] = px[1];
+                out[2] = px[0];
+            } else {
+                uint32_t px = readLE32(row + x * 4);
+                out[0] = bmpChannel(px, redMask);
+                out[1] = bmpChannel(px, greenMask);
+                out[2] = bmpChannel(px, blueMask);
+                if (channels == 4) {
+                    out[3] = bmpChannel(px, alphaMask);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// ========== PNM ==========
+
+bool readPnmNumber(const uint8_t* data, size_t size, size_t& pos, uint32_t& value) {
+    for (;;) {
+        while (pos < size && std::isspace(data[pos])) {
+            ++pos;
+        }
+        if (pos < size && data[pos] == '#') {
+            while (pos < size && data[pos] != '\n') {
+                ++pos;
+            }
+            continue;
+        }
+        break;
+    }
+    if (pos >= size || data[pos] < '0' || data[pos] > '9') {
+        return false;
+    }
+    uint64_t number = 0;
+    while (pos < size && data[pos] >= '0' && data[pos] <= '9' && number <= 0xFFFFFFFFull) {
+        number = number * 10 + (data[pos++] - '0');
+    }
+    value = static_cast<uint32_t>(std::min<uint64_t>(number, 0xFFFFFFFFull));
+    return true;
+}
+
+bool decodePnm(const uint8_t* data, size_t size, DecodedImage& image, const std::string& source) {
+    uint32_t channels = data[1] == '5' ? 1 : 3;
+    size_t pos = 2;
+    uint32_t width, height, maxValue;
+    if (!readPnmNumber(data, size, pos, width) || !readPnmNumber(data, size, pos, height) ||
+        !readPnmNumber(data, size, pos, maxValue) || pos >= size) {
+        return fail(source, "bad PNM header");
+    }
+    ++pos;   // Single whitespace before the samples
+    if (maxValue == 0 || maxValue > 65535 || !validSize(width, height, channels)) {
+        return fail(source, "unsupported PNM size or range");
+    }
+    size_t sampleBytes = maxValue > 255 ? 2 : 1;
+    size_t sampleCount = static_cast<size_t>(width) * height * channels;
+    if (sampleCount * sampleBytes > size - pos) {
+        return fail(source, "truncated PNM data");
+    }
+
+    image.width = width;
+    image.height = height;
+    image.channels = channels;
+    image.pixels.resize(sampleCount);
+    const uint8_t* samples = data + pos;
+    if (maxValue == 255) {
+        std::memcpy(image.pixels.data(), samples, sampleCount);
+    } else {
+        for (size_t i = 0; i < sampleCount; ++i) {
+            uint32_t value = sampleBytes == 2 ? (samples[i * 2] << 8) | samples[i * 2 + 1] : samples[i];
+            image.pixels[i] = static_cast<uint8_t>((std::min(value, maxValue) * 255 + maxValue / 2) / maxValue);
+        }
+    }
+    return true;
+}
+
+// ========== TGA ==========
+
+bool decodeTga(const uint8_t* data, size_t size, DecodedImage& image, const std::string& source) {
+    if (size < 18) {
+        return fail(source, "unknown image format");
+    }
+    uint8_t idLength = data[0];
+    uint8_t colorMapType = data[1];
+    uint8_t imageType = data[2];
+    uint32_t width = readLE16(data + 12);
+    uint32_t height = readLE16(data + 14);
+    uint8_t depth = data[16];
+    uint8_t descriptor = data[17];
+
+    bool rle = imageType == 10 || imageType == 11;
+    bool gray = imageType == 3 || imageType == 11;
+    bool validDepth = gray ? depth == 8 : (depth == 24 || depth == 32);
+    if (colorMapType != 0 || !(imageType == 2 || imageType == 3 || rle) || !validDepth) {
+        return fail(source, "unknown image format (or unsupported TGA variant)");
+    }
+
+    uint32_t channels = depth / 8;
+    if (!validSize(width, height, channels)) {
+        return fail(source, "image too large");
+    }
+
+    image.width = width;
+    image.height = height;
+    image.channels = channels;
+    image.pixels.resize(static_cast<size_t>(width) * height * channels);
+
+    // Read the pixels in file order, then fix the channel order and row direction
+    size_t pos = 18 + static_cast<size_t>(idLength);
+    size_t total = image.pixels.size();
+    uint8_t* out = image.pixels.data();
+    if (!rle) {
+        if (pos > size || total > size - pos) {
+            return fail(source, "truncated TGA data");
+        }
+        std::memcpy(out, data + pos, total);
+    } else {
+        size_t written = 0;
+        while (written < total) {
+            if (pos >= size) {
+                return fail(source, "truncated TGA data");
+            }
+            uint8_t header = data[pos++];
+            size_t count = static_cast<size_t>(header & 0x7F) + 1;
+            size_t bytes = std::min(count * channels, total - written);
+            if (header & 0x80) {
+                if (pos + channels > size) {
+                    return fail(source, "truncated TGA data");
+                }
+                for (size_t i = 0; i < bytes; i += channels) {
+                    std::memcpy(out + written + i, data + pos, channels);
+                }
+                pos += channels;
+            } else {
+                if (pos + count * channels > size) {
+                    return fail(source, "truncated TGA data");
+                }
+                std::memcpy(out + written, data + pos, bytes);
+                pos += count * channels;
+            }
+            written += bytes;
+        }
+    }
+
+    if (channels >= 3) {
+        for (size_t i = 0; i < total; i += channels) {
+            std::swap(out[i], out[i + 2]);   // BGR(A) -> RGB(A)
+        }
+    }
+    if (!(descriptor & 0x20)) {
+        // Bottom-up rows
+        size_t stride = static_cast<size_t>(width) * channels;
+        for (uint32_t y = 0; y < height / 2; ++y) {
+            std::swap_ranges(out + y * stride, out + (y + 1) * stride, out + (height - 1 - y) * stride);
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+// ========== ImageDecoder ==========
+
+bool ImageDecoder::load(const std::string& filepath, DecodedImage& outImage) {
+    MappedFile file;
+    if (!file.open(filepath)) {
+        std::cerr << "[ERROR] Cannot open image file: " << filepath << std::endl;
+        return false;
+    }
+    return decode(file.getData(), file.getSize(), outImage, filepath);
+}
+
+bool ImageDecoder::decode(const uint8_t* data, size_t size, DecodedImage& outImage, const std::string& sourceName) {
+    outImage = DecodedImage();
+    if (!data || size < 4) {
+        return fail(sourceName, "file too small");
+    }
+
+    bool ok;
+    if (size >= 8 && std::memcmp(data, PNG_SIGNATURE, 8) == 0) {
+        ok = decodePng(data, size, outImage, sourceName);
+    } else if (data[0] == 'B' && data[1] == 'M') {
+        ok = decodeBmp(data, size, outImage, sourceName);
+    } else if (data[0] == 'P' && (data[1] == '5' || data[1] == '6') && std::isspace(data[2])) {
+        ok = decodePnm(data, size, outImage, sourceName);
+    } else if (data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF) {
+        ok = fail(sourceName, "JPEG is not supported, convert the texture to PNG");
+    } else {
+        ok = decodeTga(data, size, outImage, sourceName);   // TGA has no signature
+    }
+
+    if (!ok) {
+        outImage = DecodedImage();
+    }
+    return ok;
+}
+
+bool ImageDecoder::inflateZlib(const uint8_t* data, size_t size, std::vector<uint8_t>& out, size_t expectedSize) {
+    // 2-byte header: deflate, no preset dictionary; the Adler-32 trailer is not checked
+    if (size < 2 || (data[0] & 0x0F) != 8 || ((data[0] << 8) | data[1]) % 31 != 0 || (data[1] & 0x20)) {
+        return false;
+    }
+    return inflateRaw(data + 2, size - 2, out, expectedSize);
+}
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rs_engine {
+namespace resource {
+
+/**
+ * @brief Decoded 8-bit image, rows top to bottom, channels interleaved
+ */
+struct DecodedImage {
+    std::vector<uint8_t> pixels;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t channels = 0;      // 1 = gray, 2 = gray + alpha, 3 = RGB, 4 = RGBA
+};
+
+/**
+ * @brief Image file decoder (no external dependencies)
+ *
+ * Formats, detected from the file contents:
+ * - PNG: all color types and bit depths, palette + tRNS, Adam7 interlacing
+ *   (16-bit channels are reduced to 8 bits)
+ * - TGA: true color / grayscale, raw or RLE, 8/24/32 bits
+ * - BMP: 24-bit and 32-bit (BI_RGB / BI_BITFIELDS), bottom-up or top-down
+ * - PNM: binary PGM (P5) and PPM (P6)
+ *
+ * JPEG is not supported; convert such textures to PNG (or KTX2) offline.
+ * Channel counts follow the file: a PNG with transparency gives 4, an
+ * opaque one 3. Decoding touches no shared state and may run on any thread.
+ *
+ * Platform Support: 100% shared
+ */
+class ImageDecoder {
+public:
+    /**
+     * @brief Decode an image file (read through a memory mapping)
+     * @return false (with a logged reason) if the file cannot be read or decoded
+     */
+    static bool load(const std::string& filepath, DecodedImage& outImage);
+
+    /**
+     * @brief Decode an image held in memory
+     */
+    static bool decode(const uint8_t* data, size_t size, DecodedImage& outImage, const std::string& sourceName);
+
+    /**
+     * @brief Inflate a zlib stream (RFC 1950 / 1951)
+     * @param expectedSize Output size if known (reserved up front, 0 = unknown)
+     * @return false on a malformed stream
+     */
+    static bool inflateZlib(const uint8_t* data, size_t size, std::vector<uint8_t>& out, size_t expectedSize = 0);
+};
+
+} // namespace resource
+} // namespace rs_engine
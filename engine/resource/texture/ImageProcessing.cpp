@@ -0,0 +1,218 @@
+#include "ImageProcessing.h"
+#include "../../core/JobSystem.h"
+#include "../../core/math/SIMD.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(RS_SIMD_SSE2) && defined(__SSSE3__)
+    #include <tmmintrin.h>
+#endif
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+constexpr size_t MIP_ROWS_CHUNK_BYTES = 32 * 1024;     // Output bytes per parallelFor chunk
+constexpr size_t MIP_SERIAL_LEVEL_BYTES = 64 * 1024;   // Smaller levels are not split
+
+// Scalar 2x2 box for one output row (any channel count, clamps x for width 1)
+void downsampleRowScalar(const uint8_t* row0, const uint8_t* row1, uint32_t srcWidth, uint32_t channels,
+                         uint32_t dstBegin, uint32_t dstEnd, uint8_t* dst) {
+    for (uint32_t x = dstBegin; x < dstEnd; ++x) {
+        uint32_t x0 = 2 * x;
+        uint32_t x1 = std::min(x0 + 1, srcWidth - 1);
+        for (uint32_t c = 0; c < channels; ++c) {
+            uint32_t sum = row0[x0 * channels + c] + row0[x1 * channels + c] +
+                           row1[x0 * channels + c] + row1[x1 * channels + c];
+            dst[x * channels + c] = static_cast<uint8_t>((sum + 2) >> 2);
+        }
+    }
+}
+
+// RGBA8 2x2 box, returns the number of output pixels written (multiple of the vector width)
+uint32_t downsampleRowRGBA(const uint8_t* row0, const uint8_t* row1, uint32_t dstWidth, uint8_t* dst) {
+    uint32_t x = 0;
+#if defined(RS_SIMD_SSE2)
+    // 8 source pixels (two registers) per row -> 4 output pixels
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(2);
+    for (; x + 4 <= dstWidth; x += 4) {
+        __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8));
+        __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8 + 16));
+        __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8));
+        __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8 + 16));
+        // Vertical sums, 2 pixels (8 x u16) per register
+        __m128i s01 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+        __m128i s23 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+        __m128i s45 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+        __m128i s67 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+        // Horizontal pairs: even pixels + odd pixels
+        __m128i d01 = _mm_add_epi16(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23));
+        __m128i d23 = _mm_add_epi16(_mm_unpacklo_epi64(s45, s67), _mm_unpackhi_epi64(s45, s67));
+        d01 = _mm_srli_epi16(_mm_add_epi16(d01, round), 2);
+        d23 = _mm_srli_epi16(_mm_add_epi16(d23, round), 2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), _mm_packus_epi16(d01, d23));
+    }
+#elif defined(RS_SIMD_WASM)
+    const v128_t round = wasm_i16x8_splat(2);
+    for (; x + 4 <= dstWidth; x += 4) {
+        v128_t a0 = wasm_v128_load(row0 + x * 8);
+        v128_t a1 = wasm_v128_load(row0 + x * 8 + 16);
+        v128_t b0 = wasm_v128_load(row1 + x * 8);
+        v128_t b1 = wasm_v128_load(row1 + x * 8 + 16);
+        v128_t s01 = wasm_i16x8_add(wasm_u16x8_extend_low_u8x16(a0), wasm_u16x8_extend_low_u8x16(b0));
+        v128_t s23 = wasm_i16x8_add(wasm_u16x8_extend_high_u8x16(a0), wasm_u16x8_extend_high_u8x16(b0));
+        v128_t s45 = wasm_i16x8_add(wasm_u16x8_extend_low_u8x16(a1), wasm_u16x8_extend_low_u8x16(b1));
+        v128_t s67 = wasm_i16x8_add(wasm_u16x8_extend_high_u8x16(a1), wasm_u16x8_extend_high_u8x16(b1));
+        v128_t d01 = wasm_i16x8_add(wasm_i64x2_shuffle(s01, s23, 0, 2), wasm_i64x2_shuffle(s01, s23, 1, 3));
+        v128_t d23 = wasm_i16x8_add(wasm_i64x2_shuffle(s45, s67, 0, 2), wasm_i64x2_shuffle(s45, s67, 1, 3));
+        d01 = wasm_u16x8_shr(wasm_i16x8_add(d01, round), 2);
+        d23 = wasm_u16x8_shr(wasm_i16x8_add(d23, round), 2);
+        wasm_v128_store(dst + x * 4, wasm_u8x16_narrow_i16x8(d01, d23));
+    }
+#elif defined(RS_SIMD_NEON)
+    // Deinterleave 16 source pixels per row; pairwise adds give the horizontal sums
+    for (; x + 8 <= dstWidth; x += 8) {
+        uint8x16x4_t a = vld4q_u8(row0 + x * 8);
+        uint8x16x4_t b = vld4q_u8(row1 + x * 8);
+        uint8x8x4_t out;
+        for (int c = 0; c < 4; ++c) {
+            uint16x8_t sum = vpadalq_u8(vpaddlq_u8(a.val[c]), b.val[c]);
+            out.val[c] = vrshrn_n_u16(sum, 2);
+        }
+        vst4_u8(dst + x * 4, out);
+    }
+#endif
+    (void)dstWidth;
+    (void)row0;
+    (void)row1;
+    (void)dst;
+    return x;
+}
+
+} // namespace
+
+void ImageProcessing::expandRGBToRGBA(const uint8_t* src, uint8_t* dst, size_t pixelCount, uint8_t alpha) {
+    size_t i = 0;
+#if defined(RS_SIMD_SSE2) && defined(__SSSE3__)
+    // 16-byte loads cover 5.33 pixels; stop while a full load stays inside src
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alphaBits = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+    for (; i + 6 <= pixelCount; i += 4) {
+        __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4),
+                         _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alphaBits));
+    }
+#elif defined(RS_SIMD_WASM)
+    // Swizzle indices >= 16 produce 0
+    const v128_t shuffle = wasm_i8x16_make(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const v128_t alphaBits = wasm_i32x4_splat(static_cast<int32_t>(static_cast<uint32_t>(alpha) << 24));
+    for (; i + 6 <= pixelCount; i += 4) {
+        v128_t rgb = wasm_v128_load(src + i * 3);
+        wasm_v128_store(dst + i * 4, wasm_v128_or(wasm_i8x16_swizzle(rgb, shuffle), alphaBits));
+    }
+#elif defined(RS_SIMD_NEON)
+    for (; i + 16 <= pixelCount; i += 16) {
+        uint8x16x3_t rgb = vld3q_u8(src + i * 3);
+        uint8x16x4_t rgba;
+        rgba.val[0] = rgb.val[0];
+        rgba.val[1] = rgb.val[1];
+        rgba.val[2] = rgb.val[2];
+        rgba.val[3] = vdupq_n_u8(alpha);
+        vst4q_u8(dst + i * 4, rgba);
+    }
+#else
+    // Plain SSE2 has no byte shuffle: 4 pixels as three 32-bit words -> four
+    // (all supported targets are little-endian)
+    const uint32_t alphaBits = static_cast<uint32_t>(alpha) << 24;
+    for (; i + 4 <= pixelCount; i += 4) {
+        uint32_t w[3];
+        std::memcpy(w, src + i * 3, sizeof(w));
+        uint32_t out[4] = {
+            (w[0] & 0x00FFFFFFu) | alphaBits,
+            ((w[0] >> 24) | (w[1] << 8)) & 0x00FFFFFFu,
+            ((w[1] >> 16) | (w[2] << 16)) & 0x00FFFFFFu,
+            w[2] >> 8
+        };
+        out[1] |= alphaBits;
+        out[2] |= alphaBits;
+        out[3] |= alphaBits;
+        std::memcpy(dst + i * 4, out, sizeof(out));
+    }
+#endif
+    for (; i < pixelCount; ++i) {
+        dst[i * 4 + 0] = src[i * 3 + 0];
+        dst[i * 4 + 1] = src[i * 3 + 1];
+        dst[i * 4 + 2] = src[i * 3 + 2];
+        dst[i * 4 + 3] = alpha;
+    }
+}
+
+void ImageProcessing::downsample2x(const uint8_t* src, uint32_t width, uint32_t height, uint32_t channels,
+                                   uint8_t* dst, JobSystem* jobs) {
+    const uint32_t dstWidth = std::max(1u, width / 2);
+    const uint32_t dstHeight = std::max(1u, height / 2);
+    const size_t srcStride = static_cast<size_t>(width) * channels;
+    const size_t dstStride = static_cast<size_t>(dstWidth) * channels;
+
+    auto rows = [&](size_t rowBegin, size_t rowEnd) {
+        for (size_t y = rowBegin; y < rowEnd; ++y) {
+            const uint8_t* row0 = src + (2 * y) * srcStride;
+            const uint8_t* row1 = src + std::min<size_t>(2 * y + 1, height - 1) * srcStride;
+            uint8_t* out = dst + y * dstStride;
+            uint32_t done = (channels == 4 && width >= 2) ? downsampleRowRGBA(row0, row1, dstWidth, out) : 0;
+            downsampleRowScalar(row0, row1, width, channels, done, dstWidth, out);
+        }
+    };
+
+    if (!jobs || dstStride * dstHeight < MIP_SERIAL_LEVEL_BYTES) {
+        rows(0, dstHeight);
+    } else {
+        size_t grain = std::max<size_t>(1, MIP_ROWS_CHUNK_BYTES / dstStride);
+        jobs->parallelFor(dstHeight, grain, rows);
+    }
+}
+
+uint32_t ImageProcessing::getMipLevelCount(uint32_t width, uint32_t height) {
+    uint32_t levels = 1;
+    uint32_t size = std::max(width, height);
+    while (size > 1) {
+        size >>= 1;
+        ++levels;
+    }
+    return levels;
+}
+
+void ImageProcessing::buildMipChain(const uint8_t* level0, uint32_t width, uint32_t height, uint32_t channels,
+                                    bool fullChain, std::vector<uint8_t>& out, std::vector<MipLevelInfo>& levels,
+                                    JobSystem* jobs) {
+    const uint32_t levelCount = fullChain ? getMipLevelCount(width, height) : 1;
+    const uint32_t outChannels = channels == 3 ? 4 : channels;
+
+    // Lay out every level first so the chain is one allocation
+    levels.resize(levelCount);
+    size_t totalBytes = 0;
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        levels[level].offset = totalBytes;
+        levels[level].width = std::max(1u, width >> level);
+        levels[level].height = std::max(1u, height >> level);
+        totalBytes += static_cast<size_t>(levels[level].width) * levels[level].height * outChannels;
+    }
+    out.resize(totalBytes);
+
+    const size_t pixelCount = static_cast<size_t>(width) * height;
+    if (channels == 3) {
+        expandRGBToRGBA(level0, out.data(), pixelCount);
+    } else {
+        std::memcpy(out.data(), level0, pixelCount * channels);
+    }
+    for (uint32_t level = 1; level < levelCount; ++level) {
+        const MipLevelInfo& parent = levels[level - 1];
+        downsample2x(out.data() + parent.offset, parent.width, parent.height, outChannels,
+                     out.data() + levels[level].offset, jobs);
+    }
+}
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rs_engine {
+
+class JobSystem;
+
+namespace resource {
+
+/**
+ * @brief One level of a mip chain stored back to back in a single array
+ */
+struct MipLevelInfo {
+    size_t offset = 0;      // Byte offset of the level
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+/**
+ * @brief CPU-side 8-bit image operations used to prepare texture uploads
+ *
+ * Inner loops are vectorized per target:
+ * - Native x86-64: SSE2 (SSSE3 byte shuffles when the build enables them)
+ * - Web: WebAssembly SIMD128
+ * - Native ARM64: NEON
+ * - Anything else: scalar code with identical results
+ *
+ * Mip generation splits rows across the workers of the JobSystem it is
+ * given (serial without one) and may be called from any thread, including
+ * from a JobSystem task.
+ *
+ * Platform Support: 100% shared
+ */
+class ImageProcessing {
+public:
+    /**
+     * @brief Expand tightly packed RGB8 pixels to RGBA8 (WebGPU has no RGB8 format)
+     * @param dst pixelCount * 4 bytes (must not overlap src)
+     */
+    static void expandRGBToRGBA(const uint8_t* src, uint8_t* dst, size_t pixelCount, uint8_t alpha = 255);
+
+    /**
+     * @brief Halve an image with a 2x2 box filter (rounded average)
+     *
+     * The result is max(1, w/2) x max(1, h/2). For odd sizes the last
+     * column / row is dropped, as in most GPU mip chains; a size of 1 is
+     * kept and only the other axis is filtered.
+     * @param channels 1, 2 or 4 bytes per pixel
+     * @param dst max(1, w/2) * max(1, h/2) * channels bytes
+     * @param jobs Workers for large levels (nullptr = calling thread only)
+     */
+    static void downsample2x(const uint8_t* src, uint32_t width, uint32_t height, uint32_t channels,
+                             uint8_t* dst, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Number of levels in a full chain down to 1x1
+     */
+    static uint32_t getMipLevelCount(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Build a mip chain from a level 0 image
+     *
+     * RGB input is expanded to RGBA while level 0 is copied in, so the
+     * chain is always in a format WebGPU can sample.
+     * @param channels 1, 2, 3 or 4 bytes per pixel
+     * @param fullChain false = level 0 only
+     * @param out Output: all levels back to back, level 0 first (1, 2 or 4 channels)
+     * @param levels Output: placement of each level in out
+     * @param jobs Workers for large levels (nullptr = calling thread only)
+     */
+    static void buildMipChain(const uint8_t* level0, uint32_t width, uint32_t height, uint32_t channels,
+                              bool fullChain, std::vector<uint8_t>& out, std::vector<MipLevelInfo>& levels,
+                              JobSystem* jobs = nullptr);
+};
+
+} // namespace resource
+} // namespace rs_engine
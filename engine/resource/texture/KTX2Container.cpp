@@ -0,0 +1,409 @@
+#include "KTX2Container.h"
+#include "ImageDecoder.h"
+#include "../../core/MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace rs_engine {
+namespace resource {
+
+namespace {
+
+const uint8_t KTX2_IDENTIFIER[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+constexpr size_t HEADER_SIZE = 80;
+constexpr size_t LEVEL_INDEX_ENTRY_SIZE = 24;
+constexpr uint32_t MAX_TEXTURE_DIMENSION = 32768;
+constexpr uint64_t MAX_TEXTURE_BYTES = 1ull << 31;
+
+// Supercompression schemes
+constexpr uint32_t SUPERCOMPRESSION_NONE = 0;
+constexpr uint32_t SUPERCOMPRESSION_BASISLZ = 1;
+constexpr uint32_t SUPERCOMPRESSION_ZSTD = 2;
+constexpr uint32_t SUPERCOMPRESSION_ZLIB = 3;
+
+// Data format descriptor values (Khronos Data Format Specification 1.3)
+constexpr uint32_t DF_VERSION_1_3 = 2;
+constexpr uint8_t DF_MODEL_RGBSDA = 1;
+constexpr uint8_t DF_MODEL_BC1A = 128;
+constexpr uint8_t DF_MODEL_BC3 = 130;
+constexpr uint8_t DF_MODEL_BC5 = 132;
+constexpr uint8_t DF_MODEL_BC7 = 134;
+constexpr uint8_t DF_MODEL_ETC2 = 161;
+constexpr uint8_t DF_MODEL_ASTC = 162;
+constexpr uint8_t DF_PRIMARIES_BT709 = 1;
+constexpr uint8_t DF_TRANSFER_LINEAR = 1;
+constexpr uint8_t DF_TRANSFER_SRGB = 2;
+constexpr uint8_t DF_SAMPLE_LINEAR = 0x10;     // Channel qualifier: not sRGB encoded (alpha)
+constexpr uint8_t DF_CHANNEL_ALPHA = 15;
+
+/**
+ * vkFormat values with an engine format. BC1 RGB blocks decode like RGBA
+ * blocks except for the transparent palette entry, so both map to BC1_RGBA.
+ */
+struct VkFormatEntry {
+    uint32_t vkFormat;
+    TextureFormat format;
+    bool srgb;
+};
+
+const VkFormatEntry VK_FORMATS[] = {
+    {9, TextureFormat::R8, false},            // VK_FORMAT_R8_UNORM
+    {16, TextureFormat::RG8, false},          // VK_FORMAT_R8G8_UNORM
+    {37, TextureFormat::RGBA8, false},        // VK_FORMAT_R8G8B8A8_UNORM
+    {43, TextureFormat::RGBA8, true},         // VK_FORMAT_R8G8B8A8_SRGB
+    {133, TextureFormat::BC1_RGBA, false},    // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+    {134, TextureFormat::BC1_RGBA, true},     // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+    {131, TextureFormat::BC1_RGBA, false},    // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+    {132, TextureFormat::BC1_RGBA, true},     // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+    {137, TextureFormat::BC3_RGBA, false},    // VK_FORMAT_BC3_UNORM_BLOCK
+    {138, TextureFormat::BC3_RGBA, true},     // VK_FORMAT_BC3_SRGB_BLOCK
+    {141, TextureFormat::BC5_RG, false},      // VK_FORMAT_BC5_UNORM_BLOCK
+    {145, TextureFormat::BC7_RGBA, false},    // VK_FORMAT_BC7_UNORM_BLOCK
+    {146, TextureFormat::BC7_RGBA, true},     // VK_FORMAT_BC7_SRGB_BLOCK
+    {147, TextureFormat::ETC2_RGB8, false},   // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+    {148, TextureFormat::ETC2_RGB8, true},    // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+    {151, TextureFormat::ETC2_RGBA8, false},  // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+    {152, TextureFormat::ETC2_RGBA8, true},   // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+    {157, TextureFormat::ASTC_4x4, false},    // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+    {158, TextureFormat::ASTC_4x4, true},     // VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+};
+
+bool fail(const std::string& source, const char* reason) {
+    std::cerr << "[ERROR] Cannot read KTX2 file '" << source << "': " << reason << std::endl;
+    return false;
+}
+
+inline uint32_t readLE32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+inline uint64_t readLE64(const uint8_t* p) {
+    return static_cast<uint64_t>(readLE32(p)) | (static_cast<uint64_t>(readLE32(p + 4)) << 32);
+}
+
+inline void appendLE32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+inline void appendLE64(std::vector<uint8_t>& out, uint64_t value) {
+    appendLE32(out, static_cast<uint32_t>(value));
+    appendLE32(out, static_cast<uint32_t>(value >> 32));
+}
+
+struct DfdSample {
+    uint16_t bitOffset;
+    uint8_t bitLength;
+    uint8_t channel;
+    uint32_t upper;
+};
+
+/**
+ * Basic data format descriptor for a format: one block with one sample per
+ * channel (uncompressed) or per compressed sub-block.
+ */
+std::vector<uint8_t> buildDataFormatDescriptor(TextureFormat format, bool srgb) {
+    const TextureFormatInfo info = getTextureFormatInfo(format);
+    uint8_t model = DF_MODEL_RGBSDA;
+    DfdSample samples[4] = {};
+    size_t sampleCount = 0;
+    switch (format) {
+        case TextureFormat::R8:
+            samples[0] = {0, 8, 0, 255};
+            sampleCount = 1;
+            break;
+        case TextureFormat::RG8:
+            samples[0] = {0, 8, 0, 255};
+            samples[1] = {8, 8, 1, 255};
+            sampleCount = 2;
+            break;
+        case TextureFormat::RGBA8:
+            samples[0] = {0, 8, 0, 255};
+            samples[1] = {8, 8, 1, 255};
+            samples[2] = {16, 8, 2, 255};
+            samples[3] = {24, 8, DF_CHANNEL_ALPHA, 255};
+            sampleCount = 4;
+            break;
+        case TextureFormat::BC1_RGBA:
+            model = DF_MODEL_BC1A;
+            samples[0] = {0, 64, 1, 0xFFFFFFFFu};     // BC1A_ALPHAPRESENT
+            sampleCount = 1;
+            break;
+        case TextureFormat::BC3_RGBA:
+            model = DF_MODEL_BC3;
+            samples[0] = {0, 64, DF_CHANNEL_ALPHA, 0xFFFFFFFFu};
+            samples[1] = {64, 64, 0, 0xFFFFFFFFu};
+            sampleCount = 2;
+            break;
+        case TextureFormat::BC5_RG:
+            model = DF_MODEL_BC5;
+            samples[0] = {0, 64, 0, 0xFFFFFFFFu};
+            samples[1] = {64, 64, 1, 0xFFFFFFFFu};
+            sampleCount = 2;
+            break;
+        case TextureFormat::BC7_RGBA:
+            model = DF_MODEL_BC7;
+            samples[0] = {0, 128, 0, 0xFFFFFFFFu};
+            sampleCount = 1;
+            break;
+        case TextureFormat::ETC2_RGB8:
+            model = DF_MODEL_ETC2;
+            samples[0] = {0, 64, 2, 0xFFFFFFFFu};     // ETC2_COLOR
+            sampleCount = 1;
+            break;
+        case TextureFormat::ETC2_RGBA8:
+            model = DF_MODEL_ETC2;
+            samples[0] = {0, 64, DF_CHANNEL_ALPHA, 0xFFFFFFFFu};
+            samples[1] = {64, 64, 2, 0xFFFFFFFFu};
+            sampleCount = 2;
+            break;
+        case TextureFormat::ASTC_4x4:
+            model = DF_MODEL_ASTC;
+            samples[0] = {0, 128, 0, 0xFFFFFFFFu};
+            sampleCount = 1;
+            break;
+        default:
+            return {};
+    }
+
+    const uint32_t blockSize = 24 + 16 * static_cast<uint32_t>(sampleCount);
+    std::vector<uint8_t> dfd;
+    appendLE32(dfd, 4 + blockSize);                     // dfdTotalSize
+    appendLE32(dfd, 0);                                 // vendorId = Khronos, descriptorType = basic
+    appendLE32(dfd, DF_VERSION_1_3 | (blockSize << 16));
+    dfd.push_back(model);
+    dfd.push_back(DF_PRIMARIES_BT709);
+    dfd.push_back(srgb ? DF_TRANSFER_SRGB : DF_TRANSFER_LINEAR);
+    dfd.push_back(0);                                   // Straight alpha
+    dfd.push_back(static_cast<uint8_t>(info.blockWidth - 1));
+    dfd.push_back(static_cast<uint8_t>(info.blockHeight - 1));
+    dfd.push_back(0);
+    dfd.push_back(0);
+    dfd.push_back(static_cast<uint8_t>(info.blockBytes));   // bytesPlane0
+    dfd.insert(dfd.end(), 7, 0);
+    for (size_t i = 0; i < sampleCount; ++i) {
+        const DfdSample& sample = samples[i];
+        uint8_t channelType = sample.channel;
+        if (srgb && sample.channel == DF_CHANNEL_ALPHA && !info.compressed) {
+            channelType |= DF_SAMPLE_LINEAR;
+        }
+        appendLE32(dfd, sample.bitOffset | (static_cast<uint32_t>(sample.bitLength - 1) << 16) |
+                        (static_cast<uint32_t>(channelType) << 24));
+        appendLE32(dfd, 0);                             // samplePosition
+        appendLE32(dfd, 0);                             // sampleLower
+        appendLE32(dfd, sample.upper);
+    }
+    return dfd;
+}
+
+} // namespace
+
+// ========== KTX2Container ==========
+
+bool KTX2Container::isKTX2(const uint8_t* data, size_t size) {
+    return data && size >= sizeof(KTX2_IDENTIFIER) && std::memcmp(data, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0;
+}
+
+bool KTX2Container::load(const std::string& filepath, KTX2Image& outImage) {
+    MappedFile file;
+    if (!file.open(filepath)) {
+        std::cerr << "[ERROR] Cannot open KTX2 file: " << filepath << std::endl;
+        return false;
+    }
+    return decode(file.getData(), file.getSize(), outImage, filepath);
+}
+
+bool KTX2Container::decode(const uint8_t* data, size_t size, KTX2Image& outImage, const std::string& sourceName) {
+    outImage = KTX2Image();
+    if (!isKTX2(data, size) || size < HEADER_SIZE) {
+        return fail(sourceName, "not a KTX2 file");
+    }
+
+    const uint32_t vkFormat = readLE32(data + 12);
+    const uint32_t width = readLE32(data + 20);
+    const uint32_t height = readLE32(data + 24);
+    const uint32_t depth = readLE32(data + 28);
+    const uint32_t layerCount = readLE32(data + 32);
+    const uint32_t faceCount = readLE32(data + 36);
+    const uint32_t levelCount = std::max(1u, readLE32(data + 40));   // 0 = "generate mips", one level stored
+    const uint32_t supercompression = readLE32(data + 44);
+
+    if (supercompression == SUPERCOMPRESSION_BASISLZ || vkFormat == 0) {
+        return fail(sourceName, "Basis Universal textures must be transcoded offline (e.g. ktx transcode)");
+    }
+    if (supercompression == SUPERCOMPRESSION_ZSTD) {
+        return fail(sourceName, "Zstd supercompression is not supported (re-encode without --zstd, or use zlib)");
+    }
+    if (supercompression != SUPERCOMPRESSION_NONE && supercompression != SUPERCOMPRESSION_ZLIB) {
+        return fail(sourceName, "unknown supercompression scheme");
+    }
+    if (height == 0 || depth > 1 || layerCount > 1 || faceCount != 1) {
+        return fail(sourceName, "only single 2D textures are supported (no 1D, 3D, arrays or cube maps)");
+    }
+    if (width == 0 || width > MAX_TEXTURE_DIMENSION || height > MAX_TEXTURE_DIMENSION ||
+        levelCount > ImageProcessing::getMipLevelCount(width, height)) {
+        return fail(sourceName, "invalid dimensions or level count");
+    }
+
+    const VkFormatEntry* entry = nullptr;
+    for (const VkFormatEntry& candidate : VK_FORMATS) {
+        if (candidate.vkFormat == vkFormat) {
+            entry = &candidate;
+        }
+    }
+    if (!entry) {
+        return fail(sourceName, "unsupported vkFormat");
+    }
+    const TextureFormatInfo info = getTextureFormatInfo(entry->format);
+    if (width % info.blockWidth != 0 || height % info.blockHeight != 0) {
+        return fail(sourceName, "size is not a whole number of blocks (required by WebGPU)");
+    }
+    if (size < HEADER_SIZE + static_cast<size_t>(levelCount) * LEVEL_INDEX_ENTRY_SIZE) {
+        return fail(sourceName, "truncated level index");
+    }
+
+    // Lay the levels out back to back, level 0 first
+    uint64_t totalSize = 0;
+    outImage.levels.resize(levelCount);
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        MipLevelInfo& mip = outImage.levels[level];
+        mip.offset = static_cast<size_t>(totalSize);
+        mip.width = std::max(1u, width >> level);
+        mip.height = std::max(1u, height >> level);
+        totalSize += getTextureLevelSize(entry->format, mip.width, mip.height);
+    }
+    if (totalSize > MAX_TEXTURE_BYTES) {
+        outImage = KTX2Image();
+        return fail(sourceName, "texture too large");
+    }
+    outImage.data.resize(static_cast<size_t>(totalSize));
+
+    std::vector<uint8_t> inflated;
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        const uint8_t* index = data + HEADER_SIZE + static_cast<size_t>(level) * LEVEL_INDEX_ENTRY_SIZE;
+        const uint64_t byteOffset = readLE64(index);
+        const uint64_t byteLength = readLE64(index + 8);
+        const uint64_t uncompressedLength = readLE64(index + 16);
+        const MipLevelInfo& mip = outImage.levels[level];
+        const size_t levelSize = getTextureLevelSize(entry->format, mip.width, mip.height);
+
+        if (byteOffset > size || byteLength > size - byteOffset) {
+            outImage = KTX2Image();
+            return fail(sourceName, "level data outside the file");
+        }
+        const uint8_t* levelData = data + byteOffset;
+
+        if (supercompression == SUPERCOMPRESSION_NONE) {
+            if (byteLength != levelSize) {
+                outImage = KTX2Image();
+                return fail(sourceName, "level size does not match the format");
+            }
+            std::memcpy(outImage.data.data() + mip.offset, levelData, levelSize);
+        } else {
+            inflated.clear();
+            if (uncompressedLength != levelSize ||
+                !ImageDecoder::inflateZlib(levelData, static_cast<size_t>(byteLength), inflated, levelSize) ||
+                inflated.size() != levelSize) {
+                outImage = KTX2Image();
+                return fail(sourceName, "corrupt zlib level data");
+            }
+            std::memcpy(outImage.data.data() + mip.offset, inflated.data(), levelSize);
+        }
+    }
+
+    outImage.width = width;
+    outImage.height = height;
+    outImage.format = entry->format;
+    outImage.srgb = entry->srgb;
+    return true;
+}
+
+bool KTX2Container::save(const std::string& filepath, const KTX2Image& image) {
+    uint32_t vkFormat = 0;
+    for (const VkFormatEntry& entry : VK_FORMATS) {
+        // First match wins, so BC1 is written as the RGBA variant
+        if (entry.format == image.format && entry.srgb == image.srgb && vkFormat == 0) {
+            vkFormat = entry.vkFormat;
+        }
+    }
+    const std::vector<uint8_t> dfd = buildDataFormatDescriptor(image.format, image.srgb);
+    if (vkFormat == 0 || dfd.empty() || image.levels.empty() || image.width == 0 || image.height == 0) {
+        std::cerr << "[ERROR] Cannot write KTX2 file '" << filepath << "': unsupported format" << std::endl;
+        return false;
+    }
+
+    const TextureFormatInfo info = getTextureFormatInfo(image.format);
+    const uint32_t levelCount = static_cast<uint32_t>(image.levels.size());
+    for (const MipLevelInfo& mip : image.levels) {
+        if (mip.offset > image.data.size() ||
+            image.data.size() - mip.offset < getTextureLevelSize(image.format, mip.width, mip.height)) {
+            std::cerr << "[ERROR] Cannot write KTX2 file '" << filepath << "': level outside the data" << std::endl;
+            return false;
+        }
+    }
+
+    // Header, level index and DFD, then the levels from smallest to largest,
+    // each aligned to lcm(block size, 4)
+    const size_t dfdOffset = HEADER_SIZE + static_cast<size_t>(levelCount) * LEVEL_INDEX_ENTRY_SIZE;
+    const size_t alignment = info.blockBytes % 4 == 0 ? info.blockBytes : 4;
+    std::vector<uint64_t> levelOffsets(levelCount);
+    size_t offset = dfdOffset + dfd.size();
+    for (uint32_t level = levelCount; level-- > 0;) {
+        offset = (offset + alignment - 1) / alignment * alignment;
+        levelOffsets[level] = offset;
+        offset += getTextureLevelSize(image.format, image.levels[level].width, image.levels[level].height);
+    }
+
+    std::vector<uint8_t> header(KTX2_IDENTIFIER, KTX2_IDENTIFIER + sizeof(KTX2_IDENTIFIER));
+    appendLE32(header, vkFormat);
+    appendLE32(header, 1);                              // typeSize (block formats and 8-bit channels)
+    appendLE32(header, image.width);
+    appendLE32(header, image.height);
+    appendLE32(header, 0);                              // pixelDepth
+    appendLE32(header, 0);                              // layerCount
+    appendLE32(header, 1);                              // faceCount
+    appendLE32(header, levelCount);
+    appendLE32(header, SUPERCOMPRESSION_NONE);
+    appendLE32(header, static_cast<uint32_t>(dfdOffset));
+    appendLE32(header, static_cast<uint32_t>(dfd.size()));
+    appendLE32(header, 0);                              // No key/value data
+    appendLE32(header, 0);
+    appendLE64(header, 0);                              // No supercompression global data
+    appendLE64(header, 0);
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        const uint64_t levelSize = getTextureLevelSize(image.format, image.levels[level].width,
+                                                       image.levels[level].height);
+        appendLE64(header, levelOffsets[level]);
+        appendLE64(header, levelSize);
+        appendLE64(header, levelSize);
+    }
+    header.insert(header.end(), dfd.begin(), dfd.end());
+
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "[ERROR] Cannot write KTX2 file: " << filepath << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    size_t written = header.size();
+    const char padding[16] = {};
+    for (uint32_t level = levelCount; level-- > 0;) {
+        const MipLevelInfo& mip = image.levels[level];
+        file.write(padding, static_cast<std::streamsize>(levelOffsets[level] - written));
+        const size_t levelSize = getTextureLevelSize(image.format, mip.width, mip.height);
+        file.write(reinterpret_cast<const char*>(image.data.data() + mip.offset),
+                   static_cast<std::streamsize>(levelSize));
+        written = static_cast<size_t>(levelOffsets[level]) + levelSize;
+    }
+    if (!file) {
+        std::cerr << "[ERROR] Failed writing KTX2 file: " << filepath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace resource
+} // namespace rs_engine
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Texture.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rs_engine {
+namespace resource {
+
+/**
+ * @brief Mip chain read from or written to a KTX2 file
+ */
+struct KTX2Image {
+    std::vector<uint8_t> data;          // Every level back to back, level 0 first
+    std::vector<MipLevelInfo> levels;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    TextureFormat format = TextureFormat::Unknown;
+    bool srgb = false;                  // Color data in the sRGB transfer function
+};
+
+/**
+ * @brief KTX 2.0 texture container (Khronos), single 2D image with mips
+ *
+ * Read formats (vkFormat): R8 / RG8 / RGBA8 (UNORM, SRGB), BC1, BC3, BC5,
+ * BC7, ETC2 RGB8 / RGBA8 and ASTC 4x4. Level data may be stored plain or
+ * with ZLIB supercompression. Basis Universal (BasisLZ / UASTC) and Zstd
+ * files, arrays, cube maps and 3D textures are rejected with a message;
+ * transcode those offline (e.g. `ktx transcode`).
+ *
+ * Written files are plain (no supercompression) with a basic data format
+ * descriptor, so other KTX tools can read them. The texture_compressor app
+ * produces them from PNG / TGA / BMP sources.
+ *
+ * Platform Support: 100% shared
+ */
+class KTX2Container {
+public:
+    /**
+     * @brief Whether data starts with the KTX2 identifier
+     */
+    static bool isKTX2(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Read a KTX2 file (through a memory mapping)
+     * @return false (with a logged reason) if the file cannot be read or is unsupported
+     */
+    static bool load(const std::string& filepath, KTX2Image& outImage);
+
+    /**
+     * @brief Read a KTX2 file held in memory
+     */
+    static bool decode(const uint8_t* data, size_t size, KTX2Image& outImage, const std::string& sourceName);
+
+    /**
+     * @brief Write a KTX2 file
+     * @return false if the format has no KTX2 equivalent or the file cannot be written
+     */
+    static bool save(const std::string& filepath, const KTX2Image& image);
+};
+
+} // namespace resource
+} // namespace rs_engine
@@ -1,14 +1,46 @@
 #include "Texture.h"
+#include "ImageDecoder.h"
+#include "KTX2Container.h"
+#include "../../core/MappedFile.h"
 #include <iostream>
+#include <algorithm>
 #include <cstring>
 
-// TODO: Add stb_image for actual image loading
-// #define STB_IMAGE_IMPLEMENTATION
-// #include <stb_image.h>
-
 namespace rs_engine {
 namespace resource {
 
+// ========== Format Info ==========
+
+TextureFormatInfo getTextureFormatInfo(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::R8: return {1, 1, 1, false};
+        case TextureFormat::RG8: return {1, 1, 2, false};
+        case TextureFormat::RGB8: return {1, 1, 4, false};     // Expanded to RGBA for the upload
+        case TextureFormat::RGBA8: return {1, 1, 4, false};
+        case TextureFormat::R16F: return {1, 1, 2, false};
+        case TextureFormat::RGBA16F: return {1, 1, 8, false};
+        case TextureFormat::R32F: return {1, 1, 4, false};
+        case TextureFormat::RGBA32F: return {1, 1, 16, false};
+        case TextureFormat::BC1_RGBA: return {4, 4, 8, true};
+        case TextureFormat::BC3_RGBA: return {4, 4, 16, true};
+        case TextureFormat::BC5_RG: return {4, 4, 16, true};
+        case TextureFormat::BC7_RGBA: return {4, 4, 16, true};
+        case TextureFormat::ETC2_RGB8: return {4, 4, 8, true};
+        case TextureFormat::ETC2_RGBA8: return {4, 4, 16, true};
+        case TextureFormat::ASTC_4x4: return {4, 4, 16, true};
+        default: return {};
+    }
+}
+
+size_t getTextureLevelSize(TextureFormat format, uint32_t width, uint32_t height) {
+    const TextureFormatInfo info = getTextureFormatInfo(format);
+    const size_t blocksWide = (static_cast<size_t>(width) + info.blockWidth - 1) / info.blockWidth;
+    const size_t blocksHigh = (static_cast<size_t>(height) + info.blockHeight - 1) / info.blockHeight;
+    return blocksWide * blocksHigh * info.blockBytes;
+}
+
+// ========== Texture ==========
+
 Texture::Texture() {
     metadata.type = ResourceType::Texture;
     metadata.state = ResourceState::Unloaded;
@@ -46,6 +78,9 @@ bool Texture::load() {
 void Texture::unload() {
     releaseGPUResources();
     pixelData.clear();
+    gpuPixelData.clear();
+    gpuMipLevels.clear();
+    fileMipLevels.clear();
     width = height = channels = 0;
     format = TextureFormat::Unknown;
     metadata.state = ResourceState::Unloaded;
@@ -57,6 +92,15 @@ void Texture::setData(const uint8_t* data, uint32_t w, uint32_t h, uint32_t ch)
         return;
     }
     
+    size_t dataSize = static_cast<size_t>(w) * h * ch;
+    setData(std::vector<uint8_t>(data, data + dataSize), w, h, ch);
+}
+
+void Texture::setData(std::vector<uint8_t>&& data, uint32_t w, uint32_t h, uint32_t ch) {
+    if (w == 0 || h == 0 || ch == 0 || data.size() < static_cast<size_t>(w) * h * ch) {
+        return;
+    }
+    
     width = w;
     height = h;
     channels = ch;
@@ -70,38 +114,174 @@ void Texture::setData(const uint8_t* data, uint32_t w, uint32_t h, uint32_t ch)
         default: format = TextureFormat::Unknown; break;
     }
     
-    size_t dataSize = w * h * ch;
-    pixelData.resize(dataSize);
-    std::memcpy(pixelData.data(), data, dataSize);
+    pixelData = std::move(data);
+    pixelData.resize(static_cast<size_t>(w) * h * ch);
+    gpuPixelData.clear();
+    gpuMipLevels.clear();
+    fileMipLevels.clear();
     
     gpuDataCreated = false; // Need to recreate GPU resources
 }
 
-bool Texture::loadFromFile(const std::string& filepath) {
-    // TODO: Implement with stb_image
-    // For now, return placeholder implementation
+bool Texture::setMipChain(std::vector<uint8_t>&& data, std::vector<MipLevelInfo>&& levels,
+                          uint32_t w, uint32_t h, TextureFormat fmt) {
+    const TextureFormatInfo info = getTextureFormatInfo(fmt);
+    if (w == 0 || h == 0 || info.blockBytes == 0 || levels.empty() ||
+        levels.size() > ImageProcessing::getMipLevelCount(w, h) ||
+        w % info.blockWidth != 0 || h % info.blockHeight != 0 || fmt == TextureFormat::RGB8) {
+        return false;
+    }
     
-    std::cerr << "Texture::loadFromFile() not yet implemented: " << filepath << std::endl;
+    // Level i must be max(1, size >> i) and lie inside the data
+    for (size_t i = 0; i < levels.size(); ++i) {
+        const MipLevelInfo& level = levels[i];
+        const uint32_t levelWidth = std::max(1u, w >> i);
+        const uint32_t levelHeight = std::max(1u, h >> i);
+        if (level.width != levelWidth || level.height != levelHeight || level.offset > data.size() ||
+            data.size() - level.offset < getTextureLevelSize(fmt, levelWidth, levelHeight)) {
+            return false;
+        }
+    }
+    
+    width = w;
+    height = h;
+    format = fmt;
+    switch (fmt) {
+        case TextureFormat::R8: channels = 1; break;
+        case TextureFormat::RG8:
+        case TextureFormat::BC5_RG: channels = 2; break;
+        case TextureFormat::ETC2_RGB8: channels = 3; break;
+        default: channels = 4; break;
+    }
     
-    /*
-    int w, h, ch;
-    unsigned char* data = stbi_load(filepath.c_str(), &w, &h, &ch, 0);
+    pixelData = std::move(data);
+    fileMipLevels = std::move(levels);
+    gpuPixelData.clear();
+    gpuMipLevels.clear();
     
-    if (!data) {
-        std::cerr << "Failed to load texture: " << filepath << std::endl;
+    gpuDataCreated = false;
+    return true;
+}
+
+void Texture::takeData(Texture& source) {
+    pixelData = std::move(source.pixelData);
+    gpuPixelData = std::move(source.gpuPixelData);
+    gpuMipLevels = std::move(source.gpuMipLevels);
+    fileMipLevels = std::move(source.fileMipLevels);
+    width = source.width;
+    height = source.height;
+    channels = source.channels;
+    format = source.format;
+    
+    source.pixelData.clear();
+    source.gpuPixelData.clear();
+    source.gpuMipLevels.clear();
+    source.fileMipLevels.clear();
+    source.width = source.height = source.channels = 0;
+    source.format = TextureFormat::Unknown;
+    
+    gpuDataCreated = false;
+}
+
+bool Texture::loadFromFile(const std::string& filepath) {
+    MappedFile file;
+    if (!file.open(filepath)) {
+        std::cerr << "[ERROR] Cannot open texture file: " << filepath << std::endl;
         metadata.state = ResourceState::Failed;
         return false;
     }
     
-    setData(data, w, h, ch);
-    stbi_image_free(data);
+    // KTX2 brings its own (usually block-compressed) mip chain; anything else is decoded to pixels
+    if (KTX2Container::isKTX2(file.getData(), file.getSize())) {
+        KTX2Image image;
+        if (!KTX2Container::decode(file.getData(), file.getSize(), image, filepath)) {
+            metadata.state = ResourceState::Failed;
+            return false;
+        }
+        if (!setMipChain(std::move(image.data), std::move(image.levels), image.width, image.height, image.format)) {
+            std::cerr << "[ERROR] Invalid KTX2 mip chain: " << filepath << std::endl;
+            metadata.state = ResourceState::Failed;
+            return false;
+        }
+    } else {
+        DecodedImage image;
+        if (!ImageDecoder::decode(file.getData(), file.getSize(), image, filepath)) {
+            metadata.state = ResourceState::Failed;
+            return false;
+        }
+        setData(std::move(image.pixels), image.width, image.height, image.channels);
+    }
     
     metadata.filepath = filepath;
     metadata.state = ResourceState::Loaded;
+    metadata.memorySize = pixelData.size();
     return true;
-    */
+}
+
+bool Texture::prepareGPUData(JobSystem* jobs) {
+    if (pixelData.empty() || width == 0 || height == 0) {
+        return false;
+    }
+    if (!fileMipLevels.empty()) {
+        return true;    // Uploaded straight from pixelData
+    }
     
-    return false;
+    ImageProcessing::buildMipChain(pixelData.data(), width, height, channels, generateMipmaps,
+                                   gpuPixelData, gpuMipLevels, jobs);
+    return true;
+}
+
+uint32_t Texture::getMipLevelCount() const {
+    if (!fileMipLevels.empty()) {
+        return static_cast<uint32_t>(fileMipLevels.size());
+    }
+    return generateMipmaps ? ImageProcessing::getMipLevelCount(width, height) : 1;
+}
+
+size_t Texture::getPreparedGPUDataSize() const {
+    return fileMipLevels.empty() ? gpuPixelData.size() : pixelData.size();
+}
+
+size_t Texture::getGPUMemorySize() const {
+    size_t total = 0;
+    const uint32_t levelCount = getMipLevelCount();
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        total += getTextureLevelSize(format, std::max(1u, width >> level), std::max(1u, height >> level));
+    }
+    return total;
+}
+
+size_t Texture::getUncompressedGPUMemorySize() const {
+    if (!isCompressed()) {
+        return getGPUMemorySize();
+    }
+    
+    const TextureFormat equivalent = format == TextureFormat::BC5_RG ? TextureFormat::RG8 : TextureFormat::RGBA8;
+    size_t total = 0;
+    const uint32_t levelCount = getMipLevelCount();
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        total += getTextureLevelSize(equivalent, std::max(1u, width >> level), std::max(1u, height >> level));
+    }
+    return total;
+}
+
+bool Texture::isFormatSupported(wgpu::Device device, TextureFormat format) {
+    switch (format) {
+        case TextureFormat::BC1_RGBA:
+        case TextureFormat::BC3_RGBA:
+        case TextureFormat::BC5_RG:
+        case TextureFormat::BC7_RGBA:
+            return device && device.HasFeature(wgpu::FeatureName::TextureCompressionBC);
+        case TextureFormat::ETC2_RGB8:
+        case TextureFormat::ETC2_RGBA8:
+            return device && device.HasFeature(wgpu::FeatureName::TextureCompressionETC2);
+        case TextureFormat::ASTC_4x4:
+            return device && device.HasFeature(wgpu::FeatureName::TextureCompressionASTC);
+        case TextureFormat::Unknown:
+            return false;
+        default:
+            return true;
+    }
 }
 
 bool Texture::createGPUResources(wgpu::Device device) {
@@ -112,14 +292,32 @@ bool Texture::createGPUResources(wgpu::Device device) {
     // Release old resources
     releaseGPUResources();
     
-    // Create texture
+    if (!isFormatSupported(device, format)) {
+        std::cerr << "[ERROR] Texture format of '" << metadata.name
+                  << "' is not supported by this device (needs a texture compression feature)" << std::endl;
+        return false;
+    }
+    
+    // Build the upload data unless a loader prepared it (or settings changed since).
+    // A chain from a file is uploaded from pixelData as is.
+    const bool fileChain = !fileMipLevels.empty();
+    const uint32_t mipLevelCount = getMipLevelCount();
+    if (!fileChain && gpuMipLevels.size() != mipLevelCount && !prepareGPUData()) {
+        return false;
+    }
+    const std::vector<uint8_t>& uploadData = fileChain ? pixelData : gpuPixelData;
+    const std::vector<MipLevelInfo>& uploadLevels = fileChain ? fileMipLevels : gpuMipLevels;
+    const TextureFormatInfo formatInfo = getTextureFormatInfo(format);
+    
+    // Create texture (compressed formats cannot be render targets)
     wgpu::TextureDescriptor textureDesc;
     textureDesc.size = {width, height, 1};
     textureDesc.format = getWebGPUFormat();
-    textureDesc.usage = wgpu::TextureUsage::TextureBinding | 
-                       wgpu::TextureUsage::CopyDst |
-                       wgpu::TextureUsage::RenderAttachment;
-    textureDesc.mipLevelCount = 1; // TODO: Generate mipmaps if requested
+    textureDesc.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::CopyDst;
+    if (!formatInfo.compressed) {
+        textureDesc.usage |= wgpu::TextureUsage::RenderAttachment;
+    }
+    textureDesc.mipLevelCount = mipLevelCount;
     textureDesc.sampleCount = 1;
     textureDesc.dimension = wgpu::TextureDimension::e2D;
     
@@ -129,17 +327,42 @@ bool Texture::createGPUResources(wgpu::Device device) {
         return false;
     }
     
-    // Upload pixel data via buffer (workaround for API compatibility)
-    // TODO: Use WriteTexture when API stabilizes
-    // For now, we'll mark as created but data upload will be handled separately
-    std::cout << "[WARNING] Texture GPU upload needs WriteTexture API implementation" << std::endl;
+    // Upload every level in rows of blocks (texels for uncompressed formats;
+    // RGB data was expanded, so those are 1, 2 or 4 bytes)
+    wgpu::Queue queue = device.GetQueue();
+    for (uint32_t level = 0; level < mipLevelCount; ++level) {
+        const MipLevelInfo& mip = uploadLevels[level];
+        const uint32_t blocksWide = (mip.width + formatInfo.blockWidth - 1) / formatInfo.blockWidth;
+        const uint32_t blocksHigh = (mip.height + formatInfo.blockHeight - 1) / formatInfo.blockHeight;
+        
+        wgpu::ImageCopyTexture destination;
+        destination.texture = gpuTexture;
+        destination.mipLevel = level;
+        destination.origin = {0, 0, 0};
+        destination.aspect = wgpu::TextureAspect::All;
+        
+        wgpu::TextureDataLayout layout;
+        layout.offset = 0;
+        layout.bytesPerRow = blocksWide * formatInfo.blockBytes;
+        layout.rowsPerImage = blocksHigh;
+        
+        // Small compressed levels are copied as whole blocks (the level's physical size)
+        wgpu::Extent3D levelSize = {blocksWide * formatInfo.blockWidth, blocksHigh * formatInfo.blockHeight, 1};
+        queue.WriteTexture(&destination, uploadData.data() + mip.offset,
+                           static_cast<size_t>(layout.bytesPerRow) * blocksHigh, &layout, &levelSize);
+    }
+    
+    // The GPU holds the chain now; keep only the original pixels on the CPU
+    gpuPixelData.clear();
+    gpuPixelData.shrink_to_fit();
+    gpuMipLevels.clear();
     
     // Create texture view
     wgpu::TextureViewDescriptor viewDesc;
     viewDesc.format = textureDesc.format;
     viewDesc.dimension = wgpu::TextureViewDimension::e2D;
     viewDesc.baseMipLevel = 0;
-    viewDesc.mipLevelCount = 1;
+    viewDesc.mipLevelCount = mipLevelCount;
     viewDesc.baseArrayLayer = 0;
     viewDesc.arrayLayerCount = 1;
     viewDesc.aspect = wgpu::TextureAspect::All;
@@ -160,7 +383,7 @@ bool Texture::createGPUResources(wgpu::Device device) {
     samplerDesc.minFilter = getWebGPUFilterMode();
     samplerDesc.mipmapFilter = wgpu::MipmapFilterMode::Linear;
     samplerDesc.lodMinClamp = 0.0f;
-    samplerDesc.lodMaxClamp = 1.0f;
+    samplerDesc.lodMaxClamp = static_cast<float>(mipLevelCount);
     samplerDesc.compare = wgpu::CompareFunction::Undefined;
     samplerDesc.maxAnisotropy = 1;
     
@@ -200,6 +423,15 @@ wgpu::TextureFormat Texture::getWebGPUFormat() const {
         case TextureFormat::RGBA16F: return wgpu::TextureFormat::RGBA16Float;
         case TextureFormat::R32F: return wgpu::TextureFormat::R32Float;
         case TextureFormat::RGBA32F: return wgpu::TextureFormat::RGBA32Float;
+        // The engine samples color data as stored (like the RGBA8Unorm path), so
+        // sRGB-tagged files map to the Unorm formats as well
+        case TextureFormat::BC1_RGBA: return wgpu::TextureFormat::BC1RGBAUnorm;
+        case TextureFormat::BC3_RGBA: return wgpu::TextureFormat::BC3RGBAUnorm;
+        case TextureFormat::BC5_RG: return wgpu::TextureFormat::BC5RGUnorm;
+        case TextureFormat::BC7_RGBA: return wgpu::TextureFormat::BC7RGBAUnorm;
+        case TextureFormat::ETC2_RGB8: return wgpu::TextureFormat::ETC2RGB8Unorm;
+        case TextureFormat::ETC2_RGBA8: return wgpu::TextureFormat::ETC2RGBA8Unorm;
+        case TextureFormat::ASTC_4x4: return wgpu::TextureFormat::ASTC4x4Unorm;
         default: return wgpu::TextureFormat::RGBA8Unorm;
     }
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "../ResourceTypes.h"
+#include "ImageProcessing.h"
 #include <webgpu/webgpu_cpp.h>
+#include <string>
 #include <vector>
 #include <cstdint>
 
@@ -20,9 +22,38 @@ enum class TextureFormat {
     R16F,         // 16-bit float grayscale
     RGBA16F,      // 16-bit float RGBA
     R32F,         // 32-bit float grayscale
-    RGBA32F       // 32-bit float RGBA
+    RGBA32F,      // 32-bit float RGBA
+    
+    // Block-compressed (4x4 texel blocks, uploaded as is; see Texture::isFormatSupported)
+    BC1_RGBA,     // 8 bytes/block, RGB + 1-bit alpha (desktop)
+    BC3_RGBA,     // 16 bytes/block, BC1 color + interpolated alpha (desktop)
+    BC5_RG,       // 16 bytes/block, two interpolated channels, e.g. normal maps (desktop)
+    BC7_RGBA,     // 16 bytes/block, high quality RGBA (desktop)
+    ETC2_RGB8,    // 8 bytes/block (mobile)
+    ETC2_RGBA8,   // 16 bytes/block (mobile)
+    ASTC_4x4      // 16 bytes/block (mobile)
+};
+
+/**
+ * @brief Storage layout of a texture format as uploaded to the GPU
+ * 
+ * Uncompressed formats are 1x1 blocks (RGB8 counts as 4 bytes, since it is
+ * expanded to RGBA before the upload).
+ */
+struct TextureFormatInfo {
+    uint32_t blockWidth = 1;
+    uint32_t blockHeight = 1;
+    uint32_t blockBytes = 0;
+    bool compressed = false;
 };
 
+TextureFormatInfo getTextureFormatInfo(TextureFormat format);
+
+/**
+ * @brief Bytes of one w x h image in a format (whole blocks for compressed formats)
+ */
+size_t getTextureLevelSize(TextureFormat format, uint32_t width, uint32_t height);
+
 /**
  * @brief Texture filtering options
  */
@@ -46,7 +77,9 @@ enum class TextureWrap {
  * @brief Texture resource - 2D image data
  * 
  * Platform Support: 100% shared
- * - Image loading: stb_image (cross-platform)
+ * - Image loading: ImageDecoder (PNG, TGA, BMP, PNM; cross-platform)
+ * - Block-compressed textures: KTX2 files (KTX2Container), mip chain read from the file
+ * - Mip chains: built on the CPU (SIMD box filter) and uploaded with WriteTexture
  * - GPU texture: WebGPU (both Web and Native)
  */
 class Texture : public IResource {
@@ -58,6 +91,15 @@ private:
     uint32_t channels = 0;
     TextureFormat format = TextureFormat::Unknown;
     
+    // Upload-ready copy: GPU pixel format (RGB expanded), every mip level
+    // back to back. Built by prepareGPUData(), dropped after the upload.
+    std::vector<uint8_t> gpuPixelData;
+    std::vector<MipLevelInfo> gpuMipLevels;
+    
+    // Mip chain that came with the data (KTX2): pixelData then holds every
+    // level back to back in the texture format and is uploaded as is
+    std::vector<MipLevelInfo> fileMipLevels;
+    
     // GPU-side data
     wgpu::Texture gpuTexture;
     wgpu::TextureView textureView;
@@ -97,14 +139,35 @@ public:
      * @param ch Number of channels (1, 2, 3, or 4)
      */
     void setData(const uint8_t* data, uint32_t w, uint32_t h, uint32_t ch);
+    void setData(std::vector<uint8_t>&& data, uint32_t w, uint32_t h, uint32_t ch);   // Takes the storage
+    
+    /**
+     * @brief Set a complete mip chain in any format (used for block-compressed data)
+     * 
+     * The chain replaces mip generation: shouldGenerateMipmaps() is ignored.
+     * Compressed level 0 sizes must be whole blocks (a WebGPU requirement).
+     * @param data Every level back to back, laid out as levels describes
+     * @return false if the levels do not match the format and size
+     */
+    bool setMipChain(std::vector<uint8_t>&& data, std::vector<MipLevelInfo>&& levels,
+                     uint32_t w, uint32_t h, TextureFormat fmt);
+    
+    /**
+     * @brief Move pixels and prepared upload data out of another texture
+     * 
+     * Used to hand a texture decoded off the main thread to the registered one.
+     */
+    void takeData(Texture& source);
     
     /**
      * @brief Load texture from file
-     * @param filepath Path to image file (PNG, JPG, etc.)
+     * @param filepath Path to image file (PNG, TGA, BMP, PPM / PGM, KTX2)
      * @return true if successful
      */
     bool loadFromFile(const std::string& filepath);
     
+    bool isCompressed() const { return getTextureFormatInfo(format).compressed; }
+    
     // ========== Texture Settings ==========
     
     void setFilterMode(TextureFilter filter) { filterMode = filter; }
@@ -119,11 +182,49 @@ public:
     
     /**
      * @brief Create GPU texture from CPU data
+     * 
+     * Uploads every mip level with Queue::WriteTexture (building the chain
+     * first unless prepareGPUData() already did).
      * @param device WebGPU device
      * @return true if successful
      */
     bool createGPUResources(wgpu::Device device);
     
+    /**
+     * @brief Convert to the GPU format and build the mip chain ahead of the upload
+     * 
+     * Thread-safe with respect to other textures, so loaders can run it on a
+     * worker; createGPUResources() then only copies.
+     * @param jobs Workers for the mip levels (nullptr = calling thread only)
+     * @return false if there is no pixel data
+     */
+    bool prepareGPUData(JobSystem* jobs = nullptr);
+    
+    /**
+     * @brief Mip levels the GPU texture gets with the current settings
+     */
+    uint32_t getMipLevelCount() const;
+    
+    /**
+     * @brief Bytes createGPUResources() will upload (0 before prepareGPUData)
+     */
+    size_t getPreparedGPUDataSize() const;
+    
+    /**
+     * @brief GPU memory of the texture with all its mip levels
+     */
+    size_t getGPUMemorySize() const;
+    
+    /**
+     * @brief GPU memory the same texture would take uncompressed (RGBA8, RG8 for BC5)
+     */
+    size_t getUncompressedGPUMemorySize() const;
+    
+    /**
+     * @brief Whether a device can sample a format (BC, ETC2 and ASTC need optional features)
+     */
+    static bool isFormatSupported(wgpu::Device device, TextureFormat format);
+    
     /**
      * @brief Release GPU texture
      */
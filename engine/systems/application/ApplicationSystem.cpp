@@ -3,9 +3,34 @@
 #include "../../core/Engine.h"
 #include <iostream>
 #include <cassert>
+#include <vector>
 
 namespace rs_engine {
 
+namespace {
+
+/**
+ * @brief Optional features enabled when the adapter has them
+ * (block-compressed texture formats, see Texture::isFormatSupported)
+ */
+std::vector<wgpu::FeatureName> getOptionalFeatures(const wgpu::Adapter& adapter) {
+    const wgpu::FeatureName candidates[] = {
+        wgpu::FeatureName::TextureCompressionBC,
+        wgpu::FeatureName::TextureCompressionETC2,
+        wgpu::FeatureName::TextureCompressionASTC,
+    };
+    
+    std::vector<wgpu::FeatureName> features;
+    for (wgpu::FeatureName feature : candidates) {
+        if (adapter.HasFeature(feature)) {
+            features.push_back(feature);
+        }
+    }
+    return features;
+}
+
+} // namespace
+
 #ifndef __EMSCRIPTEN__
 bool ApplicationSystem::s_glfwInitialized = false;
 #endif
@@ -120,6 +145,9 @@ bool ApplicationSystem::initWebGPU() {
     // Request device
     wgpu::DeviceDescriptor deviceDesc = {};
     deviceDesc.defaultQueue.label = "Default Queue";
+    const std::vector<wgpu::FeatureName> features = getOptionalFeatures(adapter);
+    deviceDesc.requiredFeatures = features.data();
+    deviceDesc.requiredFeatureCount = features.size();
 
     struct DeviceData {
         wgpu::Device device;
@@ -278,6 +306,9 @@ bool ApplicationSystem::initWebGPU() {
     // Create device
     wgpu::DeviceDescriptor deviceDesc = {};
     deviceDesc.label = "Main Device";
+    const std::vector<wgpu::FeatureName> features = getOptionalFeatures(adapter);
+    deviceDesc.requiredFeatures = features.data();
+    deviceDesc.requiredFeatureCount = features.size();
     device = adapter.CreateDevice(&deviceDesc);
     
     if (!device) {
@@ -42,11 +42,9 @@ void InputSystem::onUpdate(float deltaTime) {
     prevMouseX = mouseX;
     prevMouseY = mouseY;
     
-    // Handle object picking with left mouse button (BEFORE updateStates!)
-    // Important: Check Pressed state before it transitions to Held
-    if (isMouseButtonPressed(MouseButton::Left)) {
-        handleObjectPicking();
-    }
+    // Handle object selection with left mouse button (BEFORE updateStates!)
+    // Important: Check Pressed / JustReleased states before they transition
+    updateSelectionDrag();
     
     // Update input states (Pressed -> Held, JustReleased -> Released)
     // This MUST come after checking for Pressed states
@@ -483,46 +481,124 @@ void InputSystem::setupWebEventHandlers() {
 
 // ========== Object Picking ==========
 
-void InputSystem::handleObjectPicking() {
-    auto* renderSystem = engine->getSystem<RenderSystem>();
-    if (!renderSystem) return;
+void InputSystem::updateSelectionDrag() {
+    if (isMouseButtonPressed(MouseButton::Left)) {
+        selectionPending = canStartSelection();
+        selectionDragActive = false;
+        selectionLasso = false;
+        selectionStartX = mouseX;
+        selectionStartY = mouseY;
+        lassoPoints.clear();
+        return;
+    }
     
-#ifndef __EMSCRIPTEN__
-    // Native: Only pick if mouse is over viewport (not over ImGui widgets)
-    auto* guiManager = renderSystem->getGUI();
-    if (!guiManager) return;
+    if (!selectionPending) {
+        return;
+    }
     
-    const auto& viewport = guiManager->getViewportState();
-    if (!viewport.isHovered) {
-        // Mouse is over ImGui UI, not the viewport
+    if (isMouseButtonHeld(MouseButton::Left)) {
+        if (!selectionDragActive) {
+            double dx = mouseX - selectionStartX;
+            double dy = mouseY - selectionStartY;
+            if (dx * dx + dy * dy < SELECTION_DRAG_THRESHOLD * SELECTION_DRAG_THRESHOLD) {
+                return;
+            }
+            selectionDragActive = true;
+            selectionLasso = isKeyDown(KeyCode::LeftAlt) || isKeyDown(KeyCode::RightAlt) ||
+                             isKeyDown(KeyCode::Alt);
+            lassoPoints.emplace_back(static_cast<float>(selectionStartX),
+                                     static_cast<float>(selectionStartY));
+        }
+        
+        if (selectionLasso) {
+            const auto& last = lassoPoints.back();
+            float dx = static_cast<float>(mouseX) - last.first;
+            float dy = static_cast<float>(mouseY) - last.second;
+            if (dx * dx + dy * dy >= 4.0f) {
+                lassoPoints.emplace_back(static_cast<float>(mouseX), static_cast<float>(mouseY));
+            }
+        }
         return;
     }
     
-    std::cout << "[Picking] Handling object picking (viewport: " 
-              << viewport.width << "x" << viewport.height << ")..." << std::endl;
+    if (isMouseButtonReleased(MouseButton::Left)) {
+        if (selectionDragActive) {
+            handleRegionSelection();
+        } else {
+            handleObjectPicking();
+        }
+        selectionPending = false;
+        selectionDragActive = false;
+        selectionLasso = false;
+        lassoPoints.clear();
+    }
+}
+
+bool InputSystem::canStartSelection() const {
+    auto* renderSystem = engine->getSystem<RenderSystem>();
+    if (!renderSystem) return false;
+    
+#ifndef __EMSCRIPTEN__
+    // Native: Only select if mouse is over viewport (not over ImGui widgets)
+    auto* guiManager = renderSystem->getGUI();
+    if (!guiManager) return false;
+    
+    return guiManager->getViewportState().isHovered;
 #else
     // Web: Direct picking (no ImGui)
-    std::cout << "[Picking] Handling object picking..." << std::endl;
+    return true;
 #endif
+}
+
+rendering::SelectionMode InputSystem::getSelectionModeFromModifiers() const {
+    if (isKeyDown(KeyCode::LeftControl) || isKeyDown(KeyCode::RightControl) ||
+        isKeyDown(KeyCode::Control)) {
+        return rendering::SelectionMode::Toggle;
+    }
+    if (isKeyDown(KeyCode::LeftShift) || isKeyDown(KeyCode::RightShift) ||
+        isKeyDown(KeyCode::Shift)) {
+        return rendering::SelectionMode::Add;
+    }
+    return rendering::SelectionMode::Replace;
+}
+
+void InputSystem::handleObjectPicking() {
+    auto* renderSystem = engine->getSystem<RenderSystem>();
+    if (!renderSystem) return;
     
-    // Get mouse position
-    double clickX = mouseX;
-    double clickY = mouseY;
+    std::cout << "[Picking] Handling object picking..." << std::endl;
     
-    // Perform picking
-    auto* selectedObject = renderSystem->pickObject(
-        static_cast<float>(clickX),
-        static_cast<float>(clickY)
+    // Pick at the press position (the cursor may have moved slightly)
+    auto* pickedObject = renderSystem->pickObject(
+        static_cast<float>(selectionStartX),
+        static_cast<float>(selectionStartY)
     );
     
     // Update selection
-    renderSystem->setSelectedObject(selectedObject);
+    rendering::SelectionMode mode = getSelectionModeFromModifiers();
+    if (pickedObject) {
+        renderSystem->selectObjects({ pickedObject }, mode);
+        std::cout << "[Picking] Selected object: " << pickedObject->getName() << std::endl;
+    } else if (mode == rendering::SelectionMode::Replace) {
+        renderSystem->clearSelection();
+        std::cout << "[Picking] No object selected (clicked on empty space)" << std::endl;
+    }
+}
+
+void InputSystem::handleRegionSelection() {
+    auto* renderSystem = engine->getSystem<RenderSystem>();
+    if (!renderSystem) return;
     
-    if (selectedObject) {
-        std::cout << "[Picking] Selected object: " << selectedObject->getName() << std::endl;
+    std::vector<rendering::SceneObject*> picked;
+    if (selectionLasso) {
+        renderSystem->pickObjectsInLasso(lassoPoints, picked);
     } else {
-        std::cout << "[Picking] No object selected (clicked on empty space)" << std::endl;
+        float x0, y0, x1, y1;
+        getSelectionDragRect(x0, y0, x1, y1);
+        renderSystem->pickObjectsInRect(x0, y0, x1, y1, picked);
     }
+    
+    renderSystem->selectObjects(picked, getSelectionModeFromModifiers());
 }
 
 } // namespace rs_engine
@@ -5,6 +5,8 @@
 #include <unordered_map>
 #include <array>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #ifdef __EMSCRIPTEN__
     #include <emscripten/html5.h>
@@ -15,6 +17,7 @@ namespace rs_engine {
 // Forward declarations
 namespace rendering {
     class Camera;
+    enum class SelectionMode;
 }
 
 /**
@@ -107,6 +110,15 @@ private:
     // Input capture state
     bool cursorLocked = false;
     bool cursorVisible = true;
+    
+    // Selection drag (left button): click = pick, drag = marquee, Alt+drag = lasso
+    static constexpr double SELECTION_DRAG_THRESHOLD = 4.0;  // Pixels before a click becomes a drag
+    bool selectionPending = false;   // Left button went down over the viewport
+    bool selectionDragActive = false;
+    bool selectionLasso = false;
+    double selectionStartX = 0.0;
+    double selectionStartY = 0.0;
+    std::vector<std::pair<float, float>> lassoPoints;
 
 public:
     InputSystem();
@@ -210,6 +222,33 @@ public:
      */
     bool isCursorVisible() const { return cursorVisible; }
 
+    // ========== Selection Drag ==========
+    
+    /**
+     * @brief Check if a marquee / lasso drag is in progress
+     */
+    bool isSelectionDragActive() const { return selectionDragActive; }
+    
+    /**
+     * @brief Check if the current drag is a lasso (Alt held when the drag started)
+     */
+    bool isLassoSelection() const { return selectionLasso; }
+    
+    /**
+     * @brief Get the marquee rectangle corners in screen coordinates
+     */
+    void getSelectionDragRect(float& x0, float& y0, float& x1, float& y1) const {
+        x0 = static_cast<float>(selectionStartX);
+        y0 = static_cast<float>(selectionStartY);
+        x1 = static_cast<float>(mouseX);
+        y1 = static_cast<float>(mouseY);
+    }
+    
+    /**
+     * @brief Get the lasso polygon in screen coordinates
+     */
+    const std::vector<std::pair<float, float>>& getLassoPoints() const { return lassoPoints; }
+
     // ========== Camera Controller ==========
     
     /**
@@ -255,11 +294,31 @@ private:
      */
     void updateStates();
     
+    /**
+     * @brief Track left button press / drag / release for selection
+     */
+    void updateSelectionDrag();
+    
+    /**
+     * @brief Check whether a selection may start at the cursor (viewport hovered on native)
+     */
+    bool canStartSelection() const;
+    
     /**
      * @brief Handle object picking when left mouse button is clicked
      */
     void handleObjectPicking();
     
+    /**
+     * @brief Apply the finished marquee / lasso drag
+     */
+    void handleRegionSelection();
+    
+    /**
+     * @brief Selection mode from modifier keys (Shift = add, Ctrl = toggle, none = replace)
+     */
+    rendering::SelectionMode getSelectionModeFromModifiers() const;
+    
     /**
      * @brief Convert platform key code to KeyCode
      */
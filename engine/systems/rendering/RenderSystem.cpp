@@ -114,7 +114,8 @@ bool RenderSystem::initializeScene() {
     }
 
     scene = std::make_unique<rendering::Scene>(&appSystem->getDevice(), 
-                                                resourceSystem->getResourceManager());
+                                                resourceSystem->getResourceManager(),
+                                                engine->getJobSystem());
 
     if (!scene->initialize()) {
         std::cerr << "[ERROR] Failed to initialize scene" << std::endl;
@@ -406,123 +407,152 @@ rendering::SceneObject* RenderSystem::pickObject(float screenX, float screenY) {
     // Create ray from screen coordinates
     Ray ray = createRayFromScreen(screenX, screenY);
     
-    // Always use AABB + Triangle intersection (precise picking)
-    auto config = EngineConfig::getPickingConfig();
-    
-    // Phase 1: AABB filtering - collect candidates
-    struct Candidate {
-        rendering::SceneObject* object;
-        float aabbDistance;
-    };
-    std::vector<Candidate> candidates;
-    candidates.reserve(config.maxCandidates);
-    
-    for (const auto& [name, objectPtr] : scene->getAllObjects()) {
-        if (!objectPtr || !objectPtr->hasModel()) continue;
-
-        Vec3 min, max;
-        objectPtr->getWorldBounds(min, max);
-
-        float tMin, tMax;
-        if (ray.intersectAABB(min, max, tMin, tMax) && tMin >= 0) {
-            std::cout << "[Picking] " << name << " AABB hit at distance " << tMin
-                      << " (bounds: min=" << min.x << "," << min.y << "," << min.z
-                      << " max=" << max.x << "," << max.y << "," << max.z << ")" << std::endl;
-            candidates.push_back({objectPtr.get(), tMin});
-        } else {
-            std::cout << "[Picking] " << name << " AABB miss (bounds: min="
-                      << min.x << "," << min.y << "," << min.z
-                      << " max=" << max.x << "," << max.y << "," << max.z << ")" << std::endl;
+    // Precise triangle hit through the scene query API (AABB tree + mesh BVH)
+    rendering::Scene::RaycastHit hit;
+    if (scene->raycast(ray, hit)) {
+        std::cout << "[Picking] Precise hit on " << hit.object->getName()
+                  << " at distance: " << hit.distance << std::endl;
+        return hit.object;
+    }
+    
+    // No triangle hit: fall back to the closest AABB candidate in front of the camera
+    std::vector<rendering::Scene::RayCandidate> rayHits;
+    scene->queryRay(ray, std::numeric_limits<float>::max(), rayHits);
+    for (const auto& candidate : rayHits) {
+        if (candidate.object->hasModel() && candidate.distance >= 0) {
+            std::cout << "[Picking] No triangle hit, using closest AABB candidate" << std::endl;
+            return candidate.object;
         }
     }
     
-    if (candidates.empty()) {
-        return nullptr;
+    return nullptr;
+}
+
+size_t RenderSystem::pickObjectsInRect(float x0, float y0, float x1, float y1,
+                                       std::vector<rendering::SceneObject*>& results,
+                                       bool preciseTriangles) {
+    results.clear();
+    
+    float offsetX, offsetY, width, height;
+    if (!getViewportRect(offsetX, offsetY, width, height)) {
+        return 0;
     }
     
-    // Sort candidates by distance (closest first)
-    std::sort(candidates.begin(), candidates.end(),
-              [](const Candidate& a, const Candidate& b) {
-                  return a.aabbDistance < b.aabbDistance;
-              });
+    // Screen rectangle -> NDC rectangle (screen Y points down, NDC Y points up)
+    auto toNdcX = [&](float x) { return (2.0f * (x - offsetX)) / width - 1.0f; };
+    auto toNdcY = [&](float y) { return 1.0f - (2.0f * (y - offsetY)) / height; };
+    float ndcMinX = std::min(toNdcX(x0), toNdcX(x1));
+    float ndcMaxX = std::max(toNdcX(x0), toNdcX(x1));
+    float ndcMinY = std::min(toNdcY(y0), toNdcY(y1));
+    float ndcMaxY = std::max(toNdcY(y0), toNdcY(y1));
     
-    // Limit to top N candidates for performance
-    if (candidates.size() > config.maxCandidates) {
-        candidates.resize(config.maxCandidates);
-    }
+    auto* camera = scene->getCamera();
+    Mat4 viewProj = camera->getProjectionMatrix() * camera->getViewMatrix();
+    Frustum frustum = Frustum::fromViewProjectionRect(viewProj, ndcMinX, ndcMinY, ndcMaxX, ndcMaxY);
     
-    // Phase 2: Precise triangle intersection test
-    rendering::SceneObject* closestObject = nullptr;
-    float closestDistance = std::numeric_limits<float>::max();
+    std::vector<rendering::SceneObject*> candidates;
+    scene->queryFrustum(frustum, candidates);
     
-    for (const auto& candidate : candidates) {
-        float t = intersectObjectTriangles(ray, candidate.object);
+    results.reserve(candidates.size());
+    for (rendering::SceneObject* object : candidates) {
+        if (!object->hasModel() || !object->getVisible()) continue;
         
-        if (t >= 0 && t < closestDistance) {
-            closestDistance = t;
-            closestObject = candidate.object;
+        if (preciseTriangles &&
+            frustum.classifyAABB(object->getCachedWorldBounds()) != Frustum::Containment::Inside &&
+            !objectOverlapsFrustum(frustum, object)) {
+            continue;
         }
+        results.push_back(object);
     }
     
-    // If no triangle intersection found, fall back to closest AABB candidate
-    if (!closestObject && !candidates.empty()) {
-        std::cout << "[Picking] No triangle hit, using closest AABB candidate" << std::endl;
-        closestObject = candidates[0].object;
+    std::cout << "[Picking] Marquee found " << results.size() << " of "
+              << candidates.size() << " candidates" << std::endl;
+    return results.size();
+}
+
+size_t RenderSystem::pickObjectsInLasso(const std::vector<std::pair<float, float>>& screenPoints,
+                                        std::vector<rendering::SceneObject*>& results) {
+    results.clear();
+    if (screenPoints.size() < 3) {
+        return 0;
     }
     
-    if (closestObject) {
-        std::cout << "[Picking] Precise hit at distance: " << closestDistance << std::endl;
+    // Broad phase: the polygon's bounding rectangle
+    float minX = screenPoints[0].first, maxX = minX;
+    float minY = screenPoints[0].second, maxY = minY;
+    for (const auto& [x, y] : screenPoints) {
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
     }
     
-    return closestObject;
-}
-
-float RenderSystem::intersectObjectTriangles(const Ray& ray, rendering::SceneObject* obj) {
-    if (!obj || !obj->hasModel()) {
-        return -1.0f;
+    std::vector<rendering::SceneObject*> candidates;
+    if (pickObjectsInRect(minX, minY, maxX, maxY, candidates) == 0) {
+        return 0;
     }
     
+    float offsetX, offsetY, width, height;
+    if (!getViewportRect(offsetX, offsetY, width, height)) {
+        return 0;
+    }
+    auto* camera = scene->getCamera();
+    Mat4 viewProj = camera->getProjectionMatrix() * camera->getViewMatrix();
+    
+    // Narrow phase: even-odd point-in-polygon on each candidate's projected bounds center
+    auto insidePolygon = [&screenPoints](float px, float py) {
+        bool inside = false;
+        size_t count = screenPoints.size();
+        for (size_t i = 0, j = count - 1; i < count; j = i++) {
+            const auto& a = screenPoints[i];
+            const auto& b = screenPoints[j];
+            if ((a.second > py) != (b.second > py) &&
+                px < (b.first - a.first) * (py - a.second) / (b.second - a.second) + a.first) {
+                inside = !inside;
+            }
+        }
+        return inside;
+    };
+    
+    results.reserve(candidates.size());
+    for (rendering::SceneObject* object : candidates) {
+        Vec3 ndc = viewProj.transformPoint(object->getCachedWorldBounds().center());
+        float sx = offsetX + (ndc.x + 1.0f) * 0.5f * width;
+        float sy = offsetY + (1.0f - ndc.y) * 0.5f * height;
+        if (insidePolygon(sx, sy)) {
+            results.push_back(object);
+        }
+    }
+    
+    std::cout << "[Picking] Lasso selected " << results.size() << " objects" << std::endl;
+    return results.size();
+}
+
+bool RenderSystem::objectOverlapsFrustum(const Frustum& frustum, rendering::SceneObject* obj) {
     auto model = obj->getModel();
     if (!model) {
-        return -1.0f;
+        return false;
     }
     
-    Mat4 modelMatrix = obj->getModelMatrix();
-    
-    float closestT = std::numeric_limits<float>::max();
-    bool hitFound = false;
+    // Bring the frustum into object space once instead of transforming vertices
+    Frustum localFrustum = frustum.transformed(obj->getModelMatrix());
     
-    // Test each mesh in the model
     for (const auto& mesh : model->getMeshes()) {
         if (!mesh) continue;
         
-        const auto& vertices = mesh->getVertices();
-        const auto& indices = mesh->getIndices();
-        
-        // Test each triangle
-        for (size_t i = 0; i < indices.size(); i += 3) {
-            // Get triangle vertices in model space
-            Vec3 v0 = vertices[indices[i]].position;
-            Vec3 v1 = vertices[indices[i + 1]].position;
-            Vec3 v2 = vertices[indices[i + 2]].position;
-            
-            // Transform to world space
-            Vec3 w0 = modelMatrix.transformPoint(v0);
-            Vec3 w1 = modelMatrix.transformPoint(v1);
-            Vec3 w2 = modelMatrix.transformPoint(v2);
-            
-            // Test intersection
-            float t;
-            if (ray.intersectTriangle(w0, w1, w2, t)) {
-                if (t < closestT) {
-                    closestT = t;
-                    hitFound = true;
-                }
-            }
+        const resource::MeshBVH* bvh = mesh->getBVH();
+        if (bvh && bvh->overlapsFrustum(localFrustum)) {
+            return true;
         }
     }
-    
-    return hitFound ? closestT : -1.0f;
+    return false;
+}
+
+void RenderSystem::selectObjects(const std::vector<rendering::SceneObject*>& objects,
+                                 rendering::SelectionMode mode) {
+    if (scene) {
+        scene->selectObjects(objects, mode);
+    }
 }
 
 rendering::SceneObject* RenderSystem::getSelectedObject() {
@@ -553,36 +583,11 @@ Ray RenderSystem::createRayFromScreen(float screenX, float screenY) const {
     }
     
     float width, height;
-    float viewportOffsetX = 0.0f;
-    float viewportOffsetY = 0.0f;
-    
-#ifdef __EMSCRIPTEN__
-    // Web: Use full window size (no ImGui viewport)
-    width = static_cast<float>(appSystem->getWindowWidth());
-    height = static_cast<float>(appSystem->getWindowHeight());
-#else
-    // Native: Use ImGui viewport size and offset
-    if (guiManager) {
-        const auto& viewport = guiManager->getViewportState();
-        width = viewport.width;
-        height = viewport.height;
-        viewportOffsetX = viewport.posX;
-        viewportOffsetY = viewport.posY;
-    } else {
-        // Fallback to window size
-        width = static_cast<float>(appSystem->getWindowWidth());
-        height = static_cast<float>(appSystem->getWindowHeight());
-    }
-#endif
-    
-    if (width == 0.0f || height == 0.0f) {
+    float viewportOffsetX, viewportOffsetY;
+    if (!getViewportRect(viewportOffsetX, viewportOffsetY, width, height)) {
         return Ray();
     }
     
-    // CRITICAL: Always update aspect ratio before using projection matrix
-    float currentAspect = width / height;
-    const_cast<rendering::Camera*>(camera)->setAspectRatio(currentAspect);
-    
     // Convert screen coordinates to viewport-relative coordinates
     float viewportX = screenX - viewportOffsetX;
     float viewportY = screenY - viewportOffsetY;
@@ -613,4 +618,43 @@ Ray RenderSystem::createRayFromScreen(float screenX, float screenY) const {
     return Ray(rayOrigin, rayDirection);
 }
 
+bool RenderSystem::getViewportRect(float& offsetX, float& offsetY,
+                                   float& width, float& height) const {
+    offsetX = 0.0f;
+    offsetY = 0.0f;
+    width = 0.0f;
+    height = 0.0f;
+    
+    if (!appSystem || !scene || !scene->getCamera()) {
+        return false;
+    }
+    
+#ifdef __EMSCRIPTEN__
+    // Web: Use full window size (no ImGui viewport)
+    width = static_cast<float>(appSystem->getWindowWidth());
+    height = static_cast<float>(appSystem->getWindowHeight());
+#else
+    // Native: Use ImGui viewport size and offset
+    if (guiManager) {
+        const auto& viewport = guiManager->getViewportState();
+        width = viewport.width;
+        height = viewport.height;
+        offsetX = viewport.posX;
+        offsetY = viewport.posY;
+    } else {
+        // Fallback to window size
+        width = static_cast<float>(appSystem->getWindowWidth());
+        height = static_cast<float>(appSystem->getWindowHeight());
+    }
+#endif
+    
+    if (width == 0.0f || height == 0.0f) {
+        return false;
+    }
+    
+    // CRITICAL: Always update aspect ratio before using projection matrix
+    scene->getCamera()->setAspectRatio(width / height);
+    return true;
+}
+
 } // namespace rs_engine
@@ -5,6 +5,8 @@
 #include "../../rendering/scene/Scene.h"
 #include "../../gui/ImGuiManager.h"
 #include <memory>
+#include <utility>
+#include <vector>
 
 #ifdef __EMSCRIPTEN__
     #include <webgpu/webgpu_cpp.h>
@@ -90,7 +92,37 @@ public:
     rendering::SceneObject* pickObject(float screenX, float screenY);
     
     /**
-     * @brief Get currently selected object
+     * @brief Marquee selection: collect objects inside a screen rectangle
+     * 
+     * Builds a sub-frustum from the two corners and queries the scene's
+     * spatial index, so cost scales with the objects in the rectangle.
+     * @param x0,y0,x1,y1 Opposite rectangle corners in screen coordinates
+     * @param results Output: objects whose bounds intersect the rectangle
+     * @param preciseTriangles Also require a triangle inside the rectangle
+     *        (objects whose bounds are fully inside are accepted without it)
+     * @return Number of objects found
+     */
+    size_t pickObjectsInRect(float x0, float y0, float x1, float y1,
+                             std::vector<rendering::SceneObject*>& results,
+                             bool preciseTriangles = false);
+    
+    /**
+     * @brief Lasso selection: collect objects whose bounds center projects inside a polygon
+     * @param screenPoints Polygon vertices in screen coordinates (at least 3)
+     * @param results Output: selected objects
+     * @return Number of objects found
+     */
+    size_t pickObjectsInLasso(const std::vector<std::pair<float, float>>& screenPoints,
+                              std::vector<rendering::SceneObject*>& results);
+    
+    /**
+     * @brief Apply a selection operation to a set of objects
+     */
+    void selectObjects(const std::vector<rendering::SceneObject*>& objects,
+                       rendering::SelectionMode mode);
+    
+    /**
+     * @brief Get the primary selected object
      */
     rendering::SceneObject* getSelectedObject();
     
@@ -116,12 +148,19 @@ private:
      * @brief Create ray from screen coordinates
      */
     Ray createRayFromScreen(float screenX, float screenY) const;
-
+    
+    /**
+     * @brief Get the 3D viewport rectangle in screen coordinates
+     * 
+     * Also syncs the camera aspect ratio with the viewport.
+     * @return false if the viewport has no area
+     */
+    bool getViewportRect(float& offsetX, float& offsetY, float& width, float& height) const;
+    
     /**
-     * @brief Test ray intersection with object's triangles
-     * @return Distance to nearest intersection, or -1 if no hit
+     * @brief Test whether any of the object's triangles touch a world-space frustum
      */
-    float intersectObjectTriangles(const Ray& ray, rendering::SceneObject* obj);
+    bool objectOverlapsFrustum(const Frustum& frustum, rendering::SceneObject* obj);
 
     /**
      * @brief Create or recreate depth texture if size changed
@@ -23,8 +23,8 @@ bool ResourceSystem::initialize(Engine* engineRef) {
     // Create resource manager
     resourceManager = std::make_unique<resource::ResourceManager>();
     
-    // Initialize with WebGPU device
-    resourceManager->initialize(appSystem->getDevice());
+    // Initialize with WebGPU device; loads run on the engine's workers
+    resourceManager->initialize(appSystem->getDevice(), engine->getJobSystem());
     
     initialized = true;
     std::cout << "[SUCCESS] Resource System initialized" << std::endl;
@@ -38,8 +38,10 @@ void ResourceSystem::onStart() {
 }
 
 void ResourceSystem::onUpdate(float deltaTime) {
-    // Resource system is mostly passive
-    // Can be used for async loading updates in the future
+    // Finish async loads: GPU uploads within the per-frame budget, then callbacks
+    if (resourceManager) {
+        resourceManager->update();
+    }
 }
 
 void ResourceSystem::onShutdown() {
@@ -109,6 +111,14 @@ resource::ResourceHandle ResourceSystem::createPlaneMesh(const std::string& name
     return resourceManager->createPlaneMesh(name, width, height);
 }
 
+size_t ResourceSystem::generateMeshLODs(resource::ResourceHandle meshHandle,
+                                        const resource::LODSettings& settings) {
+    if (!resourceManager) {
+        return 0;
+    }
+    return resourceManager->generateMeshLODs(meshHandle, settings);
+}
+
 std::shared_ptr<resource::Mesh> ResourceSystem::getMesh(const std::string& name) {
     if (!resourceManager) {
         return nullptr;
@@ -123,6 +133,14 @@ std::shared_ptr<resource::Mesh> ResourceSystem::getMesh(resource::ResourceHandle
     return resourceManager->getMesh(handle);
 }
 
+resource::ResourceHandle ResourceSystem::loadModelAsync(const std::string& name, const std::string& filepath,
+                                                       resource::ResourceManager::LoadCallback onComplete) {
+    if (!resourceManager) {
+        return resource::INVALID_RESOURCE_HANDLE;
+    }
+    return resourceManager->loadModelAsync(name, filepath, std::move(onComplete));
+}
+
 // ========== Texture Management ==========
 
 resource::ResourceHandle ResourceSystem::loadTexture(const std::string& name, const std::string& filepath) {
@@ -132,6 +150,14 @@ resource::ResourceHandle ResourceSystem::loadTexture(const std::string& name, co
     return resourceManager->loadTexture(name, filepath);
 }
 
+resource::ResourceHandle ResourceSystem::loadTextureAsync(const std::string& name, const std::string& filepath,
+                                                         resource::ResourceManager::LoadCallback onComplete) {
+    if (!resourceManager) {
+        return resource::INVALID_RESOURCE_HANDLE;
+    }
+    return resourceManager->loadTextureAsync(name, filepath, std::move(onComplete));
+}
+
 resource::ResourceHandle ResourceSystem::createSolidColorTexture(const std::string& name,
                                                                  uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
     if (!resourceManager) {
@@ -17,6 +17,7 @@ class ApplicationSystem;
  * - GPU resource management
  * - Memory tracking
  * - Asset lifecycle management
+ * - Async load completion and budgeted GPU uploads (every frame in onUpdate)
  * 
  * Platform Support: 95% shared
  * - Resource management: 100% shared
@@ -66,6 +67,13 @@ public:
      */
     resource::ResourceHandle loadModel(const std::string& name, const std::string& filepath);
     
+    /**
+     * @brief Load a model in the background (see ResourceManager::loadModelAsync)
+     * @return Handle of a model in state Loading
+     */
+    resource::ResourceHandle loadModelAsync(const std::string& name, const std::string& filepath,
+                                            resource::ResourceManager::LoadCallback onComplete = nullptr);
+    
     /**
      * @brief Create a procedural model
      * @param name Resource name
@@ -91,6 +99,13 @@ public:
     resource::ResourceHandle createPlaneMesh(const std::string& name = "Plane",
                                             float width = 1.0f, float height = 1.0f);
     
+    /**
+     * @brief Generate a simplified LOD chain for a mesh
+     * @return Number of LOD levels generated
+     */
+    size_t generateMeshLODs(resource::ResourceHandle meshHandle,
+                            const resource::LODSettings& settings = resource::LODSettings());
+    
     /**
      * @brief Get mesh resource
      */
@@ -107,6 +122,12 @@ public:
      */
     resource::ResourceHandle loadTexture(const std::string& name, const std::string& filepath);
     
+    /**
+     * @brief Load a texture in the background (see ResourceManager::loadTextureAsync)
+     */
+    resource::ResourceHandle loadTextureAsync(const std::string& name, const std::string& filepath,
+                                              resource::ResourceManager::LoadCallback onComplete = nullptr);
+    
     /**
      * @brief Create procedural textures
      */
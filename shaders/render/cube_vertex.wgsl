@@ -7,27 +7,33 @@ struct VertexOutput {
     @location(0) color: vec3f,
 }
 
-struct Uniforms {
+// Per-frame data, shared by every draw
+struct FrameUniforms {
     view_proj: mat4x4f,
-    model: mat4x4f,
     time: f32,
 }
 
-@group(0) @binding(0) var<uniform> uniforms: Uniforms;
+// Per-object record; each draw passes its slot as firstInstance
+struct ObjectData {
+    model: mat4x4f,
+}
+
+@group(0) @binding(0) var<uniform> frame: FrameUniforms;
+@group(1) @binding(0) var<storage, read> objects: array<ObjectData>;
 
 @vertex
-fn vs_main(input: VertexInput) -> VertexOutput {
+fn vs_main(input: VertexInput, @builtin(instance_index) instance: u32) -> VertexOutput {
     var output: VertexOutput;
 
     // Transform position
-    let world_pos = uniforms.model * vec4f(input.position, 1.0);
-    output.position = uniforms.view_proj * world_pos;
+    let world_pos = objects[instance].model * vec4f(input.position, 1.0);
+    output.position = frame.view_proj * world_pos;
 
     // Generate color based on position and time for animation
     output.color = vec3f(
-        abs(sin(input.position.x + uniforms.time)),
-        abs(sin(input.position.y + uniforms.time * 1.2)),
-        abs(sin(input.position.z + uniforms.time * 0.8))
+        abs(sin(input.position.x + frame.time)),
+        abs(sin(input.position.y + frame.time * 1.2)),
+        abs(sin(input.position.z + frame.time * 0.8))
     );
 
     return output;
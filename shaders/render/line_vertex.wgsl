@@ -1,14 +1,16 @@
-// Line vertex shader for bounding box rendering
+// Line vertex shader for bounding box rendering (instanced: one box per selected object)
 
-struct Uniforms {
+struct FrameUniforms {
     viewProj: mat4x4<f32>,
-    model: mat4x4<f32>,
+    time: f32,
 }
 
-@group(0) @binding(0) var<uniform> uniforms: Uniforms;
+@group(0) @binding(0) var<uniform> frame: FrameUniforms;
 
 struct VertexInput {
-    @location(0) position: vec3<f32>,
+    @location(0) position: vec3<f32>,    // Unit cube corner
+    @location(1) boxCenter: vec3<f32>,   // Per-instance world bounds center
+    @location(2) boxSize: vec3<f32>,     // Per-instance world bounds size
 }
 
 struct VertexOutput {
@@ -20,9 +22,9 @@ struct VertexOutput {
 fn main(input: VertexInput) -> VertexOutput {
     var output: VertexOutput;
     
-    // Transform vertex position
-    let worldPos = uniforms.model * vec4<f32>(input.position, 1.0);
-    output.position = uniforms.viewProj * worldPos;
+    // Place the unit cube on this instance's bounds (already world space), then project
+    let worldPos = input.boxCenter + input.position * input.boxSize;
+    output.position = frame.viewProj * vec4<f32>(worldPos, 1.0);
     
     // Yellow/orange color for selection highlight
     output.color = vec3<f32>(1.0, 0.8, 0.0);